@@ -15,6 +15,7 @@
 #ifndef _BOPAlgo_Options_HeaderFile
 #define _BOPAlgo_Options_HeaderFile
 
+#include <BOPAlgo_Statistics.hxx>
 #include <Message_Report.hxx>
 #include <Standard_OStream.hxx>
 
@@ -32,6 +33,8 @@ class Message_ProgressScope;
 //!                       touching or coinciding cases;
 //! - *Using the Oriented Bounding Boxes* - Allows using the Oriented Bounding Boxes of the shapes
 //!                          for filtering the intersections.
+//! - *Performance statistics* - allows collecting the timings of the steps
+//!                          of the operation and of the slowest intersections.
 //!
 class BOPAlgo_Options
 {
@@ -165,6 +168,43 @@ public:
     return myUseOBB;
   }
 
+public:
+  //!@name Performance statistics
+
+  //! Enables/Disables the collection of the performance statistics.
+  //! The collection is disabled by default.
+  void SetCollectStatistics(const Standard_Boolean theToCollect)
+  {
+    if (!theToCollect)
+    {
+      myStatistics.Nullify();
+    }
+    else if (myStatistics.IsNull())
+    {
+      myStatistics = new BOPAlgo_Statistics();
+    }
+  }
+
+  //! Returns the flag defining the collection of the performance statistics
+  Standard_Boolean CollectStatistics() const
+  {
+    return !myStatistics.IsNull();
+  }
+
+  //! Sets the collector of the performance statistics.
+  //! Allows sharing the same collector between several algorithms.
+  //! Null handle disables the collection.
+  void SetStatistics(const Handle(BOPAlgo_Statistics)& theStatistics)
+  {
+    myStatistics = theStatistics;
+  }
+
+  //! Returns the collected performance statistics (null if the collection is disabled)
+  const Handle(BOPAlgo_Statistics)& Statistics() const
+  {
+    return myStatistics;
+  }
+
 protected:
 
   //! Adds error to the report if the break signal was caught. Returns true in this case, false otherwise.
@@ -177,6 +217,7 @@ protected:
   Standard_Boolean myRunParallel;
   Standard_Real myFuzzyValue;
   Standard_Boolean myUseOBB;
+  Handle(BOPAlgo_Statistics) myStatistics;
 
 };
 
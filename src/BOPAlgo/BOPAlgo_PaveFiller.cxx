@@ -23,6 +23,7 @@
 #include <BOPDS_Iterator.hxx>
 #include <IntTools_Context.hxx>
 #include <NCollection_BaseAllocator.hxx>
+#include <OSD_Timer.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 
@@ -215,6 +216,11 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
   //
   // 0 Clear
   Clear();
+  // the statistics collector may be shared with other algorithms,
+  // so that it is reset only on the start of the new intersection
+  if (!myStatistics.IsNull()) {
+    myStatistics->Clear();
+  }
   //
   // 1.myDS 
   myDS = new BOPDS_DS (myAllocator);
@@ -234,6 +240,50 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
   SetNonDestructive();
 }
 
+namespace
+{
+  //! Auxiliary tool measuring the time of the consecutive steps
+  //! of the intersection algorithm for the statistics.
+  class BOPAlgo_StepTimer
+  {
+  public:
+    BOPAlgo_StepTimer (const Handle(BOPAlgo_Statistics)& theStatistics)
+    : myStatistics (theStatistics) {}
+
+    ~BOPAlgo_StepTimer() { stop(); }
+
+    //! Stops measuring the previous step and starts the new one
+    void Next (const char* theStep)
+    {
+      if (myStatistics.IsNull())
+      {
+        return;
+      }
+      stop();
+      myStep = theStep;
+      myTimer.Reset();
+      myTimer.Start();
+    }
+
+  private:
+    void stop()
+    {
+      if (myStatistics.IsNull() || myStep.IsEmpty())
+      {
+        return;
+      }
+      myTimer.Stop();
+      myStatistics->AddPhaseTime (myStep, myTimer.ElapsedTime());
+      myStep.Clear();
+    }
+
+  private:
+    Handle(BOPAlgo_Statistics) myStatistics;
+    TCollection_AsciiString myStep;
+    OSD_Timer myTimer;
+  };
+}
+
 //=======================================================================
 // function: Perform
 // purpose: 
@@ -249,6 +299,8 @@ void BOPAlgo_PaveFiller::Perform (const Message_ProgressRange& theRange)
   catch (Standard_Failure const&) {
     AddError (new BOPAlgo_AlertIntersectionFailed);
   }
+  //
+  fillStatInterferences();
 }
 
 //=======================================================================
@@ -258,26 +310,32 @@ void BOPAlgo_PaveFiller::Perform (const Message_ProgressRange& theRange)
 void BOPAlgo_PaveFiller::PerformInternal (const Message_ProgressRange& theRange)
 {
   Message_ProgressScope aPS (theRange, "Performing intersection of shapes", 100);
+  BOPAlgo_StepTimer aStepTimer (myStatistics);
 
+  aStepTimer.Next ("Init");
   Init (aPS.Next (5));
   if (HasErrors()) {
     return;
   }
+  fillStatCandidates();
 
   // Compute steps of the PI
   BOPAlgo_PISteps aSteps (PIOperation_Last);
   analyzeProgress (95, aSteps);
   //
+  aStepTimer.Next ("Prepare");
   Prepare (aPS.Next (aSteps.GetStep (PIOperation_Prepare)));
   if (HasErrors()) {
     return;
   }
   // 00
+  aStepTimer.Next ("PerformVV");
   PerformVV (aPS.Next (aSteps.GetStep (PIOperation_PerformVV)));
   if (HasErrors()) {
     return;
   }
   // 01
+  aStepTimer.Next ("PerformVE");
   PerformVE (aPS.Next (aSteps.GetStep (PIOperation_PerformVE)));
   if (HasErrors()) {
     return;
@@ -285,18 +343,21 @@ void BOPAlgo_PaveFiller::PerformInternal (const Message_ProgressRange& theRange)
   //
   UpdatePaveBlocksWithSDVertices();
   // 11
+  aStepTimer.Next ("PerformEE");
   PerformEE (aPS.Next (aSteps.GetStep (PIOperation_PerformEE)));
   if (HasErrors()) {
     return;
   }
   UpdatePaveBlocksWithSDVertices();
   // 02
+  aStepTimer.Next ("PerformVF");
   PerformVF (aPS.Next (aSteps.GetStep (PIOperation_PerformVF)));
   if (HasErrors()) {
     return;
   }
   UpdatePaveBlocksWithSDVertices();
   // 12
+  aStepTimer.Next ("PerformEF");
   PerformEF (aPS.Next (aSteps.GetStep (PIOperation_PerformEF)));
   if (HasErrors()) {
     return;
@@ -305,11 +366,13 @@ void BOPAlgo_PaveFiller::PerformInternal (const Message_ProgressRange& theRange)
   UpdateInterfsWithSDVertices();
 
   // Repeat Intersection with increased vertices
+  aStepTimer.Next ("RepeatIntersection");
   RepeatIntersection (aPS.Next (aSteps.GetStep (PIOperation_RepeatIntersection)));
   if (HasErrors())
     return;
   // Force intersection of edges after increase
   // of the tolerance values of their vertices
+  aStepTimer.Next ("ForceInterfEE");
   ForceInterfEE (aPS.Next (aSteps.GetStep (PIOperation_ForceInterfEE)));
   if (HasErrors())
   {
@@ -317,6 +380,7 @@ void BOPAlgo_PaveFiller::PerformInternal (const Message_ProgressRange& theRange)
   }
   // Force Edge/Face intersection after increase
   // of the tolerance values of their vertices
+  aStepTimer.Next ("ForceInterfEF");
   ForceInterfEF (aPS.Next (aSteps.GetStep (PIOperation_ForceInterfEF)));
   if (HasErrors())
   {
@@ -324,15 +388,18 @@ void BOPAlgo_PaveFiller::PerformInternal (const Message_ProgressRange& theRange)
   }
   //
   // 22
+  aStepTimer.Next ("PerformFF");
   PerformFF (aPS.Next (aSteps.GetStep (PIOperation_PerformFF)));
   if (HasErrors()) {
     return;
   }
   //
+  aStepTimer.Next ("UpdateBlocksWithSharedVertices");
   UpdateBlocksWithSharedVertices();
   //
   myDS->RefineFaceInfoIn();
   //
+  aStepTimer.Next ("MakeSplitEdges");
   MakeSplitEdges (aPS.Next (aSteps.GetStep (PIOperation_MakeSplitEdges)));
   if (HasErrors()) {
     return;
@@ -340,24 +407,29 @@ void BOPAlgo_PaveFiller::PerformInternal (const Message_ProgressRange& theRange)
   //
   UpdatePaveBlocksWithSDVertices();
   //
+  aStepTimer.Next ("MakeBlocks");
   MakeBlocks (aPS.Next (aSteps.GetStep (PIOperation_MakeBlocks)));
   if (HasErrors()) {
     return;
   }
   //
+  aStepTimer.Next ("CheckSelfInterference");
   CheckSelfInterference();
   //
   UpdateInterfsWithSDVertices();
   myDS->ReleasePaveBlocks();
   myDS->RefineFaceInfoOn();
   //
+  aStepTimer.Next ("RemoveMicroEdges");
   RemoveMicroEdges();
   //
+  aStepTimer.Next ("MakePCurves");
   MakePCurves (aPS.Next (aSteps.GetStep (PIOperation_MakePCurves)));
   if (HasErrors()) {
     return;
   }
   //
+  aStepTimer.Next ("ProcessDE");
   ProcessDE (aPS.Next (aSteps.GetStep (PIOperation_ProcessDE)));
   if (HasErrors()) {
     return;
@@ -422,6 +494,63 @@ void BOPAlgo_PaveFiller::RepeatIntersection (const Message_ProgressRange& theRan
 }
 
 
+//=======================================================================
+// function: fillStatCandidates
+// purpose: 
+//=======================================================================
+void BOPAlgo_PaveFiller::fillStatCandidates()
+{
+  if (myStatistics.IsNull() || myIterator == NULL)
+  {
+    return;
+  }
+  static const TopAbs_ShapeEnum aTypes[6][2] =
+  {
+    { TopAbs_VERTEX, TopAbs_VERTEX },
+    { TopAbs_VERTEX, TopAbs_EDGE },
+    { TopAbs_EDGE,   TopAbs_EDGE },
+    { TopAbs_VERTEX, TopAbs_FACE },
+    { TopAbs_EDGE,   TopAbs_FACE },
+    { TopAbs_FACE,   TopAbs_FACE }
+  };
+  static const char* aNames[6] = { "VV", "VE", "EE", "VF", "EF", "FF" };
+  for (Standard_Integer i = 0; i < 6; ++i)
+  {
+    myIterator->Initialize (aTypes[i][0], aTypes[i][1]);
+    myStatistics->AddCandidates (aNames[i], myIterator->ExpectedLength());
+  }
+}
+
+//=======================================================================
+// function: fillStatInterferences
+// purpose: 
+//=======================================================================
+void BOPAlgo_PaveFiller::fillStatInterferences()
+{
+  if (myStatistics.IsNull() || myDS == NULL)
+  {
+    return;
+  }
+  myStatistics->SetInterferences ("VV", myDS->InterfVV().Length());
+  myStatistics->SetInterferences ("VE", myDS->InterfVE().Length());
+  myStatistics->SetInterferences ("EE", myDS->InterfEE().Length());
+  myStatistics->SetInterferences ("VF", myDS->InterfVF().Length());
+  myStatistics->SetInterferences ("EF", myDS->InterfEF().Length());
+
+  // Count only the pairs of faces with actually found intersection
+  Standard_Integer aNbFF = 0;
+  const BOPDS_VectorOfInterfFF& aFFs = myDS->InterfFF();
+  for (Standard_Integer i = 0; i < aFFs.Length(); ++i)
+  {
+    const BOPDS_InterfFF& aFF = aFFs (i);
+    if (!aFF.Curves().IsEmpty() || !aFF.Points().IsEmpty())
+    {
+      ++aNbFF;
+    }
+  }
+  myStatistics->SetInterferences ("FF", aNbFF);
+}
+
 //=======================================================================
 // function: fillPISteps
 // purpose: 
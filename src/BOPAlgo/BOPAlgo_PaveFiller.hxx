@@ -636,6 +636,14 @@ protected: //! Analyzing Progress steps
   //! Filling steps for all other operations
   Standard_EXPORT void fillPISteps(BOPAlgo_PISteps& theSteps) const Standard_OVERRIDE;
 
+protected: //! Performance statistics
+
+  //! Stores the numbers of candidate pairs of sub-shapes with interfering
+  //! bounding boxes into the statistics (if enabled)
+  Standard_EXPORT void fillStatCandidates();
+  //! Stores the numbers of the found interferences into the statistics (if enabled)
+  Standard_EXPORT void fillStatInterferences();
+
 protected: //! Fields
 
   TopTools_ListOfShape myArguments;
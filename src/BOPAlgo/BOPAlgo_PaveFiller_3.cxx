@@ -32,6 +32,8 @@
 #include <BOPTools_Parallel.hxx>
 #include <BndLib_Add3dCurve.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Curve.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
 #include <gp_Pnt.hxx>
 #include <IntTools_CommonPrt.hxx>
@@ -43,6 +45,7 @@
 #include <IntTools_Tools.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <NCollection_Vector.hxx>
+#include <OSD_Timer.hxx>
 #include <Precision.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
@@ -63,7 +66,9 @@ class BOPAlgo_EdgeEdge :
   //
   BOPAlgo_EdgeEdge(): 
     IntTools_EdgeEdge(),
-    BOPAlgo_ParallelAlgo() {
+    BOPAlgo_ParallelAlgo(),
+    myToMeasureTime(Standard_False),
+    myTime(0.) {
   };
   //
   virtual ~BOPAlgo_EdgeEdge(){
@@ -96,12 +101,25 @@ class BOPAlgo_EdgeEdge :
     IntTools_EdgeEdge::SetFuzzyValue(theFuzz);
   }
   //
+  void SetToMeasureTime(const Standard_Boolean theToMeasure) {
+    myToMeasureTime = theToMeasure;
+  }
+  //
+  Standard_Real Time() const {
+    return myTime;
+  }
+  //
   virtual void Perform() {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
     if (UserBreak(aPS))
     {
       return;
     }
+    OSD_Timer aTimer;
+    if (myToMeasureTime)
+    {
+      aTimer.Start();
+    }
     TopoDS_Edge anE1 = myEdge1, anE2 = myEdge2;
     Standard_Boolean hasTrsf = false;
     try
@@ -138,6 +156,11 @@ class BOPAlgo_EdgeEdge :
       }
     }
 
+    if (myToMeasureTime)
+    {
+      aTimer.Stop();
+      myTime = aTimer.ElapsedTime();
+    }
   }
   //
  protected:
@@ -145,6 +168,8 @@ class BOPAlgo_EdgeEdge :
   Handle(BOPDS_PaveBlock) myPB2;
   Bnd_Box myBox1;
   Bnd_Box myBox2;
+  Standard_Boolean myToMeasureTime;
+  Standard_Real myTime;
 };
 //
 //=======================================================================
@@ -261,6 +286,7 @@ void BOPAlgo_PaveFiller::PerformEE(const Message_ProgressRange& theRange)
         anEdgeEdge.SetEdge2(aE2, aT21, aT22);
         anEdgeEdge.SetBoxes (aBB1, aBB2);
         anEdgeEdge.SetFuzzyValue(myFuzzyValue);
+        anEdgeEdge.SetToMeasureTime(!myStatistics.IsNull());
       }//for (; aIt2.More(); aIt2.Next()) {
     }//for (; aIt1.More(); aIt1.Next()) {
   }//for (; myIterator->More(); myIterator->Next()) {
@@ -289,6 +315,21 @@ void BOPAlgo_PaveFiller::PerformEE(const Message_ProgressRange& theRange)
     Bnd_Box aBB1, aBB2;
     //
     BOPAlgo_EdgeEdge& anEdgeEdge=aVEdgeEdge(k);
+    if (!myStatistics.IsNull()) {
+      const Standard_Integer nOE1 = anEdgeEdge.PaveBlock1()->OriginalEdge();
+      const Standard_Integer nOE2 = anEdgeEdge.PaveBlock2()->OriginalEdge();
+      const TopoDS_Edge& aOE1 = TopoDS::Edge(myDS->Shape(nOE1));
+      const TopoDS_Edge& aOE2 = TopoDS::Edge(myDS->Shape(nOE2));
+      BOPAlgo_Statistics::PairRecord aRec;
+      aRec.Index1 = nOE1;
+      aRec.Index2 = nOE2;
+      aRec.Type1 = BOPAlgo_Statistics::CurveTypeName(BRepAdaptor_Curve(aOE1).GetType());
+      aRec.Type2 = BOPAlgo_Statistics::CurveTypeName(BRepAdaptor_Curve(aOE2).GetType());
+      aRec.Tolerance1 = BRep_Tool::Tolerance(aOE1);
+      aRec.Tolerance2 = BRep_Tool::Tolerance(aOE2);
+      aRec.Time = anEdgeEdge.Time();
+      myStatistics->AddEdgeEdge(aRec);
+    }
     if (!anEdgeEdge.IsDone() || anEdgeEdge.HasErrors()) {
       // Warn about failed intersection of sub-shapes
       const TopoDS_Shape& aE1 = myDS->Shape(anEdgeEdge.PaveBlock1()->OriginalEdge());
@@ -64,6 +64,7 @@
 #include <IntTools_Tools.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <NCollection_Vector.hxx>
+#include <OSD_Timer.hxx>
 #include <Precision.hxx>
 #include <TColStd_ListOfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
@@ -95,7 +96,8 @@ class BOPAlgo_FaceFace :
   BOPAlgo_FaceFace() : 
     IntTools_FaceFace(),  
     BOPAlgo_ParallelAlgo(),
-    myIF1(-1), myIF2(-1), myTolFF(1.e-7) {
+    myIF1(-1), myIF2(-1), myTolFF(1.e-7),
+    myToMeasureTime(Standard_False), myTime(0.) {
   }
   //
   virtual ~BOPAlgo_FaceFace() {
@@ -147,12 +149,25 @@ class BOPAlgo_FaceFace :
   //
   const gp_Trsf& Trsf() const { return myTrsf; }
   //
+  void SetToMeasureTime(const Standard_Boolean theToMeasure) {
+    myToMeasureTime = theToMeasure;
+  }
+  //
+  Standard_Real Time() const {
+    return myTime;
+  }
+  //
   virtual void Perform() {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
     if (UserBreak(aPS))
     {
       return;
     }
+    OSD_Timer aTimer;
+    if (myToMeasureTime)
+    {
+      aTimer.Start();
+    }
     try
     {
       OCC_CATCH_SIGNALS
@@ -185,6 +200,11 @@ class BOPAlgo_FaceFace :
     {
       AddError(new BOPAlgo_AlertIntersectionFailed);
     }
+    if (myToMeasureTime)
+    {
+      aTimer.Stop();
+      myTime = aTimer.ElapsedTime();
+    }
   }
   //
   void ApplyTrsf()
@@ -220,6 +240,8 @@ class BOPAlgo_FaceFace :
   Bnd_Box myBox1;
   Bnd_Box myBox2;
   gp_Trsf myTrsf;
+  Standard_Boolean myToMeasureTime;
+  Standard_Real myTime;
 };
 //
 //=======================================================================
@@ -428,6 +450,7 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
       //
       aFaceFace.SetParameters(bApprox, bCompC2D1, bCompC2D2, anApproxTol);
       aFaceFace.SetFuzzyValue(myFuzzyValue);
+      aFaceFace.SetToMeasureTime(!myStatistics.IsNull());
     }
     else {
       // for the Glue mode just add all interferences of that type
@@ -462,6 +485,17 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     }
     BOPAlgo_FaceFace& aFaceFace = aVFaceFace(k);
     aFaceFace.Indices(nF1, nF2);
+    if (!myStatistics.IsNull()) {
+      BOPAlgo_Statistics::PairRecord aRec;
+      aRec.Index1 = nF1;
+      aRec.Index2 = nF2;
+      aRec.Type1 = BOPAlgo_Statistics::SurfaceTypeName(myContext->SurfaceAdaptor(aFaceFace.Face1()).GetType());
+      aRec.Type2 = BOPAlgo_Statistics::SurfaceTypeName(myContext->SurfaceAdaptor(aFaceFace.Face2()).GetType());
+      aRec.Tolerance1 = BRep_Tool::Tolerance(aFaceFace.Face1());
+      aRec.Tolerance2 = BRep_Tool::Tolerance(aFaceFace.Face2());
+      aRec.Time = aFaceFace.Time();
+      myStatistics->AddFaceFace(aRec);
+    }
     if (!aFaceFace.IsDone() || aFaceFace.HasErrors()) {
       BOPDS_InterfFF& aFF = aFFs.Appended();
       aFF.SetIndices(nF1, nF2);
@@ -0,0 +1,318 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_Statistics.hxx>
+
+#include <stdio.h>
+
+IMPLEMENT_STANDARD_RTTIEXT(BOPAlgo_Statistics, Standard_Transient)
+
+namespace
+{
+  //! Removes the last item of the list
+  static void removeLast (BOPAlgo_Statistics::ListOfPairRecord& theList)
+  {
+    BOPAlgo_Statistics::ListOfPairRecord::Iterator anIt (theList);
+    for (Standard_Integer i = 1; i < theList.Extent(); ++i)
+    {
+      anIt.Next();
+    }
+    theList.Remove (anIt);
+  }
+
+  //! Dumps the list of the slowest pairs
+  static void dumpPairs (Standard_OStream& theOS,
+                         const char* theTitle,
+                         const BOPAlgo_Statistics::ListOfPairRecord& theList,
+                         const Standard_Integer theNbAll,
+                         const Standard_Real theTimeAll)
+  {
+    char aBuf[512];
+    Sprintf (aBuf, " %s: %d intersections, total time %.4f s\n", theTitle, theNbAll, theTimeAll);
+    theOS << aBuf;
+    for (BOPAlgo_Statistics::ListOfPairRecord::Iterator anIt (theList); anIt.More(); anIt.Next())
+    {
+      const BOPAlgo_Statistics::PairRecord& aRec = anIt.Value();
+      Sprintf (aBuf, "  %10.4f s  %6d (%s, tol %g) x %6d (%s, tol %g)\n",
+               aRec.Time,
+               aRec.Index1, aRec.Type1.ToCString(), aRec.Tolerance1,
+               aRec.Index2, aRec.Type2.ToCString(), aRec.Tolerance2);
+      theOS << aBuf;
+    }
+  }
+}
+
+//=======================================================================
+//function : BOPAlgo_Statistics
+//purpose  :
+//=======================================================================
+BOPAlgo_Statistics::BOPAlgo_Statistics (const Standard_Integer theNbSlowest)
+: myNbSlowest (Max (theNbSlowest, 0)),
+  myNbFF (0),
+  myNbEE (0),
+  myTimeFF (0.0),
+  myTimeEE (0.0)
+{
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BOPAlgo_Statistics::Clear()
+{
+  myPhaseTimes.Clear();
+  myCandidates.Clear();
+  myInterferences.Clear();
+  mySlowestFF.Clear();
+  mySlowestEE.Clear();
+  myNbFF = 0;
+  myNbEE = 0;
+  myTimeFF = 0.0;
+  myTimeEE = 0.0;
+}
+
+//=======================================================================
+//function : SetNbSlowest
+//purpose  :
+//=======================================================================
+void BOPAlgo_Statistics::SetNbSlowest (const Standard_Integer theNbSlowest)
+{
+  myNbSlowest = Max (theNbSlowest, 0);
+  while (mySlowestFF.Extent() > myNbSlowest)
+  {
+    removeLast (mySlowestFF);
+  }
+  while (mySlowestEE.Extent() > myNbSlowest)
+  {
+    removeLast (mySlowestEE);
+  }
+}
+
+//=======================================================================
+//function : AddPhaseTime
+//purpose  :
+//=======================================================================
+void BOPAlgo_Statistics::AddPhaseTime (const TCollection_AsciiString& thePhase,
+                                       const Standard_Real theTime)
+{
+  Standard_Real* aTime = myPhaseTimes.ChangeSeek (thePhase);
+  if (aTime != NULL)
+  {
+    *aTime += theTime;
+  }
+  else
+  {
+    myPhaseTimes.Add (thePhase, theTime);
+  }
+}
+
+//=======================================================================
+//function : PhaseTime
+//purpose  :
+//=======================================================================
+Standard_Real BOPAlgo_Statistics::PhaseTime (const TCollection_AsciiString& thePhase) const
+{
+  const Standard_Real* aTime = myPhaseTimes.Seek (thePhase);
+  return aTime != NULL ? *aTime : 0.0;
+}
+
+//=======================================================================
+//function : AddCandidates
+//purpose  :
+//=======================================================================
+void BOPAlgo_Statistics::AddCandidates (const TCollection_AsciiString& theType,
+                                        const Standard_Integer theNb)
+{
+  Standard_Integer* aNb = myCandidates.ChangeSeek (theType);
+  if (aNb != NULL)
+  {
+    *aNb += theNb;
+  }
+  else
+  {
+    myCandidates.Add (theType, theNb);
+  }
+}
+
+//=======================================================================
+//function : SetInterferences
+//purpose  :
+//=======================================================================
+void BOPAlgo_Statistics::SetInterferences (const TCollection_AsciiString& theType,
+                                           const Standard_Integer theNb)
+{
+  Standard_Integer* aNb = myInterferences.ChangeSeek (theType);
+  if (aNb != NULL)
+  {
+    *aNb = theNb;
+  }
+  else
+  {
+    myInterferences.Add (theType, theNb);
+  }
+}
+
+//=======================================================================
+//function : NbCandidates
+//purpose  :
+//=======================================================================
+Standard_Integer BOPAlgo_Statistics::NbCandidates (const TCollection_AsciiString& theType) const
+{
+  const Standard_Integer* aNb = myCandidates.Seek (theType);
+  return aNb != NULL ? *aNb : 0;
+}
+
+//=======================================================================
+//function : NbInterferences
+//purpose  :
+//=======================================================================
+Standard_Integer BOPAlgo_Statistics::NbInterferences (const TCollection_AsciiString& theType) const
+{
+  const Standard_Integer* aNb = myInterferences.Seek (theType);
+  return aNb != NULL ? *aNb : 0;
+}
+
+//=======================================================================
+//function : AddFaceFace
+//purpose  :
+//=======================================================================
+void BOPAlgo_Statistics::AddFaceFace (const PairRecord& theRecord)
+{
+  ++myNbFF;
+  myTimeFF += theRecord.Time;
+  addSlowest (mySlowestFF, theRecord);
+}
+
+//=======================================================================
+//function : AddEdgeEdge
+//purpose  :
+//=======================================================================
+void BOPAlgo_Statistics::AddEdgeEdge (const PairRecord& theRecord)
+{
+  ++myNbEE;
+  myTimeEE += theRecord.Time;
+  addSlowest (mySlowestEE, theRecord);
+}
+
+//=======================================================================
+//function : addSlowest
+//purpose  :
+//=======================================================================
+void BOPAlgo_Statistics::addSlowest (ListOfPairRecord& theList,
+                                     const PairRecord& theRecord) const
+{
+  if (myNbSlowest == 0)
+  {
+    return;
+  }
+  if (theList.Extent() == myNbSlowest
+   && theList.Last().Time >= theRecord.Time)
+  {
+    return;
+  }
+
+  ListOfPairRecord::Iterator anIt (theList);
+  for (; anIt.More(); anIt.Next())
+  {
+    if (anIt.Value().Time < theRecord.Time)
+    {
+      break;
+    }
+  }
+  if (anIt.More())
+  {
+    theList.InsertBefore (theRecord, anIt);
+  }
+  else
+  {
+    theList.Append (theRecord);
+  }
+
+  if (theList.Extent() > myNbSlowest)
+  {
+    removeLast (theList);
+  }
+}
+
+//=======================================================================
+//function : Dump
+//purpose  :
+//=======================================================================
+void BOPAlgo_Statistics::Dump (Standard_OStream& theOS) const
+{
+  char aBuf[256];
+  theOS << "Phase timings:\n";
+  for (NCollection_IndexedDataMap<TCollection_AsciiString, Standard_Real>::Iterator anIt (myPhaseTimes);
+       anIt.More(); anIt.Next())
+  {
+    Sprintf (aBuf, " %-32s %10.4f s\n", anIt.Key().ToCString(), anIt.Value());
+    theOS << aBuf;
+  }
+
+  theOS << "Interferences (candidates / found):\n";
+  for (NCollection_IndexedDataMap<TCollection_AsciiString, Standard_Integer>::Iterator anIt (myCandidates);
+       anIt.More(); anIt.Next())
+  {
+    Sprintf (aBuf, " %-4s %10d / %d\n", anIt.Key().ToCString(), anIt.Value(), NbInterferences (anIt.Key()));
+    theOS << aBuf;
+  }
+
+  theOS << "Slowest intersections:\n";
+  dumpPairs (theOS, "Face/Face", mySlowestFF, myNbFF, myTimeFF);
+  dumpPairs (theOS, "Edge/Edge", mySlowestEE, myNbEE, myTimeEE);
+}
+
+//=======================================================================
+//function : SurfaceTypeName
+//purpose  :
+//=======================================================================
+Standard_CString BOPAlgo_Statistics::SurfaceTypeName (const GeomAbs_SurfaceType theType)
+{
+  switch (theType)
+  {
+    case GeomAbs_Plane:               return "Plane";
+    case GeomAbs_Cylinder:            return "Cylinder";
+    case GeomAbs_Cone:                return "Cone";
+    case GeomAbs_Sphere:              return "Sphere";
+    case GeomAbs_Torus:               return "Torus";
+    case GeomAbs_BezierSurface:       return "BezierSurface";
+    case GeomAbs_BSplineSurface:      return "BSplineSurface";
+    case GeomAbs_SurfaceOfRevolution: return "SurfaceOfRevolution";
+    case GeomAbs_SurfaceOfExtrusion:  return "SurfaceOfExtrusion";
+    case GeomAbs_OffsetSurface:       return "OffsetSurface";
+    case GeomAbs_OtherSurface:        break;
+  }
+  return "OtherSurface";
+}
+
+//=======================================================================
+//function : CurveTypeName
+//purpose  :
+//=======================================================================
+Standard_CString BOPAlgo_Statistics::CurveTypeName (const GeomAbs_CurveType theType)
+{
+  switch (theType)
+  {
+    case GeomAbs_Line:         return "Line";
+    case GeomAbs_Circle:       return "Circle";
+    case GeomAbs_Ellipse:      return "Ellipse";
+    case GeomAbs_Hyperbola:    return "Hyperbola";
+    case GeomAbs_Parabola:     return "Parabola";
+    case GeomAbs_BezierCurve:  return "BezierCurve";
+    case GeomAbs_BSplineCurve: return "BSplineCurve";
+    case GeomAbs_OffsetCurve:  return "OffsetCurve";
+    case GeomAbs_OtherCurve:   break;
+  }
+  return "OtherCurve";
+}
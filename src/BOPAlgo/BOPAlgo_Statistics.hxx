@@ -0,0 +1,170 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_Statistics_HeaderFile
+#define _BOPAlgo_Statistics_HeaderFile
+
+#include <GeomAbs_CurveType.hxx>
+#include <GeomAbs_SurfaceType.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_List.hxx>
+#include <Standard_OStream.hxx>
+#include <Standard_Transient.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! The class collects the performance statistics of the intersection
+//! algorithm of Boolean Component (BOPAlgo_PaveFiller):
+//! - *Phase timings* - elapsed time of each step of the intersection
+//!                     (PerformVV, PerformVE, ..., PerformFF, MakeSplitEdges, MakeBlocks, etc.);
+//! - *Slowest pairs* - the given number of the slowest Face/Face and Edge/Edge
+//!                     intersections with the types of the underlying geometries
+//!                     and the tolerances of the sub-shapes;
+//! - *Interference counts* - number of candidate pairs of sub-shapes with
+//!                     interfering bounding boxes and number of actually
+//!                     found interferences of each type.
+//!
+//! The collection is disabled by default and can be enabled by
+//! BOPAlgo_Options::SetCollectStatistics().
+//! The instance may be shared between several algorithms
+//! (see BOPAlgo_Options::SetStatistics()).
+class BOPAlgo_Statistics : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BOPAlgo_Statistics, Standard_Transient)
+public:
+
+  //! Description of the single intersection of a pair of sub-shapes.
+  struct PairRecord
+  {
+    Standard_Integer        Index1;     //!< index of the first sub-shape in the Data Structure
+    Standard_Integer        Index2;     //!< index of the second sub-shape in the Data Structure
+    TCollection_AsciiString Type1;      //!< type of the geometry of the first sub-shape
+    TCollection_AsciiString Type2;      //!< type of the geometry of the second sub-shape
+    Standard_Real           Tolerance1; //!< tolerance of the first sub-shape
+    Standard_Real           Tolerance2; //!< tolerance of the second sub-shape
+    Standard_Real           Time;       //!< elapsed time of intersection, in seconds
+
+    PairRecord() : Index1 (-1), Index2 (-1), Tolerance1 (0.0), Tolerance2 (0.0), Time (0.0) {}
+  };
+
+  typedef NCollection_List<PairRecord> ListOfPairRecord;
+
+public:
+
+  //! Constructor.
+  //! @param theNbSlowest [in] number of the slowest pairs to keep for each type of intersection
+  Standard_EXPORT BOPAlgo_Statistics (const Standard_Integer theNbSlowest = 10);
+
+  //! Clears all collected data. The number of slowest pairs to keep is preserved.
+  Standard_EXPORT void Clear();
+
+  //! Returns the number of the slowest pairs kept for each type of intersection.
+  Standard_Integer NbSlowest() const { return myNbSlowest; }
+
+  //! Sets the number of the slowest pairs to keep for each type of intersection.
+  Standard_EXPORT void SetNbSlowest (const Standard_Integer theNbSlowest);
+
+public:
+  //!@name Phase timings
+
+  //! Adds the elapsed time to the given phase.
+  //! The time of the phase performed several times is accumulated.
+  Standard_EXPORT void AddPhaseTime (const TCollection_AsciiString& thePhase,
+                                     const Standard_Real theTime);
+
+  //! Returns the time of the given phase, or 0 if the phase has not been performed.
+  Standard_EXPORT Standard_Real PhaseTime (const TCollection_AsciiString& thePhase) const;
+
+  //! Returns the timings of all performed phases in order of their execution.
+  const NCollection_IndexedDataMap<TCollection_AsciiString, Standard_Real>& PhaseTimes() const
+  {
+    return myPhaseTimes;
+  }
+
+public:
+  //!@name Interference counts
+
+  //! Adds the number of candidate pairs of the given type (e.g. "VV", "EF", "FF").
+  Standard_EXPORT void AddCandidates (const TCollection_AsciiString& theType,
+                                      const Standard_Integer theNb);
+
+  //! Sets the number of actually found interferences of the given type.
+  Standard_EXPORT void SetInterferences (const TCollection_AsciiString& theType,
+                                         const Standard_Integer theNb);
+
+  //! Returns the number of candidate pairs of the given type.
+  Standard_EXPORT Standard_Integer NbCandidates (const TCollection_AsciiString& theType) const;
+
+  //! Returns the number of actually found interferences of the given type.
+  Standard_EXPORT Standard_Integer NbInterferences (const TCollection_AsciiString& theType) const;
+
+public:
+  //!@name Slowest intersections
+
+  //! Registers the Face/Face intersection.
+  Standard_EXPORT void AddFaceFace (const PairRecord& theRecord);
+
+  //! Registers the Edge/Edge intersection.
+  Standard_EXPORT void AddEdgeEdge (const PairRecord& theRecord);
+
+  //! Returns the slowest Face/Face intersections sorted by decreasing time.
+  const ListOfPairRecord& SlowestFaceFace() const { return mySlowestFF; }
+
+  //! Returns the slowest Edge/Edge intersections sorted by decreasing time.
+  const ListOfPairRecord& SlowestEdgeEdge() const { return mySlowestEE; }
+
+  //! Returns the number of registered Face/Face intersections.
+  Standard_Integer NbFaceFace() const { return myNbFF; }
+
+  //! Returns the number of registered Edge/Edge intersections.
+  Standard_Integer NbEdgeEdge() const { return myNbEE; }
+
+  //! Returns the total time of the registered Face/Face intersections.
+  Standard_Real FaceFaceTime() const { return myTimeFF; }
+
+  //! Returns the total time of the registered Edge/Edge intersections.
+  Standard_Real EdgeEdgeTime() const { return myTimeEE; }
+
+public:
+
+  //! Dumps the collected statistics into the given stream.
+  Standard_EXPORT void Dump (Standard_OStream& theOS) const;
+
+  //! Returns the name of the surface type to be used in the records.
+  Standard_EXPORT static Standard_CString SurfaceTypeName (const GeomAbs_SurfaceType theType);
+
+  //! Returns the name of the curve type to be used in the records.
+  Standard_EXPORT static Standard_CString CurveTypeName (const GeomAbs_CurveType theType);
+
+private:
+
+  //! Inserts the record into the list sorted by decreasing time
+  //! keeping not more than myNbSlowest records.
+  void addSlowest (ListOfPairRecord& theList, const PairRecord& theRecord) const;
+
+private:
+
+  Standard_Integer myNbSlowest;
+  NCollection_IndexedDataMap<TCollection_AsciiString, Standard_Real> myPhaseTimes;
+  NCollection_IndexedDataMap<TCollection_AsciiString, Standard_Integer> myCandidates;
+  NCollection_IndexedDataMap<TCollection_AsciiString, Standard_Integer> myInterferences;
+  ListOfPairRecord mySlowestFF;
+  ListOfPairRecord mySlowestEE;
+  Standard_Integer myNbFF;
+  Standard_Integer myNbEE;
+  Standard_Real myTimeFF;
+  Standard_Real myTimeEE;
+};
+
+DEFINE_STANDARD_HANDLE(BOPAlgo_Statistics, Standard_Transient)
+
+#endif // _BOPAlgo_Statistics_HeaderFile
@@ -144,6 +144,7 @@ Standard_Integer bapibop(Draw_Interpretor& di,
   pBuilder->SetGlue(aGlue);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
   pBuilder->SetUseOBB(BOPTest_Objects::UseOBB());
+  pBuilder->SetStatistics(BOPTest_Objects::Statistics());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -212,6 +213,7 @@ Standard_Integer bapibuild(Draw_Interpretor& di,
   aBuilder.SetGlue(aGlue);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetStatistics(BOPTest_Objects::Statistics());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -272,6 +274,7 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   aSplitter.SetGlue(BOPTest_Objects::Glue());
   aSplitter.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aSplitter.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSplitter.SetStatistics(BOPTest_Objects::Statistics());
   aSplitter.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   // performing operation
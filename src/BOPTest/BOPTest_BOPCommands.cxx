@@ -159,6 +159,7 @@ Standard_Integer bop(Draw_Interpretor& di,
   pPF->SetNonDestructive(bNonDestructive);
   pPF->SetGlue(aGlue);
   pPF->SetUseOBB(BOPTest_Objects::UseOBB());
+  pPF->SetStatistics(BOPTest_Objects::Statistics());
   //
   pPF->Perform(aProgress->Start());
   BOPTest::ReportAlerts(pPF->GetReport());
@@ -111,6 +111,7 @@ class BOPTest_Session {
     myUnifyEdges = Standard_False;
     myUnifyFaces = Standard_False;
     myAngTol = Precision::Angular();
+    myStatistics.Nullify();
   }
   //
   void SetRunParallel(const Standard_Boolean bFlag) {
@@ -184,6 +185,24 @@ class BOPTest_Session {
   // Returns angular tolerance
   Standard_Real Angular() const { return myAngTol; }
 
+  // Enables/Disables the collection of performance statistics
+  void SetCollectStatistics(const Standard_Boolean bCollect,
+                            const Standard_Integer theNbSlowest)
+  {
+    if (!bCollect)
+    {
+      myStatistics.Nullify();
+      return;
+    }
+    if (myStatistics.IsNull())
+    {
+      myStatistics = new BOPAlgo_Statistics(theNbSlowest);
+    }
+    myStatistics->SetNbSlowest(theNbSlowest);
+  }
+  // Returns the statistics collector
+  const Handle(BOPAlgo_Statistics)& Statistics() const { return myStatistics; }
+
 protected:
   //
   BOPTest_Session(const BOPTest_Session&);
@@ -207,6 +226,7 @@ protected:
   Standard_Boolean myUnifyEdges;
   Standard_Boolean myUnifyFaces;
   Standard_Real myAngTol;
+  Handle(BOPAlgo_Statistics) myStatistics;
 };
 //
 //=======================================================================
@@ -505,6 +525,23 @@ Standard_Real BOPTest_Objects::Angular()
   return GetSession().Angular();
 }
 //=======================================================================
+//function : SetCollectStatistics
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetCollectStatistics(const Standard_Boolean bCollect,
+                                           const Standard_Integer theNbSlowest)
+{
+  GetSession().SetCollectStatistics(bCollect, theNbSlowest);
+}
+//=======================================================================
+//function : Statistics
+//purpose  : 
+//=======================================================================
+const Handle(BOPAlgo_Statistics)& BOPTest_Objects::Statistics()
+{
+  return GetSession().Statistics();
+}
+//=======================================================================
 //function : Allocator1
 //purpose  : 
 //=======================================================================
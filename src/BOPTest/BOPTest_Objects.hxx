@@ -23,6 +23,7 @@
 #include <BOPAlgo_PBuilder.hxx>
 #include <BOPAlgo_CellsBuilder.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_Statistics.hxx>
 //
 class BOPAlgo_PaveFiller;
 class BOPAlgo_Builder;
@@ -103,6 +104,12 @@ public:
   Standard_EXPORT static void SetAngular(const Standard_Real bAngTol);
   Standard_EXPORT static Standard_Real Angular();
 
+  //! Enables/Disables collection of performance statistics of BOP algorithms
+  Standard_EXPORT static void SetCollectStatistics(const Standard_Boolean bCollect,
+                                                   const Standard_Integer theNbSlowest = 10);
+  //! Returns the statistics collector shared by the commands (null if the collection is disabled)
+  Standard_EXPORT static const Handle(BOPAlgo_Statistics)& Statistics();
+
 protected:
 
 private:
@@ -18,6 +18,7 @@
 #include <DBRep.hxx>
 #include <Draw.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <Standard_SStream.hxx>
 
 #include <string.h>
 static Standard_Integer boptions (Draw_Interpretor&, Standard_Integer, const char**); 
@@ -29,6 +30,8 @@ static Standard_Integer bdrawwarnshapes(Draw_Interpretor&, Standard_Integer, con
 static Standard_Integer bcheckinverted(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buseobb(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsimplify(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bstatistics(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bstatreport(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
 //function : OptionCommands
@@ -81,6 +84,17 @@ void BOPTest::OptionCommands(Draw_Interpretor& theCommands)
                                "\t\t-f 0/1 - enables/disables faces unification\n"
                                "\t\t-a tol - changes default angular tolerance of unification algo (accepts value in degrees).",
                   __FILE__, bsimplify, g);
+
+  theCommands.Add("bstatistics", "Enables/Disables the collection of performance statistics of BOP algorithms\n"
+                                 "\t\tUsage: bstatistics 0 (off) / 1 (on) [nbslowest]\n"
+                                 "\t\tnbslowest - number of the slowest Face/Face and Edge/Edge\n"
+                                 "\t\t            intersections to keep (10 by default)",
+                  __FILE__, bstatistics, g);
+
+  theCommands.Add("bstatreport", "Prints the performance statistics collected by the last BOP operation\n"
+                                 "\t\tUsage: bstatreport\n"
+                                 "\t\tThe collection has to be enabled by \"bstatistics 1\" command",
+                  __FILE__, bstatreport, g);
 }
 //=======================================================================
 //function : boptions
@@ -143,6 +157,9 @@ Standard_Integer boptions(Draw_Interpretor& di,
   Sprintf(buf, " Angular: %g \t\t(%s)\n", BOPTest_Objects::Angular(),
                "use \"bsimplify -a\" command to change");
   di << buf;
+  Sprintf(buf, " Collect Statistics: %s \t(%s)\n", !BOPTest_Objects::Statistics().IsNull() ? "Yes" : "No",
+               "use \"bstatistics\" command to change");
+  di << buf;
   //
   return 0;
 }
@@ -325,3 +342,56 @@ Standard_Integer bsimplify(Draw_Interpretor& di,
   }
   return 0;
 }
+
+//=======================================================================
+//function : bstatistics
+//purpose  : 
+//=======================================================================
+Standard_Integer bstatistics(Draw_Interpretor& di,
+                             Standard_Integer n,
+                             const char** a)
+{
+  if (n < 2 || n > 3)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  Standard_Integer iCollect = Draw::Atoi(a[1]);
+  Standard_Integer aNbSlowest = (n == 3) ? Draw::Atoi(a[2]) : 10;
+  if (aNbSlowest < 0)
+  {
+    di << "Wrong value.\n";
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+  BOPTest_Objects::SetCollectStatistics(iCollect != 0, aNbSlowest);
+  return 0;
+}
+
+//=======================================================================
+//function : bstatreport
+//purpose  : 
+//=======================================================================
+Standard_Integer bstatreport(Draw_Interpretor& di,
+                             Standard_Integer n,
+                             const char** a)
+{
+  if (n != 1)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  const Handle(BOPAlgo_Statistics)& aStat = BOPTest_Objects::Statistics();
+  if (aStat.IsNull())
+  {
+    di << "The collection of statistics is disabled, use \"bstatistics 1\" to enable it.\n";
+    return 0;
+  }
+
+  Standard_SStream aSStream;
+  aStat->Dump(aSStream);
+  di << aSStream;
+  return 0;
+}
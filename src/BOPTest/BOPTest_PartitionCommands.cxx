@@ -165,6 +165,7 @@ Standard_Integer bfillds(Draw_Interpretor& di,
   aPF.SetFuzzyValue(aTol);
   aPF.SetGlue(aGlue);
   aPF.SetUseOBB(BOPTest_Objects::UseOBB());
+  aPF.SetStatistics(BOPTest_Objects::Statistics());
   //
   OSD_Timer aTimer;
   aTimer.Start();
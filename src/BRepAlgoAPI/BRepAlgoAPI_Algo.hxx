@@ -54,6 +54,10 @@ public:
   using BOPAlgo_Options::ClearWarnings;
   using BOPAlgo_Options::GetReport;
   using BOPAlgo_Options::SetUseOBB;
+  using BOPAlgo_Options::SetCollectStatistics;
+  using BOPAlgo_Options::CollectStatistics;
+  using BOPAlgo_Options::SetStatistics;
+  using BOPAlgo_Options::Statistics;
 
 protected:
 
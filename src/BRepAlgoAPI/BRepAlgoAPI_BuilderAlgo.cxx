@@ -130,6 +130,8 @@ void BRepAlgoAPI_BuilderAlgo::IntersectShapes(const TopTools_ListOfShape& theArg
   myDSFiller->SetNonDestructive(myNonDestructive);
   myDSFiller->SetGlue(myGlue);
   myDSFiller->SetUseOBB(myUseOBB);
+  // Share the statistics collector with the intersection tool
+  myDSFiller->SetStatistics(myStatistics);
   // Set Face/Face intersection options to the intersection algorithm
   SetAttributes();
   // Perform intersection
@@ -42,6 +42,11 @@
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_CString.hxx>
+
+#include <string>
+#include <sstream>
 
 // Modified:    02 Nov 2000: BUC60769. JMB, PTV.  In order to be able to read BRep 
 //              files that came from a platform different from where CasCade 
@@ -59,6 +64,327 @@
 //                We simple check the next string if there are value that equal 2 
 //               (It means a parameter for triangulation).
 
+namespace
+{
+  //! Maximum number of triangulations read or written by one batch.
+  static const Standard_Integer THE_TRIANGULATION_BATCH_NB = 1024;
+
+  //! Number of nodes of triangulations written by one batch.
+  static const Standard_Size THE_TRIANGULATION_BATCH_NODES = 1 << 20;
+
+  //! Size of text of triangulations read by one batch.
+  static const Standard_Size THE_TRIANGULATION_BATCH_TEXT = 64 << 20;
+
+  //! Writes triangulation into the stream.
+  static void writeTriangulation (Standard_OStream& OS,
+                                  const Handle(Poly_Triangulation)& T,
+                                  const Standard_Integer i,
+                                  const Standard_Boolean toWriteNormals,
+                                  const Standard_Boolean Compact,
+                                  const Standard_Boolean theIsVersion3)
+  {
+    Standard_Integer j, nbNodes, nbTriangles = 0, n1, n2, n3;
+    if (Compact) {
+      OS << T->NbNodes() << " " << T->NbTriangles() << " ";
+      OS << ((T->HasUVNodes()) ? "1" : "0") << " ";
+      if (theIsVersion3)
+      {
+        OS << ((T->HasNormals() && toWriteNormals) ? "1" : "0") << " ";
+      }
+    }
+    else {
+      OS << "  "<< i << " : Triangulation with " << T->NbNodes() << " Nodes and "
+         << T->NbTriangles() <<" Triangles\n";
+      OS << "      "<<((T->HasUVNodes()) ? "with" : "without") << " UV nodes\n";
+      if (theIsVersion3)
+      {
+        OS << "      " << ((T->HasNormals() && toWriteNormals) ? "with" : "without") << " normals\n";
+      }
+    }
+
+    // write the deflection
+
+    if (!Compact) OS << "  Deflection : ";
+    OS <<T->Deflection() << "\n";
+
+    // write the 3d nodes
+
+    if (!Compact) OS << "\n3D Nodes :\n";
+
+    nbNodes = T->NbNodes();
+    for (j = 1; j <= nbNodes; j++)
+    {
+      const gp_Pnt aNode = T->Node (j);
+      if (!Compact) OS << std::setw(10) << j << " : ";
+      if (!Compact) OS << std::setw(17);
+      OS << aNode.X() << " ";
+      if (!Compact) OS << std::setw(17);
+      OS << aNode.Y() << " ";
+      if (!Compact) OS << std::setw(17);
+      OS << aNode.Z();
+      if (!Compact) OS << "\n";
+      else OS << " ";
+    }
+
+    if (T->HasUVNodes())
+    {
+      if (!Compact) OS << "\nUV Nodes :\n";
+      for (j = 1; j <= nbNodes; j++)
+      {
+        const gp_Pnt2d aNode2d = T->UVNode (j);
+        if (!Compact) OS << std::setw(10) << j << " : ";
+        if (!Compact) OS << std::setw(17);
+        OS << aNode2d.X() << " ";
+        if (!Compact) OS << std::setw(17);
+        OS << aNode2d.Y();
+        if (!Compact) OS << "\n";
+        else OS << " ";
+      }
+    }
+
+    if (!Compact) OS << "\nTriangles :\n";
+    nbTriangles = T->NbTriangles();
+    for (j = 1; j <= nbTriangles; j++) {
+      if (!Compact) OS << std::setw(10) << j << " : ";
+      T->Triangle (j).Get (n1, n2, n3);
+      if (!Compact) OS << std::setw(10);
+      OS << n1 << " ";
+      if (!Compact) OS << std::setw(10);
+      OS << n2 << " ";
+      if (!Compact) OS << std::setw(10);
+      OS << n3;
+      if (!Compact) OS << "\n";
+      else OS << " ";
+    }
+
+    if (theIsVersion3)
+    {
+      if (T->HasNormals() && toWriteNormals)
+      {
+        if (!Compact) OS << "\nNormals :\n";
+        for (j = 1; j <= nbNodes; j++)
+        {
+          if (!Compact)
+          {
+            OS << std::setw(10) << j << " : ";
+            OS << std::setw(17);
+          }
+          gp_Vec3f aNorm;
+          for (Standard_Integer k = 0; k < 3; ++k)
+          {
+            T->Normal (j, aNorm);
+            OS << aNorm[k];
+            OS << (!Compact ? "\n" : " ");
+          }
+        }
+      }
+    }
+    OS << "\n";
+  }
+
+  //! Functor formatting the batch of triangulations into separate text buffers.
+  class TriangulationFormatter
+  {
+  public:
+
+    TriangulationFormatter (const NCollection_IndexedDataMap<Handle(Poly_Triangulation), Standard_Boolean>& theTriangulations,
+                            NCollection_Array1<std::string>& theTexts,
+                            const Standard_OStream& theFormat,
+                            const Standard_Boolean theIsCompact,
+                            const Standard_Boolean theIsVersion3)
+    : myTriangulations (theTriangulations),
+      myTexts (theTexts),
+      myFormat (theFormat),
+      myFirst (1),
+      myIsCompact (theIsCompact),
+      myIsVersion3 (theIsVersion3) {}
+
+    //! Sets the index of the first triangulation of the batch.
+    void SetFirst (const Standard_Integer theFirst) { myFirst = theFirst; }
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      // the output should not depend on the buffering
+      std::ostringstream aStream;
+      aStream.flags (myFormat.flags());
+      aStream.precision (myFormat.precision());
+      aStream.fill (myFormat.fill());
+      aStream.imbue (myFormat.getloc());
+
+      const Standard_Integer anIndex = myFirst + theIndex;
+      writeTriangulation (aStream, myTriangulations.FindKey (anIndex), anIndex,
+                          myTriangulations.FindFromIndex (anIndex), myIsCompact, myIsVersion3);
+      myTexts.ChangeValue (theIndex) = aStream.str();
+    }
+
+  private:
+    TriangulationFormatter& operator= (const TriangulationFormatter&);
+
+  private:
+    const NCollection_IndexedDataMap<Handle(Poly_Triangulation), Standard_Boolean>& myTriangulations;
+    NCollection_Array1<std::string>& myTexts;
+    const Standard_OStream&          myFormat;
+    Standard_Integer                 myFirst;
+    Standard_Boolean                 myIsCompact;
+    Standard_Boolean                 myIsVersion3;
+  };
+
+  //! Text of triangulation record extracted from the stream.
+  struct TriangulationText
+  {
+    Handle(Poly_Triangulation) Triangulation; //!< triangulation allocated for the record
+    std::string                Text;          //!< null-terminated tokens of nodes, triangles and normals
+    Standard_Boolean           HasNormals;    //!< flag to write normals of the triangulation
+
+    TriangulationText() : HasNormals (Standard_False) {}
+  };
+
+  //! Extracts the specified number of tokens separated by white spaces from the stream.
+  //! Tokens are stored in the string terminated by null characters.
+  //! The failbit is set on the stream if it ends before all tokens are extracted.
+  static void readTokens (Standard_IStream& theIS,
+                          const Standard_Size theNbTokens,
+                          std::string& theText)
+  {
+    theText.clear();
+    if (theNbTokens == 0
+     || !theIS)
+    {
+      return;
+    }
+
+    std::streambuf* aBuffer = theIS.rdbuf();
+    Standard_Size aNbTokens = 0;
+    bool isInToken = false;
+    theText.reserve (theNbTokens * 16);
+    for (;;)
+    {
+      const int aChar = aBuffer->sbumpc();
+      if (aChar == std::char_traits<char>::eof())
+      {
+        if (isInToken)
+        {
+          theText.push_back ('\0');
+          ++aNbTokens;
+        }
+        theIS.setstate (aNbTokens == theNbTokens
+                      ? std::ios::eofbit
+                      : std::ios::eofbit | std::ios::failbit);
+        return;
+      }
+
+      if (aChar == ' ' || aChar == '\n' || aChar == '\r'
+       || aChar == '\t' || aChar == '\v' || aChar == '\f')
+      {
+        if (isInToken)
+        {
+          isInToken = false;
+          theText.push_back ('\0');
+          if (++aNbTokens == theNbTokens)
+          {
+            return;
+          }
+        }
+      }
+      else
+      {
+        isInToken = true;
+        theText.push_back ((char )aChar);
+      }
+    }
+  }
+
+  //! Sequential reader of tokens extracted by readTokens().
+  //! Missing tokens of the truncated record are read as zero values.
+  class TokenReader
+  {
+  public:
+
+    TokenReader (const std::string& theText)
+    : myPtr (theText.c_str()),
+      myEnd (theText.c_str() + theText.size()) {}
+
+    Standard_Real Real() { return Strtod (next(), NULL); }
+
+    Standard_Integer Integer() { return (Standard_Integer )strtol (next(), NULL, 10); }
+
+  private:
+
+    const char* next()
+    {
+      if (myPtr >= myEnd)
+      {
+        return "";
+      }
+      const char* aToken = myPtr;
+      myPtr += strlen (aToken) + 1;
+      return aToken;
+    }
+
+  private:
+    const char* myPtr;
+    const char* myEnd;
+  };
+
+  //! Functor filling triangulations of the batch from the extracted text.
+  class TriangulationParser
+  {
+  public:
+
+    TriangulationParser (NCollection_Array1<TriangulationText>& theRecords)
+    : myRecords (theRecords) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      TriangulationText& aRecord = myRecords.ChangeValue (theIndex);
+      const Handle(Poly_Triangulation)& T = aRecord.Triangulation;
+      TokenReader aReader (aRecord.Text);
+      const Standard_Integer nbNodes = T->NbNodes();
+      Standard_Integer j;
+      for (j = 1; j <= nbNodes; j++) {
+        const Standard_Real x = aReader.Real();
+        const Standard_Real y = aReader.Real();
+        const Standard_Real z = aReader.Real();
+        T->SetNode (j, gp_Pnt (x, y, z));
+      }
+
+      if (T->HasUVNodes()) {
+        for (j = 1; j <= nbNodes; j++) {
+          const Standard_Real x = aReader.Real();
+          const Standard_Real y = aReader.Real();
+          T->SetUVNode (j, gp_Pnt2d (x,y));
+        }
+      }
+
+      // read the triangles
+      for (j = 1; j <= T->NbTriangles(); j++) {
+        const Standard_Integer n1 = aReader.Integer();
+        const Standard_Integer n2 = aReader.Integer();
+        const Standard_Integer n3 = aReader.Integer();
+        T->SetTriangle (j, Poly_Triangle (n1, n2, n3));
+      }
+
+      if (aRecord.HasNormals)
+      {
+        NCollection_Vec3<Standard_Real> aNorm;
+        for (j = 1; j <= nbNodes; j++)
+        {
+          aNorm.x() = aReader.Real();
+          aNorm.y() = aReader.Real();
+          aNorm.z() = aReader.Real();
+          T->SetNormal (j, gp_Vec3f (aNorm));
+        }
+      }
+    }
+
+  private:
+    TriangulationParser& operator= (const TriangulationParser&);
+
+  private:
+    NCollection_Array1<TriangulationText>& myRecords;
+  };
+}
+
 
 //=======================================================================
 //function : BRepTools_ShapeSet
@@ -1403,9 +1729,7 @@ void BRepTools_ShapeSet::WriteTriangulation(Standard_OStream&      OS,
                                             const Standard_Boolean Compact,
                                             const Message_ProgressRange& theProgress)const
 {
-  Standard_Integer i, j, nbNodes, nbtri = myTriangulations.Extent();
-  Standard_Integer nbTriangles = 0, n1, n2, n3;
-
+  const Standard_Integer nbtri = myTriangulations.Extent();
   Message_ProgressScope aPS(theProgress, "Triangulations", nbtri);
 
   if (Compact)
@@ -1416,107 +1740,32 @@ void BRepTools_ShapeSet::WriteTriangulation(Standard_OStream&      OS,
     OS << " -------\n";
   }
 
-  Handle(Poly_Triangulation) T;
-  for (i = 1; i <= nbtri && aPS.More(); i++, aPS.Next()) {
-
-    T = myTriangulations.FindKey(i);
-    const Standard_Boolean toWriteNormals = myTriangulations(i);
-    if (Compact) {
-      OS << T->NbNodes() << " " << T->NbTriangles() << " ";
-      OS << ((T->HasUVNodes()) ? "1" : "0") << " ";
-      if (FormatNb() >= TopTools_FormatVersion_VERSION_3)
-      {
-        OS << ((T->HasNormals() && toWriteNormals) ? "1" : "0") << " ";
-      }
-    }
-    else {
-      OS << "  "<< i << " : Triangulation with " << T->NbNodes() << " Nodes and "
-         << T->NbTriangles() <<" Triangles\n";
-      OS << "      "<<((T->HasUVNodes()) ? "with" : "without") << " UV nodes\n";
-      if (FormatNb() >= TopTools_FormatVersion_VERSION_3)
-      {
-        OS << "      " << ((T->HasNormals() && toWriteNormals) ? "with" : "without") << " normals\n";
-      }
-    }
-    
-    // write the deflection
-    
-    if (!Compact) OS << "  Deflection : ";
-    OS <<T->Deflection() << "\n";
-    
-    // write the 3d nodes
-    
-    if (!Compact) OS << "\n3D Nodes :\n";
-    
-    nbNodes = T->NbNodes();
-    for (j = 1; j <= nbNodes; j++)
+  // triangulations are formatted in parallel into separate buffers
+  // having the same format settings as the output stream, and written in order
+  NCollection_Array1<std::string> aTexts (0, THE_TRIANGULATION_BATCH_NB - 1);
+  TriangulationFormatter aFormatter (myTriangulations, aTexts, OS,
+                                     Compact, FormatNb() >= TopTools_FormatVersion_VERSION_3);
+  for (Standard_Integer aBatchFirst = 1; aBatchFirst <= nbtri && aPS.More();)
+  {
+    // limit the size of the batch by the number of nodes
+    Standard_Integer aBatchLast = aBatchFirst;
+    Standard_Size aNbNodes = myTriangulations.FindKey (aBatchFirst)->NbNodes();
+    for (; aBatchLast < nbtri
+        && aBatchLast - aBatchFirst + 1 < THE_TRIANGULATION_BATCH_NB
+        && aNbNodes < THE_TRIANGULATION_BATCH_NODES; ++aBatchLast)
     {
-      const gp_Pnt aNode = T->Node (j);
-      if (!Compact) OS << std::setw(10) << j << " : ";
-      if (!Compact) OS << std::setw(17);
-      OS << aNode.X() << " ";
-      if (!Compact) OS << std::setw(17);
-      OS << aNode.Y() << " ";
-      if (!Compact) OS << std::setw(17);
-      OS << aNode.Z();
-      if (!Compact) OS << "\n";
-      else OS << " ";
-    }
-    
-    if (T->HasUVNodes())
-    {
-      if (!Compact) OS << "\nUV Nodes :\n";
-      for (j = 1; j <= nbNodes; j++)
-      {
-        const gp_Pnt2d aNode2d = T->UVNode (j);
-        if (!Compact) OS << std::setw(10) << j << " : ";
-        if (!Compact) OS << std::setw(17);
-        OS << aNode2d.X() << " ";
-        if (!Compact) OS << std::setw(17);
-        OS << aNode2d.Y();
-        if (!Compact) OS << "\n";
-        else OS << " ";
-      }
-    }
-    
-    if (!Compact) OS << "\nTriangles :\n";
-    nbTriangles = T->NbTriangles();
-    for (j = 1; j <= nbTriangles; j++) {
-      if (!Compact) OS << std::setw(10) << j << " : ";
-      T->Triangle (j).Get (n1, n2, n3);
-      if (!Compact) OS << std::setw(10);
-      OS << n1 << " ";
-      if (!Compact) OS << std::setw(10);
-      OS << n2 << " ";
-      if (!Compact) OS << std::setw(10);
-      OS << n3;
-      if (!Compact) OS << "\n";
-      else OS << " ";
+      aNbNodes += myTriangulations.FindKey (aBatchLast + 1)->NbNodes();
     }
 
-    if (FormatNb() >= TopTools_FormatVersion_VERSION_3)
+    aFormatter.SetFirst (aBatchFirst);
+    const Standard_Integer aBatchSize = aBatchLast - aBatchFirst + 1;
+    OSD_Parallel::For (0, aBatchSize, aFormatter, aBatchSize == 1);
+    for (Standard_Integer anIter = 0; anIter < aBatchSize && aPS.More(); ++anIter, aPS.Next())
     {
-      if (T->HasNormals() && toWriteNormals)
-      {
-        if (!Compact) OS << "\nNormals :\n";
-        for (j = 1; j <= nbNodes; j++)
-        {
-          if (!Compact)
-          {
-            OS << std::setw(10) << j << " : ";
-            OS << std::setw(17);
-          }
-          gp_Vec3f aNorm;
-          for (Standard_Integer k = 0; k < 3; ++k)
-          {
-            T->Normal (j, aNorm);
-            OS << aNorm[k];
-            OS << (!Compact ? "\n" : " ");
-          }
-        }
-      }
+      OS << aTexts.Value (anIter);
+      std::string().swap (aTexts.ChangeValue (anIter));
     }
-    OS << "\n";
+    aBatchFirst = aBatchLast + 1;
   }
 }
 
@@ -1539,66 +1788,59 @@ void BRepTools_ShapeSet::DumpTriangulation(Standard_OStream& OS)const
 void BRepTools_ShapeSet::ReadTriangulation(Standard_IStream& IS, const Message_ProgressRange& theProgress)
 {
   char buffer[255];
-  Standard_Integer i, j, nbtri =0;
-  Standard_Real d, x, y, z;
+  Standard_Integer i, nbtri =0;
+  Standard_Real d;
   Standard_Integer nbNodes =0, nbTriangles=0;
   Standard_Boolean hasUV= Standard_False;
   Standard_Boolean hasNormals= Standard_False;
 
-  Handle(Poly_Triangulation) T;
-
   IS >> buffer;
   if (strstr(buffer,"Triangulations") == NULL) return;
 
   IS >> nbtri;
   //OCC19559
   Message_ProgressScope aPS(theProgress, "Triangulations", nbtri);
-  for (i=1; i<=nbtri && aPS.More();i++, aPS.Next()) {
 
-    IS >> nbNodes >> nbTriangles >> hasUV;
-    if (FormatNb() >= TopTools_FormatVersion_VERSION_3)
+  // text of triangulations is extracted from the stream sequentially
+  // and converted into nodes and triangles in parallel by batches of limited size
+  NCollection_Array1<TriangulationText> aBatch (0, THE_TRIANGULATION_BATCH_NB - 1);
+  TriangulationParser aParser (aBatch);
+  for (i = 1; i <= nbtri && aPS.More();)
+  {
+    Standard_Integer aBatchSize = 0;
+    Standard_Size aTextSize = 0;
+    for (; i <= nbtri && aBatchSize < THE_TRIANGULATION_BATCH_NB && aTextSize < THE_TRIANGULATION_BATCH_TEXT; ++i, ++aBatchSize)
     {
-      IS >> hasNormals;
-    }
-    GeomTools::GetReal(IS, d);
-
-    T = new Poly_Triangulation (nbNodes, nbTriangles, hasUV, hasNormals);
-
-    for (j = 1; j <= nbNodes; j++) {
-      GeomTools::GetReal(IS, x);
-      GeomTools::GetReal(IS, y);
-      GeomTools::GetReal(IS, z);
-      T->SetNode (j, gp_Pnt (x, y, z));
-    }
-
-    if (hasUV) {
-      for (j = 1; j <= nbNodes; j++) {
-        GeomTools::GetReal(IS, x);
-        GeomTools::GetReal(IS, y);
-        T->SetUVNode (j, gp_Pnt2d (x,y));
+      if (!IS)
+      {
+        // the stream is truncated, the failure is reported by the reading of the next section
+        i = nbtri + 1;
+        break;
       }
-    }
-      
-    // read the triangles
-    Standard_Integer n1,n2,n3;
-    for (j = 1; j <= nbTriangles; j++) {
-      IS >> n1 >> n2 >> n3;
-      T->SetTriangle (j, Poly_Triangle (n1, n2, n3));
-    }
-
-    if (hasNormals)
-    {
-      NCollection_Vec3<Standard_Real> aNorm;
-      for (j = 1; j <= nbNodes; j++)
+      IS >> nbNodes >> nbTriangles >> hasUV;
+      if (FormatNb() >= TopTools_FormatVersion_VERSION_3)
       {
-        GeomTools::GetReal (IS, aNorm.x());
-        GeomTools::GetReal (IS, aNorm.y());
-        GeomTools::GetReal (IS, aNorm.z());
-        T->SetNormal (j, gp_Vec3f (aNorm));
+        IS >> hasNormals;
       }
+      GeomTools::GetReal(IS, d);
+
+      TriangulationText& aRecord = aBatch.ChangeValue (aBatchSize);
+      aRecord.Triangulation = new Poly_Triangulation (nbNodes, nbTriangles, hasUV, hasNormals);
+      aRecord.Triangulation->Deflection (d);
+      aRecord.HasNormals = hasNormals;
+      const Standard_Size aNbTokens = Standard_Size(nbNodes) * (3 + (hasUV ? 2 : 0) + (hasNormals ? 3 : 0))
+                                    + Standard_Size(nbTriangles) * 3;
+      readTokens (IS, aNbTokens, aRecord.Text);
+      aTextSize += aRecord.Text.size();
     }
 
-    T->Deflection(d);
-    myTriangulations.Add(T, hasNormals);
+    OSD_Parallel::For (0, aBatchSize, aParser, aBatchSize == 1);
+    for (Standard_Integer anIter = 0; anIter < aBatchSize; ++anIter, aPS.Next())
+    {
+      TriangulationText& aRecord = aBatch.ChangeValue (anIter);
+      myTriangulations.Add (aRecord.Triangulation, aRecord.HasNormals);
+      aRecord.Triangulation.Nullify();
+      aRecord.Text.clear();
+    }
   }
 }
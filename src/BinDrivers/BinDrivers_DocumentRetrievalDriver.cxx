@@ -36,6 +36,7 @@ IMPLEMENT_STANDARD_RTTIEXT(BinDrivers_DocumentRetrievalDriver,BinLDrivers_Docume
 //purpose  : Constructor
 //=======================================================================
 BinDrivers_DocumentRetrievalDriver::BinDrivers_DocumentRetrievalDriver ()
+: myMinNbDeferredTriangles (-1)
 {
 }
 
@@ -70,6 +71,7 @@ void BinDrivers_DocumentRetrievalDriver::ReadShapeSection
       OCC_CATCH_SIGNALS
       Handle(BinMNaming_NamedShapeDriver) aNamedShapeDriver =
         Handle(BinMNaming_NamedShapeDriver)::DownCast (aDriver);
+      setDeferredTriangulations (aNamedShapeDriver);
       aNamedShapeDriver->ReadShapeSection (theIS, theRange);
     }
     catch(Standard_Failure const& anException) {
@@ -126,4 +128,40 @@ void BinDrivers_DocumentRetrievalDriver::EnableQuickPartReading (
     throw Standard_NotImplemented ("Internal Error - TNaming_NamedShape is not found!");
 
   aShapesDriver->EnableQuickPart (theValue);
+  if (theValue)
+  {
+    // shapes are read from the attributes
+    setDeferredTriangulations (aShapesDriver);
+  }
+}
+
+//=======================================================================
+//function : SetDeferredTriangulations
+//purpose  :
+//=======================================================================
+void BinDrivers_DocumentRetrievalDriver::SetDeferredTriangulations
+                              (const Standard_Integer theMinNbTriangles,
+                               const Handle(BinTools_TriangulationCache)& theCache)
+{
+  myMinNbDeferredTriangles = theMinNbTriangles;
+  myTriangulationCache = theCache;
+}
+
+//=======================================================================
+//function : setDeferredTriangulations
+//purpose  :
+//=======================================================================
+void BinDrivers_DocumentRetrievalDriver::setDeferredTriangulations
+                              (const Handle(BinMNaming_NamedShapeDriver)& theDriver) const
+{
+  if (myMinNbDeferredTriangles >= 0
+  && !myFileName.IsEmpty())
+  {
+    theDriver->SetDeferredTriangulations (TCollection_AsciiString (myFileName),
+                                          myMinNbDeferredTriangles, myTriangulationCache);
+  }
+  else
+  {
+    theDriver->SetDeferredTriangulations (TCollection_AsciiString(), 0, Handle(BinTools_TriangulationCache)());
+  }
 }
@@ -19,10 +19,12 @@
 #include <Standard.hxx>
 
 #include <BinLDrivers_DocumentRetrievalDriver.hxx>
+#include <BinTools_TriangulationCache.hxx>
 #include <Standard_IStream.hxx>
 #include <Storage_Position.hxx>
 #include <Standard_Integer.hxx>
 class BinMDF_ADriverTable;
+class BinMNaming_NamedShapeDriver;
 class Message_Messenger;
 class BinLDrivers_DocumentSection;
 
@@ -59,9 +61,34 @@ public:
   Standard_EXPORT virtual void EnableQuickPartReading
     (const Handle(Message_Messenger)& theMessageDriver, Standard_Boolean theValue) Standard_OVERRIDE;
 
+  //! Enables reading of triangulations of the shapes section or of the attributes
+  //! (quick part documents) having at least theMinNbTriangles triangles as deferred ones,
+  //! which data is loaded from the document file on demand (see BinTools_DeferredTriangulation).
+  //! Negative value disables deferred reading (default).
+  //! Has no effect on documents read from the stream.
+  Standard_EXPORT void SetDeferredTriangulations
+    (const Standard_Integer theMinNbTriangles,
+     const Handle(BinTools_TriangulationCache)& theCache = Handle(BinTools_TriangulationCache)());
+
+  //! Returns minimal number of triangles of deferred triangulation (negative if disabled).
+  Standard_Integer MinNbDeferredTriangles() const { return myMinNbDeferredTriangles; }
+
+  //! Returns the cache limiting the memory occupied by loaded deferred triangulations.
+  const Handle(BinTools_TriangulationCache)& TriangulationCache() const { return myTriangulationCache; }
+
 
   DEFINE_STANDARD_RTTIEXT(BinDrivers_DocumentRetrievalDriver,BinLDrivers_DocumentRetrievalDriver)
 
+private:
+
+  //! Passes the parameters of deferred reading of triangulations to the shapes driver.
+  void setDeferredTriangulations (const Handle(BinMNaming_NamedShapeDriver)& theDriver) const;
+
+private:
+
+  Handle(BinTools_TriangulationCache) myTriangulationCache;
+  Standard_Integer myMinNbDeferredTriangles;
+
 };
 
 #endif // _BinDrivers_DocumentRetrievalDriver_HeaderFile
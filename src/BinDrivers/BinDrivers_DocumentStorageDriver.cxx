@@ -19,6 +19,7 @@
 #include <BinLDrivers_DocumentSection.hxx>
 #include <BinMDF_ADriverTable.hxx>
 #include <BinMNaming_NamedShapeDriver.hxx>
+#include <BinTools_DeferredTriangulation.hxx>
 #include <Message_Messenger.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_NotImplemented.hxx>
@@ -206,3 +207,12 @@ void BinDrivers_DocumentStorageDriver::WriteShapeSection
   // Write the section info in the TOC.
   theSection.Write (theOS, aShapesSectionOffset, theDocVer);
 }
+
+//=======================================================================
+//function : DetachFromFile
+//purpose  :
+//=======================================================================
+Standard_Boolean BinDrivers_DocumentStorageDriver::DetachFromFile (const TCollection_ExtendedString& theFileName)
+{
+  return BinTools_DeferredTriangulation::DetachFromFile (TCollection_AsciiString (theFileName));
+}
@@ -69,6 +69,12 @@ public:
 
   DEFINE_STANDARD_RTTIEXT(BinDrivers_DocumentStorageDriver,BinLDrivers_DocumentStorageDriver)
 
+protected:
+
+  //! Loads the triangulations read on demand from the file <theFileName>
+  //! (see BinTools_DeferredTriangulation) before the file is rewritten.
+  Standard_EXPORT virtual Standard_Boolean DetachFromFile (const TCollection_ExtendedString& theFileName) Standard_OVERRIDE;
+
 };
 
 #endif // _BinDrivers_DocumentStorageDriver_HeaderFile
@@ -0,0 +1,240 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinLDrivers_DocumentIncrement.hxx>
+
+#include <FSD_BinaryFile.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+#include <Storage_StreamReadError.hxx>
+
+namespace
+{
+  //! Signature closing the trailer of the increment.
+  static const char THE_INCREMENT_SIGNATURE[8] = { 'B', 'I', 'N', 'C', 'R', 'E', 'M', '1' };
+
+  //! Size of the trailer: offsets of data and of table of contents, index and signature.
+  static const Standard_Size THE_TRAILER_SIZE = 2 * sizeof(uint64_t) + sizeof(Standard_Integer) + sizeof(THE_INCREMENT_SIGNATURE);
+
+  //! Writes 64-bit value into the stream.
+  static void writeUint64 (Standard_OStream& theOS, uint64_t theValue)
+  {
+#if OCCT_BINARY_FILE_DO_INVERSE
+    theValue = FSD_BinaryFile::InverseUint64 (theValue);
+#endif
+    theOS.write ((const char*)&theValue, sizeof(uint64_t));
+  }
+
+  //! Reads 64-bit value from the stream.
+  static uint64_t readUint64 (Standard_IStream& theIS)
+  {
+    uint64_t aValue = 0;
+    theIS.read ((char*)&aValue, sizeof(uint64_t));
+#if OCCT_BINARY_FILE_DO_INVERSE
+    aValue = FSD_BinaryFile::InverseUint64 (aValue);
+#endif
+    return aValue;
+  }
+
+  //! Writes string into the stream.
+  static void writeString (Standard_OStream& theOS, const TCollection_AsciiString& theString)
+  {
+    FSD_BinaryFile::PutInteger (theOS, theString.Length());
+    theOS.write (theString.ToCString(), theString.Length());
+  }
+
+  //! Reads string from the stream.
+  static void readString (Standard_IStream& theIS, TCollection_AsciiString& theString)
+  {
+    Standard_Integer aLength = 0;
+    FSD_BinaryFile::GetInteger (theIS, aLength);
+    if (aLength < 0)
+    {
+      throw Storage_StreamReadError();
+    }
+
+    theString = TCollection_AsciiString (aLength, ' ');
+    if (aLength > 0)
+    {
+      theIS.read ((char*)theString.ToCString(), aLength);
+    }
+    if (theIS.gcount() != aLength && aLength > 0)
+    {
+      throw Storage_StreamReadError();
+    }
+  }
+}
+
+//=======================================================================
+//function : BinLDrivers_DocumentIncrement
+//purpose  : Empty constructor
+//=======================================================================
+BinLDrivers_DocumentIncrement::BinLDrivers_DocumentIncrement()
+: myOffset (0),
+  myIndex (0)
+{
+  //
+}
+
+//=======================================================================
+//function : TrailerSize
+//purpose  :
+//=======================================================================
+Standard_Size BinLDrivers_DocumentIncrement::TrailerSize()
+{
+  return THE_TRAILER_SIZE;
+}
+
+//=======================================================================
+//function : Write
+//purpose  :
+//=======================================================================
+void BinLDrivers_DocumentIncrement::Write (Standard_OStream& theOS) const
+{
+  const uint64_t aTOCOffset = (uint64_t )theOS.tellp();
+
+  // table of contents: modified labels and referred attributes
+  FSD_BinaryFile::PutInteger (theOS, myLabels.Length());
+  for (TColStd_SequenceOfAsciiString::Iterator aLabIter (myLabels); aLabIter.More(); aLabIter.Next())
+  {
+    writeString (theOS, aLabIter.Value());
+  }
+
+  FSD_BinaryFile::PutInteger (theOS, myReferences.Length());
+  for (NCollection_Sequence<Reference>::Iterator aRefIter (myReferences); aRefIter.More(); aRefIter.Next())
+  {
+    const Reference& aRef = aRefIter.Value();
+    char aGuidStr[Standard_GUID_SIZE_ALLOC];
+    aRef.AttributeId.ToCString (aGuidStr);
+    FSD_BinaryFile::PutInteger (theOS, aRef.Id);
+    writeString (theOS, aRef.Entry);
+    writeString (theOS, aGuidStr);
+  }
+
+  // trailer
+  writeUint64 (theOS, myOffset);
+  writeUint64 (theOS, aTOCOffset);
+  FSD_BinaryFile::PutInteger (theOS, myIndex);
+  theOS.write (THE_INCREMENT_SIGNATURE, sizeof(THE_INCREMENT_SIGNATURE));
+}
+
+//=======================================================================
+//function : Read
+//purpose  :
+//=======================================================================
+Standard_Boolean BinLDrivers_DocumentIncrement::Read (Standard_IStream& theIS,
+                                                      const uint64_t theEnd)
+{
+  myLabels.Clear();
+  myReferences.Clear();
+  if (theEnd < THE_TRAILER_SIZE)
+  {
+    return Standard_False;
+  }
+
+  try
+  {
+    OCC_CATCH_SIGNALS
+    theIS.clear();
+    theIS.seekg ((std::streamoff )(theEnd - THE_TRAILER_SIZE), std::ios_base::beg);
+    myOffset = readUint64 (theIS);
+    const uint64_t aTOCOffset = readUint64 (theIS);
+    FSD_BinaryFile::GetInteger (theIS, myIndex);
+    char aSignature[sizeof(THE_INCREMENT_SIGNATURE)];
+    theIS.read (aSignature, sizeof(aSignature));
+    if (!theIS
+      || memcmp (aSignature, THE_INCREMENT_SIGNATURE, sizeof(aSignature)) != 0
+      || myIndex < 1
+      || myOffset >= aTOCOffset
+      || aTOCOffset > theEnd - THE_TRAILER_SIZE)
+    {
+      return Standard_False;
+    }
+
+    theIS.seekg ((std::streamoff )aTOCOffset, std::ios_base::beg);
+    Standard_Integer aNbLabels = 0;
+    FSD_BinaryFile::GetInteger (theIS, aNbLabels);
+    for (Standard_Integer aLabIter = 0; aLabIter < aNbLabels; ++aLabIter)
+    {
+      TCollection_AsciiString anEntry;
+      readString (theIS, anEntry);
+      myLabels.Append (anEntry);
+    }
+
+    Standard_Integer aNbRefs = 0;
+    FSD_BinaryFile::GetInteger (theIS, aNbRefs);
+    for (Standard_Integer aRefIter = 0; aRefIter < aNbRefs; ++aRefIter)
+    {
+      Reference aRef;
+      TCollection_AsciiString aGuidStr;
+      FSD_BinaryFile::GetInteger (theIS, aRef.Id);
+      readString (theIS, aRef.Entry);
+      readString (theIS, aGuidStr);
+      aRef.AttributeId = Standard_GUID (aGuidStr.ToCString());
+      myReferences.Append (aRef);
+    }
+  }
+  catch (Standard_Failure const&)
+  {
+    myLabels.Clear();
+    myReferences.Clear();
+    return Standard_False;
+  }
+  return !theIS.fail();
+}
+
+//=======================================================================
+//function : ReadAll
+//purpose  :
+//=======================================================================
+Standard_Boolean BinLDrivers_DocumentIncrement::ReadAll (Standard_IStream& theIS,
+                                                         NCollection_Sequence<BinLDrivers_DocumentIncrement>& theIncrements)
+{
+  theIncrements.Clear();
+  theIS.clear();
+  if (!theIS.seekg (0, std::ios_base::end))
+  {
+    theIS.clear();
+    return Standard_False;
+  }
+
+  const std::streamoff anEnd = theIS.tellg();
+  if (anEnd < 0)
+  {
+    theIS.clear();
+    return Standard_False;
+  }
+
+  // walk from the last increment to the first one
+  uint64_t anIncrementEnd = (uint64_t )anEnd;
+  for (;;)
+  {
+    BinLDrivers_DocumentIncrement anIncrement;
+    if (!anIncrement.Read (theIS, anIncrementEnd)
+     || (!theIncrements.IsEmpty() && anIncrement.Index() != theIncrements.First().Index() - 1))
+    {
+      // broken chain of increments
+      theIncrements.Clear();
+      break;
+    }
+
+    anIncrementEnd = anIncrement.Offset();
+    theIncrements.Prepend (anIncrement);
+    if (anIncrement.Index() == 1)
+    {
+      break;
+    }
+  }
+  theIS.clear();
+  return !theIncrements.IsEmpty();
+}
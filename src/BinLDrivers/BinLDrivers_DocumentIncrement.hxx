@@ -0,0 +1,107 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinLDrivers_DocumentIncrement_HeaderFile
+#define _BinLDrivers_DocumentIncrement_HeaderFile
+
+#include <NCollection_Sequence.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_GUID.hxx>
+#include <Standard_IStream.hxx>
+#include <Standard_OStream.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TColStd_SequenceOfAsciiString.hxx>
+
+//! Increment of the binary document appended to the end of the file
+//! by incremental saving (see BinLDrivers_DocumentStorageDriver::SetIncrementalMode()).
+//!
+//! The increment consists of the document data in the usual format (header, sections
+//! and the tree of labels) containing only the labels modified since the previous saving,
+//! followed by the table of contents and by the trailer of fixed size closing the file:
+//! - the table of contents lists entries of modified labels, which attributes
+//!   are replaced by the increment, and the attributes stored before the increment
+//!   and referred by the attributes of the increment;
+//! - the trailer contains positions of the increment data and of the table of contents,
+//!   the index of the increment in the file and the signature.
+//! The previous increment (if any) ends just before the data of the next one,
+//! so that all increments can be located starting from the end of the file.
+class BinLDrivers_DocumentIncrement
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Attribute stored before the increment and referred by the attributes of the increment.
+  struct Reference
+  {
+    Standard_Integer        Id;          //!< identifier of the attribute within the increment
+    TCollection_AsciiString Entry;       //!< entry of the label of the attribute
+    Standard_GUID           AttributeId; //!< GUID of the attribute
+  };
+
+public:
+
+  //! Empty constructor
+  Standard_EXPORT BinLDrivers_DocumentIncrement();
+
+  //! Returns the index of the increment in the file starting from 1.
+  Standard_Integer Index() const { return myIndex; }
+
+  //! Sets the index of the increment in the file.
+  void SetIndex (const Standard_Integer theIndex) { myIndex = theIndex; }
+
+  //! Returns the position of the increment data in the file.
+  uint64_t Offset() const { return myOffset; }
+
+  //! Sets the position of the increment data in the file.
+  void SetOffset (const uint64_t theOffset) { myOffset = theOffset; }
+
+  //! Returns entries of the labels which attributes are replaced by the increment.
+  const TColStd_SequenceOfAsciiString& Labels() const { return myLabels; }
+
+  //! Returns entries of the labels which attributes are replaced by the increment.
+  TColStd_SequenceOfAsciiString& ChangeLabels() { return myLabels; }
+
+  //! Returns the attributes referred by the increment.
+  const NCollection_Sequence<Reference>& References() const { return myReferences; }
+
+  //! Returns the attributes referred by the increment.
+  NCollection_Sequence<Reference>& ChangeReferences() { return myReferences; }
+
+  //! Writes the table of contents and the trailer of the increment
+  //! at the current position of the stream (just after the increment data).
+  Standard_EXPORT void Write (Standard_OStream& theOS) const;
+
+  //! Reads the increment which trailer ends at the specified position of the stream.
+  //! Returns false if there is no increment or the stream cannot be read.
+  Standard_EXPORT Standard_Boolean Read (Standard_IStream& theIS,
+                                         const uint64_t theEnd);
+
+  //! Reads all increments stored in the stream in order of their appending.
+  //! Returns false if the stream contains no increments.
+  Standard_EXPORT static Standard_Boolean ReadAll (Standard_IStream& theIS,
+                                                   NCollection_Sequence<BinLDrivers_DocumentIncrement>& theIncrements);
+
+  //! Returns the size of the trailer in bytes.
+  Standard_EXPORT static Standard_Size TrailerSize();
+
+private:
+
+  TColStd_SequenceOfAsciiString   myLabels;
+  NCollection_Sequence<Reference> myReferences;
+  uint64_t                        myOffset;
+  Standard_Integer                myIndex;
+
+};
+
+#endif // _BinLDrivers_DocumentIncrement_HeaderFile
@@ -15,6 +15,7 @@
 
 
 #include <BinLDrivers.hxx>
+#include <BinLDrivers_DocumentIncrement.hxx>
 #include <BinLDrivers_DocumentRetrievalDriver.hxx>
 #include <BinLDrivers_DocumentSection.hxx>
 #include <BinLDrivers_Marker.hxx>
@@ -26,7 +27,9 @@
 #include <FSD_BinaryFile.hxx>
 #include <FSD_FileHeader.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
 #include <PCDM_ReadWriter.hxx>
+#include <Standard_ErrorHandler.hxx>
 #include <Standard_Stream.hxx>
 #include <Standard_Type.hxx>
 #include <Storage_HeaderData.hxx>
@@ -36,7 +39,11 @@
 #include <TDataStd_TreeNode.hxx>
 #include <TDF_Attribute.hxx>
 #include <TDF_Data.hxx>
+#include <TDF_AttributeIterator.hxx>
 #include <TDF_Label.hxx>
+#include <TDF_LabelMap.hxx>
+#include <TDF_MapIteratorOfLabelMap.hxx>
+#include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
 #include <TDocStd_FormatVersion.hxx>
 #include <TDocStd_Owner.hxx>
@@ -51,6 +58,13 @@ IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DocumentRetrievalDriver,PCDM_RetrievalDri
 #define SIZEOFSHAPELABEL  18
 
 #define DATATYPE_MIGRATION
+
+namespace
+{
+  //! Number of the attribute records decoded in parallel at once;
+  //! limits the memory occupied by the buffers of deferred records.
+  static const Standard_Integer THE_DEFERRED_BATCH_SIZE = 256;
+}
 //#define DATATYPE_MIGRATION_DEB
 //=======================================================================
 //function : BinLDrivers_DocumentRetrievalDriver
@@ -58,6 +72,7 @@ IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DocumentRetrievalDriver,PCDM_RetrievalDri
 //=======================================================================
 
 BinLDrivers_DocumentRetrievalDriver::BinLDrivers_DocumentRetrievalDriver ()
+: myNbDeferredAttributes (0)
 {
   myReaderStatus = PCDM_RS_OK;
 }
@@ -81,7 +96,9 @@ void BinLDrivers_DocumentRetrievalDriver::Read
     Handle(Storage_Data) dData;
     TCollection_ExtendedString aFormat = PCDM_ReadWriter::FileFormat (*aFileStream, dData);
 
+    myFileName = theFileName;
     Read (*aFileStream, dData, theNewDocument, theApplication, theFilter, theRange);
+    myFileName.Clear();
     if (!theRange.More())
     {
       myReaderStatus = PCDM_RS_UserBreak;
@@ -219,6 +236,9 @@ void BinLDrivers_DocumentRetrievalDriver::Read (Standard_IStream&
   // 2a. Retrieve data from the stream:
   myRelocTable.Clear();
   myRelocTable.SetHeaderData(aHeaderData);
+  for (NCollection_DataMap<Standard_Integer, Handle(TDF_Attribute)>::Iterator aRefIter (myIncrementReferences);
+       aRefIter.More(); aRefIter.Next())
+    myRelocTable.Bind (aRefIter.Key(), aRefIter.Value());
   mySections.Clear();
   myPAtt.Init();
   Handle(TDF_Data) aData = (!theFilter.IsNull() && theFilter->IsAppendMode()) ? aDoc->GetData() : new TDF_Data();
@@ -335,6 +355,7 @@ void BinLDrivers_DocumentRetrievalDriver::Read (Standard_IStream&
     theIStream.seekg(aStreamStartPosition, std::ios_base::beg);
     nbRead += ReadSubTree(theIStream, aData->Root(), theFilter, aQuickPart, Standard_True, aPS.Next());
   }
+  pasteDeferredAttributes();
   if (!aPS.More()) 
   {
     myReaderStatus = PCDM_RS_UserBreak;
@@ -371,6 +392,237 @@ void BinLDrivers_DocumentRetrievalDriver::Read (Standard_IStream&
       }
     }
   }
+
+  // Replay increments appended by incremental saving (unless the document is read partially)
+  if (myReaderStatus == PCDM_RS_OK
+   && (theFilter.IsNull() || (!theFilter->IsAppendMode() && !theFilter->IsPartTree())))
+  {
+    ReadIncrements (theIStream, aDoc, theApplication, theFilter);
+  }
+
+  if (myReaderStatus == PCDM_RS_OK
+   && (theFilter.IsNull() || !theFilter->IsAppendMode()))
+  {
+    // the attributes added by reading correspond to the file
+    aDoc->SetSaved();
+  }
+}
+
+namespace
+{
+  //! Links of the tree node: father, next, previous and first child
+  //! with labels of the linked nodes.
+  struct TreeNodeLinks
+  {
+    Handle(TDataStd_TreeNode) Nodes[4];
+    TDF_Label                 Labels[4];
+  };
+
+  //! Keeps links of the tree node not modified by the increment.
+  static void keepTreeNodeLinks (const Handle(TDataStd_TreeNode)& theNode,
+                                 const TDF_LabelMap& theModified,
+                                 NCollection_DataMap<Handle(TDataStd_TreeNode), TreeNodeLinks>& theLinks)
+  {
+    if (theNode.IsNull()
+     || theModified.Contains (theNode->Label())
+     || theLinks.IsBound (theNode))
+    {
+      return;
+    }
+
+    TreeNodeLinks aLinks;
+    aLinks.Nodes[0] = theNode->Father();
+    aLinks.Nodes[1] = theNode->Next();
+    aLinks.Nodes[2] = theNode->Previous();
+    aLinks.Nodes[3] = theNode->First();
+    for (Standard_Integer aLinkIter = 0; aLinkIter < 4; ++aLinkIter)
+    {
+      if (!aLinks.Nodes[aLinkIter].IsNull())
+        aLinks.Labels[aLinkIter] = aLinks.Nodes[aLinkIter]->Label();
+    }
+    theLinks.Bind (theNode, aLinks);
+  }
+
+  //! Returns the tree node linked before the increment, replaced by the increment if modified.
+  static Handle(TDataStd_TreeNode) linkedTreeNode (const TreeNodeLinks& theLinks,
+                                                   const Standard_Integer theIndex,
+                                                   const TDF_LabelMap& theModified)
+  {
+    const Handle(TDataStd_TreeNode)& aNode = theLinks.Nodes[theIndex];
+    if (aNode.IsNull()
+    || !theModified.Contains (theLinks.Labels[theIndex]))
+    {
+      return aNode;
+    }
+
+    Handle(TDataStd_TreeNode) aNewNode;
+    theLinks.Labels[theIndex].FindAttribute (aNode->ID(), aNewNode);
+    return aNewNode;
+  }
+}
+
+//=======================================================================
+//function : ReadIncrements
+//purpose  :
+//=======================================================================
+void BinLDrivers_DocumentRetrievalDriver::ReadIncrements (Standard_IStream&               theIS,
+                                                          const Handle(TDocStd_Document)& theDoc,
+                                                          const Handle(CDM_Application)&  theApplication,
+                                                          const Handle(PCDM_ReaderFilter)& theFilter)
+{
+  NCollection_Sequence<BinLDrivers_DocumentIncrement> anIncrements;
+  if (!BinLDrivers_DocumentIncrement::ReadAll (theIS, anIncrements))
+    return;
+
+  const TCollection_ExtendedString aMethStr ("BinLDrivers_DocumentRetrievalDriver: ");
+  const Handle(TDF_Data)& aData = theDoc->GetData();
+  // attributes of the increments overwrite the read ones;
+  // the filter of the document (if any) is used to keep skipping of the same attribute types
+  Handle(PCDM_ReaderFilter) aFilter = theFilter;
+  if (aFilter.IsNull())
+    aFilter = new PCDM_ReaderFilter (PCDM_ReaderFilter::AppendMode_Overwrite);
+  const PCDM_ReaderFilter::AppendMode aMode = aFilter->Mode();
+  aFilter->Mode() = PCDM_ReaderFilter::AppendMode_Overwrite;
+  for (NCollection_Sequence<BinLDrivers_DocumentIncrement>::Iterator anIncIter (anIncrements); anIncIter.More(); anIncIter.Next())
+  {
+    const BinLDrivers_DocumentIncrement& anIncrement = anIncIter.Value();
+
+    TDF_LabelMap aModified;
+    for (TColStd_SequenceOfAsciiString::Iterator aLabIter (anIncrement.Labels()); aLabIter.More(); aLabIter.Next())
+    {
+      TDF_Label aLabel;
+      TDF_Tool::Label (aData, aLabIter.Value(), aLabel, Standard_True);
+      if (!aLabel.IsNull())
+        aModified.Add (aLabel);
+    }
+
+    // forgetting of the modified tree nodes breaks the links of not modified ones
+    // (see TDataStd_TreeNode::BeforeForget()), so that they are kept to be restored
+    NCollection_DataMap<Handle(TDataStd_TreeNode), TreeNodeLinks> aTreeLinks;
+    for (TDF_MapIteratorOfLabelMap aLabIter (aModified); aLabIter.More(); aLabIter.Next())
+    {
+      for (TDF_AttributeIterator anAttIter (aLabIter.Key()); anAttIter.More(); anAttIter.Next())
+      {
+        Handle(TDataStd_TreeNode) aNode = Handle(TDataStd_TreeNode)::DownCast (anAttIter.Value());
+        if (aNode.IsNull())
+          continue;
+        keepTreeNodeLinks (aNode->Father(),   aModified, aTreeLinks);
+        keepTreeNodeLinks (aNode->Next(),     aModified, aTreeLinks);
+        keepTreeNodeLinks (aNode->Previous(), aModified, aTreeLinks);
+        for (Handle(TDataStd_TreeNode) aChild = aNode->First(); !aChild.IsNull(); aChild = aChild->Next())
+          keepTreeNodeLinks (aChild, aModified, aTreeLinks);
+      }
+    }
+
+    // attributes of modified labels are replaced by the increment
+    for (TDF_MapIteratorOfLabelMap aLabIter (aModified); aLabIter.More(); aLabIter.Next())
+      aLabIter.Key().ForgetAllAttributes (Standard_False);
+
+    // attributes read before and referred by the increment
+    myIncrementReferences.Clear();
+    for (NCollection_Sequence<BinLDrivers_DocumentIncrement::Reference>::Iterator aRefIter (anIncrement.References());
+         aRefIter.More(); aRefIter.Next())
+    {
+      const BinLDrivers_DocumentIncrement::Reference& aRef = aRefIter.Value();
+      TDF_Label aLabel;
+      Handle(TDF_Attribute) anAtt;
+      TDF_Tool::Label (aData, aRef.Entry, aLabel, Standard_False);
+      if (!aLabel.IsNull()
+       && aLabel.FindAttribute (aRef.AttributeId, anAtt))
+        myIncrementReferences.Bind (aRef.Id, anAtt);
+      else
+        myMsgDriver->Send (aMethStr + "warning: attribute referred by the increment is not found at "
+                         + aRef.Entry, Message_Warning);
+    }
+
+    theIS.clear();
+    theIS.seekg ((std::streampos) anIncrement.Offset());
+    Handle(Storage_Data) aStorageData;
+    PCDM_ReadWriter::FileFormat (theIS, aStorageData);
+    Read (theIS, aStorageData, theDoc, theApplication, aFilter);
+    myIncrementReferences.Clear();
+
+    // restore links of not modified tree nodes
+    for (NCollection_DataMap<Handle(TDataStd_TreeNode), TreeNodeLinks>::Iterator aLinkIter (aTreeLinks);
+         aLinkIter.More(); aLinkIter.Next())
+    {
+      const Handle(TDataStd_TreeNode)& aNode = aLinkIter.Key();
+      aNode->SetFather   (linkedTreeNode (aLinkIter.Value(), 0, aModified));
+      aNode->SetNext     (linkedTreeNode (aLinkIter.Value(), 1, aModified));
+      aNode->SetPrevious (linkedTreeNode (aLinkIter.Value(), 2, aModified));
+      aNode->SetFirst    (linkedTreeNode (aLinkIter.Value(), 3, aModified));
+    }
+
+    // the increment without written attributes is not a failure
+    if (myReaderStatus != PCDM_RS_OK && myReaderStatus != PCDM_RS_DriverFailure)
+    {
+      myMsgDriver->Send (aMethStr + "error: failure reading increment " + anIncrement.Index(), Message_Fail);
+      break;
+    }
+    myReaderStatus = PCDM_RS_OK;
+  }
+  aFilter->Mode() = aMode;
+}
+
+//! Functor decoding the deferred attribute records.
+class BinLDrivers_DocumentRetrievalDriver::DeferredPasteFunctor
+{
+public:
+
+  DeferredPasteFunctor (NCollection_Vector<DeferredAttribute>& theAttributes,
+                        BinObjMgt_RRelocationTable& theRelocTable)
+  : myAttributes (theAttributes),
+    myRelocTable (theRelocTable) {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    DeferredAttribute& anAttribute = myAttributes.ChangeValue (theIndex);
+    try
+    {
+      OCC_CATCH_SIGNALS
+      anAttribute.IsPasted = anAttribute.Driver->Paste (anAttribute.Data, anAttribute.Attribute, myRelocTable);
+    }
+    catch (Standard_Failure const&)
+    {
+      anAttribute.IsPasted = Standard_False;
+    }
+  }
+
+private:
+  DeferredPasteFunctor& operator= (const DeferredPasteFunctor&);
+
+private:
+  NCollection_Vector<DeferredAttribute>& myAttributes;
+  BinObjMgt_RRelocationTable& myRelocTable;
+};
+
+//=======================================================================
+//function : pasteDeferredAttributes
+//purpose  :
+//=======================================================================
+void BinLDrivers_DocumentRetrievalDriver::pasteDeferredAttributes()
+{
+  if (myNbDeferredAttributes == 0)
+  {
+    return;
+  }
+
+  DeferredPasteFunctor aFunctor (myDeferredAttributes, myRelocTable);
+  OSD_Parallel::For (0, myNbDeferredAttributes, aFunctor, myNbDeferredAttributes == 1);
+  for (Standard_Integer anAttIter = 0; anAttIter < myNbDeferredAttributes; ++anAttIter)
+  {
+    DeferredAttribute& anAttribute = myDeferredAttributes.ChangeValue (anAttIter);
+    if (!anAttribute.IsPasted)
+    {
+      // error converting persistent to transient
+      myMsgDriver->Send (TCollection_ExtendedString ("BinLDrivers_DocumentRetrievalDriver: warning: failure reading attribute ")
+                       + anAttribute.Driver->TypeName(), Message_Warning);
+    }
+    // keep the buffer for the next batch
+    anAttribute.Driver.Nullify();
+    anAttribute.Attribute.Nullify();
+  }
+  myNbDeferredAttributes = 0;
 }
 
 //=======================================================================
@@ -473,6 +725,7 @@ Standard_Integer BinLDrivers_DocumentRetrievalDriver::ReadSubTree
       }
       nbRead++;
 
+      Standard_Boolean isTemporaryID = Standard_False;
       if (tAtt->Label().IsNull())
       {
         if (!theFilter.IsNull() && theFilter->Mode() != PCDM_ReaderFilter::AppendMode_Forbid && theLabel.IsAttribute(tAtt->ID()))
@@ -488,12 +741,19 @@ Standard_Integer BinLDrivers_DocumentRetrievalDriver::ReadSubTree
         }
         catch (const Standard_DomainError&)
         {
-          // For attributes that can have arbitrary GUID (e.g. TDataStd_Integer), exception
-          // will be raised in valid case if attribute of that type with default GUID is already
-          // present  on the same label; the reason is that actual GUID will be read later.
-          // To avoid this, set invalid (null) GUID to the newly added attribute (see #29669)
-          static const Standard_GUID fbidGuid;
-          tAtt->SetID(fbidGuid);
+          // the actual GUIDs of the attributes waiting for the deferred decoding are not known yet
+          pasteDeferredAttributes();
+          if (theLabel.IsAttribute (tAtt->ID()))
+          {
+            // For attributes that can have arbitrary GUID (e.g. TDataStd_Integer), exception
+            // will be raised in valid case if attribute of that type with default GUID is already
+            // present  on the same label; the reason is that actual GUID will be read later.
+            // To avoid this, set invalid (null) GUID to the newly added attribute (see #29669)
+            static const Standard_GUID fbidGuid;
+            tAtt->SetID(fbidGuid);
+            // the invalid GUID should be replaced before the next attribute is added
+            isTemporaryID = Standard_True;
+          }
           theLabel.AddAttribute(tAtt);
         }
       }
@@ -502,6 +762,29 @@ Standard_Integer BinLDrivers_DocumentRetrievalDriver::ReadSubTree
           "warning: attempt to attach attribute " +
           aDriver->TypeName() + " to a second label", Message_Warning);
 
+      if ((theFilter.IsNull() || (!theFilter->IsAppendMode() && !theFilter->IsPartTree()))
+       && !isTemporaryID && !myPAtt.IsDirect() && aDriver->IsPasteThreadSafe())
+      {
+        // the record does not depend on other attributes: decode it later in parallel
+        if (myNbDeferredAttributes == myDeferredAttributes.Length())
+        {
+          myDeferredAttributes.Appended();
+        }
+        DeferredAttribute& aDeferred = myDeferredAttributes.ChangeValue (myNbDeferredAttributes++);
+        aDeferred.Driver = aDriver;
+        aDeferred.Attribute = tAtt;
+        aDeferred.Data.Swap (myPAtt);
+        if (!isBound)
+        {
+          myRelocTable.Bind (anID, tAtt);
+        }
+        if (myNbDeferredAttributes == THE_DEFERRED_BATCH_SIZE)
+        {
+          pasteDeferredAttributes();
+        }
+        continue;
+      }
+
       Standard_Boolean ok = aDriver->Paste(myPAtt, tAtt, myRelocTable);
       if (!ok) {
         // error converting persistent to transient
@@ -648,6 +931,8 @@ void BinLDrivers_DocumentRetrievalDriver::CheckShapeSection
 void BinLDrivers_DocumentRetrievalDriver::Clear()
 {
   myPAtt.Destroy();    // free buffer
+  myDeferredAttributes.Clear();
+  myNbDeferredAttributes = 0;
   myRelocTable.Clear();
   myMapUnsupported.Clear();
 }
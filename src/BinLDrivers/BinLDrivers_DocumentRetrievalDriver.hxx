@@ -18,8 +18,12 @@
 
 #include <Standard.hxx>
 
+#include <BinMDF_ADriver.hxx>
 #include <BinObjMgt_Persistent.hxx>
 #include <BinObjMgt_RRelocationTable.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <TDF_Attribute.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <BinLDrivers_VectorOfDocumentSection.hxx>
 #include <PCDM_RetrievalDriver.hxx>
@@ -35,6 +39,7 @@ class CDM_Document;
 class CDM_Application;
 class TDF_Label;
 class BinLDrivers_DocumentSection;
+class TDocStd_Document;
 
 
 class BinLDrivers_DocumentRetrievalDriver;
@@ -113,12 +118,41 @@ protected:
   //! Return true if retrieved document allows to read parts quickly.
   static Standard_Boolean IsQuickPart (const Standard_Integer theFileVer);
 
+  //! Replays the increments appended to the end of the stream by incremental saving
+  //! (see BinLDrivers_DocumentStorageDriver::SetIncrementalMode()) on the read document.
+  //! Increments are not replayed when a part of the document is read or appended
+  //! to another document; types of attributes passed by the filter are respected.
+  Standard_EXPORT virtual void ReadIncrements (Standard_IStream& theIS,
+                                               const Handle(TDocStd_Document)& theDoc,
+                                               const Handle(CDM_Application)& theApplication,
+                                               const Handle(PCDM_ReaderFilter)& theFilter);
+
   //! Enables reading in the quick part access mode.
   Standard_EXPORT virtual void EnableQuickPartReading (const Handle(Message_Messenger)& /*theMessageDriver*/, Standard_Boolean /*theValue*/) {}
 
   Handle(BinMDF_ADriverTable) myDrivers;
   BinObjMgt_RRelocationTable myRelocTable;
   Handle(Message_Messenger) myMsgDriver;
+  TCollection_ExtendedString myFileName; //!< path to the file being read (empty when reading from the stream)
+
+private:
+
+  //! Decodes the deferred attribute records in parallel (see BinMDF_ADriver::IsPasteThreadSafe()).
+  Standard_EXPORT void pasteDeferredAttributes();
+
+private:
+
+  //! Attribute attached to the label which record is decoded later
+  //! together with the other independent records.
+  struct DeferredAttribute
+  {
+    Handle(BinMDF_ADriver) Driver;
+    Handle(TDF_Attribute)  Attribute;
+    BinObjMgt_Persistent   Data;
+    Standard_Boolean       IsPasted;
+  };
+
+  class DeferredPasteFunctor;
 
 private:
 
@@ -127,6 +161,11 @@ private:
   TColStd_MapOfInteger myMapUnsupported;
   BinLDrivers_VectorOfDocumentSection mySections;
   NCollection_Map<Standard_Integer> myUnresolvedLinks;
+  //! Attributes read before the increment being read and referred by it
+  NCollection_DataMap<Standard_Integer, Handle(TDF_Attribute)> myIncrementReferences;
+  //! Buffers of the attribute records deferred for parallel decoding; reused between batches
+  NCollection_Vector<DeferredAttribute> myDeferredAttributes;
+  Standard_Integer myNbDeferredAttributes;
 
 
 };
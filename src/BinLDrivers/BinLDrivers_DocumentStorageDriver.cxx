@@ -33,7 +33,12 @@
 #include <TDF_AttributeIterator.hxx>
 #include <TDF_ChildIterator.hxx>
 #include <TDF_Data.hxx>
+#include <TDF_Delta.hxx>
 #include <TDF_Label.hxx>
+#include <TDF_ListIteratorOfDeltaList.hxx>
+#include <TDF_AttributeDelta.hxx>
+#include <TDF_ListIteratorOfAttributeDeltaList.hxx>
+#include <TDF_MapIteratorOfLabelMap.hxx>
 #include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
 #include <Message_ProgressScope.hxx>
@@ -49,6 +54,7 @@ IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DocumentStorageDriver,PCDM_StorageDriver)
 //=======================================================================
 
 BinLDrivers_DocumentStorageDriver::BinLDrivers_DocumentStorageDriver()
+: myIsIncremental (Standard_False)
 {
 }
 
@@ -67,6 +73,30 @@ void BinLDrivers_DocumentStorageDriver::Write
 
   myFileName = theFileName;
 
+  Handle(TDocStd_Document) aDoc = Handle(TDocStd_Document)::DownCast (theDocument);
+  if (myIsIncremental
+  && !aDoc.IsNull()
+  &&  CollectModifiedLabels (aDoc, theFileName))
+  {
+    if (WriteIncrement (aDoc, theFileName, theRange))
+    {
+      return;
+    }
+
+    // the file cannot be updated, so that it is rewritten
+    SetIsError (Standard_False);
+    SetStoreStatus (PCDM_SS_OK);
+    myFileName = theFileName;
+  }
+
+  // the data read on demand from the file should be loaded before the file is truncated
+  if (!DetachFromFile (theFileName))
+  {
+    SetIsError (Standard_True);
+    SetStoreStatus (PCDM_SS_Failure);
+    return;
+  }
+
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::ostream> aFileStream = aFileSystem->OpenOStream (theFileName, std::ios::out | std::ios::binary);
 
@@ -191,7 +221,26 @@ void BinLDrivers_DocumentStorageDriver::Write (const Handle(CDM_Document)&  theD
     myEmptyLabels.Clear();
     myMapUnsupported.Clear();
 
-    if (!myRelocTable.Extent()) {
+    if (!myIncrementPath.IsEmpty())
+    {
+      // attributes written before the increment and referred by it
+      myIncrementReferences.Clear();
+      for (Standard_Integer anId = 1; anId <= myRelocTable.Extent(); ++anId)
+      {
+        Handle(TDF_Attribute) anAtt = Handle(TDF_Attribute)::DownCast (myRelocTable.FindKey (anId));
+        if (!anAtt.IsNull()
+         && !anAtt->Label().IsNull()
+         && !myIncrementLabels.Contains (anAtt->Label()))
+        {
+          BinLDrivers_DocumentIncrement::Reference aRef;
+          aRef.Id = anId;
+          aRef.AttributeId = anAtt->ID();
+          TDF_Tool::Entry (anAtt->Label(), aRef.Entry);
+          myIncrementReferences.Append (aRef);
+        }
+      }
+    }
+    else if (!myRelocTable.Extent()) {
       // No objects written
 #ifdef OCCT_DEBUG
       myMsgDriver->Send ("BinLDrivers_DocumentStorageDriver, no objects written", Message_Info);
@@ -256,6 +305,9 @@ void BinLDrivers_DocumentStorageDriver::WriteSubTree
     myEmptyLabels.RemoveFirst();
     return;
   }
+  // Skip labels not modified since the last saving when writing the increment
+  if (!myIncrementPath.IsEmpty() && !myIncrementPath.Contains (theLabel))
+    return;
   Message_ProgressScope aPS(theRange, "Writing sub tree", 2, true);
   // Write label header: tag
   Standard_Integer aTag = theLabel.Tag();
@@ -271,9 +323,10 @@ void BinLDrivers_DocumentStorageDriver::WriteSubTree
     aPosition->WriteSize (theOS, Standard_True);
   }
 
-  // Write attributes
+  // Write attributes (only attributes of modified labels are written to the increment)
+  const Standard_Boolean toWriteAttributes = myIncrementPath.IsEmpty() || myIncrementLabels.Contains (theLabel);
   TDF_AttributeIterator itAtt (theLabel);
-  for ( ; itAtt.More() && theOS && aPS.More(); itAtt.Next()) {
+  for ( ; toWriteAttributes && itAtt.More() && theOS && aPS.More(); itAtt.Next()) {
     const Handle(TDF_Attribute) tAtt = itAtt.Value();
     const Handle(Standard_Type)& aType = tAtt->DynamicType();
     // Get type ID and driver
@@ -412,7 +465,22 @@ void BinLDrivers_DocumentStorageDriver::FirstPass
   myTypesMap.Clear();
   myEmptyLabels.Clear();
 
-  if (FirstPassSubTree( theRoot, myEmptyLabels))
+  if (!myIncrementLabels.IsEmpty())
+  {
+    // only types of attributes of modified labels are written to the increment
+    for (TDF_MapIteratorOfLabelMap aLabIter (myIncrementLabels); aLabIter.More(); aLabIter.Next())
+    {
+      for (TDF_AttributeIterator itAtt (aLabIter.Key()); itAtt.More(); itAtt.Next())
+      {
+        const Handle(Standard_Type)& aType = itAtt.Value()->DynamicType();
+        Handle(BinMDF_ADriver) aDriver;
+        myDrivers->GetDriver (aType, aDriver);
+        if (!aDriver.IsNull())
+          myTypesMap.Add (aType);
+      }
+    }
+  }
+  else if (FirstPassSubTree( theRoot, myEmptyLabels))
     myEmptyLabels.Append( theRoot );
 
   myDrivers->AssignIds (myTypesMap);
@@ -619,3 +687,145 @@ void BinLDrivers_DocumentStorageDriver::WriteSizes (Standard_OStream& theOS)
     anIter.Value()->WriteSize (theOS);
   mySizesToWrite.Clear();
 }
+
+//=======================================================================
+//function : Compact
+//purpose  :
+//=======================================================================
+void BinLDrivers_DocumentStorageDriver::Compact (const Handle(CDM_Document)&       theDocument,
+                                                 const TCollection_ExtendedString& theFileName,
+                                                 const Message_ProgressRange&      theRange)
+{
+  const Standard_Boolean isIncremental = myIsIncremental;
+  myIsIncremental = Standard_False;
+  Write (theDocument, theFileName, theRange);
+  myIsIncremental = isIncremental;
+}
+
+//=======================================================================
+//function : CollectModifiedLabels
+//purpose  :
+//=======================================================================
+Standard_Boolean BinLDrivers_DocumentStorageDriver::CollectModifiedLabels
+                         (const Handle(TDocStd_Document)&   theDoc,
+                          const TCollection_ExtendedString& theFileName)
+{
+  myIncrementLabels.Clear();
+  myIncrementPath.Clear();
+  if (!theDoc->IsSaved()
+   || !theDoc->GetPath().IsEqual (theFileName)
+   ||  theDoc->HasOpenCommand()
+   ||  theDoc->GetUndoLimit() <= 0
+   ||  theDoc->HasUntrackedModifications())
+  {
+    // modifications made outside of commands are not recorded in the deltas
+    return Standard_False;
+  }
+
+  // the deltas committed since the last saving should cover the whole period without gaps
+  const Standard_Integer aSavedTime = theDoc->GetSavedTime();
+  const Standard_Integer aTime = theDoc->GetData()->Time();
+  if (aTime < aSavedTime)
+  {
+    return Standard_False;
+  }
+
+  Standard_Integer aCoveredTime = aSavedTime;
+  for (TDF_ListIteratorOfDeltaList aDeltaIter (theDoc->GetUndos()); aDeltaIter.More(); aDeltaIter.Next())
+  {
+    const Handle(TDF_Delta)& aDelta = aDeltaIter.Value();
+    if (aDelta->EndTime() <= aSavedTime)
+    {
+      continue;
+    }
+    if (aDelta->BeginTime() != aCoveredTime)
+    {
+      myIncrementLabels.Clear();
+      return Standard_False;
+    }
+
+    for (TDF_ListIteratorOfAttributeDeltaList anAttIter (aDelta->AttributeDeltas()); anAttIter.More(); anAttIter.Next())
+    {
+      myIncrementLabels.Add (anAttIter.Value()->Label());
+    }
+    aCoveredTime = aDelta->EndTime();
+  }
+  if (aCoveredTime != aTime)
+  {
+    myIncrementLabels.Clear();
+    return Standard_False;
+  }
+
+  for (TDF_MapIteratorOfLabelMap aLabIter (myIncrementLabels); aLabIter.More(); aLabIter.Next())
+  {
+    for (TDF_Label aLab = aLabIter.Key(); !aLab.IsNull() && myIncrementPath.Add (aLab); aLab = aLab.Father())
+    {
+      //
+    }
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : WriteIncrement
+//purpose  :
+//=======================================================================
+Standard_Boolean BinLDrivers_DocumentStorageDriver::WriteIncrement
+                         (const Handle(TDocStd_Document)&   theDoc,
+                          const TCollection_ExtendedString& theFileName,
+                          const Message_ProgressRange&      theRange)
+{
+  if (myIncrementLabels.IsEmpty())
+  {
+    // nothing has been modified since the last saving
+    return Standard_True;
+  }
+
+  // find the index of the last increment appended to the file
+  const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  BinLDrivers_DocumentIncrement anIncrement;
+  {
+    std::shared_ptr<std::istream> anIStream = aFileSystem->OpenIStream (theFileName, std::ios::in | std::ios::binary);
+    if (anIStream.get() == NULL || !anIStream->good())
+    {
+      myIncrementLabels.Clear();
+      myIncrementPath.Clear();
+      return Standard_False;
+    }
+
+    anIStream->seekg (0, std::ios_base::end);
+    const uint64_t aFileSize = (uint64_t )anIStream->tellg();
+    BinLDrivers_DocumentIncrement aLastIncrement;
+    anIncrement.SetIndex (aLastIncrement.Read (*anIStream, aFileSize) ? aLastIncrement.Index() + 1 : 1);
+  }
+
+  for (TDF_MapIteratorOfLabelMap aLabIter (myIncrementLabels); aLabIter.More(); aLabIter.Next())
+  {
+    TCollection_AsciiString anEntry;
+    TDF_Tool::Entry (aLabIter.Key(), anEntry);
+    anIncrement.ChangeLabels().Append (anEntry);
+  }
+
+  Standard_Boolean isDone = Standard_False;
+  std::shared_ptr<std::ostream> anOStream = aFileSystem->OpenOStream (theFileName, std::ios::in | std::ios::out | std::ios::binary);
+  if (anOStream.get() != NULL && anOStream->good())
+  {
+    anOStream->seekp (0, std::ios_base::end);
+    anIncrement.SetOffset ((uint64_t )anOStream->tellp());
+    Write (theDoc, *anOStream, theRange);
+    if (!IsError())
+    {
+      // the sizes of labels have been written in place, so that the stream is moved back to its end
+      anOStream->seekp (0, std::ios_base::end);
+      anIncrement.ChangeReferences() = myIncrementReferences;
+      anIncrement.Write (*anOStream);
+      anOStream->flush();
+      isDone = anOStream->good();
+    }
+  }
+
+  myIncrementLabels.Clear();
+  myIncrementPath.Clear();
+  myIncrementReferences.Clear();
+  return isDone;
+}
@@ -18,9 +18,11 @@
 
 #include <Standard.hxx>
 
+#include <BinLDrivers_DocumentIncrement.hxx>
 #include <BinObjMgt_Persistent.hxx>
 #include <BinObjMgt_SRelocationTable.hxx>
 #include <TDF_LabelList.hxx>
+#include <TDF_LabelMap.hxx>
 #include <TColStd_MapOfTransient.hxx>
 #include <TColStd_IndexedMapOfTransient.hxx>
 #include <BinLDrivers_VectorOfDocumentSection.hxx>
@@ -35,6 +37,7 @@ class TDF_Label;
 class TCollection_AsciiString;
 class BinLDrivers_DocumentSection;
 class BinObjMgt_Position;
+class TDocStd_Document;
 
 
 class BinLDrivers_DocumentStorageDriver;
@@ -50,7 +53,9 @@ public:
   //! Constructor
   Standard_EXPORT BinLDrivers_DocumentStorageDriver();
     
-  //! Write <theDocument> to the binary file <theFileName>
+  //! Write <theDocument> to the binary file <theFileName>.
+  //! In the incremental mode, only the labels modified since the last saving
+  //! are appended to the file (see SetIncrementalMode()).
   Standard_EXPORT virtual void Write (const Handle(CDM_Document)& theDocument, 
                                       const TCollection_ExtendedString& theFileName, 
                                       const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
@@ -68,6 +73,32 @@ public:
   //! Return true if document should be stored in quick mode for partial reading
   Standard_EXPORT Standard_Boolean IsQuickPart (const Standard_Integer theVersion) const;
 
+  //! Returns true if the document is saved incrementally (false by default).
+  Standard_Boolean IsIncrementalMode() const { return myIsIncremental; }
+
+  //! Sets the incremental mode of saving the document into the file it has been saved to
+  //! (or read from) last time. In this mode Write() appends to the end of the file an increment
+  //! (BinLDrivers_DocumentIncrement) containing only the labels modified since the last saving,
+  //! which are determined from the undo deltas of the document; increments are replayed
+  //! by BinLDrivers_DocumentRetrievalDriver when the file is read.
+  //! The whole file is rewritten when modifications cannot be determined: the document
+  //! is saved into another file, has an open command, has been undone beyond the last saving,
+  //! or more commands have been committed than kept by the undo limit (which should be positive).
+  //! Modifications made outside of commands are not tracked by the undo deltas,
+  //! so that the whole file is rewritten if there are such modifications since the last saving.
+  //! Shapes of the increment are written into the own shape section of the increment and
+  //! do not refer to the sub-shapes (TShapes) stored before, so that the sharing of sub-shapes
+  //! between the increment and the previously stored shapes is lost when the file is read.
+  //! Rewrite the whole file (see Compact()) to keep such sharing.
+  void SetIncrementalMode (const Standard_Boolean theIsIncremental) { myIsIncremental = theIsIncremental; }
+
+  //! Rewrites the whole file <theFileName> removing the increments appended to it
+  //! by incremental saving, regardless of the incremental mode.
+  //! The data of the document read on demand from this file is loaded before the file is rewritten.
+  Standard_EXPORT void Compact (const Handle(CDM_Document)& theDocument,
+                                const TCollection_ExtendedString& theFileName,
+                                const Message_ProgressRange& theRange = Message_ProgressRange());
+
 
   DEFINE_STANDARD_RTTIEXT(BinLDrivers_DocumentStorageDriver,PCDM_StorageDriver)
 
@@ -98,6 +129,10 @@ protected:
   //! clears the writing-cash data in drivers if any.
   Standard_EXPORT virtual void Clear();
 
+  //! Releases the data read on demand from the file <theFileName> before the file is rewritten.
+  //! Returns false if the data cannot be released. Does nothing by default.
+  virtual Standard_Boolean DetachFromFile (const TCollection_ExtendedString& /*theFileName*/) { return Standard_True; }
+
   Handle(BinMDF_ADriverTable) myDrivers;
   BinObjMgt_SRelocationTable myRelocTable;
   Handle(Message_Messenger) myMsgDriver;
@@ -118,6 +153,17 @@ private:
   //! Writes sizes along the file where it is needed for quick part mode
   Standard_EXPORT void WriteSizes (Standard_OStream& theOS);
 
+  //! Collects the labels modified since the last saving of the document into the file
+  //! from the undo deltas. Returns false if modifications cannot be determined.
+  Standard_EXPORT Standard_Boolean CollectModifiedLabels (const Handle(TDocStd_Document)& theDoc,
+                                                          const TCollection_ExtendedString& theFileName);
+
+  //! Appends the increment with collected modified labels to the file.
+  //! Returns false if the file cannot be updated.
+  Standard_EXPORT Standard_Boolean WriteIncrement (const Handle(TDocStd_Document)& theDoc,
+                                                   const TCollection_ExtendedString& theFileName,
+                                                   const Message_ProgressRange& theRange);
+
   BinObjMgt_Persistent myPAtt;
   TDF_LabelList myEmptyLabels;
   TColStd_MapOfTransient myMapUnsupported;
@@ -126,6 +172,13 @@ private:
   TCollection_ExtendedString myFileName;
   //! Sizes of labels and some attributes that will be stored in the second pass
   NCollection_List<Handle(BinObjMgt_Position)> mySizesToWrite;
+  //! Labels modified since the last saving (written to the increment with attributes)
+  TDF_LabelMap myIncrementLabels;
+  //! Modified labels and their ancestors (written to the increment)
+  TDF_LabelMap myIncrementPath;
+  //! Attributes written before the increment and referred by it
+  NCollection_Sequence<BinLDrivers_DocumentIncrement::Reference> myIncrementReferences;
+  Standard_Boolean myIsIncremental;
 };
 
 #endif // _BinLDrivers_DocumentStorageDriver_HeaderFile
@@ -56,6 +56,13 @@ public:
   //! <aRelocTable> to keep the sharings.
   Standard_EXPORT virtual void Paste (const Handle(TDF_Attribute)& aSource, BinObjMgt_Persistent& aTarget, BinObjMgt_SRelocationTable& aRelocTable) const = 0;
 
+  //! Returns true if the retrieval Paste() only decodes the persistent data
+  //! into the given attribute without access to its label, to other attributes,
+  //! to the relocation table (except the header data) and to the message driver.
+  //! Attributes of such drivers may be decoded concurrently while reading the document
+  //! (see BinLDrivers_DocumentRetrievalDriver). Returns false by default.
+  virtual Standard_Boolean IsPasteThreadSafe() const { return Standard_False; }
+
   //! Returns the current message driver of this driver
   const Handle(Message_Messenger)& MessageDriver() const { return myMessageDriver; }
 
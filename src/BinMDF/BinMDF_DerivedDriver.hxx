@@ -45,6 +45,10 @@ public:
     return aResult;
   }
 
+  //! Returns true if the base driver is thread-safe;
+  //! AfterRetrieval() of the derivative is expected to synchronize only its own content in this case
+  virtual Standard_Boolean IsPasteThreadSafe() const Standard_OVERRIDE { return myBaseDirver->IsPasteThreadSafe(); }
+
   //! Reuses the base driver to store the base fields
   virtual void Paste (const Handle(TDF_Attribute)& theSource,
                       BinObjMgt_Persistent& theTarget,
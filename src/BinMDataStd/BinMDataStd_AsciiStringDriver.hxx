@@ -42,6 +42,9 @@ public:
   
   //! persistent -> transient (retrieve)
   Standard_EXPORT Standard_Boolean Paste (const BinObjMgt_Persistent& Source, const Handle(TDF_Attribute)& Target, BinObjMgt_RRelocationTable& RelocTable) const Standard_OVERRIDE;
+
+  //! Returns true as the attribute is decoded without access to the document.
+  virtual Standard_Boolean IsPasteThreadSafe() const Standard_OVERRIDE { return Standard_True; }
   
   //! transient -> persistent (store)
   Standard_EXPORT void Paste (const Handle(TDF_Attribute)& Source, BinObjMgt_Persistent& Target, BinObjMgt_SRelocationTable& RelocTable) const Standard_OVERRIDE;
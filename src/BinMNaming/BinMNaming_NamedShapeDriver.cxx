@@ -149,7 +149,8 @@ BinMNaming_NamedShapeDriver::BinMNaming_NamedShapeDriver
        myShapeSet (NULL),
        myWithTriangles (Standard_False),
        myWithNormals  (Standard_False),
-       myIsQuickPart (Standard_False)
+       myIsQuickPart (Standard_False),
+       myMinNbDeferredTriangles (0)
 {
 }
 
@@ -324,7 +325,8 @@ void BinMNaming_NamedShapeDriver::WriteShapeSection (Standard_OStream& theOS,
     ShapeSet (Standard_False)->SetFormatNb (BinTools_FormatVersion_VERSION_1);
   }
   ShapeSet (Standard_False)->Write (theOS, theRange);
-  ShapeSet (Standard_False)->Clear();
+  // the shape set of this kind should not be reused by the next quick part writing
+  Clear();
 }
 
 //=======================================================================
@@ -359,12 +361,28 @@ void BinMNaming_NamedShapeDriver::ReadShapeSection (Standard_IStream& theIS,
   if(aSectionTitle.Length() > 0 && aSectionTitle == SHAPESET) {
     BinTools_ShapeSetBase* aShapeSet = ShapeSet (Standard_True);
     aShapeSet->Clear();
+    static_cast<BinTools_ShapeSet*>(aShapeSet)->SetDeferredTriangulations (myDeferredFile, myMinNbDeferredTriangles,
+                                                                          myTriangulationCache);
     aShapeSet->Read (theIS, theRange);
   }
   else
     theIS.seekg (aPos); // no shape section is present, try to return to initial point
 }
 
+//=======================================================================
+//function : SetDeferredTriangulations
+//purpose  : 
+//=======================================================================
+
+void BinMNaming_NamedShapeDriver::SetDeferredTriangulations (const TCollection_AsciiString& theFilePath,
+                                                             const Standard_Integer theMinNbTriangles,
+                                                             const Handle(BinTools_TriangulationCache)& theCache)
+{
+  myDeferredFile = theFilePath;
+  myMinNbDeferredTriangles = theMinNbTriangles;
+  myTriangulationCache = theCache;
+}
+
 //=======================================================================
 //function : ShapeSet
 //purpose  : 
@@ -377,7 +395,11 @@ BinTools_ShapeSetBase* BinMNaming_NamedShapeDriver::ShapeSet (const Standard_Boo
     if (myIsQuickPart)
     {
       if (theReading)
-        myShapeSet = new BinTools_ShapeReader();
+      {
+        BinTools_ShapeReader* aReader = new BinTools_ShapeReader();
+        aReader->SetDeferredTriangulations (myDeferredFile, myMinNbDeferredTriangles, myTriangulationCache);
+        myShapeSet = aReader;
+      }
       else
         myShapeSet = new BinTools_ShapeWriter();
     }
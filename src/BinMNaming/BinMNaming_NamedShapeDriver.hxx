@@ -72,6 +72,16 @@ public:
   //! get the shapes locations
   Standard_EXPORT BinTools_LocationSet& GetShapesLocations() const;
 
+  //! Enables reading of large triangulations of the shapes section or of the attributes
+  //! (quick part access) as deferred ones, which data is loaded from the document file on demand
+  //! (see BinTools_ShapeSet::SetDeferredTriangulations()).
+  //! @param[in] theFilePath       path to the document file (empty string disables deferred reading)
+  //! @param[in] theMinNbTriangles minimal number of triangles of deferred triangulation
+  //! @param[in] theCache          cache limiting the memory occupied by loaded triangulations (optional)
+  Standard_EXPORT void SetDeferredTriangulations (const TCollection_AsciiString& theFilePath,
+                                                  const Standard_Integer theMinNbTriangles,
+                                                  const Handle(BinTools_TriangulationCache)& theCache);
+
   //! Sets the flag for quick part of the document access: shapes are stored in the attribute.
   Standard_EXPORT void EnableQuickPart(const Standard_Boolean theValue) { myIsQuickPart = theValue; }
   //! Returns true if quick part of the document access is enabled: shapes are stored in the attribute.
@@ -91,6 +101,9 @@ private:
   Standard_Boolean myWithNormals;
   //! Enables storing of whole shape data just in the attribute, not in a separated shapes section
   Standard_Boolean myIsQuickPart;
+  TCollection_AsciiString myDeferredFile; //!< document file to load deferred triangulations from
+  Handle(BinTools_TriangulationCache) myTriangulationCache;
+  Standard_Integer myMinNbDeferredTriangles;
 
 };
 
@@ -41,6 +41,9 @@ public:
                                                  const Handle(TDF_Attribute)& theTarget,
                                                  BinObjMgt_RRelocationTable& theRelocTable) const Standard_OVERRIDE;
 
+  //! Returns true as the attribute is decoded without access to the document.
+  virtual Standard_Boolean IsPasteThreadSafe() const Standard_OVERRIDE { return Standard_True; }
+
   Standard_EXPORT virtual void Paste(const Handle(TDF_Attribute)& theSource,
                                      BinObjMgt_Persistent& theTarget,
                                      BinObjMgt_SRelocationTable& theRelocTable) const Standard_OVERRIDE;
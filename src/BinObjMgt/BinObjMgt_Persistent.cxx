@@ -180,6 +180,22 @@ Standard_IStream& BinObjMgt_Persistent::Read (Standard_IStream& theIS)
   return theIS;
 }
 
+//=======================================================================
+//function : Swap
+//purpose  : Exchanges the data with theOther
+//=======================================================================
+
+void BinObjMgt_Persistent::Swap (BinObjMgt_Persistent& theOther)
+{
+  std::swap (myData,                   theOther.myData);
+  std::swap (myIndex,                  theOther.myIndex);
+  std::swap (myOffset,                 theOther.myOffset);
+  std::swap (mySize,                   theOther.mySize);
+  std::swap (myIsError,                theOther.myIsError);
+  std::swap (myDirectWritingIsEnabled, theOther.myDirectWritingIsEnabled);
+  std::swap (myStreamStart,            theOther.myStreamStart);
+}
+
 //=======================================================================
 //function : Destroy
 //purpose  : Frees the allocated memory
@@ -265,6 +265,10 @@ const BinObjMgt_Persistent& operator >> (Standard_GUID& theValue) const
   
   //! Initializes me to reuse again
   Standard_EXPORT void Init();
+
+  //! Exchanges the data with theOther without copying;
+  //! the streams set for the direct writing and reading are not exchanged
+  Standard_EXPORT void Swap (BinObjMgt_Persistent& theOther);
   
   //! Sets the Id of the object
     void SetId (const Standard_Integer theId);
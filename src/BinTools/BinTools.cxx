@@ -15,6 +15,7 @@
 
 
 #include <BinTools.hxx>
+#include <BinTools_DeferredTriangulation.hxx>
 #include <BinTools_ShapeSet.hxx>
 #include <FSD_FileHeader.hxx>
 #include <OSD_FileSystem.hxx>
@@ -214,6 +215,10 @@ Standard_Boolean BinTools::Write (const TopoDS_Shape& theShape,
                                   const BinTools_FormatVersion theVersion,
                                   const Message_ProgressRange& theRange)
 {
+  // the triangulations read on demand from the file should be loaded before the file is truncated
+  if (!BinTools_DeferredTriangulation::DetachFromFile (theFile))
+    return Standard_False;
+
   const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::ostream> aStream = aFileSystem->OpenOStream (theFile, std::ios::out | std::ios::binary);
   aStream->precision (15);
@@ -243,3 +248,27 @@ Standard_Boolean BinTools::Read (TopoDS_Shape& theShape, const Standard_CString
   Read (theShape, *aStream, theRange);
   return aStream->good();
 }
+
+//=======================================================================
+//function : Read
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools::Read (TopoDS_Shape& theShape, const Standard_CString theFile,
+                                 const Standard_Integer theMinNbDeferredTriangles,
+                                 const Handle(BinTools_TriangulationCache)& theCache,
+                                 const Message_ProgressRange& theRange)
+{
+  const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (theFile, std::ios::in | std::ios::binary);
+  if (aStream.get() == NULL)
+  {
+    return Standard_False;
+  }
+
+  BinTools_ShapeSet aShapeSet;
+  aShapeSet.SetWithTriangles (Standard_True);
+  aShapeSet.SetDeferredTriangulations (theFile, theMinNbDeferredTriangles, theCache);
+  aShapeSet.Read (*aStream, theRange);
+  aShapeSet.ReadSubs (theShape, *aStream, aShapeSet.NbShapes());
+  return aStream->good();
+}
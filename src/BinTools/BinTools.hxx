@@ -25,6 +25,7 @@
 #include <Message_ProgressRange.hxx>
 
 class TopoDS_Shape;
+class BinTools_TriangulationCache;
 
 
 //! Tool to keep shapes in binary format
@@ -119,6 +120,20 @@ public:
     (TopoDS_Shape& theShape, const Standard_CString theFile,
      const Message_ProgressRange& theRange = Message_ProgressRange());
 
+  //! Reads a shape from <theFile> and returns it in <theShape>.
+  //! Triangulations having at least theMinNbDeferredTriangles triangles are not loaded,
+  //! their data is read from the file on demand (see BinTools_DeferredTriangulation).
+  //! @param[out] theShape                 the shape read
+  //! @param[in] theFile                   the path to file to read shape from
+  //! @param[in] theMinNbDeferredTriangles minimal number of triangles of deferred triangulation
+  //! @param[in] theCache                  cache limiting the memory occupied by loaded triangulations (optional)
+  //! @param theRange                      the range of progress indicator to fill in
+  Standard_EXPORT static Standard_Boolean Read
+    (TopoDS_Shape& theShape, const Standard_CString theFile,
+     const Standard_Integer theMinNbDeferredTriangles,
+     const Handle(BinTools_TriangulationCache)& theCache,
+     const Message_ProgressRange& theRange = Message_ProgressRange());
+
 };
 
 #endif // _BinTools_HeaderFile
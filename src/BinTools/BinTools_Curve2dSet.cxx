@@ -16,6 +16,7 @@
 
 #include <BinTools.hxx>
 #include <BinTools_Curve2dSet.hxx>
+#include <BinTools_RecordTable.hxx>
 #include <Geom2d_BezierCurve.hxx>
 #include <Geom2d_BSplineCurve.hxx>
 #include <Geom2d_Circle.hxx>
@@ -334,6 +335,43 @@ void  BinTools_Curve2dSet::Write (Standard_OStream& OS,
   }
 }
 
+namespace
+{
+  //! Writer of the 2D curve record.
+  class Curve2dRecordWriter
+  {
+  public:
+    Curve2dRecordWriter (const Handle(Geom2d_Curve)& theCurve2d) : myCurve2d (theCurve2d) {}
+
+    void Write (Standard_OStream& theOS) const
+    {
+      BinTools_OStream aStream (theOS);
+      BinTools_Curve2dSet::WriteCurve2d (myCurve2d, aStream);
+    }
+
+  private:
+    const Handle(Geom2d_Curve)& myCurve2d;
+  };
+}
+
+//=======================================================================
+//function : WriteRecords
+//purpose  : 
+//=======================================================================
+
+void BinTools_Curve2dSet::WriteRecords (Standard_OStream& OS,
+                                        const Message_ProgressRange& theRange) const
+{
+  const Standard_Integer aNbItems = myMap.Extent();
+  Message_ProgressScope aPS (theRange, "Writing 2D curves", aNbItems);
+  OS << "Curve2ds " << aNbItems << "\n";
+  for (Standard_Integer anIter = 1; anIter <= aNbItems && aPS.More(); ++anIter, aPS.Next())
+  {
+    const Handle(Geom2d_Curve) anItem = Handle(Geom2d_Curve)::DownCast (myMap (anIter));
+    BinTools_RecordTable<Geom2d_Curve>::WriteRecord (OS, Curve2dRecordWriter (anItem));
+  }
+}
+
 
 //=======================================================================
 //function : ReadPnt2d
@@ -698,3 +736,39 @@ void  BinTools_Curve2dSet::Read (Standard_IStream& IS,
     myMap.Add(C);
   }
 }
+
+//=======================================================================
+//function : ReadRecords
+//purpose  : 
+//=======================================================================
+
+void BinTools_Curve2dSet::ReadRecords (Standard_IStream& IS,
+                                       const Message_ProgressRange& theRange)
+{
+  char aBuffer[255];
+  IS >> aBuffer;
+  if (IS.fail() || strcmp (aBuffer, "Curve2ds"))
+  {
+    throw Standard_Failure ("BinTools_Curve2dSet::ReadRecords: Not a Curve2d table");
+  }
+
+  Standard_Integer aNbItems = 0;
+  IS >> aNbItems;
+  IS.get(); // remove <lf>
+  if (IS.fail() || aNbItems < 0)
+  {
+    throw Standard_Failure ("BinTools_Curve2dSet::ReadRecords: wrong size of Curve2d table");
+  }
+
+  Message_ProgressScope aPS (theRange, "Reading 2D curves", 1);
+  NCollection_Array1<Handle(Geom2d_Curve)> anItems (1, aNbItems);
+  BinTools_RecordTable<Geom2d_Curve>::Read (IS, anItems, &BinTools_Curve2dSet::ReadCurve2d, aPS.Next());
+  if (!aPS.More())
+  {
+    return;
+  }
+  for (Standard_Integer anIter = 1; anIter <= aNbItems; ++anIter)
+  {
+    myMap.Add (anItems.Value (anIter));
+  }
+}
@@ -68,6 +68,17 @@ public:
   Standard_EXPORT void Read (Standard_IStream& IS,
                              const Message_ProgressRange& theRange = Message_ProgressRange());
   
+  //! Writes the content of me on the stream <OS> as a table of
+  //! size-prefixed records (BinTools_FormatVersion_VERSION_5 and later)
+  //! that can be read back by ReadRecords.
+  Standard_EXPORT void WriteRecords (Standard_OStream& OS,
+                                     const Message_ProgressRange& theRange = Message_ProgressRange()) const;
+
+  //! Reads the table of records written by WriteRecords from the stream <IS>.
+  //! The records are decoded in parallel threads.
+  Standard_EXPORT void ReadRecords (Standard_IStream& IS,
+                                    const Message_ProgressRange& theRange = Message_ProgressRange());
+  
   //! Dumps the curve on the binary stream, that can be read back.
   Standard_EXPORT static void WriteCurve2d(const Handle(Geom2d_Curve)& C, BinTools_OStream& OS);
   
@@ -16,6 +16,7 @@
 
 #include <BinTools.hxx>
 #include <BinTools_CurveSet.hxx>
+#include <BinTools_RecordTable.hxx>
 #include <Geom_BezierCurve.hxx>
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_Circle.hxx>
@@ -343,6 +344,43 @@ void  BinTools_CurveSet::Write (Standard_OStream& OS,
   }
 }
 
+namespace
+{
+  //! Writer of the curve record.
+  class CurveRecordWriter
+  {
+  public:
+    CurveRecordWriter (const Handle(Geom_Curve)& theCurve) : myCurve (theCurve) {}
+
+    void Write (Standard_OStream& theOS) const
+    {
+      BinTools_OStream aStream (theOS);
+      BinTools_CurveSet::WriteCurve (myCurve, aStream);
+    }
+
+  private:
+    const Handle(Geom_Curve)& myCurve;
+  };
+}
+
+//=======================================================================
+//function : WriteRecords
+//purpose  : 
+//=======================================================================
+
+void BinTools_CurveSet::WriteRecords (Standard_OStream& OS,
+                                      const Message_ProgressRange& theRange) const
+{
+  const Standard_Integer aNbItems = myMap.Extent();
+  Message_ProgressScope aPS (theRange, "Writing curves", aNbItems);
+  OS << "Curves " << aNbItems << "\n";
+  for (Standard_Integer anIter = 1; anIter <= aNbItems && aPS.More(); ++anIter, aPS.Next())
+  {
+    const Handle(Geom_Curve) anItem = Handle(Geom_Curve)::DownCast (myMap (anIter));
+    BinTools_RecordTable<Geom_Curve>::WriteRecord (OS, CurveRecordWriter (anItem));
+  }
+}
+
 
 //=======================================================================
 //function : ReadPnt
@@ -714,3 +752,39 @@ void  BinTools_CurveSet::Read (Standard_IStream& IS,
     myMap.Add(C);
   }
 }
+
+//=======================================================================
+//function : ReadRecords
+//purpose  : 
+//=======================================================================
+
+void BinTools_CurveSet::ReadRecords (Standard_IStream& IS,
+                                     const Message_ProgressRange& theRange)
+{
+  char aBuffer[255];
+  IS >> aBuffer;
+  if (IS.fail() || strcmp (aBuffer, "Curves"))
+  {
+    throw Standard_Failure ("BinTools_CurveSet::ReadRecords: Not a Curve table");
+  }
+
+  Standard_Integer aNbItems = 0;
+  IS >> aNbItems;
+  IS.get(); // remove <lf>
+  if (IS.fail() || aNbItems < 0)
+  {
+    throw Standard_Failure ("BinTools_CurveSet::ReadRecords: wrong size of Curve table");
+  }
+
+  Message_ProgressScope aPS (theRange, "Reading curves", 1);
+  NCollection_Array1<Handle(Geom_Curve)> anItems (1, aNbItems);
+  BinTools_RecordTable<Geom_Curve>::Read (IS, anItems, &BinTools_CurveSet::ReadCurve, aPS.Next());
+  if (!aPS.More())
+  {
+    return;
+  }
+  for (Standard_Integer anIter = 1; anIter <= aNbItems; ++anIter)
+  {
+    myMap.Add (anItems.Value (anIter));
+  }
+}
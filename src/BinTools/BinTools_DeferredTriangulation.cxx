@@ -0,0 +1,242 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_DeferredTriangulation.hxx>
+
+#include <BinTools_ShapeSet.hxx>
+#include <Message.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Map.hxx>
+#include <OSD_FileSystem.hxx>
+#include <OSD_Path.hxx>
+#include <OSD_Process.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Mutex.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BinTools_DeferredTriangulation, Poly_Triangulation)
+
+namespace
+{
+  //! Triangulations which data can be loaded from the file.
+  static NCollection_Map<BinTools_DeferredTriangulation*>& attachedTriangulations()
+  {
+    static NCollection_Map<BinTools_DeferredTriangulation*> THE_TRIANGULATIONS;
+    return THE_TRIANGULATIONS;
+  }
+
+  //! Mutex protecting the map of attached triangulations.
+  static Standard_Mutex& attachedTriangulationsMutex()
+  {
+    static Standard_Mutex THE_MUTEX;
+    return THE_MUTEX;
+  }
+
+  //! Returns the absolute path to the file to compare paths given relatively to the current directory.
+  static TCollection_AsciiString absolutePath (const TCollection_AsciiString& thePath)
+  {
+    if (!OSD_Path::IsRelativePath (thePath.ToCString()))
+    {
+      return thePath;
+    }
+    TCollection_AsciiString aCurrentDir;
+    OSD_Process().CurrentDirectory().SystemName (aCurrentDir);
+    return OSD_Path::AbsolutePath (aCurrentDir, thePath);
+  }
+}
+
+//=======================================================================
+//function : BinTools_DeferredTriangulation
+//purpose  :
+//=======================================================================
+BinTools_DeferredTriangulation::BinTools_DeferredTriangulation (const TCollection_AsciiString& theFilePath,
+                                                                const int64_t theOffset,
+                                                                const Standard_Integer theNbNodes,
+                                                                const Standard_Integer theNbTriangles,
+                                                                const Standard_Boolean theHasUVNodes,
+                                                                const Standard_Boolean theHasNormals,
+                                                                const Handle(BinTools_TriangulationCache)& theCache)
+: myFilePath (theFilePath),
+  myCache (theCache),
+  myOffset (theOffset),
+  myNbDefNodes (theNbNodes),
+  myNbDefTriangles (theNbTriangles),
+  myHasDefUVNodes (theHasUVNodes),
+  myHasDefNormals (theHasNormals)
+{
+  if (!myFilePath.IsEmpty())
+  {
+    Standard_Mutex::Sentry aSentry (attachedTriangulationsMutex());
+    attachedTriangulations().Add (this);
+  }
+}
+
+//=======================================================================
+//function : ~BinTools_DeferredTriangulation
+//purpose  :
+//=======================================================================
+BinTools_DeferredTriangulation::~BinTools_DeferredTriangulation()
+{
+  {
+    Standard_Mutex::Sentry aSentry (attachedTriangulationsMutex());
+    attachedTriangulations().Remove (this);
+  }
+  if (!myCache.IsNull())
+  {
+    myCache->Unregister (this);
+  }
+}
+
+//=======================================================================
+//function : LoadDeferredData
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_DeferredTriangulation::LoadDeferredData (const Handle(OSD_FileSystem)& theFileSystem)
+{
+  if (!myCache.IsNull()
+    && HasGeometry()
+    && myCache->Touch (this))
+  {
+    return Standard_True;
+  }
+  return Poly_Triangulation::LoadDeferredData (theFileSystem);
+}
+
+//=======================================================================
+//function : UnloadDeferredData
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_DeferredTriangulation::UnloadDeferredData()
+{
+  if (!myCache.IsNull())
+  {
+    myCache->Unregister (this);
+  }
+  return Poly_Triangulation::UnloadDeferredData();
+}
+
+//=======================================================================
+//function : loadDeferredData
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_DeferredTriangulation::loadDeferredData (const Handle(OSD_FileSystem)& theFileSystem,
+                                                                   const Handle(Poly_Triangulation)& theDestTriangulation) const
+{
+  const Handle(OSD_FileSystem)& aFileSystem = !theFileSystem.IsNull() ? theFileSystem : OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (myFilePath, std::ios::in | std::ios::binary, myOffset);
+  if (aStream.get() == NULL)
+  {
+    Message::SendFail (TCollection_AsciiString ("Error: unable to open file '") + myFilePath + "' to load triangulation");
+    return Standard_False;
+  }
+
+  try
+  {
+    OCC_CATCH_SIGNALS
+    theDestTriangulation->ResizeNodes (myNbDefNodes, Standard_False);
+    theDestTriangulation->ResizeTriangles (myNbDefTriangles, Standard_False);
+    if (myHasDefUVNodes)
+    {
+      theDestTriangulation->AddUVNodes();
+    }
+    if (myHasDefNormals)
+    {
+      theDestTriangulation->AddNormals();
+    }
+    theDestTriangulation->Deflection (Deflection());
+    BinTools_ShapeSet::ReadTriangulationData (*aStream, theDestTriangulation);
+  }
+  catch (Standard_Failure const& anException)
+  {
+    Message::SendFail (TCollection_AsciiString ("Error: unable to load triangulation from file '") + myFilePath + "': "
+                     + anException.GetMessageString());
+    theDestTriangulation->Clear();
+    return Standard_False;
+  }
+  if (aStream->fail())
+  {
+    Message::SendFail (TCollection_AsciiString ("Error: unexpected end of file '") + myFilePath + "' while loading triangulation");
+    theDestTriangulation->Clear();
+    return Standard_False;
+  }
+
+  if (!myCache.IsNull()
+    && theDestTriangulation.get() == this)
+  {
+    myCache->Register (const_cast<BinTools_DeferredTriangulation*> (this), DataSize());
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : DetachFromFile
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_DeferredTriangulation::DetachFromFile (const TCollection_AsciiString& theFilePath)
+{
+  const TCollection_AsciiString aFilePath = absolutePath (theFilePath);
+  Standard_Boolean isDone = Standard_True;
+  Standard_Mutex::Sentry aSentry (attachedTriangulationsMutex());
+  NCollection_Map<BinTools_DeferredTriangulation*>& aTriangulations = attachedTriangulations();
+  NCollection_List<BinTools_DeferredTriangulation*> aDetached;
+  NCollection_DataMap<TCollection_AsciiString, Standard_Boolean> aMatchedPaths;
+  for (NCollection_Map<BinTools_DeferredTriangulation*>::Iterator anIter (aTriangulations); anIter.More(); anIter.Next())
+  {
+    BinTools_DeferredTriangulation* aTriangulation = anIter.Value();
+    const Standard_Boolean* isMatched = aMatchedPaths.Seek (aTriangulation->myFilePath);
+    if (isMatched == NULL)
+    {
+      isMatched = aMatchedPaths.Bound (aTriangulation->myFilePath, absolutePath (aTriangulation->myFilePath).IsEqual (aFilePath));
+    }
+    if (*isMatched)
+    {
+      if (aTriangulation->detachFromFile())
+      {
+        aDetached.Append (aTriangulation);
+      }
+      else
+      {
+        isDone = Standard_False;
+      }
+    }
+  }
+  for (NCollection_List<BinTools_DeferredTriangulation*>::Iterator anIter (aDetached); anIter.More(); anIter.Next())
+  {
+    aTriangulations.Remove (anIter.Value());
+  }
+  return isDone;
+}
+
+//=======================================================================
+//function : detachFromFile
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_DeferredTriangulation::detachFromFile()
+{
+  // the loaded data should not be unloaded by the cache anymore
+  if (!myCache.IsNull())
+  {
+    myCache->Unregister (this);
+    myCache.Nullify();
+  }
+  if (NbTriangles() < myNbDefTriangles
+   && !loadDeferredData (Handle(OSD_FileSystem)(), this))
+  {
+    return Standard_False;
+  }
+  SetMeshPurpose (MeshPurpose() | Poly_MeshPurpose_Loaded);
+  myFilePath.Clear();
+  myNbDefNodes = 0;
+  myNbDefTriangles = 0;
+  return Standard_True;
+}
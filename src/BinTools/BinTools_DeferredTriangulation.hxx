@@ -0,0 +1,108 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_DeferredTriangulation_HeaderFile
+#define _BinTools_DeferredTriangulation_HeaderFile
+
+#include <BinTools_TriangulationCache.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Triangulation read from the binary file (BinTools_ShapeSet) without data.
+//! Nodes, triangles, UV nodes and normals are loaded from the file on demand
+//! by LoadDeferredData() and can be released by UnloadDeferredData().
+//! Loaded triangulations can be registered within the cache
+//! limiting the memory occupied by them.
+class BinTools_DeferredTriangulation : public Poly_Triangulation
+{
+  DEFINE_STANDARD_RTTIEXT(BinTools_DeferredTriangulation, Poly_Triangulation)
+public:
+
+  //! Creates the triangulation which data is stored in the file.
+  //! @param[in] theFilePath    path to the file
+  //! @param[in] theOffset      offset of triangulation data (nodes) within the file
+  //! @param[in] theNbNodes     number of nodes
+  //! @param[in] theNbTriangles number of triangles
+  //! @param[in] theHasUVNodes  flag indicating that UV nodes are stored
+  //! @param[in] theHasNormals  flag indicating that normals are stored
+  //! @param[in] theCache       cache limiting the memory occupied by loaded data (optional)
+  Standard_EXPORT BinTools_DeferredTriangulation (const TCollection_AsciiString& theFilePath,
+                                                  const int64_t theOffset,
+                                                  const Standard_Integer theNbNodes,
+                                                  const Standard_Integer theNbTriangles,
+                                                  const Standard_Boolean theHasUVNodes,
+                                                  const Standard_Boolean theHasNormals,
+                                                  const Handle(BinTools_TriangulationCache)& theCache);
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BinTools_DeferredTriangulation();
+
+  //! Returns path to the file.
+  const TCollection_AsciiString& FilePath() const { return myFilePath; }
+
+  //! Returns offset of triangulation data within the file.
+  int64_t Offset() const { return myOffset; }
+
+  //! Returns the cache limiting the memory occupied by loaded data.
+  const Handle(BinTools_TriangulationCache)& Cache() const { return myCache; }
+
+  //! Loads the data of all triangulations which are read on demand from specified file
+  //! and detaches them from the file, so that the file can be rewritten.
+  //! Detached triangulations keep the data and are not registered within the cache.
+  //! Should be called before rewriting the file the shapes have been read from.
+  //! @param[in] theFilePath  path to the file
+  //! @return FALSE if data of some triangulation cannot be loaded
+  Standard_EXPORT static Standard_Boolean DetachFromFile (const TCollection_AsciiString& theFilePath);
+
+public: //! @name late-load deferred data interface
+
+  //! Returns number of nodes for deferred loading.
+  virtual Standard_Integer NbDeferredNodes() const Standard_OVERRIDE { return myNbDefNodes; }
+
+  //! Returns number of triangles for deferred loading.
+  virtual Standard_Integer NbDeferredTriangles() const Standard_OVERRIDE { return myNbDefTriangles; }
+
+  //! Loads triangulation data from the file.
+  //! If the data registered within the cache is already loaded, it is not read again
+  //! and the triangulation becomes the most recently used one within the cache.
+  Standard_EXPORT virtual Standard_Boolean LoadDeferredData (const Handle(OSD_FileSystem)& theFileSystem = Handle(OSD_FileSystem)()) Standard_OVERRIDE;
+
+  //! Releases triangulation data and removes it from the cache.
+  Standard_EXPORT virtual Standard_Boolean UnloadDeferredData() Standard_OVERRIDE;
+
+protected:
+
+  //! Loads triangulation data from the file using specified shared input file system.
+  Standard_EXPORT virtual Standard_Boolean loadDeferredData (const Handle(OSD_FileSystem)& theFileSystem,
+                                                             const Handle(Poly_Triangulation)& theDestTriangulation) const Standard_OVERRIDE;
+
+protected:
+
+  //! Loads the data and detaches the triangulation from the file.
+  Standard_Boolean detachFromFile();
+
+protected:
+
+  TCollection_AsciiString             myFilePath;
+  Handle(BinTools_TriangulationCache) myCache;
+  int64_t                             myOffset;
+  Standard_Integer                    myNbDefNodes;
+  Standard_Integer                    myNbDefTriangles;
+  Standard_Boolean                    myHasDefUVNodes;
+  Standard_Boolean                    myHasDefNormals;
+
+};
+
+DEFINE_STANDARD_HANDLE(BinTools_DeferredTriangulation, Poly_Triangulation)
+
+#endif // _BinTools_DeferredTriangulation_HeaderFile
@@ -26,13 +26,15 @@ enum BinTools_FormatVersion
   BinTools_FormatVersion_VERSION_4 = 4, //!< Stores per-vertex normal information in case
                                         //!  of triangulation-only Faces, because
                                         //!  no analytical geometry to restore normals
+  BinTools_FormatVersion_VERSION_5 = 5, //!< Stores geometry and triangulations as tables of size-prefixed
+                                        //!  records, which are decoded in parallel threads on reading
   BinTools_FormatVersion_CURRENT = BinTools_FormatVersion_VERSION_4 //!< Current version
 };
 
 enum
 {
   BinTools_FormatVersion_LOWER   = BinTools_FormatVersion_VERSION_1,
-  BinTools_FormatVersion_UPPER   = BinTools_FormatVersion_VERSION_4
+  BinTools_FormatVersion_UPPER   = BinTools_FormatVersion_VERSION_5
 };
 
 #endif
@@ -0,0 +1,162 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_RecordTable_HeaderFile
+#define _BinTools_RecordTable_HeaderFile
+
+#include <BinTools.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ArrayStreamBuffer.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+#include <Standard_Integer.hxx>
+
+#include <sstream>
+#include <vector>
+
+//! Tool for tables of objects stored as records prefixed by their sizes
+//! (binary format BinTools_FormatVersion_VERSION_5 and later).
+//! On reading, all records of the table are loaded into memory at once
+//! and decoded in parallel threads, as they don't depend on each other.
+template<class TheItemType>
+class BinTools_RecordTable
+{
+public:
+
+  //! Function decoding an object from the stream.
+  typedef Standard_IStream& (*ItemReader) (Standard_IStream& theIS, Handle(TheItemType)& theItem);
+
+  //! Writes the record filled by the writer into the stream.
+  //! Throws Standard_Failure if the record does not fit into the 32-bit size prefix.
+  //! @param[in] theOS     output stream
+  //! @param[in] theWriter functor with method Write (Standard_OStream&) writing the object
+  template<class TheWriter>
+  static void WriteRecord (Standard_OStream& theOS, const TheWriter& theWriter)
+  {
+    std::ostringstream aRecordStream (std::ios::out | std::ios::binary);
+    theWriter.Write (aRecordStream);
+    const std::string aRecord = aRecordStream.str();
+    if (aRecordStream.fail()
+     || aRecord.size() > static_cast<size_t> (IntegerLast()))
+    {
+      throw Standard_Failure ("BinTools_RecordTable::WriteRecord: record is too large");
+    }
+    BinTools::PutInteger (theOS, static_cast<Standard_Integer> (aRecord.size()));
+    theOS.write (aRecord.c_str(), static_cast<std::streamsize> (aRecord.size()));
+  }
+
+  //! Reads the records and decodes objects of the table in parallel threads.
+  //! @param[in]  theIS     input stream positioned at the first record
+  //! @param[out] theItems  decoded objects, the array defines the number of records
+  //! @param[in]  theReader function decoding one object
+  //! @param[in]  theRange  progress indicator
+  static void Read (Standard_IStream& theIS,
+                    NCollection_Array1<Handle(TheItemType)>& theItems,
+                    ItemReader theReader,
+                    const Message_ProgressRange& theRange)
+  {
+    Message_ProgressScope aPS (theRange, "Reading records", 2);
+    const Standard_Integer aNbItems = theItems.Size();
+    NCollection_Array1<Standard_Size> anOffsets (0, aNbItems);
+    std::vector<char> aData;
+    anOffsets.ChangeFirst() = 0;
+    for (Standard_Integer anItemIter = 1; anItemIter <= aNbItems; ++anItemIter)
+    {
+      Standard_Integer aSize = 0;
+      BinTools::GetInteger (theIS, aSize);
+      if (theIS.fail() || aSize < 0)
+      {
+        throw Standard_Failure ("BinTools_RecordTable::Read: wrong record size");
+      }
+
+      const Standard_Size anOffset = anOffsets.Value (anItemIter - 1);
+      anOffsets.ChangeValue (anItemIter) = anOffset + aSize;
+      aData.resize (anOffset + aSize);
+      if (aSize > 0)
+      {
+        theIS.read (&aData[anOffset], aSize);
+      }
+      if (theIS.fail())
+      {
+        throw Standard_Failure ("BinTools_RecordTable::Read: unexpected end of stream");
+      }
+    }
+    aPS.Next();
+    if (!aPS.More())
+    {
+      return;
+    }
+
+    NCollection_Array1<Standard_Boolean> aStatuses (theItems.Lower(), theItems.Upper());
+    aStatuses.Init (Standard_False);
+    RecordDecoder aDecoder (aData.empty() ? NULL : &aData.front(), anOffsets, theReader, theItems, aStatuses);
+    OSD_Parallel::For (0, aNbItems, aDecoder, aNbItems < 2);
+    for (Standard_Integer anItemIter = theItems.Lower(); anItemIter <= theItems.Upper(); ++anItemIter)
+    {
+      if (!aStatuses.Value (anItemIter))
+      {
+        throw Standard_Failure ("BinTools_RecordTable::Read: record cannot be decoded");
+      }
+    }
+    aPS.Next();
+  }
+
+private:
+
+  //! Functor decoding records in parallel threads.
+  class RecordDecoder
+  {
+  public:
+    //! Main constructor.
+    RecordDecoder (const char* theData,
+                   const NCollection_Array1<Standard_Size>& theOffsets,
+                   ItemReader theReader,
+                   NCollection_Array1<Handle(TheItemType)>& theItems,
+                   NCollection_Array1<Standard_Boolean>& theStatuses)
+    : myData (theData), myOffsets (theOffsets), myReader (theReader), myItems (theItems), myStatuses (theStatuses) {}
+
+    //! Decodes the record with specified zero-based index.
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Standard_Integer anItemIndex = myItems.Lower() + theIndex;
+      const Standard_Size anOffset = myOffsets.Value (theIndex);
+      Standard_ArrayStreamBuffer aBuffer (myData + anOffset, myOffsets.Value (theIndex + 1) - anOffset);
+      Standard_IStream aStream (&aBuffer);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        myReader (aStream, myItems.ChangeValue (anItemIndex));
+        myStatuses.ChangeValue (anItemIndex) = !aStream.fail();
+      }
+      catch (Standard_Failure const&)
+      {
+        myItems.ChangeValue (anItemIndex).Nullify();
+      }
+    }
+
+  private:
+    RecordDecoder& operator= (const RecordDecoder&);
+
+  private:
+    const char* myData;
+    const NCollection_Array1<Standard_Size>& myOffsets;
+    ItemReader myReader;
+    NCollection_Array1<Handle(TheItemType)>& myItems;
+    NCollection_Array1<Standard_Boolean>& myStatuses;
+  };
+
+};
+
+#endif // _BinTools_RecordTable_HeaderFile
@@ -15,6 +15,8 @@
 
 #include <BinTools_Curve2dSet.hxx>
 #include <BinTools_CurveSet.hxx>
+#include <BinTools_DeferredTriangulation.hxx>
+#include <BinTools_ShapeSet.hxx>
 #include <BinTools_SurfaceSet.hxx>
 #include <BRep_Builder.hxx>
 #include <BRep_PointOnCurve.hxx>
@@ -27,6 +29,7 @@
 //purpose  : 
 //=======================================================================
 BinTools_ShapeReader::BinTools_ShapeReader()
+: myMinNbDeferredTriangles (0)
 {}
   
 //=======================================================================
@@ -561,8 +564,23 @@ Handle(Poly_Triangulation) BinTools_ShapeReader::ReadTriangulation (BinTools_ISt
     Standard_Integer aNbTriangles = theStream.ReadInteger();
     Standard_Boolean aHasUV = theStream.ReadBool();
     Standard_Boolean aHasNormals = theStream.ReadBool();
+    const Standard_Real aDeflection = theStream.ReadReal();
+    if (!myDeferredFile.IsEmpty()
+      && aNbTriangles > 0
+      && aNbTriangles >= myMinNbDeferredTriangles)
+    {
+      // keep only position of the data to load it on demand
+      aResult = new BinTools_DeferredTriangulation (myDeferredFile, int64_t (theStream.Position()),
+                                                    aNbNodes, aNbTriangles, aHasUV, aHasNormals,
+                                                    myTriangulationCache);
+      aResult->Deflection (aDeflection);
+      theStream.GoTo (theStream.Position()
+                    + BinTools_ShapeSet::TriangulationDataSize (aNbNodes, aNbTriangles, aHasUV, aHasNormals));
+      myTriangulationPos.Bind (aPosition, aResult);
+      return aResult;
+    }
     aResult = new Poly_Triangulation (aNbNodes, aNbTriangles, aHasUV, aHasNormals);
-    aResult->Deflection (theStream.ReadReal());
+    aResult->Deflection (aDeflection);
     for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
       aResult->SetNode(aNodeIter, theStream.ReadPnt());
     if (aHasUV)
@@ -600,3 +618,16 @@ Handle(Poly_Triangulation) BinTools_ShapeReader::ReadTriangulation (BinTools_ISt
   }
   return aResult;
 }
+
+//=======================================================================
+//function : SetDeferredTriangulations
+//purpose  :
+//=======================================================================
+void BinTools_ShapeReader::SetDeferredTriangulations (const TCollection_AsciiString& theFilePath,
+                                                      const Standard_Integer theMinNbTriangles,
+                                                      const Handle(BinTools_TriangulationCache)& theCache)
+{
+  myDeferredFile = theFilePath;
+  myMinNbDeferredTriangles = theMinNbTriangles;
+  myTriangulationCache = theCache;
+}
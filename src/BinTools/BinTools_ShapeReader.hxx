@@ -16,7 +16,9 @@
 
 #include <BinTools_ShapeSetBase.hxx>
 #include <BinTools_IStream.hxx>
+#include <BinTools_TriangulationCache.hxx>
 #include <NCollection_DataMap.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <TopLoc_Location.hxx>
 #include <TopoDS_Shape.hxx>
 
@@ -49,6 +51,17 @@ public:
   //! Reads location from the stream.
   Standard_EXPORT const TopLoc_Location* ReadLocation (BinTools_IStream& theStream);
 
+  //! Enables reading of large triangulations as BinTools_DeferredTriangulation
+  //! keeping only the position of their data within the file
+  //! (see BinTools_ShapeSet::SetDeferredTriangulations()).
+  //! The stream passed to Read() should be opened on the same file from its beginning.
+  //! @param[in] theFilePath       path to the file being read (empty string disables deferred reading)
+  //! @param[in] theMinNbTriangles minimal number of triangles of deferred triangulation
+  //! @param[in] theCache          cache limiting the memory occupied by loaded triangulations (optional)
+  Standard_EXPORT void SetDeferredTriangulations (const TCollection_AsciiString& theFilePath,
+                                                  const Standard_Integer theMinNbTriangles,
+                                                  const Handle(BinTools_TriangulationCache)& theCache = Handle(BinTools_TriangulationCache)());
+
 private:
   //! Reads the shape from stream using previously restored shapes and objects by references.
   TopoDS_Shape ReadShape (BinTools_IStream& theStream);
@@ -74,6 +87,10 @@ private:
   NCollection_DataMap<uint64_t, Handle(Poly_Polygon3D)> myPolygon3dPos;
   NCollection_DataMap<uint64_t, Handle(Poly_PolygonOnTriangulation)> myPolygonPos;
   NCollection_DataMap<uint64_t, Handle(Poly_Triangulation)> myTriangulationPos;
+
+  TCollection_AsciiString myDeferredFile; //!< file to load deferred triangulations from
+  Handle(BinTools_TriangulationCache) myTriangulationCache;
+  Standard_Integer myMinNbDeferredTriangles;
 };
 
 #endif // _BinTools_ShapeReader_HeaderFile
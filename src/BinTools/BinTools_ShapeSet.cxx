@@ -16,6 +16,8 @@
 
 #include <BinTools.hxx>
 #include <BinTools_Curve2dSet.hxx>
+#include <BinTools_DeferredTriangulation.hxx>
+#include <BinTools_RecordTable.hxx>
 #include <BinTools_ShapeSet.hxx>
 #include <BinTools_SurfaceSet.hxx>
 #include <BRep_CurveOnClosedSurface.hxx>
@@ -53,7 +55,8 @@
 //purpose  :
 //=======================================================================
 BinTools_ShapeSet::BinTools_ShapeSet ()
-  : BinTools_ShapeSetBase ()
+  : BinTools_ShapeSetBase (),
+    myMinNbDeferredTriangles (0)
 {}
 
 //=======================================================================
@@ -270,10 +273,17 @@ void  BinTools_ShapeSet::WriteGeometry (Standard_OStream& OS,
                                         const Message_ProgressRange& theRange)const
 {
   Message_ProgressScope aPS(theRange, "Writing geometry", 6);
-  myCurves2d.Write(OS, aPS.Next());
+  const Standard_Boolean isRecords = FormatNb() >= BinTools_FormatVersion_VERSION_5;
+  if (isRecords)
+    myCurves2d.WriteRecords(OS, aPS.Next());
+  else
+    myCurves2d.Write(OS, aPS.Next());
   if (!aPS.More())
     return;
-  myCurves.Write(OS, aPS.Next());
+  if (isRecords)
+    myCurves.WriteRecords(OS, aPS.Next());
+  else
+    myCurves.Write(OS, aPS.Next());
   if (!aPS.More())
     return;
   WritePolygon3D(OS, aPS.Next());
@@ -282,7 +292,10 @@ void  BinTools_ShapeSet::WriteGeometry (Standard_OStream& OS,
   WritePolygonOnTriangulation(OS, aPS.Next());
   if (!aPS.More())
     return;
-  mySurfaces.Write(OS, aPS.Next());
+  if (isRecords)
+    mySurfaces.WriteRecords(OS, aPS.Next());
+  else
+    mySurfaces.Write(OS, aPS.Next());
   if (!aPS.More())
     return;
   WriteTriangulation(OS, aPS.Next());
@@ -534,11 +547,19 @@ void BinTools_ShapeSet::ReadGeometry (Standard_IStream& IS,
 {
 
   Message_ProgressScope aPS(theRange, "Reading geometry", 6);
-  myCurves2d.Read(IS, aPS.Next());
+  // since version 5 the tables are stored as records decoded in parallel threads
+  const Standard_Boolean isRecords = FormatNb() >= BinTools_FormatVersion_VERSION_5;
+  if (isRecords)
+    myCurves2d.ReadRecords(IS, aPS.Next());
+  else
+    myCurves2d.Read(IS, aPS.Next());
   if (!aPS.More())
     return;
 
-  myCurves.Read(IS, aPS.Next());
+  if (isRecords)
+    myCurves.ReadRecords(IS, aPS.Next());
+  else
+    myCurves.Read(IS, aPS.Next());
   if (!aPS.More())
     return;
 
@@ -550,7 +571,10 @@ void BinTools_ShapeSet::ReadGeometry (Standard_IStream& IS,
   if (!aPS.More())
     return;
 
-  mySurfaces.Read(IS, aPS.Next());
+  if (isRecords)
+    mySurfaces.ReadRecords(IS, aPS.Next());
+  else
+    mySurfaces.Read(IS, aPS.Next());
   if (!aPS.More())
     return;
 
@@ -1419,6 +1443,138 @@ void BinTools_ShapeSet::ReadPolygon3D (Standard_IStream& IS,
 }
 
 
+namespace
+{
+  //! Writes the triangulation data into the stream.
+  void writeTriangulation (Standard_OStream& theOS,
+                           const Handle(Poly_Triangulation)& theTriangulation,
+                           const Standard_Integer theFormatNb,
+                           const Standard_Boolean theToWriteNormals)
+  {
+    Handle(Poly_Triangulation) aTriangulation = theTriangulation;
+    if (!aTriangulation->HasGeometry()
+      && aTriangulation->HasDeferredData())
+    {
+      // the data has not been loaded yet
+      aTriangulation = theTriangulation->DetachedLoadDeferredData();
+      if (aTriangulation.IsNull())
+      {
+        throw Standard_Failure ("BinTools_ShapeSet::WriteTriangulation: deferred triangulation data cannot be loaded");
+      }
+    }
+
+    const Standard_Integer aNbNodes     = aTriangulation->NbNodes();
+    const Standard_Integer aNbTriangles = aTriangulation->NbTriangles();
+    BinTools::PutInteger(theOS, aNbNodes);
+    BinTools::PutInteger(theOS, aNbTriangles);
+    BinTools::PutBool(theOS, aTriangulation->HasUVNodes() ? 1 : 0);
+    if (theFormatNb >= BinTools_FormatVersion_VERSION_4)
+    {
+      BinTools::PutBool(theOS, (aTriangulation->HasNormals() && theToWriteNormals) ? 1 : 0);
+    }
+    BinTools::PutReal(theOS, aTriangulation->Deflection());
+
+    // write the 3d nodes
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      const gp_Pnt aPnt = aTriangulation->Node (aNodeIter);
+      BinTools::PutReal(theOS, aPnt.X());
+      BinTools::PutReal(theOS, aPnt.Y());
+      BinTools::PutReal(theOS, aPnt.Z());
+    }
+
+    if (aTriangulation->HasUVNodes())
+    {
+      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        const gp_Pnt2d aUV = aTriangulation->UVNode (aNodeIter);
+        BinTools::PutReal(theOS, aUV.X());
+        BinTools::PutReal(theOS, aUV.Y());
+      }
+    }
+
+    for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    {
+      const Poly_Triangle aTri = aTriangulation->Triangle (aTriIter);
+      BinTools::PutInteger(theOS, aTri.Value (1));
+      BinTools::PutInteger(theOS, aTri.Value (2));
+      BinTools::PutInteger(theOS, aTri.Value (3));
+    }
+
+    // write the normals
+    if (theFormatNb >= BinTools_FormatVersion_VERSION_4)
+    {
+      if (aTriangulation->HasNormals() && theToWriteNormals)
+      {
+        gp_Vec3f aNormal;
+        for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+        {
+          aTriangulation->Normal (aNormalIter, aNormal);
+          BinTools::PutShortReal (theOS, aNormal.x());
+          BinTools::PutShortReal (theOS, aNormal.y());
+          BinTools::PutShortReal (theOS, aNormal.z());
+        }
+      }
+    }
+  }
+
+  //! Reads the triangulation header from the stream.
+  void readTriangulationHeader (Standard_IStream& theIS,
+                                const Standard_Integer theFormatNb,
+                                Standard_Integer& theNbNodes,
+                                Standard_Integer& theNbTriangles,
+                                Standard_Boolean& theHasUV,
+                                Standard_Boolean& theHasNormals,
+                                Standard_Real& theDeflection)
+  {
+    theNbNodes = 0;
+    theNbTriangles = 0;
+    theHasUV = Standard_False;
+    theHasNormals = Standard_False;
+    theDeflection = 0.0;
+    BinTools::GetInteger(theIS, theNbNodes);
+    BinTools::GetInteger(theIS, theNbTriangles);
+    BinTools::GetBool(theIS, theHasUV);
+    if (theFormatNb >= BinTools_FormatVersion_VERSION_4)
+    {
+      BinTools::GetBool(theIS, theHasNormals);
+    }
+    BinTools::GetReal(theIS, theDeflection); //deflection
+  }
+
+  //! Reads the triangulation record (BinTools_FormatVersion_VERSION_5 and later).
+  Standard_IStream& readTriangulationRecord (Standard_IStream& theIS,
+                                             Handle(Poly_Triangulation)& theTriangulation)
+  {
+    Standard_Integer aNbNodes = 0, aNbTriangles = 0;
+    Standard_Boolean hasUV = Standard_False, hasNormals = Standard_False;
+    Standard_Real aDefl = 0.0;
+    readTriangulationHeader (theIS, BinTools_FormatVersion_VERSION_5, aNbNodes, aNbTriangles, hasUV, hasNormals, aDefl);
+    theTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
+    theTriangulation->Deflection (aDefl);
+    BinTools_ShapeSet::ReadTriangulationData (theIS, theTriangulation);
+    return theIS;
+  }
+
+  //! Writer of the triangulation record.
+  class TriangulationRecordWriter
+  {
+  public:
+    TriangulationRecordWriter (const Handle(Poly_Triangulation)& theTriangulation,
+                               const Standard_Boolean theToWriteNormals)
+    : myTriangulation (theTriangulation), myToWriteNormals (theToWriteNormals) {}
+
+    void Write (Standard_OStream& theOS) const
+    {
+      writeTriangulation (theOS, myTriangulation, BinTools_FormatVersion_VERSION_5, myToWriteNormals);
+    }
+
+  private:
+    const Handle(Poly_Triangulation)& myTriangulation;
+    Standard_Boolean myToWriteNormals;
+  };
+}
+
 //=======================================================================
 //function : WriteTriangulation
 //purpose  :
@@ -1437,58 +1593,13 @@ void BinTools_ShapeSet::WriteTriangulation (Standard_OStream& OS,
     {
       const Handle(Poly_Triangulation)& aTriangulation = myTriangulations.FindKey (aTriangulationIter);
       Standard_Boolean NeedToWriteNormals = myTriangulations.FindFromIndex(aTriangulationIter);
-      const Standard_Integer aNbNodes     = aTriangulation->NbNodes();
-      const Standard_Integer aNbTriangles = aTriangulation->NbTriangles();
-      BinTools::PutInteger(OS, aNbNodes);
-      BinTools::PutInteger(OS, aNbTriangles);
-      BinTools::PutBool(OS, aTriangulation->HasUVNodes() ? 1 : 0);
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        BinTools::PutBool(OS, (aTriangulation->HasNormals() && NeedToWriteNormals) ? 1 : 0);
-      }
-      BinTools::PutReal(OS, aTriangulation->Deflection());
-
-      // write the 3d nodes
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        const gp_Pnt aPnt = aTriangulation->Node (aNodeIter);
-        BinTools::PutReal(OS, aPnt.X());
-        BinTools::PutReal(OS, aPnt.Y());
-        BinTools::PutReal(OS, aPnt.Z());
-      }
-
-      if (aTriangulation->HasUVNodes())
+      if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
       {
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          const gp_Pnt2d aUV = aTriangulation->UVNode (aNodeIter);
-          BinTools::PutReal(OS, aUV.X());
-          BinTools::PutReal(OS, aUV.Y());
-        }
+        BinTools_RecordTable<Poly_Triangulation>::WriteRecord (OS, TriangulationRecordWriter (aTriangulation, NeedToWriteNormals));
       }
-
-      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+      else
       {
-        const Poly_Triangle aTri = aTriangulation->Triangle (aTriIter);
-        BinTools::PutInteger(OS, aTri.Value (1));
-        BinTools::PutInteger(OS, aTri.Value (2));
-        BinTools::PutInteger(OS, aTri.Value (3));
-      }
-
-      // write the normals
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        if (aTriangulation->HasNormals() && NeedToWriteNormals)
-        {
-          gp_Vec3f aNormal;
-          for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
-          {
-            aTriangulation->Normal (aNormalIter, aNormal);
-            BinTools::PutShortReal (OS, aNormal.x());
-            BinTools::PutShortReal (OS, aNormal.y());
-            BinTools::PutShortReal (OS, aNormal.z());
-          }
-        }
+        writeTriangulation (OS, aTriangulation, FormatNb(), NeedToWriteNormals);
       }
     }
   }
@@ -1521,67 +1632,63 @@ void BinTools_ShapeSet::ReadTriangulation (Standard_IStream& IS,
   try
   {
     OCC_CATCH_SIGNALS
-    Message_ProgressScope aPS(theRange, "Reading triangulation", aNbTriangulations);
-    for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More(); ++aTriangulationIter, aPS.Next())
+    const Standard_Boolean isRecords = FormatNb() >= BinTools_FormatVersion_VERSION_5;
+    if (isRecords
+     && myDeferredFile.IsEmpty())
     {
-      Standard_Integer aNbNodes = 0, aNbTriangles = 0;
-      Standard_Boolean hasUV = Standard_False;
-      Standard_Boolean hasNormals = Standard_False;
-      Standard_Real aDefl = 0.0;
-      BinTools::GetInteger(IS, aNbNodes);
-      BinTools::GetInteger(IS, aNbTriangles);
-      BinTools::GetBool(IS, hasUV);
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
+      // records are decoded in parallel threads
+      Message_ProgressScope aPS(theRange, "Reading triangulation", 1);
+      NCollection_Array1<Handle(Poly_Triangulation)> aTriangulations (1, aNbTriangulations);
+      BinTools_RecordTable<Poly_Triangulation>::Read (IS, aTriangulations, &readTriangulationRecord, aPS.Next());
+      if (!aPS.More())
       {
-        BinTools::GetBool(IS, hasNormals);
+        return;
       }
-      BinTools::GetReal(IS, aDefl); //deflection
-      Handle(Poly_Triangulation) aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
-      aTriangulation->Deflection (aDefl);
-
-      gp_Pnt aNode;
-      for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations; ++aTriangulationIter)
       {
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (1));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (2));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (3));
-        aTriangulation->SetNode (aNodeIter, aNode);
+        const Handle(Poly_Triangulation)& aTriangulation = aTriangulations.Value (aTriangulationIter);
+        myTriangulations.Add (aTriangulation, aTriangulation->HasNormals());
       }
+      return;
+    }
 
-      if (hasUV)
+    Message_ProgressScope aPS(theRange, "Reading triangulation", aNbTriangulations);
+    for (Standard_Integer aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More(); ++aTriangulationIter, aPS.Next())
+    {
+      if (isRecords)
       {
-        gp_Pnt2d aNode2d;
-        for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (1));
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (2));
-          aTriangulation->SetUVNode (aNodeIter, aNode2d);
-        }
+        // record has the same layout after the size prefix
+        Standard_Integer aRecordSize = 0;
+        BinTools::GetInteger(IS, aRecordSize);
       }
 
-      // read the triangles
-      Standard_Integer aTriNodes[3] = {};
-      for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
-      {
-        BinTools::GetInteger(IS, aTriNodes[0]);
-        BinTools::GetInteger(IS, aTriNodes[1]);
-        BinTools::GetInteger(IS, aTriNodes[2]);
-        aTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
-      }
-      //IS.ignore(sizeof(Standard_Real) * (hasUV ? 5 : 3) * aNbNodes + sizeof(Standard_Integer) * 3 * aNbTriangles);
+      Standard_Integer aNbNodes = 0, aNbTriangles = 0;
+      Standard_Boolean hasUV = Standard_False, hasNormals = Standard_False;
+      Standard_Real aDefl = 0.0;
+      readTriangulationHeader (IS, FormatNb(), aNbNodes, aNbTriangles, hasUV, hasNormals, aDefl);
 
-      if (hasNormals)
+      Handle(Poly_Triangulation) aTriangulation;
+      if (!myDeferredFile.IsEmpty()
+        && aNbTriangles > 0
+        && aNbTriangles >= myMinNbDeferredTriangles)
       {
-        gp_Vec3f aNormal;
-        for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+        // keep only position of the data to load it on demand
+        const std::streampos aDataPos = IS.tellg();
+        if (aDataPos != std::streampos (-1))
         {
-          BinTools::GetShortReal(IS, aNormal.x());
-          BinTools::GetShortReal(IS, aNormal.y());
-          BinTools::GetShortReal(IS, aNormal.z());
-          aTriangulation->SetNormal (aNormalIter, aNormal);
+          aTriangulation = new BinTools_DeferredTriangulation (myDeferredFile, int64_t(aDataPos),
+                                                               aNbNodes, aNbTriangles, hasUV, hasNormals,
+                                                               myTriangulationCache);
+          aTriangulation->Deflection (aDefl);
+          IS.seekg (TriangulationDataSize (aNbNodes, aNbTriangles, hasUV, hasNormals), std::ios::cur);
         }
       }
-
+      if (aTriangulation.IsNull())
+      {
+        aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUV, hasNormals);
+        aTriangulation->Deflection (aDefl);
+        ReadTriangulationData (IS, aTriangulation);
+      }
       myTriangulations.Add (aTriangulation, hasNormals);
     }
   }
@@ -1593,6 +1700,92 @@ void BinTools_ShapeSet::ReadTriangulation (Standard_IStream& IS,
   }
 }
 
+//=======================================================================
+//function : ReadTriangulationData
+//purpose  :
+//=======================================================================
+void BinTools_ShapeSet::ReadTriangulationData (Standard_IStream& IS,
+                                               const Handle(Poly_Triangulation)& theTriangulation)
+{
+  const Standard_Integer aNbNodes     = theTriangulation->NbNodes();
+  const Standard_Integer aNbTriangles = theTriangulation->NbTriangles();
+  gp_Pnt aNode;
+  for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+  {
+    BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (1));
+    BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (2));
+    BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord (3));
+    theTriangulation->SetNode (aNodeIter, aNode);
+  }
+
+  if (theTriangulation->HasUVNodes())
+  {
+    gp_Pnt2d aNode2d;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (1));
+      BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord (2));
+      theTriangulation->SetUVNode (aNodeIter, aNode2d);
+    }
+  }
+
+  // read the triangles
+  Standard_Integer aTriNodes[3] = {};
+  for (Standard_Integer aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+  {
+    BinTools::GetInteger(IS, aTriNodes[0]);
+    BinTools::GetInteger(IS, aTriNodes[1]);
+    BinTools::GetInteger(IS, aTriNodes[2]);
+    theTriangulation->SetTriangle (aTriIter, Poly_Triangle (aTriNodes[0], aTriNodes[1], aTriNodes[2]));
+  }
+
+  if (theTriangulation->HasNormals())
+  {
+    gp_Vec3f aNormal;
+    for (Standard_Integer aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+    {
+      BinTools::GetShortReal(IS, aNormal.x());
+      BinTools::GetShortReal(IS, aNormal.y());
+      BinTools::GetShortReal(IS, aNormal.z());
+      theTriangulation->SetNormal (aNormalIter, aNormal);
+    }
+  }
+}
+
+//=======================================================================
+//function : TriangulationDataSize
+//purpose  :
+//=======================================================================
+int64_t BinTools_ShapeSet::TriangulationDataSize (const Standard_Integer theNbNodes,
+                                                  const Standard_Integer theNbTriangles,
+                                                  const Standard_Boolean theHasUV,
+                                                  const Standard_Boolean theHasNormals)
+{
+  int64_t aNodeSize = 3 * sizeof(Standard_Real);
+  if (theHasUV)
+  {
+    aNodeSize += 2 * sizeof(Standard_Real);
+  }
+  if (theHasNormals)
+  {
+    aNodeSize += 3 * sizeof(Standard_ShortReal);
+  }
+  return aNodeSize * theNbNodes + int64_t(3 * sizeof(Standard_Integer)) * theNbTriangles;
+}
+
+//=======================================================================
+//function : SetDeferredTriangulations
+//purpose  :
+//=======================================================================
+void BinTools_ShapeSet::SetDeferredTriangulations (const TCollection_AsciiString& theFilePath,
+                                                   const Standard_Integer theMinNbTriangles,
+                                                   const Handle(BinTools_TriangulationCache)& theCache)
+{
+  myDeferredFile = theFilePath;
+  myMinNbDeferredTriangles = theMinNbTriangles;
+  myTriangulationCache = theCache;
+}
+
 //=======================================================================
 //function : NbShapes
 //purpose  : 
@@ -24,7 +24,9 @@
 #include <BinTools_SurfaceSet.hxx>
 #include <BinTools_CurveSet.hxx>
 #include <BinTools_Curve2dSet.hxx>
+#include <BinTools_TriangulationCache.hxx>
 #include <TColStd_IndexedMapOfTransient.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <Standard_OStream.hxx>
 #include <Standard_IStream.hxx>
 
@@ -61,6 +63,28 @@ public:
   
   //! Returns number of shapes read from file.
   Standard_EXPORT Standard_Integer NbShapes() const;
+
+  //! Enables reading of large triangulations as BinTools_DeferredTriangulation
+  //! keeping only the position of their data within the file;
+  //! the data is loaded on demand by Poly_Triangulation::LoadDeferredData().
+  //! The stream passed to Read() should be opened on the same file.
+  //! @param[in] theFilePath       path to the file being read (empty string disables deferred reading)
+  //! @param[in] theMinNbTriangles minimal number of triangles of deferred triangulation
+  //! @param[in] theCache          cache limiting the memory occupied by loaded triangulations (optional)
+  Standard_EXPORT void SetDeferredTriangulations (const TCollection_AsciiString& theFilePath,
+                                                  const Standard_Integer theMinNbTriangles,
+                                                  const Handle(BinTools_TriangulationCache)& theCache = Handle(BinTools_TriangulationCache)());
+
+  //! Reads nodes, UV nodes, triangles and normals of the triangulation from the stream.
+  //! The triangulation should be already allocated with expected dimensions and attributes.
+  Standard_EXPORT static void ReadTriangulationData (Standard_IStream& IS,
+                                                     const Handle(Poly_Triangulation)& theTriangulation);
+
+  //! Returns the size in bytes of the triangulation data read by ReadTriangulationData().
+  Standard_EXPORT static int64_t TriangulationDataSize (const Standard_Integer theNbNodes,
+                                                        const Standard_Integer theNbTriangles,
+                                                        const Standard_Boolean theHasUV,
+                                                        const Standard_Boolean theHasNormals);
   
   //! Writes the content of  me  on the stream <OS> in binary
   //! format that can be read back by Read.
@@ -191,6 +215,9 @@ private:
                                                                  //!  to save normals for triangulation
 // clang-format on
   NCollection_IndexedMap<Handle(Poly_PolygonOnTriangulation)> myNodes;
+  TCollection_AsciiString myDeferredFile; //!< file to load deferred triangulations from
+  Handle(BinTools_TriangulationCache) myTriangulationCache;
+  Standard_Integer myMinNbDeferredTriangles;
 };
 
 #endif // _BinTools_ShapeSet_HeaderFile
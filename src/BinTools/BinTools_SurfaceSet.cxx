@@ -17,6 +17,7 @@
 #include <BinTools.hxx>
 #include <BinTools_CurveSet.hxx>
 #include <BinTools_SurfaceSet.hxx>
+#include <BinTools_RecordTable.hxx>
 #include <Geom_BezierSurface.hxx>
 #include <Geom_ConicalSurface.hxx>
 #include <Geom_CylindricalSurface.hxx>
@@ -416,6 +417,43 @@ void  BinTools_SurfaceSet::Write (Standard_OStream& OS,
 
 }
 
+namespace
+{
+  //! Writer of the surface record.
+  class SurfaceRecordWriter
+  {
+  public:
+    SurfaceRecordWriter (const Handle(Geom_Surface)& theSurface) : mySurface (theSurface) {}
+
+    void Write (Standard_OStream& theOS) const
+    {
+      BinTools_OStream aStream (theOS);
+      BinTools_SurfaceSet::WriteSurface (mySurface, aStream);
+    }
+
+  private:
+    const Handle(Geom_Surface)& mySurface;
+  };
+}
+
+//=======================================================================
+//function : WriteRecords
+//purpose  : 
+//=======================================================================
+
+void BinTools_SurfaceSet::WriteRecords (Standard_OStream& OS,
+                                        const Message_ProgressRange& theRange) const
+{
+  const Standard_Integer aNbItems = myMap.Extent();
+  Message_ProgressScope aPS (theRange, "Writing surfaces", aNbItems);
+  OS << "Surfaces " << aNbItems << "\n";
+  for (Standard_Integer anIter = 1; anIter <= aNbItems && aPS.More(); ++anIter, aPS.Next())
+  {
+    const Handle(Geom_Surface) anItem = Handle(Geom_Surface)::DownCast (myMap (anIter));
+    BinTools_RecordTable<Geom_Surface>::WriteRecord (OS, SurfaceRecordWriter (anItem));
+  }
+}
+
 
 //=======================================================================
 //function : ReadPnt
@@ -867,3 +905,39 @@ void  BinTools_SurfaceSet::Read (Standard_IStream& IS,
     myMap.Add(S);
   }
 }
+
+//=======================================================================
+//function : ReadRecords
+//purpose  : 
+//=======================================================================
+
+void BinTools_SurfaceSet::ReadRecords (Standard_IStream& IS,
+                                       const Message_ProgressRange& theRange)
+{
+  char aBuffer[255];
+  IS >> aBuffer;
+  if (IS.fail() || strcmp (aBuffer, "Surfaces"))
+  {
+    throw Standard_Failure ("BinTools_SurfaceSet::ReadRecords: Not a Surface table");
+  }
+
+  Standard_Integer aNbItems = 0;
+  IS >> aNbItems;
+  IS.get(); // remove <lf>
+  if (IS.fail() || aNbItems < 0)
+  {
+    throw Standard_Failure ("BinTools_SurfaceSet::ReadRecords: wrong size of Surface table");
+  }
+
+  Message_ProgressScope aPS (theRange, "Reading surfaces", 1);
+  NCollection_Array1<Handle(Geom_Surface)> anItems (1, aNbItems);
+  BinTools_RecordTable<Geom_Surface>::Read (IS, anItems, &BinTools_SurfaceSet::ReadSurface, aPS.Next());
+  if (!aPS.More())
+  {
+    return;
+  }
+  for (Standard_Integer anIter = 1; anIter <= aNbItems; ++anIter)
+  {
+    myMap.Add (anItems.Value (anIter));
+  }
+}
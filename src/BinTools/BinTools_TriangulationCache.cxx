@@ -0,0 +1,132 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinTools_TriangulationCache.hxx>
+
+#include <Poly_Triangulation.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BinTools_TriangulationCache, Standard_Transient)
+
+//=======================================================================
+//function : BinTools_TriangulationCache
+//purpose  :
+//=======================================================================
+BinTools_TriangulationCache::BinTools_TriangulationCache (const Standard_Size theMemoryLimit)
+: myMemoryLimit (theMemoryLimit),
+  myUsedMemory (0)
+{
+  //
+}
+
+//=======================================================================
+//function : SetMemoryLimit
+//purpose  :
+//=======================================================================
+void BinTools_TriangulationCache::SetMemoryLimit (const Standard_Size theMemoryLimit)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  myMemoryLimit = theMemoryLimit;
+  unloadExceeding();
+}
+
+//=======================================================================
+//function : Register
+//purpose  :
+//=======================================================================
+void BinTools_TriangulationCache::Register (Poly_Triangulation* theTriangulation,
+                                            const Standard_Size theSize)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  for (NCollection_List<Entry>::Iterator anIter (myLoaded); anIter.More(); anIter.Next())
+  {
+    if (anIter.Value().Triangulation == theTriangulation)
+    {
+      myUsedMemory -= anIter.Value().Size;
+      myLoaded.Remove (anIter);
+      break;
+    }
+  }
+
+  Entry anEntry;
+  anEntry.Triangulation = theTriangulation;
+  anEntry.Size = theSize;
+  myLoaded.Append (anEntry);
+  myUsedMemory += theSize;
+  unloadExceeding();
+}
+
+//=======================================================================
+//function : Touch
+//purpose  :
+//=======================================================================
+Standard_Boolean BinTools_TriangulationCache::Touch (const Poly_Triangulation* theTriangulation)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  if (!myLoaded.IsEmpty()
+    && myLoaded.Last().Triangulation == theTriangulation)
+  {
+    return Standard_True;
+  }
+  for (NCollection_List<Entry>::Iterator anIter (myLoaded); anIter.More(); anIter.Next())
+  {
+    if (anIter.Value().Triangulation == theTriangulation)
+    {
+      // move the entry to the end of the list
+      const Entry anEntry = anIter.Value();
+      myLoaded.Remove (anIter);
+      myLoaded.Append (anEntry);
+      return Standard_True;
+    }
+  }
+  return Standard_False;
+}
+
+//=======================================================================
+//function : Unregister
+//purpose  :
+//=======================================================================
+void BinTools_TriangulationCache::Unregister (const Poly_Triangulation* theTriangulation)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  for (NCollection_List<Entry>::Iterator anIter (myLoaded); anIter.More(); anIter.Next())
+  {
+    if (anIter.Value().Triangulation == theTriangulation)
+    {
+      myUsedMemory -= anIter.Value().Size;
+      myLoaded.Remove (anIter);
+      return;
+    }
+  }
+}
+
+//=======================================================================
+//function : unloadExceeding
+//purpose  :
+//=======================================================================
+void BinTools_TriangulationCache::unloadExceeding()
+{
+  if (myMemoryLimit == 0)
+  {
+    return;
+  }
+
+  while (myUsedMemory > myMemoryLimit
+      && myLoaded.Extent() > 1)
+  {
+    // the entry is removed before unloading, so that Unregister() called back does nothing
+    const Entry anEntry = myLoaded.First();
+    myLoaded.RemoveFirst();
+    myUsedMemory -= anEntry.Size;
+    anEntry.Triangulation->UnloadDeferredData();
+  }
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinTools_TriangulationCache_HeaderFile
+#define _BinTools_TriangulationCache_HeaderFile
+
+#include <NCollection_List.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+class Poly_Triangulation;
+
+//! Keeps track of the memory occupied by triangulations loaded on demand
+//! from the binary file (see BinTools_DeferredTriangulation)
+//! and unloads the least recently used ones when the memory limit is exceeded.
+//! The triangulation is used when it is loaded and on each call of
+//! BinTools_DeferredTriangulation::LoadDeferredData() on already loaded data.
+//!
+//! Note that triangulation is unloaded within the thread loading another one,
+//! so that the application accessing the same triangulations
+//! from several threads should define the limit with care.
+class BinTools_TriangulationCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BinTools_TriangulationCache, Standard_Transient)
+public:
+
+  //! Creates the cache with the memory limit in bytes (0 means no limit).
+  Standard_EXPORT BinTools_TriangulationCache (const Standard_Size theMemoryLimit = 0);
+
+  //! Returns the memory limit in bytes (0 means no limit).
+  Standard_Size MemoryLimit() const { return myMemoryLimit; }
+
+  //! Sets the memory limit in bytes (0 means no limit)
+  //! and unloads triangulations exceeding the new limit.
+  Standard_EXPORT void SetMemoryLimit (const Standard_Size theMemoryLimit);
+
+  //! Returns the memory in bytes occupied by registered triangulations.
+  Standard_Size UsedMemory() const { return myUsedMemory; }
+
+  //! Returns the number of registered triangulations.
+  Standard_Integer NbLoaded() const { return myLoaded.Extent(); }
+
+  //! Registers just loaded triangulation occupying specified memory size
+  //! and unloads the least recently used ones exceeding the memory limit.
+  Standard_EXPORT void Register (Poly_Triangulation* theTriangulation,
+                                 const Standard_Size theSize);
+
+  //! Marks the registered triangulation as the most recently used one.
+  //! @return FALSE if the triangulation is not registered (its data is not loaded)
+  Standard_EXPORT Standard_Boolean Touch (const Poly_Triangulation* theTriangulation);
+
+  //! Removes the unloaded or destroyed triangulation from the cache.
+  Standard_EXPORT void Unregister (const Poly_Triangulation* theTriangulation);
+
+private:
+
+  //! Unloads the least recently used triangulations exceeding the memory limit;
+  //! the most recently used triangulation is always kept.
+  void unloadExceeding();
+
+private:
+
+  //! Registered triangulation.
+  struct Entry
+  {
+    Poly_Triangulation* Triangulation;
+    Standard_Size       Size;
+  };
+
+private:
+
+  NCollection_List<Entry> myLoaded;      //!< registered triangulations from the least to the most recently used
+  Standard_Mutex          myMutex;       //!< mutex protecting the list
+  Standard_Size           myMemoryLimit; //!< memory limit in bytes
+  Standard_Size           myUsedMemory;  //!< memory occupied by registered triangulations
+
+};
+
+DEFINE_STANDARD_HANDLE(BinTools_TriangulationCache, Standard_Transient)
+
+#endif // _BinTools_TriangulationCache_HeaderFile
@@ -23,6 +23,8 @@
 #include <BRepTools_ShapeSet.hxx>
 #include <BRepTools_WireExplorer.hxx>
 #include <BinTools.hxx>
+#include <BinTools_DeferredTriangulation.hxx>
+#include <BinTools_TriangulationCache.hxx>
 #include <DBRep_DrawableShape.hxx>
 #include <Draw_Appli.hxx>
 #include <Draw_ProgressIndicator.hxx>
@@ -1546,7 +1548,9 @@ static Standard_Integer writebrep (Draw_Interpretor& theDI,
     TopTools_FormatVersion aTopToolsVersion = aVersion > 0
                                             ? static_cast<TopTools_FormatVersion> (aVersion)
                                             : TopTools_FormatVersion_CURRENT;
-    if (!BRepTools::Write (aShape, aFileName.ToCString(), isWithTriangles, isWithNormals, aTopToolsVersion, aProgress->Start()))
+    // the triangulations read on demand from the binary file should be loaded before the file is truncated
+    if (!BinTools_DeferredTriangulation::DetachFromFile (aFileName)
+     || !BRepTools::Write (aShape, aFileName.ToCString(), isWithTriangles, isWithNormals, aTopToolsVersion, aProgress->Start()))
     {
       theDI << "Cannot write to the file " << aFileName;
       return 1;
@@ -1563,7 +1567,7 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
                                   Standard_Integer theNbArgs,
                                   const char** theArgVec)
 {
-  if (theNbArgs != 3)
+  if (theNbArgs < 3)
   {
     theDI << "Syntax error: wrong number of arguments";
     return 1;
@@ -1571,6 +1575,34 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
 
   Standard_CString aFileName  = theArgVec[1];
   Standard_CString aShapeName = theArgVec[2];
+  Standard_Integer aMinNbDeferredTriangles = -1;
+  Standard_Real aMemoryLimitMiB = -1.0;
+  for (Standard_Integer anArgIter = 3; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString aParam (theArgVec[anArgIter]);
+    aParam.LowerCase();
+    if (aParam == "-defertriangulations"
+     || aParam == "-defertriangulation")
+    {
+      aMinNbDeferredTriangles = 0;
+      if (anArgIter + 1 < theNbArgs
+       && Draw::ParseInteger (theArgVec[anArgIter + 1], aMinNbDeferredTriangles))
+      {
+        ++anArgIter;
+      }
+    }
+    else if (aParam == "-memorylimit"
+          && anArgIter + 1 < theNbArgs
+          && Draw::ParseReal (theArgVec[anArgIter + 1], aMemoryLimitMiB))
+    {
+      ++anArgIter;
+    }
+    else
+    {
+      theDI << "Syntax error: unknown argument '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
   bool isBinaryFormat = true;
   {
     // probe file header to recognize format
@@ -1594,7 +1626,21 @@ static Standard_Integer readbrep (Draw_Interpretor& theDI,
 
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator (theDI);
   TopoDS_Shape aShape;
-  if (isBinaryFormat)
+  if (isBinaryFormat && aMinNbDeferredTriangles >= 0)
+  {
+    // cache of triangulations loaded on demand shared by all shapes read with deferred triangulations
+    static Handle(BinTools_TriangulationCache) THE_TRIANGULATION_CACHE = new BinTools_TriangulationCache();
+    if (aMemoryLimitMiB >= 0.0)
+    {
+      THE_TRIANGULATION_CACHE->SetMemoryLimit (Standard_Size(aMemoryLimitMiB * 1024.0 * 1024.0));
+    }
+    if (!BinTools::Read (aShape, aFileName, aMinNbDeferredTriangles, THE_TRIANGULATION_CACHE, aProgress->Start()))
+    {
+      theDI << "Error: cannot read from the file '" << aFileName << "'";
+      return 1;
+    }
+  }
+  else if (isBinaryFormat)
   {
     if (!BinTools::Read (aShape, aFileName, aProgress->Start()))
     {
@@ -1723,14 +1769,18 @@ void  DBRep::BasicCommands(Draw_Interpretor& theCommands)
                   "\n\t\t:  -binary  write into the binary format (ASCII when unspecified)"
                   "\n\t\t:  -version a number of format version to save;"
                   "\n\t\t:           ASCII  versions: 1, 2 and 3    (3 for ASCII  when unspecified);"
-                  "\n\t\t:           Binary versions: 1, 2, 3 and 4 (4 for Binary when unspecified)."
+                  "\n\t\t:           Binary versions: 1, 2, 3, 4 and 5 (4 for Binary when unspecified)."
                   "\n\t\t:  -triangles write triangulation data (TRUE when unspecified)."
                   "\n\t\t:           Ignored (always written) if face defines only triangulation (no surface)."
                   "\n\t\t:  -normals include vertex normals while writing triangulation data (FALSE when unspecified).",
                   __FILE__, writebrep, g);
   theCommands.Add("readbrep",
-                  "readbrep filename shape"
-                  "\n\t\t: Restore the shape from the binary or ASCII format file.",
+                  "readbrep filename shape [-deferTriangulations [MinNbTriangles]=0] [-memoryLimit MiB]=0"
+                  "\n\t\t: Restore the shape from the binary or ASCII format file."
+                  "\n\t\t:  -deferTriangulations do not load triangulations of binary file having"
+                  "\n\t\t:           at least specified number of triangles; see trlateload command."
+                  "\n\t\t:  -memoryLimit unload the least recently used deferred triangulations"
+                  "\n\t\t:           exceeding specified memory limit (0 means no limit).",
                   __FILE__, readbrep, g);
   theCommands.Add("binsave", "binsave shape filename", __FILE__, writebrep, g);
   theCommands.Add("binrestore",
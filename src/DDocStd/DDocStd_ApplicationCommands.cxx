@@ -27,6 +27,12 @@
 #include <TDF_Data.hxx>
 #include <TDF_ChildIterator.hxx>
 #include <PCDM_ReaderFilter.hxx>
+#include <PCDM_ReadWriter.hxx>
+#include <BinDrivers_DocumentRetrievalDriver.hxx>
+#include <BinLDrivers_DocumentStorageDriver.hxx>
+#include <BinTools_TriangulationCache.hxx>
+#include <XmlLDrivers_DocumentRetrievalDriver.hxx>
+#include <Standard_ErrorHandler.hxx>
 
 #include <OSD_FileSystem.hxx>
 #include <TDocStd_PathParser.hxx>
@@ -128,11 +134,33 @@ static Standard_Integer DDocStd_Open (Draw_Interpretor& di,
     PCDM_ReaderStatus theStatus;
 
     Standard_Boolean anUseStream = Standard_False;
+    Standard_Boolean isXmlStreaming = Standard_False;
+    Standard_Integer aMinNbDeferredTriangles = -1;
+    Standard_Real aMemoryLimitMiB = -1.0;
     Handle(PCDM_ReaderFilter) aFilter = new PCDM_ReaderFilter;
     for ( Standard_Integer i = 3; i < nb; i++ )
     {
       TCollection_AsciiString anArg(a[i]);
-      if (anArg == "-append")
+      if (anArg == "-deferTriangulations")
+      {
+        aMinNbDeferredTriangles = 0;
+        if (i + 1 < nb
+         && Draw::ParseInteger (a[i + 1], aMinNbDeferredTriangles))
+        {
+          ++i;
+        }
+      }
+      else if (anArg == "-memoryLimit"
+            && i + 1 < nb
+            && Draw::ParseReal (a[i + 1], aMemoryLimitMiB))
+      {
+        ++i;
+      }
+      else if (anArg == "-xmlStreaming")
+      {
+        isXmlStreaming = Standard_True;
+      }
+      else if (anArg == "-append")
       {
         aFilter->Mode() = PCDM_ReaderFilter::AppendMode_Protect;
       }
@@ -169,6 +197,54 @@ static Standard_Integer DDocStd_Open (Draw_Interpretor& di,
       di << "for append mode document " << DocName << " must be already created\n";
       return 1;
     }
+    Handle(BinDrivers_DocumentRetrievalDriver) aBinReader;
+    if (aMinNbDeferredTriangles >= 0 && !anUseStream)
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        aBinReader = Handle(BinDrivers_DocumentRetrievalDriver)::DownCast (A->ReaderFromFormat (PCDM_ReadWriter::FileFormat (path)));
+      }
+      catch (Standard_Failure const&)
+      {
+        //
+      }
+      if (aBinReader.IsNull())
+      {
+        di << "Warning: deferred triangulations are supported only by binary documents\n";
+      }
+      else
+      {
+        static Handle(BinTools_TriangulationCache) THE_TRIANGULATION_CACHE = new BinTools_TriangulationCache();
+        if (aMemoryLimitMiB >= 0.0)
+        {
+          THE_TRIANGULATION_CACHE->SetMemoryLimit (Standard_Size(aMemoryLimitMiB * 1024.0 * 1024.0));
+        }
+        aBinReader->SetDeferredTriangulations (aMinNbDeferredTriangles, THE_TRIANGULATION_CACHE);
+      }
+    }
+    Handle(XmlLDrivers_DocumentRetrievalDriver) aXmlReader;
+    if (isXmlStreaming)
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        aXmlReader = Handle(XmlLDrivers_DocumentRetrievalDriver)::DownCast (A->ReaderFromFormat (PCDM_ReadWriter::FileFormat (path)));
+      }
+      catch (Standard_Failure const&)
+      {
+        //
+      }
+      if (aXmlReader.IsNull())
+      {
+        di << "Warning: streaming mode is supported only by XML documents\n";
+      }
+      else
+      {
+        aXmlReader->SetStreamingMode (Standard_True);
+      }
+    }
+
     Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
     if (anUseStream)
     {
@@ -181,6 +257,15 @@ static Standard_Integer DDocStd_Open (Draw_Interpretor& di,
     {
       theStatus = A->Open (path, D, aFilter , aProgress->Start());
     }
+    if (!aBinReader.IsNull())
+    {
+      // reader is shared by all documents of the format
+      aBinReader->SetDeferredTriangulations (-1);
+    }
+    if (!aXmlReader.IsNull())
+    {
+      aXmlReader->SetStreamingMode (Standard_False);
+    }
     if (theStatus == PCDM_RS_OK && !D.IsNull())
     {
       if (!aFilter->IsAppendMode())
@@ -240,7 +325,7 @@ static Standard_Integer DDocStd_Save (Draw_Interpretor& di,
                                       Standard_Integer nb,
                                       const char** a)
 {  
-  if (nb == 2) {
+  if (nb == 2 || nb == 3) {
     Handle(TDocStd_Document) D;    
     if (!DDocStd::GetDocument(a[1],D)) return 1;
     Handle(TDocStd_Application) A = DDocStd::GetApplication();
@@ -249,8 +334,47 @@ static Standard_Integer DDocStd_Save (Draw_Interpretor& di,
       return 0;
     }
 
+    Standard_Boolean isIncremental = Standard_False;
+    if (nb == 3)
+    {
+      TCollection_AsciiString anArg (a[2]);
+      anArg.LowerCase();
+      if (anArg == "-incremental")
+      {
+        isIncremental = Standard_True;
+      }
+      else if (anArg != "-compact")
+      {
+        di << "Syntax error at '" << a[2] << "'\n";
+        return 1;
+      }
+    }
+
+    Handle(BinLDrivers_DocumentStorageDriver) aBinWriter;
+    try
+    {
+      OCC_CATCH_SIGNALS
+      aBinWriter = Handle(BinLDrivers_DocumentStorageDriver)::DownCast (A->WriterFromFormat (D->StorageFormat()));
+    }
+    catch (Standard_Failure const&)
+    {
+      //
+    }
+    if (isIncremental && aBinWriter.IsNull())
+    {
+      di << "Warning: incremental saving is supported only by binary documents\n";
+    }
+    if (!aBinWriter.IsNull())
+    {
+      aBinWriter->SetIncrementalMode (isIncremental);
+    }
+
     Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
     A->Save (D, aProgress->Start());
+    if (!aBinWriter.IsNull())
+    {
+      aBinWriter->SetIncrementalMode (Standard_False);
+    }
     return 0; 
   }
   di << "DDocStd_Save : Error\n";
@@ -609,8 +733,13 @@ void DDocStd::ApplicationCommands(Draw_Interpretor& theCommands)
 
   theCommands.Add("Open",
 		  "Open path docname [-stream] [-skipAttribute] [-readAttribute] [-readPath] [-append|-overwrite]"
+       "\n\t\t           [-deferTriangulations [MinNbTriangles]=0] [-memoryLimit MiB]=0 [-xmlStreaming]"
        "\n\t\t The options are:"
        "\n\t\t   -stream : opens path as a stream"
+       "\n\t\t   -deferTriangulations : do not load triangulations of binary document having at least specified number of triangles,"
+       "\n\t\t                          they are loaded from the file on demand (see trlateload command)"
+       "\n\t\t   -memoryLimit : unload the least recently used deferred triangulations exceeding specified memory limit"
+       "\n\t\t   -xmlStreaming : read labels of XML document while parsing the file without building the whole DOM tree in memory"
        "\n\t\t   -skipAttribute : class name of the attribute to skip during open, for example -skipTDF_Reference"
        "\n\t\t   -readAttribute : class name of the attribute to read only during open, for example -readTDataStd_Name loads only such attributes"
        "\n\t\t   -append : to read file into already existing document once again, append new attributes and don't touch existing"
@@ -622,7 +751,11 @@ void DDocStd::ApplicationCommands(Draw_Interpretor& theCommands)
 		  __FILE__, DDocStd_SaveAs, g);  
 
   theCommands.Add("Save",
-		  "Save",
+		  "Save DOC [-incremental|-compact]"
+       "\n\t\t: Saves the document into the file it has been saved to (or read from)."
+       "\n\t\t:  -incremental appends to the binary file only the labels modified"
+       "\n\t\t:               within the commands committed since the last saving;"
+       "\n\t\t:  -compact     rewrites the whole file (default).",
 		  __FILE__, DDocStd_Save, g);  
 
   theCommands.Add("Close",
@@ -185,6 +185,33 @@ static Standard_Integer DDocStd_UndoLimit (Draw_Interpretor& di,Standard_Integer
   return 0;
 }
 
+//=======================================================================
+//function : UndoMemoryLimit
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer DDocStd_UndoMemoryLimit (Draw_Interpretor& di,Standard_Integer n, const char** a)
+{
+  if (n < 2) return 1;
+
+  Handle(TDocStd_Document) D;
+  if (!DDocStd::GetDocument(a[1],D)) return 1;
+
+  if (n > 2) {
+    const Standard_Real aLimit = Draw::Atof(a[2]);
+    if (aLimit < 0.0) {
+      di << "Syntax error: negative memory limit\n";
+      return 1;
+    }
+    D->SetUndoMemoryLimit((Standard_Size )aLimit);
+  }
+
+  // display current values
+  di << (Standard_Real )D->GetUndoMemoryLimit() << " ";
+  di << (Standard_Real )D->UndoMemorySize();
+  return 0;
+}
+
 //=======================================================================
 //function : Undo, Redo
 //purpose  : Undo (DOC)
@@ -515,6 +542,9 @@ void DDocStd::DocumentCommands(Draw_Interpretor& theCommands)
 
   theCommands.Add("UndoLimit","UndoLimit DOC (Value), return UndoLimit Undos Redos",
 		  __FILE__, DDocStd_UndoLimit, g);
+
+  theCommands.Add("UndoMemoryLimit","UndoMemoryLimit DOC (bytes = 0 - no limit), return limit and size of undo history in bytes",
+		  __FILE__, DDocStd_UndoMemoryLimit, g);
   
   theCommands.Add("Undo","Undo DOC (steps = 1)",
 		  __FILE__, DDocStd_Undo, g);
@@ -100,6 +100,11 @@ public:
   //! @return Standard_True if export is support
   Standard_EXPORT virtual bool IsExportSupported() const;
 
+  //! Checks if providers built from copies of the node can work concurrently,
+  //! i.e. if transfer doesn't modify global state (static parameters, units).
+  //! @return Standard_True if transfer can be performed in parallel threads
+  Standard_EXPORT virtual bool IsThreadSafe() const;
+
   //! Gets CAD format name of associated provider
   //! @return provider CAD format
   Standard_EXPORT virtual TCollection_AsciiString GetFormat() const = 0;
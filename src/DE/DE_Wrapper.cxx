@@ -16,12 +16,14 @@
 #include <DE_ConfigurationContext.hxx>
 #include <DE_ConfigurationNode.hxx>
 #include <DE_Provider.hxx>
-#include <Message_ProgressRange.hxx>
+#include <Message_ProgressScope.hxx>
 #include <NCollection_Buffer.hxx>
 #include <OSD_File.hxx>
 #include <OSD_FileSystem.hxx>
 #include <OSD_Path.hxx>
 #include <OSD_Protection.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <OSD_Timer.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <TopoDS_Shape.hxx>
 
@@ -40,6 +42,87 @@ static Handle(DE_Wrapper)& THE_GLOBAL_CONFIGURATION()
   static Handle(DE_Wrapper) aConf = new DE_Wrapper();
   return aConf;
 }
+
+//! Configuration nodes and progress range of the batch conversion task
+struct BatchJob
+{
+  Handle(DE_ConfigurationNode) ReadNode;
+  Handle(DE_ConfigurationNode) WriteNode;
+  Message_ProgressRange        Range;
+};
+
+//! Functor converting files of the batch in parallel threads
+class BatchFunctor
+{
+public:
+  //! Main constructor
+  BatchFunctor(NCollection_Array1<DE_Wrapper::BatchItem>& theItems,
+               const NCollection_Array1<BatchJob>&        theJobs,
+               Standard_Mutex&                            theMutex)
+      : myItems(theItems),
+        myJobs(theJobs),
+        myMutex(theMutex)
+  {
+  }
+
+  //! Converts the file with the given index
+  void operator()(int /*theThreadIndex*/, int theIndex) const
+  {
+    const BatchJob& aJob = myJobs.Value(theIndex);
+    if (aJob.ReadNode.IsNull() || aJob.WriteNode.IsNull())
+    {
+      return;
+    }
+
+    DE_Wrapper::BatchItem& anItem = myItems.ChangeValue(theIndex);
+    Message_ProgressScope  aPS(aJob.Range, NULL, 2);
+    try
+    {
+      OCC_CATCH_SIGNALS
+      // providers of node copies don't share any state, except the global one
+      Handle(DE_Provider) aReader = aJob.ReadNode->Copy()->BuildProvider();
+      Handle(DE_Provider) aWriter = aJob.WriteNode->Copy()->BuildProvider();
+      TopoDS_Shape        aShape;
+      OSD_Timer           aTimer;
+      aTimer.Start();
+      {
+        Standard_Mutex::Sentry aLock(aJob.ReadNode->IsThreadSafe() ? NULL : &myMutex);
+        anItem.IsDone = aReader->Read(anItem.InputPath, aShape, aPS.Next());
+      }
+      anItem.ReadTime = aTimer.ElapsedTime();
+      if (!anItem.IsDone || aShape.IsNull())
+      {
+        anItem.IsDone = Standard_False;
+        anItem.Error  = "Cannot read the file";
+        return;
+      }
+      aTimer.Reset();
+      aTimer.Start();
+      {
+        Standard_Mutex::Sentry aLock(aJob.WriteNode->IsThreadSafe() ? NULL : &myMutex);
+        anItem.IsDone = aWriter->Write(anItem.OutputPath, aShape, aPS.Next());
+      }
+      anItem.WriteTime = aTimer.ElapsedTime();
+      if (!anItem.IsDone)
+      {
+        anItem.Error = "Cannot write the file";
+      }
+    }
+    catch (Standard_Failure const& anException)
+    {
+      anItem.IsDone = Standard_False;
+      anItem.Error  = TCollection_AsciiString("Exception: ") + anException.GetMessageString();
+    }
+  }
+
+private:
+  BatchFunctor& operator=(const BatchFunctor&);
+
+private:
+  NCollection_Array1<DE_Wrapper::BatchItem>& myItems;
+  const NCollection_Array1<BatchJob>&        myJobs;
+  Standard_Mutex&                            myMutex;
+};
 } // namespace
 
 //=================================================================================================
@@ -247,6 +330,60 @@ Standard_Boolean DE_Wrapper::Write(const TCollection_AsciiString& thePath,
 
 //=================================================================================================
 
+Standard_Boolean DE_Wrapper::ConvertBatch(NCollection_Array1<BatchItem>& theItems,
+                                          const Standard_Integer         theNbJobs,
+                                          const Message_ProgressRange&   theProgress)
+{
+  if (theItems.IsEmpty())
+  {
+    return Standard_True;
+  }
+
+  // nodes are looked up in advance, as lookup updates their state
+  Message_ProgressScope        aPS(theProgress, "Batch conversion", theItems.Size());
+  NCollection_Array1<BatchJob> aJobs(theItems.Lower(), theItems.Upper());
+  Standard_Boolean             isDone = Standard_True;
+  for (Standard_Integer anIndex = theItems.Lower(); anIndex <= theItems.Upper(); ++anIndex)
+  {
+    BatchItem& anItem = theItems.ChangeValue(anIndex);
+    BatchJob&  aJob   = aJobs.ChangeValue(anIndex);
+    anItem.IsDone     = Standard_False;
+    anItem.Error.Clear();
+    anItem.ReadTime  = 0.0;
+    anItem.WriteTime = 0.0;
+    aJob.Range       = aPS.Next();
+    if (!FindNode(anItem.InputPath, Standard_True, aJob.ReadNode))
+    {
+      anItem.Error = "Cannot find a provider to read the file";
+    }
+    else if (!FindNode(anItem.OutputPath, Standard_False, aJob.WriteNode))
+    {
+      anItem.Error = "Cannot find a provider to write the file";
+    }
+    else
+    {
+      aJob.ReadNode->GlobalParameters  = GlobalParameters;
+      aJob.WriteNode->GlobalParameters = GlobalParameters;
+      continue;
+    }
+    aJob.ReadNode.Nullify();
+    isDone = Standard_False;
+  }
+
+  // number of threads limits the number of files loaded into memory at once
+  Standard_Mutex           aMutex;
+  OSD_ThreadPool::Launcher aLauncher(*OSD_ThreadPool::DefaultPool(), theNbJobs > 0 ? theNbJobs : -1);
+  aLauncher.Perform(theItems.Lower(), theItems.Upper() + 1, BatchFunctor(theItems, aJobs, aMutex));
+
+  for (Standard_Integer anIndex = theItems.Lower(); anIndex <= theItems.Upper(); ++anIndex)
+  {
+    isDone = isDone && theItems.Value(anIndex).IsDone;
+  }
+  return isDone && !aPS.UserBreak();
+}
+
+//=================================================================================================
+
 Standard_Boolean DE_Wrapper::Load(const TCollection_AsciiString& theResource,
                                   const Standard_Boolean         theIsRecursive)
 {
@@ -498,6 +635,22 @@ Handle(DE_Wrapper) DE_Wrapper::Copy() const
 Standard_Boolean DE_Wrapper::FindProvider(const TCollection_AsciiString& thePath,
                                           const Standard_Boolean         theToImport,
                                           Handle(DE_Provider)&           theProvider) const
+{
+  Handle(DE_ConfigurationNode) aNode;
+  if (!FindNode(thePath, theToImport, aNode))
+  {
+    return Standard_False;
+  }
+  theProvider             = aNode->BuildProvider();
+  aNode->GlobalParameters = GlobalParameters;
+  return Standard_True;
+}
+
+//=================================================================================================
+
+Standard_Boolean DE_Wrapper::FindNode(const TCollection_AsciiString& thePath,
+                                      const Standard_Boolean         theToImport,
+                                      Handle(DE_ConfigurationNode)&  theNode) const
 {
   Handle(NCollection_Buffer) aBuffer;
   if (theToImport)
@@ -527,8 +680,7 @@ Standard_Boolean DE_Wrapper::FindProvider(const TCollection_AsciiString& thePath
           && (aNode->CheckExtension(anExtr) || (theToImport && aNode->CheckContent(aBuffer)))
           && aNode->UpdateLoad(theToImport, myKeepUpdates))
       {
-        theProvider             = aNode->BuildProvider();
-        aNode->GlobalParameters = GlobalParameters;
+        theNode = aNode;
         return Standard_True;
       }
     }
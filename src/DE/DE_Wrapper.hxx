@@ -16,6 +16,7 @@
 
 #include <DE_ConfigurationNode.hxx>
 #include <Message_ProgressRange.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IndexedDataMap.hxx>
 #include <Standard_Mutex.hxx>
@@ -51,10 +52,34 @@ typedef NCollection_DataMap<TCollection_AsciiString, DE_ConfigurationVendorMap>
 //!   3.2) Configuration can change the priority of Vendors
 //! 4) Initiate the transfer process by calling "::Write" or "::Read" methods
 //! 5) Validate the transfer process output
+//!
+//! Many files can be converted at once in parallel threads by "::ConvertBatch" method.
 class DE_Wrapper : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(DE_Wrapper, Standard_Transient)
 
+public:
+  //! Conversion task of the batch, filled with the report after conversion
+  struct BatchItem
+  {
+    // clang-format off
+    TCollection_AsciiString InputPath;  //!< path to the import CAD file
+    TCollection_AsciiString OutputPath; //!< path to the export CAD file
+    Standard_Boolean        IsDone;     //!< conversion status
+    TCollection_AsciiString Error;      //!< description of the conversion failure
+    Standard_Real           ReadTime;   //!< elapsed time of reading, in seconds
+    Standard_Real           WriteTime;  //!< elapsed time of writing, in seconds
+    // clang-format on
+
+    //! Empty constructor
+    BatchItem()
+        : IsDone(Standard_False),
+          ReadTime(0.0),
+          WriteTime(0.0)
+    {
+    }
+  };
+
 public:
   //! Initializes all field by default
   Standard_EXPORT DE_Wrapper();
@@ -163,6 +188,21 @@ public:
           const TopoDS_Shape&            theShape,
           const Message_ProgressRange&   theProgress = Message_ProgressRange());
 
+  //! Converts CAD files in parallel threads, according internal configuration.
+  //! Each input file is read into a shape, which is written to the output file
+  //! by providers built from own copies of configuration nodes.
+  //! Providers which are not thread-safe (see DE_ConfigurationNode::IsThreadSafe())
+  //! perform transfer one at a time.
+  //! @param[in,out] theItems input and output paths, filled with conversion reports
+  //! @param[in] theNbJobs maximum number of files converted simultaneously (bounds memory usage);
+  //!                      number of threads of the default pool is used if 0 or less
+  //! @param[in] theProgress progress indicator
+  //! @return true if all files have been converted
+  Standard_EXPORT Standard_Boolean
+    ConvertBatch(NCollection_Array1<BatchItem>& theItems,
+                 const Standard_Integer         theNbJobs   = 0,
+                 const Message_ProgressRange&   theProgress = Message_ProgressRange());
+
 public:
   //! Updates values according the resource file
   //! @param[in] theResource file path to resource or resource value
@@ -243,6 +283,16 @@ public:
                                                         const Standard_Boolean         theToImport,
                                                         Handle(DE_Provider)& theProvider) const;
 
+  //! Find available configuration node from the configuration.
+  //! If there are several nodes, choose the one with the highest priority.
+  //! @param[in] thePath path to the CAD file
+  //! @param[in] theToImport flag to finds for import. Standard_True-import, Standard_False-export
+  //! @param[out] theNode found node
+  //! @return Standard_True if node found
+  Standard_EXPORT Standard_Boolean FindNode(const TCollection_AsciiString& thePath,
+                                            const Standard_Boolean         theToImport,
+                                            Handle(DE_ConfigurationNode)&  theNode) const;
+
   //! Updates all registered nodes, all changes will be saved in nodes
   //! @param[in] theToForceUpdate flag that turns on/of nodes, according to updated ability to
   //! import/export
@@ -150,6 +150,13 @@ bool DEBREP_ConfigurationNode::IsExportSupported() const
 
 //=================================================================================================
 
+bool DEBREP_ConfigurationNode::IsThreadSafe() const
+{
+  return true;
+}
+
+//=================================================================================================
+
 TCollection_AsciiString DEBREP_ConfigurationNode::GetFormat() const
 {
   return TCollection_AsciiString("BREP");
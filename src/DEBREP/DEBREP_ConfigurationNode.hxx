@@ -67,6 +67,10 @@ public:
   //! @return true if export is supported
   Standard_EXPORT virtual bool IsExportSupported() const Standard_OVERRIDE;
 
+  //! Checks if providers can work in parallel threads
+  //! @return true, transfer doesn't modify global state
+  Standard_EXPORT virtual bool IsThreadSafe() const Standard_OVERRIDE;
+
   //! Gets CAD format name of associated provider
   //! @return provider CAD format
   Standard_EXPORT virtual TCollection_AsciiString GetFormat() const Standard_OVERRIDE;
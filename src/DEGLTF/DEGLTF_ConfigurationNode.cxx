@@ -100,6 +100,8 @@ bool DEGLTF_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRe
     theResource->BooleanVal("read.print.debug.message",
                             InternalParameters.ReadPrintDebugMessages,
                             aScope);
+  InternalParameters.ReadSkipUnusedJson =
+    theResource->BooleanVal("read.skip.unused.json", InternalParameters.ReadSkipUnusedJson, aScope);
 
   InternalParameters.WriteComment =
     theResource->StringVal("write.comment", InternalParameters.WriteComment, aScope);
@@ -135,6 +137,16 @@ bool DEGLTF_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRe
     theResource->BooleanVal("write.split.indices16",
                             InternalParameters.WriteSplitIndices16,
                             aScope);
+  InternalParameters.WriteDeduplicateMeshes =
+    theResource->BooleanVal("write.deduplicate.meshes",
+                            InternalParameters.WriteDeduplicateMeshes,
+                            aScope);
+  InternalParameters.WriteMeshInstancing =
+    theResource->BooleanVal("write.mesh.instancing", InternalParameters.WriteMeshInstancing, aScope);
+  InternalParameters.WriteMinInstances =
+    theResource->IntegerVal("write.min.instances", InternalParameters.WriteMinInstances, aScope);
+  InternalParameters.WriteParallel =
+    theResource->BooleanVal("write.parallel", InternalParameters.WriteParallel, aScope);
   return true;
 }
 
@@ -260,6 +272,13 @@ TCollection_AsciiString DEGLTF_ConfigurationNode::Save() const
     aScope + "read.print.debug.message :\t " + InternalParameters.ReadPrintDebugMessages + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag to skip JSON elements not used by the reader (animations, skins, cameras, etc.)\n";
+  aResult += "!while parsing the stream to reduce memory footprint\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.skip.unused.json :\t " + InternalParameters.ReadSkipUnusedJson + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
@@ -325,6 +344,30 @@ TCollection_AsciiString DEGLTF_ConfigurationNode::Save() const
   aResult += aScope + "write.split.indices16 :\t " + InternalParameters.WriteSplitIndices16 + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag to write identical triangulation data of distinct shapes only once\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "write.deduplicate.meshes :\t " + InternalParameters.WriteDeduplicateMeshes + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Flag to write repeated meshes using EXT_mesh_gpu_instancing extension\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "write.mesh.instancing :\t " + InternalParameters.WriteMeshInstancing + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Minimal number of instances of the same mesh to use EXT_mesh_gpu_instancing extension\n";
+  aResult += "!Default value: 2. Available values: any integer not less than 2\n";
+  aResult += aScope + "write.min.instances :\t " + InternalParameters.WriteMinInstances + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Flag to write binary data of faces using multiple threads\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "write.parallel :\t " + InternalParameters.WriteParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!*****************************************************************************\n";
   return aResult;
 }
@@ -359,6 +402,13 @@ bool DEGLTF_ConfigurationNode::IsExportSupported() const
 
 //=================================================================================================
 
+bool DEGLTF_ConfigurationNode::IsThreadSafe() const
+{
+  return true;
+}
+
+//=================================================================================================
+
 TCollection_AsciiString DEGLTF_ConfigurationNode::GetFormat() const
 {
   return TCollection_AsciiString("GLTF");
@@ -67,6 +67,10 @@ public:
   //! @return true if export is supported
   Standard_EXPORT virtual bool IsExportSupported() const Standard_OVERRIDE;
 
+  //! Checks if providers can work in parallel threads
+  //! @return true, transfer doesn't modify global state
+  Standard_EXPORT virtual bool IsThreadSafe() const Standard_OVERRIDE;
+
   //! Gets CAD format name of associated provider
   //! @return provider CAD format
   Standard_EXPORT virtual TCollection_AsciiString GetFormat() const Standard_OVERRIDE;
@@ -101,6 +105,7 @@ public:
     bool ReadSkipLateDataLoading = false; //!< Flag to skip triangulation loading
     bool ReadKeepLateData = true;//!< Flag to keep information about deferred storage to load/unload triangulation later
     bool ReadPrintDebugMessages = false; //!< Flag to print additional debug information
+    bool ReadSkipUnusedJson = false; //!< Flag to skip JSON elements not used by the reader while parsing the stream
     // Writing
     TCollection_AsciiString WriteComment; //!< Export special comment
     TCollection_AsciiString WriteAuthor; //!< Author of exported file name
@@ -111,6 +116,10 @@ public:
     bool WriteEmbedTexturesInGlb = true; //!< Flag to write image textures into GLB file
     bool WriteMergeFaces = false; //!< Flag to merge faces within a single part
     bool WriteSplitIndices16 = false; //!< Flag to prefer keeping 16-bit indexes while merging face
+    bool WriteDeduplicateMeshes = false; //!< Flag to write identical triangulation data only once
+    bool WriteMeshInstancing = false; //!< Flag to write repeated meshes using EXT_mesh_gpu_instancing extension
+    int WriteMinInstances = 2; //!< Minimal number of instances of the same mesh to use EXT_mesh_gpu_instancing extension
+    bool WriteParallel = false; //!< Flag to write binary data of faces using multiple threads
     // clang-format on
   } InternalParameters;
 };
@@ -41,6 +41,7 @@ static void SetReaderParameters(RWGltf_CafReader&                       theReade
   theReader.SetToSkipLateDataLoading(theNode->InternalParameters.ReadSkipLateDataLoading);
   theReader.SetToKeepLateData(theNode->InternalParameters.ReadKeepLateData);
   theReader.SetToPrintDebugMessages(theNode->InternalParameters.ReadPrintDebugMessages);
+  theReader.SetSkipUnusedJson(theNode->InternalParameters.ReadSkipUnusedJson);
 }
 } // namespace
 
@@ -168,6 +169,10 @@ bool DEGLTF_Provider::Write(const TCollection_AsciiString&  thePath,
   aWriter.SetToEmbedTexturesInGlb(aNode->InternalParameters.WriteEmbedTexturesInGlb);
   aWriter.SetMergeFaces(aNode->InternalParameters.WriteMergeFaces);
   aWriter.SetSplitIndices16(aNode->InternalParameters.WriteSplitIndices16);
+  aWriter.SetDeduplicateMeshes(aNode->InternalParameters.WriteDeduplicateMeshes);
+  aWriter.SetMeshInstancing(aNode->InternalParameters.WriteMeshInstancing);
+  aWriter.SetMeshInstancingThreshold(aNode->InternalParameters.WriteMinInstances);
+  aWriter.SetParallel(aNode->InternalParameters.WriteParallel);
   if (!aWriter.Perform(theDocument, aFileInfo, theProgress))
   {
     Message::SendFail() << "Error in the DEGLTF_Provider during writing the file " << thePath;
@@ -79,6 +79,8 @@ bool DEOBJ_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRes
     theResource->BooleanVal("read.fill.incomplete", InternalParameters.ReadFillIncomplete, aScope);
   InternalParameters.ReadMemoryLimitMiB =
     theResource->IntegerVal("read.memory.limit.mib", InternalParameters.ReadMemoryLimitMiB, aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
 
   InternalParameters.WriteComment =
     theResource->StringVal("write.comment", InternalParameters.WriteComment, aScope);
@@ -163,6 +165,12 @@ TCollection_AsciiString DEOBJ_ConfigurationNode::Save() const
   aResult += aScope + "read.memory.limit.mib :\t " + InternalParameters.ReadMemoryLimitMiB + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag for parsing the file in parallel threads\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
@@ -215,6 +223,13 @@ bool DEOBJ_ConfigurationNode::IsExportSupported() const
 
 //=================================================================================================
 
+bool DEOBJ_ConfigurationNode::IsThreadSafe() const
+{
+  return true;
+}
+
+//=================================================================================================
+
 TCollection_AsciiString DEOBJ_ConfigurationNode::GetFormat() const
 {
   return TCollection_AsciiString("OBJ");
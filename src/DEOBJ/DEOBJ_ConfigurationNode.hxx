@@ -65,6 +65,10 @@ public:
   //! @return true if export is supported
   Standard_EXPORT virtual bool IsExportSupported() const Standard_OVERRIDE;
 
+  //! Checks if providers can work in parallel threads
+  //! @return true, transfer doesn't modify global state
+  Standard_EXPORT virtual bool IsThreadSafe() const Standard_OVERRIDE;
+
   //! Gets CAD format name of associated provider
   //! @return provider CAD format
   Standard_EXPORT virtual TCollection_AsciiString GetFormat() const Standard_OVERRIDE;
@@ -93,6 +97,7 @@ public:
     bool ReadFillIncomplete = true; //!< Flag for fill the document with partially retrieved data even if reader has failed with error
     // clang-format on
     int ReadMemoryLimitMiB = -1; //!< Memory usage limit
+    bool ReadParallel = false; //!< Flag for parsing the file in parallel threads
     // Writing
     TCollection_AsciiString WriteComment; //!< Export special comment
     TCollection_AsciiString WriteAuthor;  //!< Author of exported file name
@@ -66,6 +66,13 @@ bool DEPLY_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRes
                                                       aScope)
                               % 2);
 
+  InternalParameters.ReadSinglePrecision =
+    theResource->BooleanVal("read.single.precision",
+                            InternalParameters.ReadSinglePrecision,
+                            aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
+
   InternalParameters.WriteNormals =
     theResource->BooleanVal("write.normals", InternalParameters.WriteNormals, aScope);
   InternalParameters.WriteColors =
@@ -117,6 +124,22 @@ TCollection_AsciiString DEPLY_ConfigurationNode::Save() const
   aResult += aScope + "file.cs :\t " + InternalParameters.FileCS + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Read parameters:\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Flag for reading vertex data with single or double floating point precision\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.single.precision :\t " + InternalParameters.ReadSinglePrecision + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Flag for decoding the file body in parallel threads\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
@@ -187,7 +210,7 @@ Handle(DE_Provider) DEPLY_ConfigurationNode::BuildProvider()
 
 bool DEPLY_ConfigurationNode::IsImportSupported() const
 {
-  return Standard_False;
+  return Standard_True;
 }
 
 //=================================================================================================
@@ -199,6 +222,13 @@ bool DEPLY_ConfigurationNode::IsExportSupported() const
 
 //=================================================================================================
 
+bool DEPLY_ConfigurationNode::IsThreadSafe() const
+{
+  return Standard_True;
+}
+
+//=================================================================================================
+
 TCollection_AsciiString DEPLY_ConfigurationNode::GetFormat() const
 {
   return TCollection_AsciiString("PLY");
@@ -28,7 +28,7 @@ class DE_ConfigurationContext;
 //! The Vendor name is "OCC"
 //! The Format type is "PLY"
 //! The supported CAD extension is ".ply"
-//! The import process isn't supported.
+//! The import process is supported.
 //! The export process is supported.
 class DEPLY_ConfigurationNode : public DE_ConfigurationNode
 {
@@ -68,6 +68,10 @@ public:
   //! @return true if export is supported
   Standard_EXPORT virtual bool IsExportSupported() const Standard_OVERRIDE;
 
+  //! Checks if providers can work in parallel threads
+  //! @return true, transfer doesn't modify global state
+  Standard_EXPORT virtual bool IsThreadSafe() const Standard_OVERRIDE;
+
   //! Gets CAD format name of associated provider
   //! @return provider CAD format
   Standard_EXPORT virtual TCollection_AsciiString GetFormat() const Standard_OVERRIDE;
@@ -94,6 +98,9 @@ public:
     double FileLengthUnit = 1.; //!< File length units to convert from while reading the file, defined as scale factor for m (meters)
     RWMesh_CoordinateSystem SystemCS = RWMesh_CoordinateSystem_Zup; //!< System origin coordinate system to perform conversion into during read
     RWMesh_CoordinateSystem FileCS = RWMesh_CoordinateSystem_Yup; //!< File origin coordinate system to perform conversion during read
+    // Reading
+    bool ReadSinglePrecision = false; //!< Flag for reading vertex data with single or double floating point precision
+    bool ReadParallel = false; //!< Flag for decoding the file body in parallel threads
     // Writing
     bool WriteNormals = true; //!< Flag for write normals
     bool WriteColors = true; //!< Flag for write colors
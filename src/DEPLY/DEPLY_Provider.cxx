@@ -18,7 +18,9 @@
 #include <DE_Wrapper.hxx>
 #include <Message.hxx>
 #include <RWMesh_FaceIterator.hxx>
+#include <RWPly_CafReader.hxx>
 #include <RWPly_CafWriter.hxx>
+#include <RWPly_PlyReaderContext.hxx>
 #include <RWPly_PlyWriterContext.hxx>
 #include <TDocStd_Document.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
@@ -40,6 +42,17 @@ DEPLY_Provider::DEPLY_Provider(const Handle(DE_ConfigurationNode)& theNode)
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString&  thePath,
+                          const Handle(TDocStd_Document)& theDocument,
+                          Handle(XSControl_WorkSession)&  theWS,
+                          const Message_ProgressRange&    theProgress)
+{
+  (void)theWS;
+  return Read(thePath, theDocument, theProgress);
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString&  thePath,
                            const Handle(TDocStd_Document)& theDocument,
                            Handle(XSControl_WorkSession)&  theWS,
@@ -51,6 +64,44 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString&  thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString&  thePath,
+                          const Handle(TDocStd_Document)& theDocument,
+                          const Message_ProgressRange&    theProgress)
+{
+  if (theDocument.IsNull())
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath
+                        << "\t: theDocument shouldn't be null";
+    return false;
+  }
+  if (GetNode().IsNull() || !GetNode()->IsKind(STANDARD_TYPE(DEPLY_ConfigurationNode)))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath
+                        << "\t: Incorrect or empty Configuration Node";
+    return false;
+  }
+  Handle(DEPLY_ConfigurationNode) aNode = Handle(DEPLY_ConfigurationNode)::DownCast(GetNode());
+  RWPly_CafReader                 aReader;
+  aReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
+  aReader.SetParallel(aNode->InternalParameters.ReadParallel);
+  aReader.SetSystemLengthUnit(aNode->GlobalParameters.LengthUnit / 1000);
+  aReader.SetSystemCoordinateSystem(aNode->InternalParameters.SystemCS);
+  aReader.SetFileLengthUnit(aNode->InternalParameters.FileLengthUnit);
+  aReader.SetFileCoordinateSystem(aNode->InternalParameters.FileCS);
+  aReader.SetDocument(theDocument);
+  if (!aReader.Perform(thePath, theProgress))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath;
+    return false;
+  }
+  XCAFDoc_DocumentTool::SetLengthUnit(theDocument,
+                                      aNode->GlobalParameters.LengthUnit,
+                                      UnitsMethods_LengthUnit_Millimeter);
+  return true;
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString&  thePath,
                            const Handle(TDocStd_Document)& theDocument,
                            const Message_ProgressRange&    theProgress)
@@ -115,6 +166,17 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString&  thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString& thePath,
+                          TopoDS_Shape&                  theShape,
+                          Handle(XSControl_WorkSession)& theWS,
+                          const Message_ProgressRange&   theProgress)
+{
+  (void)theWS;
+  return Read(thePath, theShape, theProgress);
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString& thePath,
                            const TopoDS_Shape&            theShape,
                            Handle(XSControl_WorkSession)& theWS,
@@ -126,6 +188,41 @@ bool DEPLY_Provider::Write(const TCollection_AsciiString& thePath,
 
 //=================================================================================================
 
+bool DEPLY_Provider::Read(const TCollection_AsciiString& thePath,
+                          TopoDS_Shape&                  theShape,
+                          const Message_ProgressRange&   theProgress)
+{
+  if (GetNode().IsNull() || !GetNode()->IsKind(STANDARD_TYPE(DEPLY_ConfigurationNode)))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath
+                        << "\t: Incorrect or empty Configuration Node";
+    return false;
+  }
+  Handle(DEPLY_ConfigurationNode)  aNode = Handle(DEPLY_ConfigurationNode)::DownCast(GetNode());
+  RWMesh_CoordinateSystemConverter aConverter;
+  aConverter.SetOutputLengthUnit(aNode->GlobalParameters.LengthUnit / 1000);
+  aConverter.SetOutputCoordinateSystem(aNode->InternalParameters.SystemCS);
+  aConverter.SetInputLengthUnit(aNode->InternalParameters.FileLengthUnit);
+  aConverter.SetInputCoordinateSystem(aNode->InternalParameters.FileCS);
+
+  RWPly_PlyReaderContext aPlyCtx;
+  aPlyCtx.SetCoordinateSystemConverter(aConverter);
+  aPlyCtx.SetDoublePrecision(!aNode->InternalParameters.ReadSinglePrecision);
+  aPlyCtx.SetParallel(aNode->InternalParameters.ReadParallel);
+  if (!aPlyCtx.Read(thePath, theProgress))
+  {
+    Message::SendFail() << "Error in the DEPLY_Provider during reading the file " << thePath;
+    return false;
+  }
+  TopoDS_Face  aFace;
+  BRep_Builder aBuilder;
+  aBuilder.MakeFace(aFace, aPlyCtx.Triangulation());
+  theShape = aFace;
+  return true;
+}
+
+//=================================================================================================
+
 bool DEPLY_Provider::Write(const TCollection_AsciiString& thePath,
                            const TopoDS_Shape&            theShape,
                            const Message_ProgressRange&   theProgress)
@@ -196,6 +196,8 @@ bool DESTEP_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRe
     (STEPControl_StepModelType)theResource->IntegerVal("write.model.type",
                                                        InternalParameters.WriteModelType,
                                                        aScope);
+  InternalParameters.WriteParallel =
+    theResource->BooleanVal("write.parallel", InternalParameters.WriteParallel, aScope);
 
   return true;
 }
@@ -575,6 +577,14 @@ TCollection_AsciiString DESTEP_ConfigurationNode::Save() const
   aResult += aScope + "write.model.type :\t " + InternalParameters.WriteModelType + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Setting up the write.parallel parameter which is used to indicate whether distinct "
+             "part shapes ";
+  aResult += "are converted into STEP entities in parallel threads or not\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "write.parallel :\t " + InternalParameters.WriteParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!*****************************************************************************\n";
 
   return aResult;
@@ -610,6 +620,13 @@ bool DESTEP_ConfigurationNode::IsExportSupported() const
 
 //=================================================================================================
 
+bool DESTEP_ConfigurationNode::IsThreadSafe() const
+{
+  return true;
+}
+
+//=================================================================================================
+
 TCollection_AsciiString DESTEP_ConfigurationNode::GetFormat() const
 {
   return TCollection_AsciiString("STEP");
@@ -86,6 +86,7 @@ void DESTEP_Parameters::InitFromStatic()
   WriteLayer         = Interface_Static::IVal("write.layer") == 1;
   WriteProps         = Interface_Static::IVal("write.props") == 1;
   WriteModelType     = (STEPControl_StepModelType)Interface_Static::IVal("write.model.type");
+  WriteParallel      = Interface_Static::IVal("write.step.parallel") == 1;
 }
 
 //=================================================================================================
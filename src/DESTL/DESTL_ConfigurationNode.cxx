@@ -58,8 +58,12 @@ bool DESTL_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRes
     theResource->RealVal("read.merge.angle", InternalParameters.ReadMergeAngle, aScope);
   InternalParameters.ReadBRep =
     theResource->BooleanVal("read.brep", InternalParameters.ReadBRep, aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
   InternalParameters.WriteAscii =
     theResource->BooleanVal("write.ascii", InternalParameters.WriteAscii, aScope);
+  InternalParameters.WriteParallel =
+    theResource->BooleanVal("write.parallel", InternalParameters.WriteParallel, aScope);
   return true;
 }
 
@@ -90,6 +94,12 @@ TCollection_AsciiString DESTL_ConfigurationNode::Save() const
   aResult += aScope + "read.brep :\t " + InternalParameters.ReadBRep + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag for decoding binary file and merging nodes in parallel threads\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
@@ -100,6 +110,12 @@ TCollection_AsciiString DESTL_ConfigurationNode::Save() const
   aResult += aScope + "write.ascii :\t " + InternalParameters.WriteAscii + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag for preparing the facets in parallel threads\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "write.parallel :\t " + InternalParameters.WriteParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!*****************************************************************************\n";
   return aResult;
 }
@@ -134,6 +150,13 @@ bool DESTL_ConfigurationNode::IsExportSupported() const
 
 //=================================================================================================
 
+bool DESTL_ConfigurationNode::IsThreadSafe() const
+{
+  return true;
+}
+
+//=================================================================================================
+
 TCollection_AsciiString DESTL_ConfigurationNode::GetFormat() const
 {
   return TCollection_AsciiString("STL");
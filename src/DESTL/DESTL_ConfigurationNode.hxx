@@ -64,6 +64,10 @@ public:
   //! @return true if export is supported
   Standard_EXPORT virtual bool IsExportSupported() const Standard_OVERRIDE;
 
+  //! Checks if providers can work in parallel threads
+  //! @return true, transfer doesn't modify global state
+  Standard_EXPORT virtual bool IsThreadSafe() const Standard_OVERRIDE;
+
   //! Gets CAD format name of associated provider
   //! @return provider CAD format
   Standard_EXPORT virtual TCollection_AsciiString GetFormat() const Standard_OVERRIDE;
@@ -88,9 +92,11 @@ public:
     // Read
     double ReadMergeAngle = 90.;   //!< Input merge angle value
     bool   ReadBRep       = false; //!< Setting up Boundary Representation flag
+    bool   ReadParallel   = false; //!< Flag for decoding binary file and merging nodes in parallel threads
 
     // Write
-    bool WriteAscii = true; //!< Setting up writing mode (Ascii or Binary)
+    bool WriteAscii    = true;  //!< Setting up writing mode (Ascii or Binary)
+    bool WriteParallel = false; //!< Flag for preparing the facets in parallel threads
 
   } InternalParameters;
 };
@@ -174,7 +174,10 @@ bool DESTL_Provider::Read(const TCollection_AsciiString& thePath,
   if (!aNode->InternalParameters.ReadBRep)
   {
     Handle(Poly_Triangulation) aTriangulation =
-      RWStl::ReadFile(thePath.ToCString(), aMergeAngle, theProgress);
+      RWStl::ReadFile(thePath.ToCString(),
+                      aMergeAngle,
+                      aNode->InternalParameters.ReadParallel,
+                      theProgress);
 
     TopoDS_Face  aFace;
     BRep_Builder aB;
@@ -217,7 +220,8 @@ bool DESTL_Provider::Write(const TCollection_AsciiString& thePath,
   }
 
   StlAPI_Writer aWriter;
-  aWriter.ASCIIMode() = aNode->InternalParameters.WriteAscii;
+  aWriter.ASCIIMode()    = aNode->InternalParameters.WriteAscii;
+  aWriter.ParallelMode() = aNode->InternalParameters.WriteParallel;
   if (!aWriter.Write(theShape, thePath.ToCString(), theProgress))
   {
     Message::SendFail() << "Error in the DESTL_Provider during reading the file " << thePath
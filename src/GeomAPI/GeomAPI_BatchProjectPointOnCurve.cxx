@@ -0,0 +1,507 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <GeomAPI_BatchProjectPointOnCurve.hxx>
+
+#include <Bnd_Box.hxx>
+#include <BndLib_Add3dCurve.hxx>
+#include <BVH_Distance.hxx>
+#include <BVH_Tools.hxx>
+#include <Geom_Curve.hxx>
+#include <GeomAdaptor_Curve.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <StdFail_NotDone.hxx>
+#include <TColStd_Array1OfReal.hxx>
+
+namespace
+{
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> GeomAPI_CurveSegmentSet;
+
+  //! Number of the samples inside the segment to start the Newton refinement.
+  static const Standard_Integer THE_NB_SEGMENT_SAMPLES = 4;
+
+  //! Maximal number of iterations of the Newton refinement.
+  static const Standard_Integer THE_NB_NEWTON_ITERATIONS = 32;
+
+  //! Tool computing the minimal square distance from the point to the curve
+  //! by traversing the BVH tree of the curve segments.
+  class GeomAPI_CurveSegmentDistance : public BVH_Distance<Standard_Real, 3, BVH_Vec3d, GeomAPI_CurveSegmentSet>
+  {
+  public:
+
+    GeomAPI_CurveSegmentDistance()
+    : myCurve (NULL),
+      myBreakPoints (NULL),
+      myTolerance (Precision::PConfusion()),
+      myParameter (0.0)
+    {}
+
+    //! Sets the curve and the bounds of its segments.
+    void SetCurve (const GeomAdaptor_Curve& theCurve,
+                   const NCollection_Array1<Standard_Real>& theBreakPoints,
+                   const Standard_Real theTolerance)
+    {
+      myCurve       = &theCurve;
+      myBreakPoints = &theBreakPoints;
+      myTolerance   = theTolerance;
+    }
+
+    //! Computes the projection of the point.
+    Standard_Boolean Perform (const gp_Pnt& thePoint)
+    {
+      myPoint = thePoint;
+      SetObject (BVH_Vec3d (thePoint.X(), thePoint.Y(), thePoint.Z()));
+      myDistance = RealLast();
+      myParameter = 0.0;
+      ComputeDistance();
+      return IsDone();
+    }
+
+    //! Returns the parameter of the projection.
+    Standard_Real Parameter() const { return myParameter; }
+
+  public:
+
+    //! Computes the square distance from the point to the box of the segments.
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                         const BVH_Vec3d& theCMax,
+                                         Standard_Real& theDistance) const Standard_OVERRIDE
+    {
+      theDistance = BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance (myObject, theCMin, theCMax);
+      return RejectMetric (theDistance);
+    }
+
+    //! Computes the minimal square distance from the point to the segment.
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      const Standard_Integer aSegment = myBVHSet->Element (theIndex);
+      Standard_Real aParam = 0.0;
+      const Standard_Real aSqDist = segmentMinimum (myBreakPoints->Value (aSegment),
+                                                    myBreakPoints->Value (aSegment + 1),
+                                                    aParam);
+      if (aSqDist < myDistance)
+      {
+        myDistance = aSqDist;
+        myParameter = aParam;
+        return Standard_True;
+      }
+      return Standard_False;
+    }
+
+  private:
+
+    //! Computes the square distance to the point and its derivative by the parameter divided by 2,
+    //! i.e. the scalar product of the curve derivative and the vector from the point to the curve.
+    Standard_Real evaluate (const Standard_Real theU,
+                            Standard_Real& theFunc,
+                            Standard_Real& theDeriv) const
+    {
+      gp_Pnt aP;
+      gp_Vec aD1, aD2;
+      myCurve->D2 (theU, aP, aD1, aD2);
+      const gp_Vec aV (myPoint, aP);
+      theFunc  = aV.Dot (aD1);
+      theDeriv = aD1.SquareMagnitude() + aV.Dot (aD2);
+      return aV.SquareMagnitude();
+    }
+
+    //! Finds the minimal square distance from the point to the segment [theU1, theU2].
+    //! The best of the uniform samples defines the interval of the local minimum,
+    //! which is refined by the Newton method safeguarded by bisection.
+    Standard_Real segmentMinimum (const Standard_Real theU1,
+                                  const Standard_Real theU2,
+                                  Standard_Real& theParam) const
+    {
+      Standard_Real aParams[THE_NB_SEGMENT_SAMPLES + 1], aFuncs[THE_NB_SEGMENT_SAMPLES + 1];
+      Standard_Real aSqDistMin = RealLast();
+      Standard_Integer anIndMin = 0;
+      const Standard_Real aStep = (theU2 - theU1) / THE_NB_SEGMENT_SAMPLES;
+      for (Standard_Integer i = 0; i <= THE_NB_SEGMENT_SAMPLES; ++i)
+      {
+        aParams[i] = (i == THE_NB_SEGMENT_SAMPLES) ? theU2 : theU1 + i * aStep;
+        Standard_Real aDeriv = 0.0;
+        const Standard_Real aSqDist = evaluate (aParams[i], aFuncs[i], aDeriv);
+        if (aSqDist < aSqDistMin)
+        {
+          aSqDistMin = aSqDist;
+          anIndMin = i;
+        }
+      }
+      theParam = aParams[anIndMin];
+
+      // the local minimum lies between the sample with decreasing distance and the one with increasing
+      Standard_Real aLo = 0.0, aHi = 0.0;
+      if (anIndMin > 0 && aFuncs[anIndMin] > 0.0 && aFuncs[anIndMin - 1] < 0.0)
+      {
+        aLo = aParams[anIndMin - 1];
+        aHi = aParams[anIndMin];
+      }
+      else if (anIndMin < THE_NB_SEGMENT_SAMPLES && aFuncs[anIndMin] < 0.0 && aFuncs[anIndMin + 1] > 0.0)
+      {
+        aLo = aParams[anIndMin];
+        aHi = aParams[anIndMin + 1];
+      }
+      else
+      {
+        return aSqDistMin;
+      }
+
+      Standard_Real aU = theParam;
+      for (Standard_Integer anIter = 0; anIter < THE_NB_NEWTON_ITERATIONS; ++anIter)
+      {
+        Standard_Real aFunc = 0.0, aDeriv = 0.0;
+        const Standard_Real aSqDist = evaluate (aU, aFunc, aDeriv);
+        if (aSqDist < aSqDistMin)
+        {
+          aSqDistMin = aSqDist;
+          theParam = aU;
+        }
+        if (aFunc < 0.0)
+        {
+          aLo = aU;
+        }
+        else
+        {
+          aHi = aU;
+        }
+
+        Standard_Real aNext = 0.5 * (aLo + aHi);
+        if (aDeriv > 0.0)
+        {
+          const Standard_Real aNewton = aU - aFunc / aDeriv;
+          if (aNewton > aLo && aNewton < aHi)
+          {
+            aNext = aNewton;
+          }
+        }
+        if (Abs (aNext - aU) < myTolerance
+         || aHi - aLo < myTolerance)
+        {
+          aU = aNext;
+          break;
+        }
+        aU = aNext;
+      }
+
+      Standard_Real aFunc = 0.0, aDeriv = 0.0;
+      const Standard_Real aSqDist = evaluate (aU, aFunc, aDeriv);
+      if (aSqDist < aSqDistMin)
+      {
+        aSqDistMin = aSqDist;
+        theParam = aU;
+      }
+      return aSqDistMin;
+    }
+
+  private:
+    const GeomAdaptor_Curve* myCurve;
+    const NCollection_Array1<Standard_Real>* myBreakPoints;
+    Standard_Real myTolerance;
+    gp_Pnt myPoint;
+    Standard_Real myParameter;
+  };
+
+  //! Data of the working thread: curve adaptor keeping the cache of the current span
+  //! and the tool traversing the segments.
+  struct GeomAPI_BatchProjectCurveTLS
+  {
+    GeomAdaptor_Curve            Adaptor;
+    GeomAPI_CurveSegmentDistance Tool;
+    Standard_Boolean             IsInit;
+
+    GeomAPI_BatchProjectCurveTLS() : IsInit (Standard_False) {}
+  };
+
+  //! Functor projecting single point.
+  class GeomAPI_BatchProjectCurveFunctor
+  {
+  public:
+
+    GeomAPI_BatchProjectCurveFunctor (const Handle(Geom_Curve)& theCurve,
+                                      const Standard_Real theUMin,
+                                      const Standard_Real theUSup,
+                                      const Standard_Real theTolerance,
+                                      const NCollection_Array1<Standard_Real>& theBreakPoints,
+                                      GeomAPI_CurveSegmentSet* theSegments,
+                                      const TColgp_Array1OfPnt& thePoints,
+                                      NCollection_Array1<GeomAPI_BatchProjectCurveTLS>& theTLS,
+                                      NCollection_Array1<Standard_Boolean>& theIsDone,
+                                      NCollection_Array1<Standard_Real>& theDistances,
+                                      NCollection_Array1<Standard_Real>& theParameters,
+                                      NCollection_Array1<gp_Pnt>& theProjPoints)
+    : myCurve (theCurve),
+      myUMin (theUMin), myUSup (theUSup),
+      myTolerance (theTolerance),
+      myBreakPoints (theBreakPoints),
+      mySegments (theSegments),
+      myPoints (thePoints),
+      myTLS (theTLS),
+      myIsDone (theIsDone),
+      myDistances (theDistances),
+      myParameters (theParameters),
+      myProjPoints (theProjPoints)
+    {}
+
+    void operator() (int theThreadIndex, int theIndex) const
+    {
+      GeomAPI_BatchProjectCurveTLS& aTLS = myTLS.ChangeValue (theThreadIndex);
+      myIsDone.ChangeValue (theIndex) = Standard_False;
+      try
+      {
+        OCC_CATCH_SIGNALS
+        if (!aTLS.IsInit)
+        {
+          aTLS.Adaptor.Load (myCurve, myUMin, myUSup);
+          aTLS.Tool.SetCurve (aTLS.Adaptor, myBreakPoints, myTolerance);
+          aTLS.Tool.SetBVHSet (mySegments);
+          aTLS.IsInit = Standard_True;
+        }
+
+        if (!aTLS.Tool.Perform (myPoints.Value (theIndex)))
+        {
+          return;
+        }
+
+        const Standard_Real aParam = aTLS.Tool.Parameter();
+        myDistances.ChangeValue (theIndex) = Sqrt (aTLS.Tool.Distance());
+        myParameters.ChangeValue (theIndex) = aParam;
+        myProjPoints.ChangeValue (theIndex) = aTLS.Adaptor.Value (aParam);
+        myIsDone.ChangeValue (theIndex) = Standard_True;
+      }
+      catch (Standard_Failure const&)
+      {
+        //
+      }
+    }
+
+  private:
+    GeomAPI_BatchProjectCurveFunctor& operator= (const GeomAPI_BatchProjectCurveFunctor&);
+
+  private:
+    const Handle(Geom_Curve)& myCurve;
+    Standard_Real myUMin;
+    Standard_Real myUSup;
+    Standard_Real myTolerance;
+    const NCollection_Array1<Standard_Real>& myBreakPoints;
+    GeomAPI_CurveSegmentSet* mySegments;
+    const TColgp_Array1OfPnt& myPoints;
+    NCollection_Array1<GeomAPI_BatchProjectCurveTLS>& myTLS;
+    NCollection_Array1<Standard_Boolean>& myIsDone;
+    NCollection_Array1<Standard_Real>& myDistances;
+    NCollection_Array1<Standard_Real>& myParameters;
+    NCollection_Array1<gp_Pnt>& myProjPoints;
+  };
+}
+
+//=======================================================================
+//function : GeomAPI_BatchProjectPointOnCurve
+//purpose  :
+//=======================================================================
+GeomAPI_BatchProjectPointOnCurve::GeomAPI_BatchProjectPointOnCurve()
+: myUMin (0.0),
+  myUSup (0.0),
+  myTolerance (Precision::PConfusion()),
+  myIsParallel (Standard_False)
+{
+}
+
+//=======================================================================
+//function : GeomAPI_BatchProjectPointOnCurve
+//purpose  :
+//=======================================================================
+GeomAPI_BatchProjectPointOnCurve::GeomAPI_BatchProjectPointOnCurve (const Handle(Geom_Curve)& theCurve,
+                                                                    const Standard_Real theTolerance)
+: myUMin (0.0),
+  myUSup (0.0),
+  myTolerance (Precision::PConfusion()),
+  myIsParallel (Standard_False)
+{
+  Init (theCurve, theTolerance);
+}
+
+//=======================================================================
+//function : Init
+//purpose  :
+//=======================================================================
+void GeomAPI_BatchProjectPointOnCurve::Init (const Handle(Geom_Curve)& theCurve,
+                                             const Standard_Real theTolerance)
+{
+  Init (theCurve, theCurve->FirstParameter(), theCurve->LastParameter(), theTolerance);
+}
+
+//=======================================================================
+//function : Init
+//purpose  :
+//=======================================================================
+void GeomAPI_BatchProjectPointOnCurve::Init (const Handle(Geom_Curve)& theCurve,
+                                             const Standard_Real theUMin,
+                                             const Standard_Real theUSup,
+                                             const Standard_Real theTolerance)
+{
+  myCurve     = theCurve;
+  myUMin      = theUMin;
+  myUSup      = theUSup;
+  myTolerance = theTolerance;
+
+  myIsDone     = NCollection_Array1<Standard_Boolean>();
+  myDistances  = NCollection_Array1<Standard_Real>();
+  myParameters = NCollection_Array1<Standard_Real>();
+  myPoints     = NCollection_Array1<gp_Pnt>();
+
+  buildSegments();
+}
+
+//=======================================================================
+//function : buildSegments
+//purpose  :
+//=======================================================================
+void GeomAPI_BatchProjectPointOnCurve::buildSegments()
+{
+  myBreakPoints = NCollection_Array1<Standard_Real>();
+  mySegments.Nullify();
+  if (myCurve.IsNull()
+   || Precision::IsInfinite (myUMin)
+   || Precision::IsInfinite (myUSup)
+   || myUSup - myUMin < Precision::PConfusion())
+  {
+    return;
+  }
+
+  GeomAdaptor_Curve anAdaptor (myCurve, myUMin, myUSup);
+
+  // intervals of the polynomial pieces, i.e. the knot spans of B-spline curve
+  const Standard_Integer aNbIntervals = anAdaptor.NbIntervals (GeomAbs_CN);
+  TColStd_Array1OfReal anIntervals (1, aNbIntervals + 1);
+  anAdaptor.Intervals (anIntervals, GeomAbs_CN);
+
+  // number of the segments per interval, enough to make the segments almost convex
+  Standard_Integer aNbSub = 1;
+  switch (anAdaptor.GetType())
+  {
+    case GeomAbs_Line:
+      aNbSub = 1;
+      break;
+    case GeomAbs_BezierCurve:
+    case GeomAbs_BSplineCurve:
+      aNbSub = Max (2, anAdaptor.Degree());
+      break;
+    case GeomAbs_Circle:
+    case GeomAbs_Ellipse:
+      aNbSub = Max (2, (Standard_Integer )Ceiling (8.0 * (myUSup - myUMin) / (2.0 * M_PI)));
+      break;
+    default:
+      aNbSub = 16;
+      break;
+  }
+
+  myBreakPoints = NCollection_Array1<Standard_Real> (0, aNbIntervals * aNbSub);
+  Standard_Integer anIndex = 0;
+  for (Standard_Integer anIntIter = 1; anIntIter <= aNbIntervals; ++anIntIter)
+  {
+    const Standard_Real aU1 = anIntervals.Value (anIntIter);
+    const Standard_Real aStep = (anIntervals.Value (anIntIter + 1) - aU1) / aNbSub;
+    for (Standard_Integer i = 0; i < aNbSub; ++i)
+    {
+      myBreakPoints.ChangeValue (anIndex++) = aU1 + i * aStep;
+    }
+  }
+  myBreakPoints.ChangeLast() = anIntervals.Last();
+
+  mySegments = new GeomAPI_CurveSegmentSet();
+  mySegments->SetSize (myBreakPoints.Upper());
+  for (Standard_Integer aSegIter = myBreakPoints.Lower(); aSegIter < myBreakPoints.Upper(); ++aSegIter)
+  {
+    Bnd_Box aBox;
+    BndLib_Add3dCurve::Add (anAdaptor, myBreakPoints.Value (aSegIter), myBreakPoints.Value (aSegIter + 1),
+                            Precision::Confusion(), aBox);
+    if (aBox.IsVoid())
+    {
+      continue;
+    }
+
+    Standard_Real aXMin = 0.0, aYMin = 0.0, aZMin = 0.0, aXMax = 0.0, aYMax = 0.0, aZMax = 0.0;
+    aBox.Get (aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+    mySegments->Add (aSegIter, BVH_Box<Standard_Real, 3> (BVH_Vec3d (aXMin, aYMin, aZMin),
+                                                          BVH_Vec3d (aXMax, aYMax, aZMax)));
+  }
+
+  // build the tree here to share it between the working threads
+  mySegments->Build();
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void GeomAPI_BatchProjectPointOnCurve::Perform (const TColgp_Array1OfPnt& thePoints)
+{
+  if (thePoints.IsEmpty())
+  {
+    myIsDone = NCollection_Array1<Standard_Boolean>();
+    return;
+  }
+
+  const Standard_Integer aLower = thePoints.Lower(), anUpper = thePoints.Upper();
+  myIsDone     = NCollection_Array1<Standard_Boolean> (aLower, anUpper);
+  myDistances  = NCollection_Array1<Standard_Real>    (aLower, anUpper);
+  myParameters = NCollection_Array1<Standard_Real>    (aLower, anUpper);
+  myPoints     = NCollection_Array1<gp_Pnt>           (aLower, anUpper);
+  myIsDone.Init (Standard_False);
+  if (mySegments.IsNull()
+   || mySegments->Size() == 0)
+  {
+    return;
+  }
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = myIsParallel
+                                    ? Min (thePoints.Size(), aThreadPool->NbDefaultThreadsToLaunch())
+                                    : 1;
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+  NCollection_Array1<GeomAPI_BatchProjectCurveTLS> aTLS (aLauncher.LowerThreadIndex(), aLauncher.UpperThreadIndex());
+  GeomAPI_BatchProjectCurveFunctor aFunctor (myCurve, myUMin, myUSup, myTolerance, myBreakPoints, mySegments.get(),
+                                             thePoints, aTLS, myIsDone, myDistances, myParameters, myPoints);
+  aLauncher.Perform (aLower, anUpper + 1, aFunctor);
+}
+
+//=======================================================================
+//function : LowerDistance
+//purpose  :
+//=======================================================================
+Standard_Real GeomAPI_BatchProjectPointOnCurve::LowerDistance (const Standard_Integer theIndex) const
+{
+  StdFail_NotDone_Raise_if (!myIsDone.Value (theIndex), "GeomAPI_BatchProjectPointOnCurve::LowerDistance");
+  return myDistances.Value (theIndex);
+}
+
+//=======================================================================
+//function : LowerDistanceParameter
+//purpose  :
+//=======================================================================
+Standard_Real GeomAPI_BatchProjectPointOnCurve::LowerDistanceParameter (const Standard_Integer theIndex) const
+{
+  StdFail_NotDone_Raise_if (!myIsDone.Value (theIndex), "GeomAPI_BatchProjectPointOnCurve::LowerDistanceParameter");
+  return myParameters.Value (theIndex);
+}
+
+//=======================================================================
+//function : NearestPoint
+//purpose  :
+//=======================================================================
+gp_Pnt GeomAPI_BatchProjectPointOnCurve::NearestPoint (const Standard_Integer theIndex) const
+{
+  StdFail_NotDone_Raise_if (!myIsDone.Value (theIndex), "GeomAPI_BatchProjectPointOnCurve::NearestPoint");
+  return myPoints.Value (theIndex);
+}
@@ -0,0 +1,126 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _GeomAPI_BatchProjectPointOnCurve_HeaderFile
+#define _GeomAPI_BatchProjectPointOnCurve_HeaderFile
+
+#include <BVH_BoxSet.hxx>
+#include <gp_Pnt.hxx>
+#include <NCollection_Array1.hxx>
+#include <Precision.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+
+class Geom_Curve;
+
+//! This class computes for each point of a set the nearest point on the same curve
+//! (possibly an end point of its parameter range, which is not an orthogonal projection).
+//!
+//! At initialization the parameter range of the curve is split into segments
+//! following the knot spans of B-spline curves (or uniformly for other curves),
+//! and the BVH tree is built on the bounding boxes of these segments.
+//! The projection of each point descends the tree from the closest segments,
+//! refines the minimum of the distance inside the accepted segments by the
+//! safeguarded Newton method and rejects the segments whose boxes are farther
+//! than the current minimum. The span polynomials are evaluated through the
+//! cache of GeomAdaptor_Curve, which each working thread keeps on its own.
+//!
+//! Contrary to GeomAPI_ProjectPointOnCurve, only the global minimum is searched,
+//! and the preparation is done once for all points.
+//! The points can be processed in parallel (see SetRunParallel()).
+//!
+//! The parameter range of the curve must be finite.
+//! The results are accessed by the index of the point in the input array.
+class GeomAPI_BatchProjectPointOnCurve
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates an empty object. Use the Init() method for further initialization.
+  Standard_EXPORT GeomAPI_BatchProjectPointOnCurve();
+
+  //! Creates the projector onto the whole curve.
+  Standard_EXPORT GeomAPI_BatchProjectPointOnCurve (const Handle(Geom_Curve)& theCurve,
+                                                    const Standard_Real theTolerance = Precision::PConfusion());
+
+  //! Initializes the projector onto the whole curve.
+  Standard_EXPORT void Init (const Handle(Geom_Curve)& theCurve,
+                             const Standard_Real theTolerance = Precision::PConfusion());
+
+  //! Initializes the projector onto the part [theUMin, theUSup] of the curve.
+  //! @param theTolerance [in] parametric tolerance of the refinement of the projections
+  Standard_EXPORT void Init (const Handle(Geom_Curve)& theCurve,
+                             const Standard_Real theUMin,
+                             const Standard_Real theUSup,
+                             const Standard_Real theTolerance = Precision::PConfusion());
+
+  //! Returns the number of segments into which the curve has been split.
+  Standard_Integer NbSegments() const { return mySegments.IsNull() ? 0 : mySegments->Size(); }
+
+  //! Sets the flag of parallel processing of the points (FALSE by default).
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing of the points.
+  Standard_Boolean RunParallel() const { return myIsParallel; }
+
+  //! Performs the projection of the given points.
+  //! The results are accessible by the indices of the points in the given array.
+  Standard_EXPORT void Perform (const TColgp_Array1OfPnt& thePoints);
+
+  //! Returns the lower index of the processed points.
+  Standard_Integer Lower() const { return myIsDone.Lower(); }
+
+  //! Returns the upper index of the processed points.
+  Standard_Integer Upper() const { return myIsDone.Upper(); }
+
+  //! Returns the number of the processed points.
+  Standard_Integer NbPoints() const { return myIsDone.Size(); }
+
+  //! Returns TRUE if the projection of the point with the given index has been found.
+  Standard_Boolean IsDone (const Standard_Integer theIndex) const { return myIsDone.Value (theIndex); }
+
+  //! Returns the distance between the point with the given index and its nearest point on the curve.
+  //! Exceptions: StdFail_NotDone if the projection of this point has failed.
+  Standard_EXPORT Standard_Real LowerDistance (const Standard_Integer theIndex) const;
+
+  //! Returns the parameter of the nearest point on the curve to the point with the given index.
+  //! Exceptions: StdFail_NotDone if the projection of this point has failed.
+  Standard_EXPORT Standard_Real LowerDistanceParameter (const Standard_Integer theIndex) const;
+
+  //! Returns the nearest point on the curve to the point with the given index.
+  //! Exceptions: StdFail_NotDone if the projection of this point has failed.
+  Standard_EXPORT gp_Pnt NearestPoint (const Standard_Integer theIndex) const;
+
+private:
+
+  //! Splits the curve into segments and builds the BVH tree on their boxes.
+  void buildSegments();
+
+private:
+
+  Handle(Geom_Curve) myCurve;
+  Standard_Real myUMin;
+  Standard_Real myUSup;
+  Standard_Real myTolerance;
+  Standard_Boolean myIsParallel;
+
+  NCollection_Array1<Standard_Real> myBreakPoints;                        //!< bounds of the segments
+  opencascade::handle<BVH_BoxSet<Standard_Real, 3, Standard_Integer> > mySegments; //!< BVH on the segments
+
+  NCollection_Array1<Standard_Boolean> myIsDone;
+  NCollection_Array1<Standard_Real> myDistances;
+  NCollection_Array1<Standard_Real> myParameters;
+  NCollection_Array1<gp_Pnt> myPoints;
+};
+
+#endif // _GeomAPI_BatchProjectPointOnCurve_HeaderFile
@@ -0,0 +1,273 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <GeomAPI_BatchProjectPointOnSurf.hxx>
+
+#include <Extrema_ExtPS.hxx>
+#include <Extrema_POnSurf.hxx>
+#include <Geom_Surface.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <StdFail_NotDone.hxx>
+
+namespace
+{
+  //! Data of the working thread: surface adaptor and extrema algorithm
+  //! with the sampling grid built once for all points processed by the thread.
+  struct GeomAPI_BatchProjectTLS
+  {
+    GeomAdaptor_Surface Adaptor;
+    Extrema_ExtPS       Extrema;
+    Standard_Boolean    IsInit;
+
+    GeomAPI_BatchProjectTLS() : IsInit (Standard_False) {}
+  };
+
+  //! Functor projecting single point.
+  class GeomAPI_BatchProjectFunctor
+  {
+  public:
+
+    GeomAPI_BatchProjectFunctor (const Handle(Geom_Surface)& theSurface,
+                                 const Standard_Real theUMin,
+                                 const Standard_Real theUSup,
+                                 const Standard_Real theVMin,
+                                 const Standard_Real theVSup,
+                                 const Standard_Real theTolerance,
+                                 const Extrema_ExtAlgo theAlgo,
+                                 const TColgp_Array1OfPnt& thePoints,
+                                 NCollection_Array1<GeomAPI_BatchProjectTLS>& theTLS,
+                                 NCollection_Array1<Standard_Boolean>& theIsDone,
+                                 NCollection_Array1<Standard_Real>& theDistances,
+                                 NCollection_Array1<gp_XY>& theParameters,
+                                 NCollection_Array1<gp_Pnt>& theProjPoints)
+    : mySurface (theSurface),
+      myUMin (theUMin), myUSup (theUSup), myVMin (theVMin), myVSup (theVSup),
+      myTolerance (theTolerance),
+      myAlgo (theAlgo),
+      myPoints (thePoints),
+      myTLS (theTLS),
+      myIsDone (theIsDone),
+      myDistances (theDistances),
+      myParameters (theParameters),
+      myProjPoints (theProjPoints)
+    {}
+
+    void operator() (int theThreadIndex, int theIndex) const
+    {
+      GeomAPI_BatchProjectTLS& aTLS = myTLS.ChangeValue (theThreadIndex);
+      myIsDone.ChangeValue (theIndex) = Standard_False;
+      try
+      {
+        OCC_CATCH_SIGNALS
+        if (!aTLS.IsInit)
+        {
+          aTLS.Adaptor.Load (mySurface, myUMin, myUSup, myVMin, myVSup);
+          aTLS.Extrema.SetAlgo (myAlgo);
+          aTLS.Extrema.SetFlag (Extrema_ExtFlag_MIN);
+          aTLS.Extrema.Initialize (aTLS.Adaptor, myUMin, myUSup, myVMin, myVSup, myTolerance, myTolerance);
+          aTLS.IsInit = Standard_True;
+        }
+
+        aTLS.Extrema.Perform (myPoints.Value (theIndex));
+        if (!aTLS.Extrema.IsDone() || aTLS.Extrema.NbExt() == 0)
+        {
+          return;
+        }
+
+        Standard_Integer anIndMin = 1;
+        Standard_Real aSqDistMin = aTLS.Extrema.SquareDistance (1);
+        for (Standard_Integer i = 2; i <= aTLS.Extrema.NbExt(); ++i)
+        {
+          const Standard_Real aSqDist = aTLS.Extrema.SquareDistance (i);
+          if (aSqDist < aSqDistMin)
+          {
+            aSqDistMin = aSqDist;
+            anIndMin = i;
+          }
+        }
+
+        const Extrema_POnSurf& aPOnS = aTLS.Extrema.Point (anIndMin);
+        Standard_Real aU = 0.0, aV = 0.0;
+        aPOnS.Parameter (aU, aV);
+        myDistances.ChangeValue (theIndex) = Sqrt (aSqDistMin);
+        myParameters.ChangeValue (theIndex).SetCoord (aU, aV);
+        myProjPoints.ChangeValue (theIndex) = aPOnS.Value();
+        myIsDone.ChangeValue (theIndex) = Standard_True;
+      }
+      catch (Standard_Failure const&)
+      {
+        // the extrema algorithm may be left in inconsistent state
+        aTLS.IsInit = Standard_False;
+      }
+    }
+
+  private:
+    GeomAPI_BatchProjectFunctor& operator= (const GeomAPI_BatchProjectFunctor&);
+
+  private:
+    const Handle(Geom_Surface)& mySurface;
+    Standard_Real myUMin;
+    Standard_Real myUSup;
+    Standard_Real myVMin;
+    Standard_Real myVSup;
+    Standard_Real myTolerance;
+    Extrema_ExtAlgo myAlgo;
+    const TColgp_Array1OfPnt& myPoints;
+    NCollection_Array1<GeomAPI_BatchProjectTLS>& myTLS;
+    NCollection_Array1<Standard_Boolean>& myIsDone;
+    NCollection_Array1<Standard_Real>& myDistances;
+    NCollection_Array1<gp_XY>& myParameters;
+    NCollection_Array1<gp_Pnt>& myProjPoints;
+  };
+}
+
+//=======================================================================
+//function : GeomAPI_BatchProjectPointOnSurf
+//purpose  :
+//=======================================================================
+GeomAPI_BatchProjectPointOnSurf::GeomAPI_BatchProjectPointOnSurf()
+: myUMin (0.0),
+  myUSup (0.0),
+  myVMin (0.0),
+  myVSup (0.0),
+  myTolerance (Precision::PConfusion()),
+  myAlgo (Extrema_ExtAlgo_Grad),
+  myIsParallel (Standard_False)
+{
+}
+
+//=======================================================================
+//function : GeomAPI_BatchProjectPointOnSurf
+//purpose  :
+//=======================================================================
+GeomAPI_BatchProjectPointOnSurf::GeomAPI_BatchProjectPointOnSurf (const Handle(Geom_Surface)& theSurface,
+                                                                  const Standard_Real theTolerance,
+                                                                  const Extrema_ExtAlgo theAlgo)
+: myUMin (0.0),
+  myUSup (0.0),
+  myVMin (0.0),
+  myVSup (0.0),
+  myTolerance (Precision::PConfusion()),
+  myAlgo (Extrema_ExtAlgo_Grad),
+  myIsParallel (Standard_False)
+{
+  Init (theSurface, theTolerance, theAlgo);
+}
+
+//=======================================================================
+//function : Init
+//purpose  :
+//=======================================================================
+void GeomAPI_BatchProjectPointOnSurf::Init (const Handle(Geom_Surface)& theSurface,
+                                            const Standard_Real theTolerance,
+                                            const Extrema_ExtAlgo theAlgo)
+{
+  Standard_Real aUMin = 0.0, aUSup = 0.0, aVMin = 0.0, aVSup = 0.0;
+  theSurface->Bounds (aUMin, aUSup, aVMin, aVSup);
+  Init (theSurface, aUMin, aUSup, aVMin, aVSup, theTolerance, theAlgo);
+}
+
+//=======================================================================
+//function : Init
+//purpose  :
+//=======================================================================
+void GeomAPI_BatchProjectPointOnSurf::Init (const Handle(Geom_Surface)& theSurface,
+                                            const Standard_Real theUMin,
+                                            const Standard_Real theUSup,
+                                            const Standard_Real theVMin,
+                                            const Standard_Real theVSup,
+                                            const Standard_Real theTolerance,
+                                            const Extrema_ExtAlgo theAlgo)
+{
+  mySurface   = theSurface;
+  myUMin      = theUMin;
+  myUSup      = theUSup;
+  myVMin      = theVMin;
+  myVSup      = theVSup;
+  myTolerance = theTolerance;
+  myAlgo      = theAlgo;
+
+  myIsDone     = NCollection_Array1<Standard_Boolean>();
+  myDistances  = NCollection_Array1<Standard_Real>();
+  myParameters = NCollection_Array1<gp_XY>();
+  myPoints     = NCollection_Array1<gp_Pnt>();
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void GeomAPI_BatchProjectPointOnSurf::Perform (const TColgp_Array1OfPnt& thePoints)
+{
+  if (thePoints.IsEmpty())
+  {
+    myIsDone = NCollection_Array1<Standard_Boolean>();
+    return;
+  }
+
+  const Standard_Integer aLower = thePoints.Lower(), anUpper = thePoints.Upper();
+  myIsDone     = NCollection_Array1<Standard_Boolean> (aLower, anUpper);
+  myDistances  = NCollection_Array1<Standard_Real>    (aLower, anUpper);
+  myParameters = NCollection_Array1<gp_XY>            (aLower, anUpper);
+  myPoints     = NCollection_Array1<gp_Pnt>           (aLower, anUpper);
+  myIsDone.Init (Standard_False);
+  if (mySurface.IsNull())
+  {
+    return;
+  }
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = myIsParallel
+                                    ? Min (thePoints.Size(), aThreadPool->NbDefaultThreadsToLaunch())
+                                    : 1;
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+  NCollection_Array1<GeomAPI_BatchProjectTLS> aTLS (aLauncher.LowerThreadIndex(), aLauncher.UpperThreadIndex());
+  GeomAPI_BatchProjectFunctor aFunctor (mySurface, myUMin, myUSup, myVMin, myVSup, myTolerance, myAlgo,
+                                        thePoints, aTLS, myIsDone, myDistances, myParameters, myPoints);
+  aLauncher.Perform (aLower, anUpper + 1, aFunctor);
+}
+
+//=======================================================================
+//function : LowerDistance
+//purpose  :
+//=======================================================================
+Standard_Real GeomAPI_BatchProjectPointOnSurf::LowerDistance (const Standard_Integer theIndex) const
+{
+  StdFail_NotDone_Raise_if (!myIsDone.Value (theIndex), "GeomAPI_BatchProjectPointOnSurf::LowerDistance");
+  return myDistances.Value (theIndex);
+}
+
+//=======================================================================
+//function : LowerDistanceParameters
+//purpose  :
+//=======================================================================
+void GeomAPI_BatchProjectPointOnSurf::LowerDistanceParameters (const Standard_Integer theIndex,
+                                                               Standard_Real& theU,
+                                                               Standard_Real& theV) const
+{
+  StdFail_NotDone_Raise_if (!myIsDone.Value (theIndex), "GeomAPI_BatchProjectPointOnSurf::LowerDistanceParameters");
+  theU = myParameters.Value (theIndex).X();
+  theV = myParameters.Value (theIndex).Y();
+}
+
+//=======================================================================
+//function : NearestPoint
+//purpose  :
+//=======================================================================
+gp_Pnt GeomAPI_BatchProjectPointOnSurf::NearestPoint (const Standard_Integer theIndex) const
+{
+  StdFail_NotDone_Raise_if (!myIsDone.Value (theIndex), "GeomAPI_BatchProjectPointOnSurf::NearestPoint");
+  return myPoints.Value (theIndex);
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _GeomAPI_BatchProjectPointOnSurf_HeaderFile
+#define _GeomAPI_BatchProjectPointOnSurf_HeaderFile
+
+#include <Extrema_ExtAlgo.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_XY.hxx>
+#include <NCollection_Array1.hxx>
+#include <Precision.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+
+class Geom_Surface;
+
+//! This class computes the nearest orthogonal projections of a set of points
+//! onto the same surface.
+//!
+//! Contrary to calling GeomAPI_ProjectPointOnSurf for each point, the sampling grid
+//! of the surface (and the tree of spheres for Extrema_ExtAlgo_Tree algorithm)
+//! is built only once per working thread and reused for all points processed by this thread.
+//! The points can be processed in parallel (see SetRunParallel()),
+//! in which case each thread uses its own copy of the surface adaptor.
+//!
+//! The results are accessed by the index of the point in the input array.
+class GeomAPI_BatchProjectPointOnSurf
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates an empty object. Use the Init() method for further initialization.
+  Standard_EXPORT GeomAPI_BatchProjectPointOnSurf();
+
+  //! Creates the projector onto the whole surface.
+  Standard_EXPORT GeomAPI_BatchProjectPointOnSurf (const Handle(Geom_Surface)& theSurface,
+                                                   const Standard_Real theTolerance = Precision::PConfusion(),
+                                                   const Extrema_ExtAlgo theAlgo = Extrema_ExtAlgo_Grad);
+
+  //! Initializes the projector onto the whole surface.
+  Standard_EXPORT void Init (const Handle(Geom_Surface)& theSurface,
+                             const Standard_Real theTolerance = Precision::PConfusion(),
+                             const Extrema_ExtAlgo theAlgo = Extrema_ExtAlgo_Grad);
+
+  //! Initializes the projector onto the domain [theUMin, theUSup] x [theVMin, theVSup] of the surface.
+  Standard_EXPORT void Init (const Handle(Geom_Surface)& theSurface,
+                             const Standard_Real theUMin,
+                             const Standard_Real theUSup,
+                             const Standard_Real theVMin,
+                             const Standard_Real theVSup,
+                             const Standard_Real theTolerance = Precision::PConfusion(),
+                             const Extrema_ExtAlgo theAlgo = Extrema_ExtAlgo_Grad);
+
+  //! Sets the flag of parallel processing of the points (FALSE by default).
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing of the points.
+  Standard_Boolean RunParallel() const { return myIsParallel; }
+
+  //! Performs the projection of the given points.
+  //! The results are accessible by the indices of the points in the given array.
+  Standard_EXPORT void Perform (const TColgp_Array1OfPnt& thePoints);
+
+  //! Returns the lower index of the processed points.
+  Standard_Integer Lower() const { return myIsDone.Lower(); }
+
+  //! Returns the upper index of the processed points.
+  Standard_Integer Upper() const { return myIsDone.Upper(); }
+
+  //! Returns the number of the processed points.
+  Standard_Integer NbPoints() const { return myIsDone.Size(); }
+
+  //! Returns TRUE if the projection of the point with the given index has been found.
+  Standard_Boolean IsDone (const Standard_Integer theIndex) const { return myIsDone.Value (theIndex); }
+
+  //! Returns the distance between the point with the given index and its nearest projection.
+  //! Exceptions: StdFail_NotDone if the projection of this point has failed.
+  Standard_EXPORT Standard_Real LowerDistance (const Standard_Integer theIndex) const;
+
+  //! Returns the parameters on the surface of the nearest projection of the point with the given index.
+  //! Exceptions: StdFail_NotDone if the projection of this point has failed.
+  Standard_EXPORT void LowerDistanceParameters (const Standard_Integer theIndex,
+                                                Standard_Real& theU,
+                                                Standard_Real& theV) const;
+
+  //! Returns the nearest projection of the point with the given index.
+  //! Exceptions: StdFail_NotDone if the projection of this point has failed.
+  Standard_EXPORT gp_Pnt NearestPoint (const Standard_Integer theIndex) const;
+
+private:
+
+  Handle(Geom_Surface) mySurface;
+  Standard_Real myUMin;
+  Standard_Real myUSup;
+  Standard_Real myVMin;
+  Standard_Real myVSup;
+  Standard_Real myTolerance;
+  Extrema_ExtAlgo myAlgo;
+  Standard_Boolean myIsParallel;
+
+  NCollection_Array1<Standard_Boolean> myIsDone;
+  NCollection_Array1<Standard_Real> myDistances;
+  NCollection_Array1<gp_XY> myParameters;
+  NCollection_Array1<gp_Pnt> myPoints;
+};
+
+#endif // _GeomAPI_BatchProjectPointOnSurf_HeaderFile
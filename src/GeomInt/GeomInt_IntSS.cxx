@@ -18,7 +18,24 @@
 
 #include <Adaptor3d_TopolTool.hxx>
 #include <GeomAdaptor_Surface.hxx>
+#include <GeomInt_IntSSCache.hxx>
 #include <Extrema_ExtPS.hxx>
+#include <Geom2d_Curve.hxx>
+
+namespace
+{
+  //! Copies the curves to avoid sharing of the cached geometry with the caller.
+  template<class TheSequence, class TheCurve>
+  static void copyCurves (const TheSequence& theFrom, TheSequence& theTo)
+  {
+    theTo.Clear();
+    for (typename TheSequence::Iterator anIt (theFrom); anIt.More(); anIt.Next())
+    {
+      const Handle(TheCurve)& aCurve = anIt.Value();
+      theTo.Append (aCurve.IsNull() ? aCurve : Handle(TheCurve)::DownCast (aCurve->Copy()));
+    }
+  }
+}
 
 //=======================================================================
 //function : Perform
@@ -77,7 +94,56 @@ void GeomInt_IntSS::Perform(const Handle(Geom_Surface)& S1,
   myTolReached2d = myTolReached3d = 0.0;
   myNbrestr = 0;
   sline.Clear();
-  
+  slineS1.Clear();
+  slineS2.Clear();
+
+  // Take the result from the cache of the intersections, if enabled
+  const Handle(GeomInt_IntSSCache)& aCache = GeomInt_IntSSCache::DefaultCache();
+  GeomInt_IntSSCache::Key aCacheKey;
+  const Standard_Boolean toUseCache = aCache->IsEnabled();
+  if (toUseCache)
+  {
+    aCacheKey.Surface1 = myHS1->Surface();
+    aCacheKey.Surface2 = myHS2->Surface();
+    Standard_Real* aValues = aCacheKey.Values;
+    aValues[0]  = myHS1->FirstUParameter();
+    aValues[1]  = myHS1->LastUParameter();
+    aValues[2]  = myHS1->FirstVParameter();
+    aValues[3]  = myHS1->LastVParameter();
+    aValues[4]  = myHS2->FirstUParameter();
+    aValues[5]  = myHS2->LastUParameter();
+    aValues[6]  = myHS2->FirstVParameter();
+    aValues[7]  = myHS2->LastVParameter();
+    aValues[8]  = Tol;
+    aValues[9]  = myTolCheck;
+    aValues[10] = myTolAngCheck;
+    if (useStart)
+    {
+      aValues[11] = U1;
+      aValues[12] = V1;
+      aValues[13] = U2;
+      aValues[14] = V2;
+    }
+    aCacheKey.Flags = (Approx   ? 0x01 : 0)
+                    | (ApproxS1 ? 0x02 : 0)
+                    | (ApproxS2 ? 0x04 : 0)
+                    | (useStart ? 0x08 : 0)
+                    | (myHS1 == myHS2 ? 0x10 : 0);
+
+    Handle(GeomInt_IntSSCache::Entry) anEntry = aCache->Find (aCacheKey);
+    if (!anEntry.IsNull())
+    {
+      myIntersector  = anEntry->Intersector;
+      myNbrestr      = anEntry->NbBoundaries;
+      myTolReached2d = anEntry->TolReached2d;
+      myTolReached3d = anEntry->TolReached3d;
+      copyCurves<TColGeom_SequenceOfCurve,   Geom_Curve>   (anEntry->Lines,     sline);
+      copyCurves<TColGeom2d_SequenceOfCurve, Geom2d_Curve> (anEntry->LinesOnS1, slineS1);
+      copyCurves<TColGeom2d_SequenceOfCurve, Geom2d_Curve> (anEntry->LinesOnS2, slineS2);
+      return;
+    }
+  }
+
   Standard_Real TolArc = Tol;
   Standard_Real TolTang = Tol;
   Standard_Real Deflection = 0.1;
@@ -151,6 +217,20 @@ void GeomInt_IntSS::Perform(const Handle(Geom_Surface)& S1,
       }
     }
   }
+
+  if (toUseCache)
+  {
+    Handle(GeomInt_IntSSCache::Entry) anEntry = new GeomInt_IntSSCache::Entry();
+    anEntry->Intersector  = myIntersector;
+    anEntry->NbBoundaries = myNbrestr;
+    anEntry->TolReached2d = myTolReached2d;
+    anEntry->TolReached3d = myTolReached3d;
+    copyCurves<TColGeom_SequenceOfCurve,   Geom_Curve>   (sline,   anEntry->Lines);
+    copyCurves<TColGeom2d_SequenceOfCurve, Geom2d_Curve> (slineS1, anEntry->LinesOnS1);
+    copyCurves<TColGeom2d_SequenceOfCurve, Geom2d_Curve> (slineS2, anEntry->LinesOnS2);
+    anEntry->EstimateSize (aCacheKey);
+    aCache->Add (aCacheKey, anEntry);
+  }
 }
 
 //=======================================================================
@@ -0,0 +1,426 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <GeomInt_IntSSCache.hxx>
+
+#include <Geom_BezierCurve.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BezierSurface.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_OffsetSurface.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
+#include <Geom_SweptSurface.hxx>
+#include <Geom_TrimmedCurve.hxx>
+#include <Geom2d_BezierCurve.hxx>
+#include <Geom2d_BSplineCurve.hxx>
+#include <Geom2d_TrimmedCurve.hxx>
+#include <IntPatch_Line.hxx>
+#include <IntPatch_Point.hxx>
+#include <IntPatch_PointLine.hxx>
+#include <IntSurf_PntOn2S.hxx>
+#include <Standard_HashUtils.hxx>
+
+#include <stdio.h>
+
+IMPLEMENT_STANDARD_RTTIEXT(GeomInt_IntSSCache, Standard_Transient)
+
+namespace
+{
+  //! Approximate size of the geometric object without arrays.
+  static const Standard_Size THE_GEOM_BASE_SIZE = 128;
+
+  //! Estimates the memory occupied by the 3D curve.
+  static Standard_Size curveSize (const Handle(Geom_Curve)& theCurve)
+  {
+    if (theCurve.IsNull())
+    {
+      return 0;
+    }
+    if (Handle(Geom_TrimmedCurve) aTrimmed = Handle(Geom_TrimmedCurve)::DownCast (theCurve))
+    {
+      return THE_GEOM_BASE_SIZE + curveSize (aTrimmed->BasisCurve());
+    }
+    if (Handle(Geom_BSplineCurve) aBSpline = Handle(Geom_BSplineCurve)::DownCast (theCurve))
+    {
+      return THE_GEOM_BASE_SIZE
+           + aBSpline->NbPoles() * (sizeof(gp_Pnt) + (aBSpline->IsRational() ? sizeof(Standard_Real) : 0))
+           + aBSpline->NbKnots() * (sizeof(Standard_Real) + sizeof(Standard_Integer));
+    }
+    if (Handle(Geom_BezierCurve) aBezier = Handle(Geom_BezierCurve)::DownCast (theCurve))
+    {
+      return THE_GEOM_BASE_SIZE + aBezier->NbPoles() * (sizeof(gp_Pnt) + sizeof(Standard_Real));
+    }
+    return THE_GEOM_BASE_SIZE;
+  }
+
+  //! Estimates the memory occupied by the 2D curve.
+  static Standard_Size curveSize (const Handle(Geom2d_Curve)& theCurve)
+  {
+    if (theCurve.IsNull())
+    {
+      return 0;
+    }
+    if (Handle(Geom2d_TrimmedCurve) aTrimmed = Handle(Geom2d_TrimmedCurve)::DownCast (theCurve))
+    {
+      return THE_GEOM_BASE_SIZE + curveSize (aTrimmed->BasisCurve());
+    }
+    if (Handle(Geom2d_BSplineCurve) aBSpline = Handle(Geom2d_BSplineCurve)::DownCast (theCurve))
+    {
+      return THE_GEOM_BASE_SIZE
+           + aBSpline->NbPoles() * (sizeof(gp_Pnt2d) + (aBSpline->IsRational() ? sizeof(Standard_Real) : 0))
+           + aBSpline->NbKnots() * (sizeof(Standard_Real) + sizeof(Standard_Integer));
+    }
+    if (Handle(Geom2d_BezierCurve) aBezier = Handle(Geom2d_BezierCurve)::DownCast (theCurve))
+    {
+      return THE_GEOM_BASE_SIZE + aBezier->NbPoles() * (sizeof(gp_Pnt2d) + sizeof(Standard_Real));
+    }
+    return THE_GEOM_BASE_SIZE;
+  }
+
+  //! Estimates the memory occupied by the surface.
+  static Standard_Size surfaceSize (const Handle(Geom_Surface)& theSurface)
+  {
+    if (theSurface.IsNull())
+    {
+      return 0;
+    }
+    if (Handle(Geom_RectangularTrimmedSurface) aTrimmed = Handle(Geom_RectangularTrimmedSurface)::DownCast (theSurface))
+    {
+      return THE_GEOM_BASE_SIZE + surfaceSize (aTrimmed->BasisSurface());
+    }
+    if (Handle(Geom_OffsetSurface) anOffset = Handle(Geom_OffsetSurface)::DownCast (theSurface))
+    {
+      return THE_GEOM_BASE_SIZE + surfaceSize (anOffset->BasisSurface());
+    }
+    if (Handle(Geom_SweptSurface) aSwept = Handle(Geom_SweptSurface)::DownCast (theSurface))
+    {
+      return THE_GEOM_BASE_SIZE + curveSize (aSwept->BasisCurve());
+    }
+    if (Handle(Geom_BSplineSurface) aBSpline = Handle(Geom_BSplineSurface)::DownCast (theSurface))
+    {
+      return THE_GEOM_BASE_SIZE
+           + aBSpline->NbUPoles() * aBSpline->NbVPoles()
+             * (sizeof(gp_Pnt) + (aBSpline->IsURational() || aBSpline->IsVRational() ? sizeof(Standard_Real) : 0))
+           + (aBSpline->NbUKnots() + aBSpline->NbVKnots()) * (sizeof(Standard_Real) + sizeof(Standard_Integer));
+    }
+    if (Handle(Geom_BezierSurface) aBezier = Handle(Geom_BezierSurface)::DownCast (theSurface))
+    {
+      return THE_GEOM_BASE_SIZE + aBezier->NbUPoles() * aBezier->NbVPoles() * (sizeof(gp_Pnt) + sizeof(Standard_Real));
+    }
+    return THE_GEOM_BASE_SIZE;
+  }
+}
+
+//=======================================================================
+//function : HashCode
+//purpose  :
+//=======================================================================
+size_t GeomInt_IntSSCache::Key::HashCode() const
+{
+  const Standard_Transient* aSurfaces[2] = { Surface1.get(), Surface2.get() };
+  size_t aHash = opencascade::hashBytes (aSurfaces, sizeof(aSurfaces));
+  aHash ^= opencascade::hashBytes (Values, sizeof(Values)) + 0x9e3779b9 + (aHash << 6) + (aHash >> 2);
+  aHash ^= static_cast<size_t> (Flags) + 0x9e3779b9 + (aHash << 6) + (aHash >> 2);
+  return aHash;
+}
+
+//=======================================================================
+//function : IsEqual
+//purpose  :
+//=======================================================================
+bool GeomInt_IntSSCache::Key::IsEqual (const Key& theOther) const
+{
+  if (Surface1 != theOther.Surface1
+   || Surface2 != theOther.Surface2
+   || Flags    != theOther.Flags)
+  {
+    return false;
+  }
+  for (Standard_Integer i = 0; i < NbValues; ++i)
+  {
+    if (Values[i] != theOther.Values[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//=======================================================================
+//function : EstimateSize
+//purpose  :
+//=======================================================================
+Standard_Size GeomInt_IntSSCache::Key::EstimateSize() const
+{
+  // the surfaces may be released by the model while they are referred by the cache
+  Standard_Size aSize = surfaceSize (Surface1);
+  if (Surface2 != Surface1)
+  {
+    aSize += surfaceSize (Surface2);
+  }
+  return aSize;
+}
+
+//=======================================================================
+//function : EstimateSize
+//purpose  :
+//=======================================================================
+void GeomInt_IntSSCache::Entry::EstimateSize (const Key& theKey)
+{
+  Size = sizeof(Entry) + theKey.EstimateSize();
+  for (TColGeom_SequenceOfCurve::Iterator anIt (Lines); anIt.More(); anIt.Next())
+  {
+    Size += curveSize (anIt.Value());
+  }
+  for (TColGeom2d_SequenceOfCurve::Iterator anIt (LinesOnS1); anIt.More(); anIt.Next())
+  {
+    Size += curveSize (anIt.Value());
+  }
+  for (TColGeom2d_SequenceOfCurve::Iterator anIt (LinesOnS2); anIt.More(); anIt.Next())
+  {
+    Size += curveSize (anIt.Value());
+  }
+
+  if (!Intersector.IsDone())
+  {
+    return;
+  }
+  Size += Intersector.NbPnts() * sizeof(IntPatch_Point);
+  for (Standard_Integer aLineIter = 1; aLineIter <= Intersector.NbLines(); ++aLineIter)
+  {
+    const Handle(IntPatch_Line)& aLine = Intersector.Line (aLineIter);
+    Size += THE_GEOM_BASE_SIZE;
+    if (Handle(IntPatch_PointLine) aPointLine = Handle(IntPatch_PointLine)::DownCast (aLine))
+    {
+      Size += aPointLine->NbPnts() * sizeof(IntSurf_PntOn2S)
+            + aPointLine->NbVertex() * sizeof(IntPatch_Point);
+    }
+  }
+}
+
+//=======================================================================
+//function : DefaultCache
+//purpose  :
+//=======================================================================
+const Handle(GeomInt_IntSSCache)& GeomInt_IntSSCache::DefaultCache()
+{
+  static const Handle(GeomInt_IntSSCache) THE_CACHE = new GeomInt_IntSSCache();
+  return THE_CACHE;
+}
+
+//=======================================================================
+//function : GeomInt_IntSSCache
+//purpose  :
+//=======================================================================
+GeomInt_IntSSCache::GeomInt_IntSSCache()
+: myIsEnabled (Standard_False),
+  myMemoryLimit (64 * 1024 * 1024),
+  myMemoryUsed (0),
+  myClock (0),
+  myNbHits (0),
+  myNbMisses (0)
+{
+}
+
+//=======================================================================
+//function : SetEnabled
+//purpose  :
+//=======================================================================
+void GeomInt_IntSSCache::SetEnabled (const Standard_Boolean theIsEnabled)
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  myIsEnabled = theIsEnabled;
+  if (!theIsEnabled)
+  {
+    myEntries.Clear();
+    myMemoryUsed = 0;
+  }
+}
+
+//=======================================================================
+//function : SetMemoryLimit
+//purpose  :
+//=======================================================================
+void GeomInt_IntSSCache::SetMemoryLimit (const Standard_Size theLimit)
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  myMemoryLimit = theLimit;
+  shrink (myMemoryLimit);
+}
+
+//=======================================================================
+//function : MemoryLimit
+//purpose  :
+//=======================================================================
+Standard_Size GeomInt_IntSSCache::MemoryLimit() const
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  return myMemoryLimit;
+}
+
+//=======================================================================
+//function : MemoryUsed
+//purpose  :
+//=======================================================================
+Standard_Size GeomInt_IntSSCache::MemoryUsed() const
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  return myMemoryUsed;
+}
+
+//=======================================================================
+//function : NbEntries
+//purpose  :
+//=======================================================================
+Standard_Integer GeomInt_IntSSCache::NbEntries() const
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  return myEntries.Extent();
+}
+
+//=======================================================================
+//function : NbHits
+//purpose  :
+//=======================================================================
+Standard_Size GeomInt_IntSSCache::NbHits() const
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  return myNbHits;
+}
+
+//=======================================================================
+//function : NbMisses
+//purpose  :
+//=======================================================================
+Standard_Size GeomInt_IntSSCache::NbMisses() const
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  return myNbMisses;
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void GeomInt_IntSSCache::Clear()
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  myEntries.Clear();
+  myMemoryUsed = 0;
+}
+
+//=======================================================================
+//function : ResetCounters
+//purpose  :
+//=======================================================================
+void GeomInt_IntSSCache::ResetCounters()
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  myNbHits = 0;
+  myNbMisses = 0;
+}
+
+//=======================================================================
+//function : Find
+//purpose  :
+//=======================================================================
+Handle(GeomInt_IntSSCache::Entry) GeomInt_IntSSCache::Find (const Key& theKey)
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  Handle(Entry)* anEntry = myEntries.ChangeSeek (theKey);
+  if (anEntry == NULL)
+  {
+    ++myNbMisses;
+    return Handle(Entry)();
+  }
+
+  ++myNbHits;
+  (*anEntry)->Stamp = ++myClock;
+  return *anEntry;
+}
+
+//=======================================================================
+//function : Add
+//purpose  :
+//=======================================================================
+void GeomInt_IntSSCache::Add (const Key& theKey,
+                              const Handle(Entry)& theEntry)
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  if (!myIsEnabled
+    || theEntry->Size > myMemoryLimit)
+  {
+    return;
+  }
+
+  if (Handle(Entry)* anOld = myEntries.ChangeSeek (theKey))
+  {
+    // the same intersection computed concurrently
+    myMemoryUsed -= (*anOld)->Size;
+    myEntries.UnBind (theKey);
+  }
+
+  shrink (myMemoryLimit - theEntry->Size);
+  theEntry->Stamp = ++myClock;
+  myEntries.Bind (theKey, theEntry);
+  myMemoryUsed += theEntry->Size;
+}
+
+//=======================================================================
+//function : shrink
+//purpose  :
+//=======================================================================
+void GeomInt_IntSSCache::shrink (const Standard_Size theLimit)
+{
+  while (myMemoryUsed > theLimit
+     && !myEntries.IsEmpty())
+  {
+    const Key* anOldest = NULL;
+    Standard_Size anOldestStamp = 0;
+    for (NCollection_DataMap<Key, Handle(Entry), KeyHasher>::Iterator anIt (myEntries); anIt.More(); anIt.Next())
+    {
+      if (anOldest == NULL
+       || anIt.Value()->Stamp < anOldestStamp)
+      {
+        anOldest = &anIt.Key();
+        anOldestStamp = anIt.Value()->Stamp;
+      }
+    }
+
+    const Key anOldestKey = *anOldest;
+    myMemoryUsed -= myEntries.Find (anOldestKey)->Size;
+    myEntries.UnBind (anOldestKey);
+  }
+}
+
+//=======================================================================
+//function : Dump
+//purpose  :
+//=======================================================================
+void GeomInt_IntSSCache::Dump (Standard_OStream& theOS) const
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  const Standard_Size aNbRequests = myNbHits + myNbMisses;
+  char aBuf[256];
+  Sprintf (aBuf, "Surface/surface intersection cache: %s\n", myIsEnabled.load() ? "enabled" : "disabled");
+  theOS << aBuf;
+  Sprintf (aBuf, " Entries: %d\n", myEntries.Extent());
+  theOS << aBuf;
+  Sprintf (aBuf, " Memory: %.3f / %.3f MiB\n",
+           Standard_Real (myMemoryUsed) / (1024.0 * 1024.0), Standard_Real (myMemoryLimit) / (1024.0 * 1024.0));
+  theOS << aBuf;
+  Sprintf (aBuf, " Hits: %lu\n Misses: %lu\n Hit rate: %.1f %%\n",
+           (unsigned long )myNbHits, (unsigned long )myNbMisses,
+           aNbRequests != 0 ? 100.0 * Standard_Real (myNbHits) / Standard_Real (aNbRequests) : 0.0);
+  theOS << aBuf;
+}
@@ -0,0 +1,175 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _GeomInt_IntSSCache_HeaderFile
+#define _GeomInt_IntSSCache_HeaderFile
+
+#include <Geom_Surface.hxx>
+#include <IntPatch_Intersection.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_OStream.hxx>
+#include <TColGeom_SequenceOfCurve.hxx>
+#include <TColGeom2d_SequenceOfCurve.hxx>
+
+#include <atomic>
+
+//! Process-wide cache of the results of the intersection of two surfaces
+//! computed by GeomInt_IntSS.
+//!
+//! The results are identified by the handles of the intersected surfaces,
+//! their parameter ranges, the tolerances, the approximation flags and the starting point.
+//! Thus, the cache is useful when the same pair of surfaces is intersected repeatedly.
+//! The surfaces must not be modified while the results of their intersection are kept in the cache.
+//!
+//! The cache is disabled by default. When enabled, the least recently used results
+//! are removed from the cache as soon as the estimated memory occupied by the cached
+//! results exceeds the limit (see SetMemoryLimit()).
+//! The cache is protected by the mutex and may be used from several threads.
+class GeomInt_IntSSCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(GeomInt_IntSSCache, Standard_Transient)
+public:
+
+  //! Identifier of the intersection.
+  struct Key
+  {
+    //! Number of the real parameters of the intersection.
+    static const Standard_Integer NbValues = 16;
+
+    Handle(Geom_Surface) Surface1;         //!< first surface
+    Handle(Geom_Surface) Surface2;         //!< second surface
+    Standard_Real        Values[NbValues]; //!< ranges, tolerances and starting point
+    Standard_Integer     Flags;            //!< approximation flags and usage of the starting point
+
+    Key() : Flags (0)
+    {
+      for (Standard_Integer i = 0; i < NbValues; ++i)
+      {
+        Values[i] = 0.0;
+      }
+    }
+
+    //! Returns hash code of the key.
+    Standard_EXPORT size_t HashCode() const;
+
+    //! Returns TRUE if the keys are equal.
+    Standard_EXPORT bool IsEqual (const Key& theOther) const;
+
+    //! Estimates the memory occupied by the surfaces, which are kept alive by the key.
+    Standard_EXPORT Standard_Size EstimateSize() const;
+  };
+
+  //! Hasher of the keys.
+  struct KeyHasher
+  {
+    size_t operator() (const Key& theKey) const { return theKey.HashCode(); }
+    bool operator() (const Key& theKey1, const Key& theKey2) const { return theKey1.IsEqual (theKey2); }
+  };
+
+  //! Cached result of the intersection.
+  //! The copy of the intersector shares the intersection lines (IntPatch_Line) with the
+  //! intersector of the algorithm the result is taken from, and with the algorithms the result
+  //! is given to. The lines are not modified after the intersection is computed, so that
+  //! they are not copied.
+  class Entry : public Standard_Transient
+  {
+    DEFINE_STANDARD_RTTI_INLINE(Entry, Standard_Transient)
+  public:
+    IntPatch_Intersection      Intersector;  //!< intersection lines (shared) and points
+    TColGeom_SequenceOfCurve   Lines;        //!< 3D curves (boundaries first)
+    TColGeom2d_SequenceOfCurve LinesOnS1;    //!< 2D curves on the first surface
+    TColGeom2d_SequenceOfCurve LinesOnS2;    //!< 2D curves on the second surface
+    Standard_Integer           NbBoundaries; //!< number of the boundaries
+    Standard_Real              TolReached2d; //!< reached 2D tolerance
+    Standard_Real              TolReached3d; //!< reached 3D tolerance
+    Standard_Size              Size;         //!< estimated memory with the surfaces of the key, in bytes
+    Standard_Size              Stamp;        //!< time of the last access
+
+    Entry() : NbBoundaries (0), TolReached2d (0.0), TolReached3d (0.0), Size (0), Stamp (0) {}
+
+    //! Estimates the memory occupied by the result and by the surfaces kept alive
+    //! by its key, and stores it in the Size field.
+    Standard_EXPORT void EstimateSize (const Key& theKey);
+  };
+
+public:
+
+  //! Returns the process-wide cache.
+  Standard_EXPORT static const Handle(GeomInt_IntSSCache)& DefaultCache();
+
+  //! Creates the disabled cache with the memory limit of 64 MiB.
+  Standard_EXPORT GeomInt_IntSSCache();
+
+  //! Returns TRUE if the cache is enabled.
+  Standard_Boolean IsEnabled() const { return myIsEnabled.load(); }
+
+  //! Enables or disables the cache. Disabling the cache clears it.
+  Standard_EXPORT void SetEnabled (const Standard_Boolean theIsEnabled);
+
+  //! Returns the limit of the memory occupied by the cached results, in bytes.
+  Standard_EXPORT Standard_Size MemoryLimit() const;
+
+  //! Sets the limit of the memory occupied by the cached results, in bytes.
+  //! The least recently used results are removed to fit the new limit.
+  Standard_EXPORT void SetMemoryLimit (const Standard_Size theLimit);
+
+  //! Returns the estimated memory occupied by the cached results, in bytes.
+  Standard_EXPORT Standard_Size MemoryUsed() const;
+
+  //! Returns the number of the cached results.
+  Standard_EXPORT Standard_Integer NbEntries() const;
+
+  //! Returns the number of the requests answered from the cache.
+  Standard_EXPORT Standard_Size NbHits() const;
+
+  //! Returns the number of the requests not found in the cache.
+  Standard_EXPORT Standard_Size NbMisses() const;
+
+  //! Removes all results from the cache.
+  Standard_EXPORT void Clear();
+
+  //! Resets the counters of hits and misses.
+  Standard_EXPORT void ResetCounters();
+
+  //! Finds the result of the intersection and updates the counters.
+  //! Returns null handle if the result is not cached.
+  Standard_EXPORT Handle(Entry) Find (const Key& theKey);
+
+  //! Adds the result of the intersection into the cache.
+  //! The result is not cached if its size exceeds the memory limit.
+  Standard_EXPORT void Add (const Key& theKey, const Handle(Entry)& theEntry);
+
+  //! Dumps the state and the counters of the cache.
+  Standard_EXPORT void Dump (Standard_OStream& theOS) const;
+
+private:
+
+  //! Removes the least recently used results until the memory fits the limit.
+  void shrink (const Standard_Size theLimit);
+
+private:
+
+  NCollection_DataMap<Key, Handle(Entry), KeyHasher> myEntries;
+  mutable Standard_Mutex myMutex;
+  std::atomic<bool> myIsEnabled; //!< read without locking by each intersection
+  Standard_Size myMemoryLimit;
+  Standard_Size myMemoryUsed;
+  Standard_Size myClock;
+  Standard_Size myNbHits;
+  Standard_Size myNbMisses;
+};
+
+DEFINE_STANDARD_HANDLE(GeomInt_IntSSCache, Standard_Transient)
+
+#endif // _GeomInt_IntSSCache_HeaderFile
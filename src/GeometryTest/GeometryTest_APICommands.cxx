@@ -19,6 +19,8 @@
 #include <DrawTrSurf.hxx>
 #include <Draw_Appli.hxx>
 #include <GeometryTest.hxx>
+#include <GeomAPI_BatchProjectPointOnCurve.hxx>
+#include <GeomAPI_BatchProjectPointOnSurf.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
 #include <Extrema_GenLocateExtPS.hxx>
@@ -35,6 +37,8 @@
 #include <Message.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #include <TColgp_Array2OfPnt.hxx>
+#include <NCollection_Vector.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <TColStd_Array2OfReal.hxx>
 #include <Precision.hxx>
 #include <stdio.h>
@@ -743,6 +747,105 @@ static Standard_Integer totalextcc(Draw_Interpretor& di, Standard_Integer n, con
 }
 
 
+//=======================================================================
+//function : projpoints
+//purpose  : 
+//=======================================================================
+static Standard_Integer projpoints (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n < 5)
+  {
+    di.PrintHelp (a[0]);
+    return 1;
+  }
+
+  Handle(Geom_Curve)   aCurve = DrawTrSurf::GetCurve (a[1]);
+  Handle(Geom_Surface) aSurf;
+  if (aCurve.IsNull())
+  {
+    aSurf = DrawTrSurf::GetSurface (a[1]);
+    if (aSurf.IsNull())
+    {
+      di << "Syntax error: " << a[1] << " is neither a curve nor a surface\n";
+      return 1;
+    }
+  }
+
+  Standard_Boolean isParallel = Standard_False;
+  Extrema_ExtAlgo anAlgo = Extrema_ExtAlgo_Grad;
+  NCollection_Vector<gp_Pnt> aPoints;
+  for (Standard_Integer anArgIter = 2; anArgIter < n; ++anArgIter)
+  {
+    TCollection_AsciiString anArg (a[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-parallel")
+    {
+      isParallel = Standard_True;
+    }
+    else if (anArg == "-tree"
+          && !aSurf.IsNull())
+    {
+      anAlgo = Extrema_ExtAlgo_Tree;
+    }
+    else if (anArgIter + 2 < n)
+    {
+      aPoints.Append (gp_Pnt (Draw::Atof (a[anArgIter]), Draw::Atof (a[anArgIter + 1]), Draw::Atof (a[anArgIter + 2])));
+      anArgIter += 2;
+    }
+    else
+    {
+      di << "Syntax error at '" << a[anArgIter] << "'\n";
+      return 1;
+    }
+  }
+  if (aPoints.IsEmpty())
+  {
+    di << "Syntax error: no points to project\n";
+    return 1;
+  }
+
+  TColgp_Array1OfPnt anArray (1, aPoints.Length());
+  for (Standard_Integer i = 1; i <= aPoints.Length(); ++i)
+  {
+    anArray.SetValue (i, aPoints.Value (i - 1));
+  }
+
+  if (!aCurve.IsNull())
+  {
+    GeomAPI_BatchProjectPointOnCurve aProjector (aCurve);
+    aProjector.SetRunParallel (isParallel);
+    aProjector.Perform (anArray);
+    for (Standard_Integer i = aProjector.Lower(); i <= aProjector.Upper(); ++i)
+    {
+      di << "Point " << i << ": ";
+      if (!aProjector.IsDone (i))
+      {
+        di << "projection failed\n";
+        continue;
+      }
+      di << "distance " << aProjector.LowerDistance (i) << " parameter " << aProjector.LowerDistanceParameter (i) << "\n";
+    }
+    return 0;
+  }
+
+  GeomAPI_BatchProjectPointOnSurf aProjector (aSurf, Precision::PConfusion(), anAlgo);
+  aProjector.SetRunParallel (isParallel);
+  aProjector.Perform (anArray);
+  for (Standard_Integer i = aProjector.Lower(); i <= aProjector.Upper(); ++i)
+  {
+    di << "Point " << i << ": ";
+    if (!aProjector.IsDone (i))
+    {
+      di << "projection failed\n";
+      continue;
+    }
+    Standard_Real aU = 0.0, aV = 0.0;
+    aProjector.LowerDistanceParameters (i, aU, aV);
+    di << "distance " << aProjector.LowerDistance (i) << " parameters " << aU << " " << aV << "\n";
+  }
+  return 0;
+}
+
 void GeometryTest::APICommands(Draw_Interpretor& theCommands)
 {
   static Standard_Boolean done = Standard_False;
@@ -754,6 +857,11 @@ void GeometryTest::APICommands(Draw_Interpretor& theCommands)
                   "\t\tOptional parameters are relevant to surf only.\n"
                   "\t\tIf initial {u v} are given then local extrema is called",__FILE__, proj);
 
+  theCommands.Add("projpoints", "projpoints curve/surf [-parallel] [-tree] x1 y1 z1 [x2 y2 z2 ...]\n"
+                  "\t\tComputes the nearest projections of the points on the curve or surface in one batch.\n"
+                  "\t\t-parallel - process the points in parallel;\n"
+                  "\t\t-tree     - use Tree extrema algorithm instead of Grad (surface only)",__FILE__, projpoints);
+
   theCommands.Add("appro", "appro result nbpoint [curve]",__FILE__, appro);
   theCommands.Add("surfapp","surfapp result nbupoint nbvpoint x y z ....",
 		  __FILE__,
@@ -30,6 +30,7 @@
 #include <GeomAPI.hxx>
 #include <GeomAPI_IntCS.hxx>
 #include <GeomAPI_IntSS.hxx>
+#include <GeomInt_IntSSCache.hxx>
 
 //#include <GeomLProp.hxx>
 #include <GeomProjLib.hxx>
@@ -1472,6 +1473,66 @@ static Standard_Integer surfpoints (Draw_Interpretor& /*di*/, Standard_Integer /
 
 
 
+//=======================================================================
+//function : intsscache
+//purpose  : Manages the cache of surface/surface intersections
+//=======================================================================
+static Standard_Integer intsscache (Draw_Interpretor& theDI,
+                                    Standard_Integer theNArg,
+                                    const char** theArgVec)
+{
+  const Handle(GeomInt_IntSSCache)& aCache = GeomInt_IntSSCache::DefaultCache();
+  for (Standard_Integer anArgIter = 1; anArgIter < theNArg; ++anArgIter)
+  {
+    TCollection_AsciiString anArg (theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-enable"
+     || anArg == "-disable")
+    {
+      Standard_Boolean toEnable = anArg == "-enable";
+      if (anArgIter + 1 < theNArg
+       && Draw::ParseOnOff (theArgVec[anArgIter + 1], toEnable))
+      {
+        if (anArg == "-disable")
+        {
+          toEnable = !toEnable;
+        }
+        ++anArgIter;
+      }
+      aCache->SetEnabled (toEnable);
+    }
+    else if (anArg == "-limit"
+          && anArgIter + 1 < theNArg)
+    {
+      const Standard_Real aLimitMiB = Draw::Atof (theArgVec[++anArgIter]);
+      if (aLimitMiB < 0.0)
+      {
+        theDI << "Syntax error: wrong memory limit\n";
+        return 1;
+      }
+      aCache->SetMemoryLimit ((Standard_Size )(aLimitMiB * 1024.0 * 1024.0));
+    }
+    else if (anArg == "-clear")
+    {
+      aCache->Clear();
+    }
+    else if (anArg == "-reset")
+    {
+      aCache->ResetCounters();
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'\n";
+      return 1;
+    }
+  }
+
+  Standard_SStream aSStream;
+  aCache->Dump (aSStream);
+  theDI << aSStream;
+  return 0;
+}
+
 //=======================================================================
 //function : intersect
 //purpose  : 
@@ -1811,6 +1872,17 @@ void  GeometryTest::CurveCommands(Draw_Interpretor& theCommands)
 		  __FILE__,
 		  intersection,g);
 
+  theCommands.Add("intsscache",
+                  "intsscache [-enable [on|off]] [-disable] [-limit sizeMiB] [-clear] [-reset]\n"
+                  "\t\tManages the process-wide cache of surface/surface intersections (disabled by default)\n"
+                  "\t\tand prints its state, memory usage and hit rate.\n"
+                  "\t\t-enable, -disable - enable or disable (and clear) the cache;\n"
+                  "\t\t-limit - set the memory limit in MiB;\n"
+                  "\t\t-clear - remove all cached results;\n"
+                  "\t\t-reset - reset the counters of hits and misses.",
+		  __FILE__,
+		  intsscache,g);
+
   theCommands.Add("crvpoints",
 		  "crvpoints result <curve or wire> deflection",
 		  __FILE__,
@@ -164,6 +164,13 @@ static Handle(IGESData_DefaultSpecific)   speci;
   Interface_Static::Init ("XSTEP","read.iges.faulty.entities",'&',"eval On");
   Interface_Static::SetIVal ("read.iges.faulty.entities",0);
 
+  // parallel decoding of the entities when loading IGES file
+  Interface_Static::Init ("XSTEP","read.iges.parallel",'e',"");
+  Interface_Static::Init ("XSTEP","read.iges.parallel",'&',"ematch 0");
+  Interface_Static::Init ("XSTEP","read.iges.parallel",'&',"eval Off");
+  Interface_Static::Init ("XSTEP","read.iges.parallel",'&',"eval On");
+  Interface_Static::SetIVal ("read.iges.parallel",0);
+
   //ika added parameter for writing planes mode 2.11.2012 
   Interface_Static::Init ("XSTEP","write.iges.plane.mode",'e',"");
   Interface_Static::Init ("XSTEP","write.iges.plane.mode",'&',"ematch 0");
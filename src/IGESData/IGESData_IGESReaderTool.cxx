@@ -34,6 +34,10 @@
 #include <Interface_ParamList.hxx>
 #include <Interface_ReaderModule.hxx>
 #include <Message_Msg.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
 #include <Standard_Transient.hxx>
 #include <TCollection_HAsciiString.hxx>
 
@@ -43,10 +47,57 @@
 IGESData_IGESReaderTool::IGESData_IGESReaderTool
   (const Handle(IGESData_IGESReaderData)& reader,
    const Handle(IGESData_Protocol)& protocol)
-      : theglib(protocol) , therlib(protocol)
+      : theglib(protocol) , therlib(protocol) , myIsParallel (Standard_False)
       {  SetData (reader,protocol);  }
 
 
+//! Functor decoding one record into the entity bound to it.
+class IGESData_IGESReaderTool::ReadEntityFunctor
+{
+public:
+
+  ReadEntityFunctor (const IGESData_IGESReaderTool& theTool,
+                     const Handle(Interface_FileReaderData)& theData,
+                     const NCollection_Vector<Standard_Integer>& theRecords,
+                     NCollection_Array1<Handle(Interface_Check)>& theChecks,
+                     NCollection_Array1<Standard_Integer>& theStatus)
+  : myTool (theTool), myData (theData), myRecords (theRecords),
+    myChecks (theChecks), myStatus (theStatus) {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    const Standard_Integer num = myRecords.Value (theIndex);
+    DeclareAndCast(IGESData_IGESEntity,ent,myData->BoundEntity(num));
+    DeclareAndCast(IGESData_IGESReaderData,igesdat,myData);
+    if (ent.IsNull()) return;
+
+    Handle(Interface_Check) ach = new Interface_Check(ent);
+    IGESData_ReadStage aStage = IGESData_ReadDir;
+    try {
+      OCC_CATCH_SIGNALS
+      const Standard_Boolean isOk = myTool.analyseRecord (num,igesdat->DirType(num),ent,ach,aStage);
+      myChecks.ChangeValue (num) = ach;
+      myStatus.ChangeValue (num) = (isOk ? 1 : 2);
+    }
+    catch (Standard_Failure const&) {
+      // the record is left for sequential reading, which reports the failure
+      myChecks.ChangeValue (num).Nullify();
+      myStatus.ChangeValue (num) = 0;
+    }
+  }
+
+private:
+  ReadEntityFunctor& operator= (const ReadEntityFunctor&);
+
+private:
+  const IGESData_IGESReaderTool& myTool;
+  Handle(Interface_FileReaderData) myData;
+  const NCollection_Vector<Standard_Integer>& myRecords;
+  NCollection_Array1<Handle(Interface_Check)>& myChecks;
+  NCollection_Array1<Standard_Integer>& myStatus;
+};
+
+
 //  ###########################################################################
 //  ########                        PREPARATION                        ########
 
@@ -100,6 +151,33 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
   if (thegradweight > 0)
     { themaxweight = themaxweight/thegradweight; thegradweight = 1; }
   thedefweight = igesdat->DefaultLineWeight();
+
+  if (myIsParallel) readEntitiesParallel();
+}
+
+
+//=======================================================================
+//function : readEntitiesParallel
+//purpose  : 
+//=======================================================================
+
+    void IGESData_IGESReaderTool::readEntitiesParallel ()
+{
+  Handle(Interface_FileReaderData) aData = Data();
+  const Standard_Integer nbr = aData->NbRecords();
+  myReadChecks = NCollection_Array1<Handle(Interface_Check)>();
+  myReadStatus = NCollection_Array1<Standard_Integer>();
+  if (nbr < 1) return;
+
+  NCollection_Vector<Standard_Integer> aRecords;
+  for (Standard_Integer num = aData->FindNextRecord(0); num > 0; num = aData->FindNextRecord(num))
+    aRecords.Append (num);
+
+  myReadChecks = NCollection_Array1<Handle(Interface_Check)> (1,nbr);
+  myReadStatus = NCollection_Array1<Standard_Integer> (1,nbr);
+  myReadStatus.Init (0);
+  ReadEntityFunctor aFunctor (*this,aData,aRecords,myReadChecks,myReadStatus);
+  OSD_Parallel::For (0,aRecords.Length(),aFunctor);
 }
 
 
@@ -108,10 +186,35 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
   (const Standard_Integer num, const Handle(Standard_Transient)& anent,
    Handle(Interface_Check)& ach)
 {
+  DeclareAndCast(IGESData_IGESEntity,ent,anent);
+
+//  Record already decoded by readEntitiesParallel : take its messages
+  if (num >= myReadStatus.Lower() && num <= myReadStatus.Upper() &&
+      myReadStatus.Value(num) != 0 && anent == Data()->BoundEntity(num)) {
+    const Standard_Boolean isOk = (myReadStatus.Value(num) == 1);
+    myReadStatus.ChangeValue(num) = 0;
+    ach->GetMessages (myReadChecks.Value(num));
+    myReadChecks.ChangeValue(num).Nullify();
+    return (isOk && !ach->HasFailed());
+  }
+  DeclareAndCast(IGESData_IGESReaderData,igesdat,Data());
+  return analyseRecord (num,igesdat->DirType(num),ent,ach,thestep);
+}
+
+
+//=======================================================================
+//function : analyseRecord
+//purpose  : 
+//=======================================================================
+
+    Standard_Boolean  IGESData_IGESReaderTool::analyseRecord
+  (const Standard_Integer num, const IGESData_IGESType& theType,
+   const Handle(IGESData_IGESEntity)& ent,
+   Handle(Interface_Check)& ach, IGESData_ReadStage& theStage) const
+{
 
   Handle(TCollection_HAsciiString) lab;
 
-  DeclareAndCast(IGESData_IGESEntity,ent,anent);
   DeclareAndCast(IGESData_IGESReaderData,igesdat,Data());
 
 //  Demarrage de la lecture : Faire Clear
@@ -122,11 +225,11 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
   if (!undent.IsNull()) {
     IGESData_DirPart DP = igesdat->DirPart(num);    // qui le copie ...
     undent->ReadDir (igesdat,DP,ach);               // DP a pu etre modifie
-    ReadDir (ent,igesdat,DP,ach);                   // Lecture avec ce DP
+    ReadDir (num,theType,ent,igesdat,DP,ach);       // Lecture avec ce DP
   }
-  else ReadDir (ent,igesdat,igesdat->DirPart(num),ach);
+  else ReadDir (num,theType,ent,igesdat,igesdat->DirPart(num),ach);
 
-  thestep = IGESData_ReadDir;
+  theStage = IGESData_ReadDir;
 
 //   Liste de Parametres : controle de son entete
 //  Handle(Interface_ParamList) list = Data()->Params(num);
@@ -137,7 +240,7 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
     if (!undent.IsNull()) return Standard_True;
     // Sending of message : DE : no parameter
     Message_Msg Msg27 ("XSTEP_27");
-    Msg27.Arg(thecnum);
+    Msg27.Arg(num);
     ach->SendFail(Msg27);
     return Standard_False;
   }
@@ -146,23 +249,23 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
     { 
      // Sending of message : DE : Incorrect type 
       Message_Msg Msg28 ("XSTEP_28");
-      Msg28.Arg(thecnum);
+      Msg28.Arg(num);
       ach->SendFail(Msg28);  
       return Standard_False; 
     }
 
   IGESData_ParamReader PR (thelist,ach,n0par,nbpar,num);
-  thestep = IGESData_ReadOwn;
+  theStage = IGESData_ReadOwn;
   ReadOwnParams (ent,igesdat,PR);
-  if ((thestep = PR.Stage()) == IGESData_ReadOwn) PR.NextStage();
-  if (thestep == IGESData_ReadEnd) {
+  if ((theStage = PR.Stage()) == IGESData_ReadOwn) PR.NextStage();
+  if (theStage == IGESData_ReadEnd) {
     if (!PR.IsCheckEmpty()) ach = PR.Check();
     return (!ach->HasFailed());
   }
 
   ReadAssocs (ent,igesdat,PR);
-  if ((thestep = PR.Stage()) == IGESData_ReadAssocs) PR.NextStage();
-  if (thestep == IGESData_ReadEnd) {
+  if ((theStage = PR.Stage()) == IGESData_ReadAssocs) PR.NextStage();
+  if (theStage == IGESData_ReadEnd) {
     if (!PR.IsCheckEmpty()) ach = PR.Check();
     return (!ach->HasFailed());
   }
@@ -193,6 +296,15 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
   (const Handle(IGESData_IGESEntity)& ent,
    const Handle(IGESData_IGESReaderData)& IR,
    const IGESData_DirPart& DP, Handle(Interface_Check)& ach) const 
+{
+  ReadDir (thecnum,thectyp,ent,IR,DP,ach);
+}
+
+    void  IGESData_IGESReaderTool::ReadDir
+  (const Standard_Integer num, const IGESData_IGESType& theType,
+   const Handle(IGESData_IGESEntity)& ent,
+   const Handle(IGESData_IGESReaderData)& IR,
+   const IGESData_DirPart& DP, Handle(Interface_Check)& ach) const 
 { 
     
   Standard_Integer v[17] = {};
@@ -212,8 +324,8 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
     if (Lnf.IsNull()) {
       // Sending of message : Incorrect Line Font Pattern
       Message_Msg Msg29 ("XSTEP_29");
-      Msg29.Arg(thecnum);
-      Msg29.Arg(thectyp.Type());
+      Msg29.Arg(num);
+      Msg29.Arg(theType.Type());
       ach->SendWarning(Msg29);
       ent->InitDirFieldEntity(4,fieldent);
     }
@@ -228,8 +340,8 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
     if (Lvs.IsNull()) {
       // Sending of message : Incorrect Line Font Pattern
       Message_Msg Msg30 ("XSTEP_30");
-      Msg30.Arg(thecnum);
-      Msg30.Arg(thectyp.Type());
+      Msg30.Arg(num);
+      Msg30.Arg(theType.Type());
       ach->SendWarning(Msg30);
       ent->InitDirFieldEntity(5,fieldent);
     }
@@ -243,8 +355,8 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
     if (View.IsNull()) {
       // Sending of message : Incorrect View 
       Message_Msg Msg31 ("XSTEP_31");
-      Msg31.Arg(thecnum);
-      Msg31.Arg(thectyp.Type());
+      Msg31.Arg(num);
+      Msg31.Arg(theType.Type());
       ach->SendWarning(Msg31);
       ent->InitDirFieldEntity(6,fieldent);
     }
@@ -257,8 +369,8 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
     if (Transf.IsNull()) {
       // Sending of message : Incorrect Transformation Matrix 
       Message_Msg Msg32 ("XSTEP_32");
-      Msg32.Arg(thecnum);
-      Msg32.Arg(thectyp.Type());
+      Msg32.Arg(num);
+      Msg32.Arg(theType.Type());
       ach->SendWarning(Msg32);
       ent->InitDirFieldEntity(7,fieldent);
     }
@@ -272,8 +384,8 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
     if (Lbd.IsNull()) {
       // Sending of message : Incorrect Label Display 
       Message_Msg Msg33 ("XSTEP_33");
-      Msg33.Arg(thecnum);
-      Msg33.Arg(thectyp.Type());
+      Msg33.Arg(num);
+      Msg33.Arg(theType.Type());
       ach->SendWarning(Msg33);
     }
   }
@@ -291,8 +403,8 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
     if (Color.IsNull()) {
       // Sending of message : Incorrect Color Number 
       Message_Msg Msg34 ("XSTEP_34");
-      Msg34.Arg(thecnum);
-      Msg34.Arg(thectyp.Type());
+      Msg34.Arg(num);
+      Msg34.Arg(theType.Type());
       ach->SendWarning(Msg34);
       ent->InitDirFieldEntity(13,Color);
     }
@@ -346,7 +458,7 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
 //  Pas trouve dutout
     // Sending of message : Null Entity
     Message_Msg Msg35 ("XSTEP_35");
-    Msg35.Arg(thecnum);
+    Msg35.Arg(PR.EntityNumber());
     ach->SendFail(Msg35);
 //  Cas de UndefinedEntity
   } else if (ent->IsKind(STANDARD_TYPE(IGESData_UndefinedEntity))) {
@@ -357,7 +469,7 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
 //    IGESData_IGESType DT = ent->IGESType();
     // Sending of message : Unknown Entity
     Message_Msg Msg36 ("XSTEP_36");
-    Msg36.Arg(thecnum);
+    Msg36.Arg(PR.EntityNumber());
     ach->SendFail(Msg36);
   }
 }
@@ -377,8 +489,8 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
  //Message_Msg Msg221 ("XSTEP_221");
  //=====================================
  Handle(Interface_Check) ach = new Interface_Check;
-  Msg38.Arg(thecnum);
-  Msg38.Arg(thectyp.Type());
+  Msg38.Arg(PR.EntityNumber());
+  Msg38.Arg(IR->DirType(PR.EntityNumber()).Type());
  if (PR.Stage() != IGESData_ReadProps) ach->SendFail(Msg38);
   Standard_Integer ncur = PR.CurrentNumber();
   Standard_Integer nbp  = PR.NbParams();
@@ -418,8 +530,8 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
   Message_Msg Msg37 ("XSTEP_37");
 //  Message_Msg Msg220 ("XSTEP_220");
   //=====================================
-  Msg37.Arg(thecnum);
-  Msg37.Arg(thectyp.Type());
+  Msg37.Arg(PR.EntityNumber());
+  Msg37.Arg(IR->DirType(PR.EntityNumber()).Type());
   Handle(Interface_Check) ach = new Interface_Check;
   if (PR.Stage() != IGESData_ReadAssocs) ach->SendFail(Msg37);
   Standard_Integer ncur = PR.CurrentNumber(); 
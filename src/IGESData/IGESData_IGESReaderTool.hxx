@@ -27,6 +27,7 @@
 #include <IGESData_IGESType.hxx>
 #include <IGESData_ReadStage.hxx>
 #include <Interface_FileReaderTool.hxx>
+#include <NCollection_Array1.hxx>
 class Interface_ParamList;
 class IGESData_FileRecognizer;
 class Interface_Check;
@@ -62,7 +63,20 @@ public:
   //! recognizes records by asking Protocol (on data of DirType)
   Standard_EXPORT Standard_Boolean Recognize (const Standard_Integer num, Handle(Interface_Check)& ach, Handle(Standard_Transient)& ent) Standard_OVERRIDE;
   
+  //! Sets the flag of parallel reading of the entities (FALSE by default).
+  //! When set, BeginRead() decodes the directory and parameter parts of all
+  //! records concurrently, the entities being already created by Prepare(),
+  //! so that references between them are resolved to the bound entities.
+  //! The entities are then added to the model and the reports are built
+  //! sequentially in the order of the records, as in the sequential mode,
+  //! and the resulting model is the same.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag of parallel reading of the entities.
+  Standard_Boolean RunParallel() const { return myIsParallel; }
+
   //! fills model's header, that is, its GlobalSection
+  //! In parallel mode, also decodes all records (see SetRunParallel())
   Standard_EXPORT void BeginRead (const Handle(Interface_InterfaceModel)& amodel) Standard_OVERRIDE;
   
   //! fills an entity, given record no; works by calling ReadDirPart
@@ -77,6 +91,11 @@ public:
   //! Reads directory part components from file; DP is the literal
   //! directory part, IR detains entities referenced by DP
   Standard_EXPORT void ReadDir (const Handle(IGESData_IGESEntity)& ent, const Handle(IGESData_IGESReaderData)& IR, const IGESData_DirPart& DP, Handle(Interface_Check)& ach) const;
+
+  //! Same as above for the record <num> of type <theType>, which are
+  //! reported in the messages (the above variant takes the record last
+  //! recognized by Recognize())
+  Standard_EXPORT void ReadDir (const Standard_Integer num, const IGESData_IGESType& theType, const Handle(IGESData_IGESEntity)& ent, const Handle(IGESData_IGESReaderData)& IR, const IGESData_DirPart& DP, Handle(Interface_Check)& ach) const;
   
   //! Performs Reading of own Parameters for each IGESEntity
   //! Works with the ReaderLib loaded with ReadWriteModules for IGES
@@ -108,6 +127,22 @@ protected:
 
 
 
+private:
+
+  class ReadEntityFunctor;
+
+  //! Reads the entity from the record <num> of type <theType>; the reached stage
+  //! of reading is returned in theStage.
+  //! Does not modify the tool, thus it may be called concurrently for different records.
+  Standard_Boolean analyseRecord (const Standard_Integer num,
+                                  const IGESData_IGESType& theType,
+                                  const Handle(IGESData_IGESEntity)& ent,
+                                  Handle(Interface_Check)& ach,
+                                  IGESData_ReadStage& theStage) const;
+
+  //! Decodes all records concurrently into the entities bound to them.
+  void readEntitiesParallel();
+
 private:
 
 
@@ -123,6 +158,9 @@ private:
   Standard_Integer thegradweight;
   Standard_Real themaxweight;
   Standard_Real thedefweight;
+  Standard_Boolean myIsParallel;
+  NCollection_Array1<Handle(Interface_Check)> myReadChecks; //!< checks of the records decoded in parallel
+  NCollection_Array1<Standard_Integer> myReadStatus;        //!< 0 if not decoded, 1 if decoded, 2 if decoded with fails
 
 
 };
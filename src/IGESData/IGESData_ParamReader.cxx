@@ -31,7 +31,7 @@
 
 #include <stdio.h>
 // MGE 03/08/98
-static Standard_Integer testconv = -1;  // cf parametre de session
+static const Standard_Integer testconv = 0;  // cf parametre de session "iges.convert.read" (not read)
 
 //  ....              Gestion generale (etat, courant ...)              ....
 
@@ -45,14 +45,13 @@ IGESData_ParamReader::IGESData_ParamReader(const Handle(Interface_ParamList)& li
                                            const Handle(Interface_Check)& ach,
                                            const Standard_Integer base,
                                            const Standard_Integer nbpar,
-                                           const Standard_Integer /*num*/)
+                                           const Standard_Integer num)
 {
   Clear();
   theparams = list;  thecheck = ach;  thelast = Standard_True;
   thebase   = base;
   thenbpar  = (nbpar > 0 ? nbpar : list->Length());
-  thenum    = 0;
-  testconv  = -1;
+  thenum    = num;
 }
 
 
@@ -1255,7 +1254,6 @@ Standard_Boolean IGESData_ParamReader::ReadingReal (const Standard_Integer num,
   const Interface_FileParameter& FP = theparams->Value(num+thebase);
   if(FP.ParamType() == Interface_ParamInteger) {
     if (!pbrealint) {
-      if (testconv < 0) testconv = 0; //Interface_Static::IVal("iges.convert.read");
       if (testconv > 0) {
      //   char ssem[100];
         pbrealint = num;
@@ -1281,7 +1279,6 @@ Standard_Boolean IGESData_ParamReader::ReadingReal (const Standard_Integer num,
     val = Atof(text);
   else if (FP.ParamType() == Interface_ParamEnum) {  // convention
     if (!pbrealform) {
-      if (testconv < 0) testconv = 0; //Interface_Static::IVal("iges.convert.read");
       if (testconv > 0) {
        // char ssem[100];
         pbrealform = num;
@@ -1323,7 +1320,6 @@ Standard_Boolean IGESData_ParamReader::ReadingReal
   const Interface_FileParameter& FP = theparams->Value(num+thebase);
   if (FP.ParamType() == Interface_ParamInteger) {
     if (!pbrealint) {
-      if (testconv < 0) testconv = 0; //Interface_Static::IVal("iges.convert.read");
       if (testconv > 0) {
 	char ssem[100];
 	pbrealint = num;
@@ -1349,7 +1345,6 @@ Standard_Boolean IGESData_ParamReader::ReadingReal
     val = Atof(text);
   else if (FP.ParamType() == Interface_ParamEnum) {  // convention
     if (!pbrealform) {
-      if (testconv < 0) testconv = 0; //Interface_Static::IVal("iges.convert.read");
       if (testconv > 0) {
 	char ssem[100];
 	pbrealform = num;
@@ -19,6 +19,7 @@
 #include <IGESData_IGESReaderTool.hxx>
 #include <IGESData_GeneralModule.hxx>
 #include <Interface_Check.hxx>
+#include <Interface_Static.hxx>
 
 //  Pour traiter les exceptions :
 #include <Standard_ErrorHandler.hxx>
@@ -162,6 +163,7 @@ Standard_Integer IGESFile_Read
   IGESData_IGESReaderTool IT (IR,protocol);
   IT.Prepare(reco); 
   IT.SetErrorHandle(Standard_True);
+  IT.SetRunParallel (Interface_Static::IVal("read.iges.parallel") == 1);
 
   // Sending of message : Loading of Model : Beginning 
   IT.LoadModel(amodel);
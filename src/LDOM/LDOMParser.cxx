@@ -32,6 +32,9 @@
 #include <unistd.h>
 #endif
 
+// size of memory blocks allocating the dropped elements and their content
+#define LDOM_DROPPED_BLOCK_SIZE 4096
+
 //=======================================================================
 //function : ~LDOMParser
 //purpose  : 
@@ -268,43 +271,54 @@ Standard_Boolean LDOMParser::ParseDocument (std::istream& theIStream, const Stan
 //purpose  : parse one element, given the type of its XML presentation
 //=======================================================================
 
-Standard_Boolean LDOMParser::ParseElement (Standard_IStream& theIStream, Standard_Boolean& theDocStart)
+Standard_Boolean LDOMParser::ParseElement (Standard_IStream& theIStream,
+                                           Standard_Boolean& theDocStart,
+                                           const Standard_Boolean isDropped)
 {
   Standard_Boolean  isError = Standard_False;
   const LDOM_BasicElement * aParent = &myReader->GetElement();
   const LDOM_BasicNode    * aLastChild = NULL;
+
+  // the content of dropped element is allocated in the separate memory
+  // released after its end tag. In dropping mode each child element is read
+  // into a scratch memory released if the child is dropped, or attached to
+  // the memory of the content otherwise; after a kept child the next ones
+  // are read directly into the content memory, except the children of the
+  // document element
+  const Handle(LDOM_MemManager) aDocument = myReader -> GetDocument();
+  const Handle(LDOM_MemManager) aContent  =
+    isDropped ? new LDOM_MemManager (LDOM_DROPPED_BLOCK_SIZE) : aDocument;
+  const Standard_Boolean isDocElement = (aParent == myDocument -> myRootElement);
+  Handle(LDOM_MemManager) aScratch;
+  Standard_Boolean isPrevKept = Standard_False;
   for(;;) {
     LDOM_Node::NodeType aLocType;
     LDOMBasicString     aTextValue;
     char *aTextStr;
+    Standard_Boolean    isChildDropped = Standard_False;
+    const Standard_Boolean isScratch = myIsDropping && (!isPrevKept || isDocElement);
+    if (isScratch) {
+      if (aScratch.IsNull())
+        aScratch = new LDOM_MemManager (LDOM_DROPPED_BLOCK_SIZE);
+      myReader -> SetDocument (aScratch);
+    } else
+      myReader -> SetDocument (aContent);
     LDOM_XmlReader::RecordType aType = ReadRecord (* myReader, theIStream, myCurrentData, theDocStart);
     switch (aType) {
     case LDOM_XmlReader::XML_UNKNOWN:
       isError = Standard_True;
       break;
     case LDOM_XmlReader::XML_FULL_ELEMENT:
-      aParent -> AppendChild (&myReader -> GetElement(), aLastChild);
-      if (startElement()) {
-        isError = Standard_True;
-        myError = "User abort at startElement()";
-        break;
-      }
-      if (endElement()) {
-        isError = Standard_True;
-        myError = "User abort at endElement()";
-        break;
-      }
+      isError = ParseChild (theIStream, theDocStart, aParent, aLastChild,
+                            Standard_True, isChildDropped);
       break;
     case LDOM_XmlReader::XML_START_ELEMENT:
-      aParent -> AppendChild (&myReader -> GetElement(), aLastChild);
-      if (startElement()) {
-        isError = Standard_True;
-        myError = "User abort at startElement()";
-        break;
-      }
-      isError = ParseElement (theIStream, theDocStart);
+      isError = ParseChild (theIStream, theDocStart, aParent, aLastChild,
+                            Standard_False, isChildDropped);
       break;
     case LDOM_XmlReader::XML_END_ELEMENT:
+      // the element is owned by the memory of its parent
+      myReader -> SetDocument (aDocument);
       {
         Standard_CString aParentName = Standard_CString(aParent->GetTagName());
         aTextStr = (char *)myCurrentData.str();
@@ -330,9 +344,9 @@ Standard_Boolean LDOMParser::ParseElement (Standard_IStream& theIStream, Standar
         if (IsDigit(aTextStr[0])) {
           if (LDOM_XmlReader::getInteger (aTextValue, aTextStr,
                                           aTextStr + aTextLen))
-            aTextValue = LDOMBasicString (aTextStr, aTextLen, myDocument);
+            aTextValue = LDOMBasicString (aTextStr, aTextLen, aContent);
         } else
-          aTextValue = LDOMBasicString (aTextStr, aTextLen, myDocument);
+          aTextValue = LDOMBasicString (aTextStr, aTextLen, aContent);
       }
       goto create_text_node;
     case LDOM_XmlReader::XML_COMMENT:
@@ -340,17 +354,17 @@ Standard_Boolean LDOMParser::ParseElement (Standard_IStream& theIStream, Standar
       {
         Standard_Integer aTextLen;
         aTextStr = LDOM_CharReference::Decode ((char *)myCurrentData.str(), aTextLen);
-        aTextValue = LDOMBasicString (aTextStr, aTextLen, myDocument);
+        aTextValue = LDOMBasicString (aTextStr, aTextLen, aContent);
       }
       goto create_text_node;
     case LDOM_XmlReader::XML_CDATA:
       aLocType = LDOM_Node::CDATA_SECTION_NODE;
       aTextStr = (char *)myCurrentData.str();
-      aTextValue = LDOMBasicString(aTextStr,myCurrentData.Length(),myDocument);
+      aTextValue = LDOMBasicString(aTextStr,myCurrentData.Length(),aContent);
     create_text_node:
       {
         LDOM_BasicNode& aTextNode =
-          LDOM_BasicText::Create (aLocType, aTextValue, myDocument);
+          LDOM_BasicText::Create (aLocType, aTextValue, aContent);
         aParent -> AppendChild (&aTextNode, aLastChild);
       }
       delete [] aTextStr;
@@ -362,6 +376,61 @@ Standard_Boolean LDOMParser::ParseElement (Standard_IStream& theIStream, Standar
     default: ;
     }
     if (isError) break;
+    if (aType == LDOM_XmlReader::XML_FULL_ELEMENT ||
+        aType == LDOM_XmlReader::XML_START_ELEMENT) {
+      isPrevKept = !isChildDropped;
+      if (isScratch) {
+        if (isPrevKept)
+          aContent -> myAttachedMemory.Append (aScratch);
+        aScratch.Nullify();
+      }
+    }
+  }
+  myReader -> SetDocument (aDocument);
+  return isError;
+}
+
+//=======================================================================
+//function : ParseChild
+//purpose  : parse the child element which start tag has been just read
+//=======================================================================
+
+Standard_Boolean LDOMParser::ParseChild (Standard_IStream&          theIStream,
+                                         Standard_Boolean&          theDocStart,
+                                         const LDOM_BasicElement  * theParent,
+                                         const LDOM_BasicNode    *& theLastChild,
+                                         const Standard_Boolean     isFull,
+                                         Standard_Boolean&          isDropped)
+{
+  LDOM_BasicElement& anElement = myReader -> GetElement();
+  const LDOM_BasicNode * aPrevChild = theLastChild;
+  theParent -> AppendChild (&anElement, theLastChild);
+  myToDrop = Standard_False;
+  if (startElement()) {
+    myError = "User abort at startElement()";
+    return Standard_True;
+  }
+  isDropped = myToDrop;
+  myToDrop = Standard_False;
+
+  Standard_Boolean isError = Standard_False;
+  if (isFull) {
+    if (endElement()) {
+      isError = Standard_True;
+      myError = "User abort at endElement()";
+    }
+  } else
+    isError = ParseElement (theIStream, theDocStart, isDropped);
+
+  if (isDropped) {
+    // remove the element from its parent
+    const LDOM_BasicNode * aNext = ((const LDOM_BasicNode&) anElement).mySibling;
+    if (aPrevChild)
+      ((LDOM_BasicNode *) aPrevChild) -> mySibling = aNext;
+    else
+      ((LDOM_BasicElement *) theParent) -> myFirstChild = (LDOM_BasicNode *) aNext;
+    theLastChild = aPrevChild;
+    myReader -> SetElement ((LDOM_BasicElement&) * theParent);
   }
   return isError;
 }
@@ -393,7 +462,17 @@ Standard_Boolean LDOMParser::endElement ()
 
 LDOM_Element LDOMParser::getCurrentElement () const
 {
-  return LDOM_Element (myReader -> GetElement(), myDocument);
+  return LDOM_Element (myReader -> GetElement(), myReader -> GetDocument());
+}
+
+//=======================================================================
+//function : dropCurrentElement
+//purpose  : 
+//=======================================================================
+
+void LDOMParser::dropCurrentElement ()
+{
+  myToDrop = Standard_True;
 }
 
 //=======================================================================
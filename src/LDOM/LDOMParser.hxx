@@ -32,7 +32,8 @@ class LDOMParser
  public:
   // ---------- PUBLIC METHODS ----------
 
-  LDOMParser () : myReader (NULL), myCurrentData (16384) {}
+  LDOMParser () : myReader (NULL), myCurrentData (16384),
+                  myToDrop (Standard_False), myIsDropping (Standard_False) {}
   // Empty constructor
 
   virtual Standard_EXPORT ~LDOMParser  ();
@@ -82,11 +83,34 @@ class LDOMParser
                         getCurrentElement () const;
   // to be called from startElement() and endElement()
 
+  Standard_EXPORT void  dropCurrentElement ();
+  // to be called from startElement(): the content of the current element
+  // is allocated in a separate memory released after its endElement() event,
+  // and the element is removed from its parent. Allows to process large
+  // documents element by element keeping in memory only the current branch.
+  // The element should not be used after its endElement() event.
+
+  void                  setDropping     (const Standard_Boolean theIsDropping)
+                                { myIsDropping = theIsDropping; }
+  // to be called before parse() by descendant classes dropping elements:
+  // each child element is read into a scratch memory released when the
+  // element is dropped, so that the node of the dropped element itself
+  // does not stay in the memory of its parent. Otherwise only the content
+  // of the dropped element is released.
+
  private:
   // ---------- PRIVATE METHODS ----------
   Standard_Boolean      ParseDocument   (Standard_IStream& theIStream, const Standard_Boolean theWithoutRoot = Standard_False);
 
-  Standard_Boolean      ParseElement    (Standard_IStream& theIStream, Standard_Boolean& theDocStart);
+  Standard_Boolean      ParseElement    (Standard_IStream& theIStream, Standard_Boolean& theDocStart,
+                                         const Standard_Boolean isDropped = Standard_False);
+
+  Standard_Boolean      ParseChild      (Standard_IStream&          theIStream,
+                                         Standard_Boolean&          theDocStart,
+                                         const LDOM_BasicElement  * theParent,
+                                         const LDOM_BasicNode    *& theLastChild,
+                                         const Standard_Boolean     isFull,
+                                         Standard_Boolean&          isDropped);
 
   // ---------- PRIVATE (PROHIBITED) METHODS ----------
 
@@ -103,6 +127,8 @@ class LDOMParser
   Handle(LDOM_MemManager)       myDocument;
   LDOM_OSStream                 myCurrentData;
   TCollection_AsciiString       myError;
+  Standard_Boolean              myToDrop;
+  Standard_Boolean              myIsDropping;
 };
 
 #endif
@@ -18,6 +18,7 @@
 
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
+#include <NCollection_List.hxx>
 
 class LDOM_BasicElement;
 class LDOM_MemManager;
@@ -124,6 +125,8 @@ class LDOM_MemManager : public Standard_Transient
   MemBlock              * myFirstWithoutRoom;
   Standard_Integer      myBlockSize;
   HashTable             * myHashTable;
+  NCollection_List<Handle(LDOM_MemManager)> myAttachedMemory;
+  // memories of the nodes read by LDOMParser in a scratch memory and kept
 
  public:
   // CASCADE RTTI
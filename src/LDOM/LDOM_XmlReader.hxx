@@ -61,6 +61,15 @@ class LDOM_XmlReader
   LDOM_BasicElement& GetElement() const { return * myElement; }
   // get the last element retrieved from the stream
 
+  void SetElement (LDOM_BasicElement& theElement) { myElement = &theElement; }
+  // set the last element retrieved from the stream
+
+  const Handle(LDOM_MemManager)& GetDocument() const { return myDocument; }
+  // get the memory manager allocating the retrieved nodes
+
+  void SetDocument (const Handle(LDOM_MemManager)& theDocument) { myDocument = theDocument; }
+  // set the memory manager allocating the nodes retrieved after this call
+
   void CreateElement (const char *theName, const Standard_Integer theLen);
 
   static Standard_Boolean getInteger (LDOMBasicString&       theValue,
@@ -38,6 +38,9 @@
 #include <IMeshData_Status.hxx>
 #include <Message.hxx>
 #include <Message_ProgressRange.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_IndexedMap.hxx>
+#include <NCollection_Map.hxx>
 #include <OSD_OpenFile.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Poly_TriangulationParameters.hxx>
@@ -1003,6 +1006,76 @@ static Standard_Integer trianglesinfo (Draw_Interpretor& theDI, Standard_Integer
   return 0;
 }
 
+//=======================================================================
+//function : trianglesmemory
+//purpose  :
+//=======================================================================
+static Standard_Integer trianglesmemory (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs != 2)
+  {
+    Message::SendFail ("Syntax error: wrong number of arguments");
+    return 1;
+  }
+  TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  if (aShape.IsNull())
+  {
+    theDI << theArgVec[1] << " is not a shape\n";
+    return 1;
+  }
+
+  // triangulations of the shape (including LODs) and number of them referring each shared storage
+  NCollection_IndexedMap<Handle(Poly_Triangulation)> aTriangulations;
+  NCollection_DataMap<Handle(Standard_Transient), Standard_Integer> aNbSharingMap;
+  for (TopExp_Explorer anExp (aShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    TopLoc_Location aLoc;
+    const Poly_ListOfTriangulation& aTriList = BRep_Tool::Triangulations (TopoDS::Face (anExp.Current()), aLoc);
+    for (Poly_ListOfTriangulation::Iterator aTriIter (aTriList); aTriIter.More(); aTriIter.Next())
+    {
+      const Handle(Poly_Triangulation)& aTri = aTriIter.Value();
+      if (aTri.IsNull() || !aTriangulations.Add (aTri) || !aTri->IsShared())
+      {
+        continue;
+      }
+      if (Standard_Integer* aNbSharing = aNbSharingMap.ChangeSeek (aTri->SharedData()))
+      {
+        ++(*aNbSharing);
+      }
+      else
+      {
+        aNbSharingMap.Bind (aTri->SharedData(), 1);
+      }
+    }
+  }
+
+  // storage shared by several triangulations is counted once
+  Standard_Size aTotalSize = 0, anUniqueSize = 0, aSharedSize = 0;
+  NCollection_Map<Handle(Standard_Transient)> aCountedStorages;
+  for (NCollection_IndexedMap<Handle(Poly_Triangulation)>::Iterator aTriIter (aTriangulations); aTriIter.More(); aTriIter.Next())
+  {
+    const Handle(Poly_Triangulation)& aTri = aTriIter.Value();
+    const Standard_Size aSize = aTri->DataSize();
+    aTotalSize += aSize;
+    if (!aTri->IsShared()
+     || aNbSharingMap.Find (aTri->SharedData()) < 2)
+    {
+      anUniqueSize += aSize;
+    }
+    else if (aCountedStorages.Add (aTri->SharedData()))
+    {
+      aSharedSize += aSize;
+    }
+  }
+
+  theDI << "This shape contains " << aTriangulations.Extent() << " triangulations.\n";
+  theDI << "  Data size:        " << (Standard_Real )aTotalSize << " bytes\n";
+  theDI << "  Unique data size: " << (Standard_Real )anUniqueSize << " bytes\n";
+  theDI << "  Shared data size: " << (Standard_Real )aSharedSize << " bytes\n";
+  theDI << "  Used memory:      " << (Standard_Real )(anUniqueSize + aSharedSize) << " bytes\n";
+  return 0;
+}
+
 //=======================================================================
 //function : veriftriangles
 //purpose  : 
@@ -1639,6 +1712,11 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
                   "trinfo shapeName [-lods], print triangles information on objects"
                   "\n\t\t: -lods Print detailed LOD information",
                   __FILE__,trianglesinfo,g);
+  theCommands.Add("trmemory",
+                  "trmemory shapeName"
+                  "\n\t\t: Prints the size of triangulation data of the shape: total size, size of data"
+                  "\n\t\t: owned by single triangulation and size of data shared by copies of triangulations.",
+                  __FILE__, trianglesmemory, g);
   theCommands.Add("veriftriangles","veriftriangles name, verif triangles",__FILE__,veriftriangles,g);
   theCommands.Add("wavefront","wavefront name",__FILE__, wavefront, g);
   theCommands.Add("triepoints", "triepoints shape1 [shape2 ...]",__FILE__, triedgepoints, g);
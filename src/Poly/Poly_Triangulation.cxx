@@ -20,10 +20,71 @@
 #include <OSD_FileSystem.hxx>
 #include <Poly_Triangle.hxx>
 #include <Standard_Dump.hxx>
+#include <Standard_Mutex.hxx>
 #include <Standard_Type.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT (Poly_Triangulation, Standard_Transient)
 
+namespace
+{
+  //! Arrays of triangulation shared by several copies of triangulation.
+  //! Triangulations refer to these arrays through non-owning wrappers.
+  class Poly_TriangulationSharedData : public Standard_Transient
+  {
+  public:
+    Poly_ArrayOfNodes            Nodes;
+    Poly_Array1OfTriangle        Triangles;
+    Poly_ArrayOfUVNodes          UVNodes;
+    NCollection_Array1<gp_Vec3f> Normals;
+  };
+
+  //! Mutex protecting sharing of arrays by concurrently created copies of the same triangulation.
+  static Standard_Mutex& sharedDataMutex()
+  {
+    static Standard_Mutex THE_MUTEX;
+    return THE_MUTEX;
+  }
+
+  //! Initializes the array of nodes by non-owning wrapper of another array.
+  static void wrapArray (Poly_ArrayOfNodes& theArray, const Poly_ArrayOfNodes& theSource)
+  {
+    if (theSource.IsEmpty())
+    {
+      theArray.SetDoublePrecision (theSource.IsDoublePrecision());
+      return;
+    }
+    Poly_ArrayOfNodes aWrapper = theSource.IsDoublePrecision()
+                               ? Poly_ArrayOfNodes (theSource.First<gp_Pnt>(),   theSource.Size())
+                               : Poly_ArrayOfNodes (theSource.First<gp_Vec3f>(), theSource.Size());
+    theArray.Move (aWrapper);
+  }
+
+  //! Initializes the array of UV nodes by non-owning wrapper of another array.
+  static void wrapArray (Poly_ArrayOfUVNodes& theArray, const Poly_ArrayOfUVNodes& theSource)
+  {
+    if (theSource.IsEmpty())
+    {
+      theArray.SetDoublePrecision (theSource.IsDoublePrecision());
+      return;
+    }
+    Poly_ArrayOfUVNodes aWrapper = theSource.IsDoublePrecision()
+                                 ? Poly_ArrayOfUVNodes (theSource.First<gp_Pnt2d>(), theSource.Size())
+                                 : Poly_ArrayOfUVNodes (theSource.First<gp_Vec2f>(), theSource.Size());
+    theArray.Move (aWrapper);
+  }
+
+  //! Initializes the array by non-owning wrapper of another array.
+  template<class TheArrayType>
+  static void wrapArray (TheArrayType& theArray, const TheArrayType& theSource)
+  {
+    if (!theSource.IsEmpty())
+    {
+      TheArrayType aWrapper (theSource.First(), theSource.Lower(), theSource.Upper());
+      theArray.Move (aWrapper);
+    }
+  }
+}
+
 //=======================================================================
 //function : Poly_Triangulation
 //purpose  : 
@@ -126,15 +187,91 @@ Handle(Poly_Triangulation) Poly_Triangulation::Copy() const
 Poly_Triangulation::Poly_Triangulation (const Handle(Poly_Triangulation)& theTriangulation)
 : myCachedMinMax (NULL),
   myDeflection(theTriangulation->myDeflection),
-  myNodes     (theTriangulation->myNodes),
-  myTriangles (theTriangulation->myTriangles),
-  myUVNodes   (theTriangulation->myUVNodes),
-  myNormals   (theTriangulation->myNormals),
   myPurpose   (theTriangulation->myPurpose)
 {
+  // arrays are moved into the storage shared by both triangulations,
+  // so that they remain valid until the last triangulation referring them is modified or destroyed
+  mySharedData = theTriangulation->shareData();
+  wrapArray (myNodes,     theTriangulation->myNodes);
+  wrapArray (myTriangles, theTriangulation->myTriangles);
+  wrapArray (myUVNodes,   theTriangulation->myUVNodes);
+  wrapArray (myNormals,   theTriangulation->myNormals);
   SetCachedMinMax (theTriangulation->CachedMinMax());
 }
 
+//=======================================================================
+//function : shareData
+//purpose  :
+//=======================================================================
+Handle(Standard_Transient) Poly_Triangulation::shareData() const
+{
+  Standard_Mutex::Sentry aLock (sharedDataMutex());
+  Poly_Triangulation* aThis = const_cast<Poly_Triangulation*> (this);
+  if (!mySharedData.IsNull())
+  {
+    if (!myNodes.IsDeletable()
+     && !myTriangles.IsDeletable()
+     && !myUVNodes.IsDeletable()
+     && !myNormals.IsDeletable())
+    {
+      return mySharedData;
+    }
+
+    // some arrays have been reallocated since the previous sharing
+    aThis->copySharedData();
+  }
+
+  // the arrays keep pointing to the moved data without owning it
+  Handle(Poly_TriangulationSharedData) aData = new Poly_TriangulationSharedData();
+  aData->Nodes    .Move (aThis->myNodes);
+  aData->Triangles.Move (aThis->myTriangles);
+  aData->UVNodes  .Move (aThis->myUVNodes);
+  aData->Normals  .Move (aThis->myNormals);
+  aThis->mySharedData = aData;
+  return mySharedData;
+}
+
+//=======================================================================
+//function : copySharedData
+//purpose  :
+//=======================================================================
+void Poly_Triangulation::copySharedData()
+{
+  if (!myNodes.IsEmpty() && !myNodes.IsDeletable())
+  {
+    Poly_ArrayOfNodes aCopy (myNodes);
+    myNodes.Move (aCopy);
+  }
+  if (!myTriangles.IsEmpty() && !myTriangles.IsDeletable())
+  {
+    Poly_Array1OfTriangle aCopy (myTriangles);
+    myTriangles.Move (aCopy);
+  }
+  if (!myUVNodes.IsEmpty() && !myUVNodes.IsDeletable())
+  {
+    Poly_ArrayOfUVNodes aCopy (myUVNodes);
+    myUVNodes.Move (aCopy);
+  }
+  if (!myNormals.IsEmpty() && !myNormals.IsDeletable())
+  {
+    NCollection_Array1<gp_Vec3f> aCopy (myNormals);
+    myNormals.Move (aCopy);
+  }
+  mySharedData.Nullify();
+}
+
+//=======================================================================
+//function : DataSize
+//purpose  :
+//=======================================================================
+Standard_Size Poly_Triangulation::DataSize() const
+{
+  return myNodes.SizeBytes()
+       + myUVNodes.SizeBytes()
+       + Standard_Size(myTriangles.Size()) * sizeof(Poly_Triangle)
+       + Standard_Size(myNormals.Size())   * sizeof(gp_Vec3f);
+}
+
 //=======================================================================
 //function : Clear
 //purpose  : 
@@ -154,6 +291,7 @@ void Poly_Triangulation::Clear()
   }
   RemoveUVNodes();
   RemoveNormals();
+  mySharedData.Nullify();
 }
 
 //=======================================================================
@@ -483,6 +621,7 @@ Bnd_Box Poly_Triangulation::computeBoundingBox (const gp_Trsf& theTrsf) const
 void Poly_Triangulation::ComputeNormals()
 {
   // zero values
+  detachSharedData();
   AddNormals();
   myNormals.Init (gp_Vec3f (0.0f));
 
@@ -88,12 +88,26 @@ public:
   //! Destructor
   Standard_EXPORT virtual ~Poly_Triangulation();
 
-  //! Creates full copy of current triangulation
+  //! Creates full copy of current triangulation.
+  //! Arrays of nodes, triangles, UV-nodes and normals are not duplicated but shared
+  //! by both triangulations until one of them is modified (copy-on-write).
   Standard_EXPORT virtual Handle(Poly_Triangulation) Copy() const;
 
-  //! Copy constructor for triangulation.
+  //! Copy constructor for triangulation sharing arrays of the source triangulation (see Copy()).
   Standard_EXPORT Poly_Triangulation (const Handle(Poly_Triangulation)& theTriangulation);
 
+  //! Returns TRUE if arrays of this triangulation are shared with its copies (see Copy()).
+  //! Shared arrays are duplicated by the first modification of triangulation data.
+  Standard_Boolean IsShared() const { return !mySharedData.IsNull(); }
+
+  //! Returns the storage of arrays shared by this triangulation and its copies
+  //! or NULL if arrays are owned by this triangulation.
+  //! Triangulations returning the same storage refer to the same memory.
+  const Handle(Standard_Transient)& SharedData() const { return mySharedData; }
+
+  //! Returns the size in bytes of arrays of nodes, triangles, UV-nodes and normals.
+  Standard_EXPORT Standard_Size DataSize() const;
+
   //! Returns the deflection of this triangulation.
   Standard_Real Deflection() const { return myDeflection; }
 
@@ -136,6 +150,7 @@ public:
   void SetNode (Standard_Integer theIndex,
                 const gp_Pnt& thePnt)
   {
+    detachSharedData();
     myNodes.SetValue (theIndex - 1, thePnt);
   }
 
@@ -150,6 +165,7 @@ public:
   void SetUVNode (Standard_Integer theIndex,
                   const gp_Pnt2d&  thePnt)
   {
+    detachSharedData();
     myUVNodes.SetValue (theIndex - 1, thePnt);
   }
 
@@ -164,6 +180,7 @@ public:
   void SetTriangle (Standard_Integer theIndex,
                     const Poly_Triangle& theTriangle)
   {
+    detachSharedData();
     myTriangles.SetValue (theIndex, theTriangle);
   }
 
@@ -191,6 +208,7 @@ public:
   void SetNormal (const Standard_Integer theIndex,
                   const gp_Vec3f& theNormal)
   {
+    detachSharedData();
     myNormals.SetValue (theIndex - 1, theNormal);
   }
 
@@ -309,19 +327,19 @@ public:
 
   //! Returns an internal array of triangles.
   //! Triangle()/SetTriangle() should be used instead in portable code.
-  Poly_Array1OfTriangle& InternalTriangles() { return myTriangles; }
+  Poly_Array1OfTriangle& InternalTriangles() { detachSharedData(); return myTriangles; }
 
   //! Returns an internal array of nodes.
   //! Node()/SetNode() should be used instead in portable code.
-  Poly_ArrayOfNodes& InternalNodes() { return myNodes; }
+  Poly_ArrayOfNodes& InternalNodes() { detachSharedData(); return myNodes; }
 
   //! Returns an internal array of UV nodes.
   //! UBNode()/SetUVNode() should be used instead in portable code.
-  Poly_ArrayOfUVNodes& InternalUVNodes() { return myUVNodes; }
+  Poly_ArrayOfUVNodes& InternalUVNodes() { detachSharedData(); return myUVNodes; }
 
   //! Return an internal array of normals.
   //! Normal()/SetNormal() should be used instead in portable code.
-  NCollection_Array1<gp_Vec3f>& InternalNormals() { return myNormals; }
+  NCollection_Array1<gp_Vec3f>& InternalNormals() { detachSharedData(); return myNormals; }
 
   Standard_DEPRECATED("Deprecated method, SetNormal() should be used instead")
   Standard_EXPORT void SetNormals (const Handle(TShort_HArray1OfShortReal)& theNormals);
@@ -330,10 +348,10 @@ public:
   const Poly_Array1OfTriangle& Triangles() const { return myTriangles; }
 
   Standard_DEPRECATED("Deprecated method, SetTriangle() should be used instead")
-  Poly_Array1OfTriangle& ChangeTriangles() { return myTriangles; }
+  Poly_Array1OfTriangle& ChangeTriangles() { detachSharedData(); return myTriangles; }
 
   Standard_DEPRECATED("Deprecated method, SetTriangle() should be used instead")
-  Poly_Triangle& ChangeTriangle (const Standard_Integer theIndex) { return myTriangles.ChangeValue (theIndex); }
+  Poly_Triangle& ChangeTriangle (const Standard_Integer theIndex) { detachSharedData(); return myTriangles.ChangeValue (theIndex); }
 
 public: //! @name late-load deferred data interface
 
@@ -388,6 +406,22 @@ protected:
   //! @param[in] theTrsf  optional transformation.
   Standard_EXPORT virtual Bnd_Box computeBoundingBox (const gp_Trsf& theTrsf) const;
 
+  //! Duplicates arrays shared with other triangulations before their modification.
+  void detachSharedData()
+  {
+    if (!mySharedData.IsNull())
+    {
+      copySharedData();
+    }
+  }
+
+  //! Replaces arrays shared with other triangulations by their own copies.
+  Standard_EXPORT void copySharedData();
+
+  //! Moves arrays of this triangulation into the storage shared with its copies
+  //! (if not yet done) and returns this storage.
+  Standard_EXPORT Handle(Standard_Transient) shareData() const;
+
 protected:
 
   Bnd_Box*                     myCachedMinMax;
@@ -399,6 +433,7 @@ protected:
   Poly_MeshPurpose             myPurpose;
 
   Handle(Poly_TriangulationParameters) myParams;
+  Handle(Standard_Transient)           mySharedData;
 };
 
 #endif // _Poly_Triangulation_HeaderFile
@@ -2118,9 +2118,23 @@ private:
 };
 
 static Standard_Integer OCC25004 (Draw_Interpretor& theDI,
-                                  Standard_Integer /*theNArg*/,
-                                  const char** /*theArgs*/)
+                                  Standard_Integer theNArg,
+                                  const char** theArgs)
 {
+  if (theNArg > 2)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  // number of strips of the parallel search
+  const Standard_Integer aNbStrips = theNArg == 2 ? Draw::Atoi (theArgs[1]) : 1;
+  if (aNbStrips < 1)
+  {
+    theDI << "Syntax error: wrong number of strips\n";
+    return 1;
+  }
+
   BraninFunction aFunc;
 
   math_Vector aLower(1,2), aUpper(1,2);
@@ -2176,6 +2190,16 @@ static Standard_Integer OCC25004 (Draw_Interpretor& theDI,
     }
 
   math_GlobOptMin aFinder(&aFunc, aLower, aUpper, aLipConst);
+  NCollection_Array1<BraninFunction> aStripFuncs (1, aNbStrips);
+  if (aNbStrips > 1)
+  {
+    NCollection_Array1<math_MultipleVarFunction*> aFuncs (1, aNbStrips);
+    for (Standard_Integer aStripIter = 1; aStripIter <= aNbStrips; ++aStripIter)
+    {
+      aFuncs (aStripIter) = &aStripFuncs (aStripIter);
+    }
+    aFinder.SetParallelFunctions (aFuncs);
+  }
   aFinder.Perform();
   //(-pi , 12.275), (pi , 2.275), (9.42478, 2.475)
 
@@ -2184,6 +2208,12 @@ static Standard_Integer OCC25004 (Draw_Interpretor& theDI,
 
   Standard_Integer aNbExt = aFinder.NbExtrema();
   theDI << "NbExtrema = " << aNbExt << "\n";
+  for (Standard_Integer anExtIter = 1; anExtIter <= aNbExt; ++anExtIter)
+  {
+    math_Vector aSol (1, 2);
+    aFinder.Points (anExtIter, aSol);
+    theDI << "Point " << anExtIter << " = " << aSol (1) << " " << aSol (2) << "\n";
+  }
 
   return 0;
 }
@@ -5365,7 +5395,7 @@ void QABugs::Commands_19(Draw_Interpretor& theCommands) {
   theCommands.Add ("OCC24931", "OCC24931 path to saved xml file", __FILE__, OCC24931, group);
   theCommands.Add ("OCC24945", "OCC24945", __FILE__, OCC24945, group);
   theCommands.Add ("OCC23950", "OCC23950 step_file", __FILE__, OCC23950, group);
-  theCommands.Add ("OCC25004", "OCC25004", __FILE__, OCC25004, group);
+  theCommands.Add ("OCC25004", "OCC25004 [nbStrips]", __FILE__, OCC25004, group);
   theCommands.Add ("OCC24925",
                    "OCC24925 filename [pluginLib=TKXml storageGuid retrievalGuid]"
                    "\nOCAF persistence without setting environment variables",
@@ -174,7 +174,8 @@ RWGltf_CafReader::RWGltf_CafReader()
   myIsDoublePrecision (false),
   myToSkipLateDataLoading (false),
   myToKeepLateData (true),
-  myToPrintDebugMessages (false)
+  myToPrintDebugMessages (false),
+  myToSkipUnusedJson (false)
 {
   myCoordSysConverter.SetInputLengthUnit (1.0); // glTF defines model in meters
   myCoordSysConverter.SetInputCoordinateSystem (RWMesh_CoordinateSystem_glTF);
@@ -305,7 +306,11 @@ Standard_Boolean RWGltf_CafReader::performMesh (std::istream& theStream,
 #ifdef HAVE_RAPIDJSON
   rapidjson::ParseResult aRes;
   rapidjson::IStreamWrapper aFileStream (theStream);
-  if (isBinaryFile)
+  if (myToSkipUnusedJson)
+  {
+    aRes = aDoc.ParseStreamCompact (aFileStream, isBinaryFile);
+  }
+  else if (isBinaryFile)
   {
     aRes = aDoc.ParseStream<rapidjson::kParseStopWhenDoneFlag, rapidjson::UTF8<>, rapidjson::IStreamWrapper>(aFileStream);
   }
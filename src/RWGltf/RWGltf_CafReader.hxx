@@ -80,6 +80,14 @@ public:
   //! Sets flag to print debug information.
   void SetToPrintDebugMessages (const Standard_Boolean theToPrint) { myToPrintDebugMessages = theToPrint; }
 
+  //! Returns TRUE if JSON elements not used by the reader (animations, skins, cameras, morph targets, unused "extras")
+  //! should be skipped while parsing the stream instead of being stored in JSON DOM; FALSE by default.
+  //! This reduces memory footprint and parsing time of large scenes.
+  bool ToSkipUnusedJson() const { return myToSkipUnusedJson; }
+
+  //! Sets flag to skip unused JSON elements while parsing the stream.
+  void SetSkipUnusedJson (bool theToSkip) { myToSkipUnusedJson = theToSkip; }
+
 protected:
 
   //! Read the mesh from specified file.
@@ -120,6 +128,7 @@ protected:
   Standard_Boolean myToKeepLateData;        //!< flag to keep information about deferred storage to load/unload triangulation later
 // clang-format on
   Standard_Boolean myToPrintDebugMessages;  //!< flag to print additional debug information
+  Standard_Boolean myToSkipUnusedJson;      //!< flag to skip JSON elements not used by the reader; FALSE by default
 
 };
 
@@ -92,6 +92,275 @@ namespace
     theStream.write ((const char* )theTri.GetData(), sizeof(theTri));
   }
 
+  //! Size of output chunk filled in parallel threads (64 MiB).
+  static const int64_t THE_PARALLEL_CHUNK_SIZE = int64_t(64) * 1024 * 1024;
+
+  //! Return TRUE if texture UV coordinates of the face should be written.
+  static bool toWriteTexCoords (const RWMesh_FaceIterator& theFaceIter,
+                                const bool theIsForcedUVExport)
+  {
+    if (!theFaceIter.HasTexCoords())
+    {
+      return false;
+    }
+    if (theIsForcedUVExport)
+    {
+      return true;
+    }
+
+    const Handle(XCAFDoc_VisMaterial)& aMat = theFaceIter.FaceStyle().Material();
+    if (aMat.IsNull())
+    {
+      return false;
+    }
+
+    return !RWGltf_GltfMaterialMap::baseColorTexture (aMat).IsNull()
+        || !aMat->PbrMaterial().MetallicRoughnessTexture.IsNull()
+        || !aMat->PbrMaterial().EmissiveTexture.IsNull()
+        || !aMat->PbrMaterial().OcclusionTexture.IsNull()
+        || !aMat->PbrMaterial().NormalTexture.IsNull();
+  }
+
+  //! Size of data block to be hashed at once while comparing glTF faces.
+  static const size_t THE_FACE_HASH_BLOCK = 1024 * 1024;
+
+  //! Fill the vector with triangulation data of glTF face as it would be written into binary buffer.
+  static void fillGltfFaceData (std::vector<char>& theData,
+                                const RWGltf_GltfFace& theGltfFace,
+                                const RWMesh_CoordinateSystemConverter& theCSTrsf,
+                                const bool theIsForcedUVExport)
+  {
+    theData.clear();
+    Standard_Integer aNbIndexedNodes = 0;
+    for (RWMesh_FaceIterator aFaceIter (theGltfFace.Shape, theGltfFace.Style); aFaceIter.More(); aFaceIter.Next())
+    {
+      const Standard_Integer aHeader[4] =
+      {
+        aFaceIter.NbNodes(),
+        aFaceIter.NbTriangles(),
+        aFaceIter.HasNormals() ? 1 : 0,
+        toWriteTexCoords (aFaceIter, theIsForcedUVExport) ? 1 : 0
+      };
+      const size_t aSize = sizeof(aHeader)
+                         + size_t(aHeader[0]) * (sizeof(Graphic3d_Vec3) * (aHeader[2] + 1) + sizeof(Graphic3d_Vec2) * aHeader[3])
+                         + size_t(aHeader[1]) * sizeof(Graphic3d_Vec3i);
+      size_t anOffset = theData.size();
+      theData.resize (anOffset + aSize);
+      char* aData = theData.data() + anOffset;
+      memcpy (aData, aHeader, sizeof(aHeader));
+      aData += sizeof(aHeader);
+
+      const Standard_Integer aNodeLower = aFaceIter.NodeLower();
+      const Standard_Integer aNodeUpper = aFaceIter.NodeUpper();
+      for (Standard_Integer aNodeIter = aNodeLower; aNodeIter <= aNodeUpper; ++aNodeIter, aData += sizeof(Graphic3d_Vec3))
+      {
+        gp_XYZ aNode = aFaceIter.NodeTransformed (aNodeIter).XYZ();
+        theCSTrsf.TransformPosition (aNode);
+        const Graphic3d_Vec3 aVec3 (float(aNode.X()), float(aNode.Y()), float(aNode.Z()));
+        memcpy (aData, aVec3.GetData(), sizeof(aVec3));
+      }
+      if (aHeader[2] != 0)
+      {
+        for (Standard_Integer aNodeIter = aNodeLower; aNodeIter <= aNodeUpper; ++aNodeIter, aData += sizeof(Graphic3d_Vec3))
+        {
+          const gp_Dir aNormal = aFaceIter.NormalTransformed (aNodeIter);
+          Graphic3d_Vec3 aVecNormal ((float )aNormal.X(), (float )aNormal.Y(), (float )aNormal.Z());
+          theCSTrsf.TransformNormal (aVecNormal);
+          memcpy (aData, aVecNormal.GetData(), sizeof(aVecNormal));
+        }
+      }
+      if (aHeader[3] != 0)
+      {
+        for (Standard_Integer aNodeIter = aNodeLower; aNodeIter <= aNodeUpper; ++aNodeIter, aData += sizeof(Graphic3d_Vec2))
+        {
+          const gp_Pnt2d aTexCoord = aFaceIter.NodeTexCoord (aNodeIter);
+          const Graphic3d_Vec2 aVec2 (float(aTexCoord.X()), float(1.0 - aTexCoord.Y()));
+          memcpy (aData, aVec2.GetData(), sizeof(aVec2));
+        }
+      }
+
+      const Standard_Integer aNodeFirst = aNbIndexedNodes - aFaceIter.ElemLower();
+      const Standard_Integer anElemUpper = aFaceIter.ElemUpper();
+      for (Standard_Integer anElemIter = aFaceIter.ElemLower(); anElemIter <= anElemUpper; ++anElemIter, aData += sizeof(Graphic3d_Vec3i))
+      {
+        const Poly_Triangle aTri = aFaceIter.TriangleOriented (anElemIter);
+        const Graphic3d_Vec3i aTri32 (aTri(1) + aNodeFirst, aTri(2) + aNodeFirst, aTri(3) + aNodeFirst);
+        memcpy (aData, aTri32.GetData(), sizeof(aTri32));
+      }
+      aNbIndexedNodes += aHeader[0];
+    }
+  }
+
+  //! Compute hash of triangulation data of glTF face.
+  static size_t hashGltfFaceData (const std::vector<char>& theData)
+  {
+    size_t aHash = theData.size();
+    for (size_t anOffset = 0; anOffset < theData.size(); anOffset += THE_FACE_HASH_BLOCK)
+    {
+      const int aLen = (int )std::min (THE_FACE_HASH_BLOCK, theData.size() - anOffset);
+      aHash = opencascade::MurmurHash::hash_combine<char, size_t> (theData[anOffset], aLen, aHash);
+    }
+    return aHash;
+  }
+
+  //! Functor computing hashes of triangulation data of glTF faces.
+  class GltfFaceHashFunctor
+  {
+  public:
+
+    //! Main constructor.
+    GltfFaceHashFunctor (const std::vector<RWGltf_GltfFace*>& theFaces,
+                         std::vector<size_t>& theHashes,
+                         const RWMesh_CoordinateSystemConverter& theCSTrsf,
+                         const bool theIsForcedUVExport)
+    : myFaces (&theFaces),
+      myHashes (&theHashes),
+      myCSTrsf (&theCSTrsf),
+      myIsForcedUVExport (theIsForcedUVExport) {}
+
+    //! Compute hash of the face.
+    void operator() (const Standard_Integer theIndex) const
+    {
+      std::vector<char> aData;
+      fillGltfFaceData (aData, *(*myFaces)[theIndex], *myCSTrsf, myIsForcedUVExport);
+      (*myHashes)[theIndex] = hashGltfFaceData (aData);
+    }
+
+  private:
+    GltfFaceHashFunctor& operator= (const GltfFaceHashFunctor& );
+  private:
+    const std::vector<RWGltf_GltfFace*>*    myFaces;
+    std::vector<size_t>*                    myHashes;
+    const RWMesh_CoordinateSystemConverter* myCSTrsf;
+    bool                                    myIsForcedUVExport;
+  };
+
+  //! Triangulated face within glTF primitive, defining a piece of each buffer view.
+  struct GltfFacePiece
+  {
+    TopoDS_Face        Face;            //!< located face
+    RWGltf_GltfFace*   GltfFace;        //!< glTF primitive containing the face
+    Standard_Integer   NbNodes;         //!< number of nodes
+    Standard_Integer   NbTriangles;     //!< number of triangles
+    Standard_Integer   NodeFirst;       //!< shift of triangle indices within primitive
+    bool               HasNormals;      //!< flag to write normals
+    bool               HasTexCoords;    //!< flag to write texture UV coordinates
+    int64_t            Offsets[4];      //!< offsets within the file of positions, normals, UV and indices
+    Graphic3d_BndBox3d BndBox;          //!< bounding box of transformed nodes
+
+    GltfFacePiece()
+    : GltfFace (NULL), NbNodes (0), NbTriangles (0), NodeFirst (0), HasNormals (false), HasTexCoords (false)
+    {
+      Offsets[0] = Offsets[1] = Offsets[2] = Offsets[3] = -1;
+    }
+  };
+
+  //! Functor converting face pieces into the chunk of binary data.
+  class GltfFacePieceFunctor
+  {
+  public:
+
+    //! Main constructor.
+    GltfFacePieceFunctor (std::vector<GltfFacePiece>& thePieces,
+                          const std::vector<size_t>& thePieceIds,
+                          const Standard_Integer theArrType,
+                          const RWMesh_CoordinateSystemConverter& theCSTrsf,
+                          char* theChunk,
+                          const int64_t theChunkOffset)
+    : myPieces (&thePieces),
+      myPieceIds (&thePieceIds),
+      myArrType (theArrType),
+      myCSTrsf (&theCSTrsf),
+      myChunk (theChunk),
+      myChunkOffset (theChunkOffset) {}
+
+    //! Convert the face piece.
+    void operator() (const Standard_Integer theIndex) const
+    {
+      GltfFacePiece& aPiece = (*myPieces)[(*myPieceIds)[theIndex]];
+      RWMesh_FaceIterator aFaceIter (aPiece.Face, aPiece.GltfFace->Style);
+      if (!aFaceIter.More())
+      {
+        return;
+      }
+
+      char* aData = myChunk + (aPiece.Offsets[myArrType] - myChunkOffset);
+      const Standard_Integer aNodeLower = aFaceIter.NodeLower();
+      const Standard_Integer aNodeUpper = aFaceIter.NodeUpper();
+      switch (myArrType)
+      {
+        case 0: // RWGltf_GltfArrayType_Position
+        {
+          for (Standard_Integer aNodeIter = aNodeLower; aNodeIter <= aNodeUpper; ++aNodeIter, aData += sizeof(Graphic3d_Vec3))
+          {
+            gp_XYZ aNode = aFaceIter.NodeTransformed (aNodeIter).XYZ();
+            myCSTrsf->TransformPosition (aNode);
+            aPiece.BndBox.Add (Graphic3d_Vec3d (aNode.X(), aNode.Y(), aNode.Z()));
+            const Graphic3d_Vec3 aVec3 (float(aNode.X()), float(aNode.Y()), float(aNode.Z()));
+            memcpy (aData, aVec3.GetData(), sizeof(aVec3));
+          }
+          break;
+        }
+        case 1: // RWGltf_GltfArrayType_Normal
+        {
+          for (Standard_Integer aNodeIter = aNodeLower; aNodeIter <= aNodeUpper; ++aNodeIter, aData += sizeof(Graphic3d_Vec3))
+          {
+            const gp_Dir aNormal = aFaceIter.NormalTransformed (aNodeIter);
+            Graphic3d_Vec3 aVecNormal ((float )aNormal.X(), (float )aNormal.Y(), (float )aNormal.Z());
+            myCSTrsf->TransformNormal (aVecNormal);
+            memcpy (aData, aVecNormal.GetData(), sizeof(aVecNormal));
+          }
+          break;
+        }
+        case 2: // RWGltf_GltfArrayType_TCoord0
+        {
+          for (Standard_Integer aNodeIter = aNodeLower; aNodeIter <= aNodeUpper; ++aNodeIter, aData += sizeof(Graphic3d_Vec2))
+          {
+            const gp_Pnt2d aTexCoord = aFaceIter.NodeTexCoord (aNodeIter);
+            const Graphic3d_Vec2 aVec2 (float(aTexCoord.X()), float(1.0 - aTexCoord.Y()));
+            memcpy (aData, aVec2.GetData(), sizeof(aVec2));
+          }
+          break;
+        }
+        case 3: // RWGltf_GltfArrayType_Indices
+        {
+          const bool isUInt16 = aPiece.GltfFace->Indices.ComponentType == RWGltf_GltfAccessorCompType_UInt16;
+          const Standard_Integer anElemUpper = aFaceIter.ElemUpper();
+          for (Standard_Integer anElemIter = aFaceIter.ElemLower(); anElemIter <= anElemUpper; ++anElemIter)
+          {
+            Poly_Triangle aTri = aFaceIter.TriangleOriented (anElemIter);
+            aTri(1) += aPiece.NodeFirst;
+            aTri(2) += aPiece.NodeFirst;
+            aTri(3) += aPiece.NodeFirst;
+            if (isUInt16)
+            {
+              const NCollection_Vec3<uint16_t> aTri16 ((uint16_t)aTri(1), (uint16_t)aTri(2), (uint16_t)aTri(3));
+              memcpy (aData, aTri16.GetData(), sizeof(aTri16));
+              aData += sizeof(aTri16);
+            }
+            else
+            {
+              const Graphic3d_Vec3i aTri32 (aTri(1), aTri(2), aTri(3));
+              memcpy (aData, aTri32.GetData(), sizeof(aTri32));
+              aData += sizeof(aTri32);
+            }
+          }
+          break;
+        }
+      }
+    }
+
+  private:
+    GltfFacePieceFunctor& operator= (const GltfFacePieceFunctor& );
+  private:
+    std::vector<GltfFacePiece>*             myPieces;
+    const std::vector<size_t>*              myPieceIds;
+    Standard_Integer                        myArrType;
+    const RWMesh_CoordinateSystemConverter* myCSTrsf;
+    char*                                   myChunk;
+    int64_t                                 myChunkOffset;
+  };
+
 #ifdef HAVE_DRACO
   //! Write nodes to Draco mesh
   static void writeNodesToDracoMesh (draco::Mesh& theMesh,
@@ -253,6 +522,9 @@ RWGltf_CafWriter::RWGltf_CafWriter (const TCollection_AsciiString& theFile,
   myToMergeFaces (false),
   myToSplitIndices16 (false),
   myBinDataLen64  (0),
+  myToDeduplicateMeshes (false),
+  myToUseMeshInstancing (false),
+  myMeshInstancingThreshold (2),
   myToParallel (false)
 {
   myCSTrsf.SetOutputLengthUnit (1.0); // meters
@@ -398,26 +670,10 @@ void RWGltf_CafWriter::saveTextCoords (RWGltf_GltfFace& theGltfFace,
                                        Standard_Integer& theAccessorNb,
                                        const std::shared_ptr<RWGltf_CafWriter::Mesh>& theMesh) const
 {
-  if (!theFaceIter.HasTexCoords())
+  if (!toWriteTexCoords (theFaceIter, myIsForcedUVExport))
   {
     return;
   }
-  if (!myIsForcedUVExport)
-  {
-    if (theFaceIter.FaceStyle().Material().IsNull())
-    {
-      return;
-    }
-
-    if (RWGltf_GltfMaterialMap::baseColorTexture (theFaceIter.FaceStyle().Material()).IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().MetallicRoughnessTexture.IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().EmissiveTexture.IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().OcclusionTexture.IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().NormalTexture.IsNull())
-    {
-      return;
-    }
-  }
 
   if (theGltfFace.NodeUV.Id == RWGltf_GltfAccessor::INVALID_ID)
   {
@@ -600,7 +856,14 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
   myBuffViewInd.ByteLength       = 0;
   myBuffViewInd.Target           = RWGltf_GltfBufferViewTarget_ELEMENT_ARRAY_BUFFER;
 
+  myBuffViewInstances.Id         = RWGltf_GltfAccessor::INVALID_ID;
+  myBuffViewInstances.ByteOffset = 0;
+  myBuffViewInstances.ByteLength = 0;
+  myBuffViewInstances.Target     = RWGltf_GltfBufferViewTarget_UNKNOWN;
+
   myBuffViewsDraco.clear();
+  myInstancedNodes.Clear();
+  myMergedInstances.Clear();
 
   myBinDataMap.Clear();
   myBinDataLen64 = 0;
@@ -716,11 +979,24 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
     }
   }
 
+  if (myToDeduplicateMeshes)
+  {
+    shareIdenticalFaces();
+  }
+
+  const bool toWriteParallel = myToParallel
+                            && !myDracoParameters.DracoCompression;
+  if (toWriteParallel
+  && !writeBinDataParallel (*aBinFile, aPSentryBin))
+  {
+    return false;
+  }
+
   std::vector<std::shared_ptr<RWGltf_CafWriter::Mesh>> aMeshes;
   Standard_Integer aNbAccessors = 0;
   NCollection_Map<Handle(RWGltf_GltfFaceList)> aWrittenFaces;
   NCollection_DataMap<TopoDS_Shape, Handle(RWGltf_GltfFace), TopTools_ShapeMapHasher> aWrittenPrimData;
-  for (Standard_Integer aTypeIter = 0; aTypeIter < 4; ++aTypeIter)
+  for (Standard_Integer aTypeIter = 0; aTypeIter < 4 && !toWriteParallel; ++aTypeIter)
   {
     const RWGltf_GltfArrayType anArrType = (RWGltf_GltfArrayType )anArrTypes[aTypeIter];
     RWGltf_GltfBufferView* aBuffView = NULL;
@@ -916,6 +1192,12 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
 #endif
   }
 
+  if (myToUseMeshInstancing
+  && !writeInstancesData (theDocument, theRootLabels, theLabelFilter, *aBinFile))
+  {
+    return false;
+  }
+
   if (myIsBinary
    && myToEmbedTexturesInGlb)
   {
@@ -960,6 +1242,11 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
   {
     myBuffViewInd.Id = aBuffViewId++;
   }
+  if (myBuffViewInstances.ByteLength > 0)
+  {
+    // written after Draco buffer views
+    myBuffViewInstances.Id = aBuffViewId + (int )myBuffViewsDraco.size();
+  }
   // myMaterialMap->FlushGlbBufferViews() will put image bufferView's IDs at the end of list
 
   myBinDataLen64 = aBinFile->tellp();
@@ -973,6 +1260,476 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
   return true;
 }
 
+// =======================================================================
+// function : writeBinDataParallel
+// purpose  :
+// =======================================================================
+bool RWGltf_CafWriter::writeBinDataParallel (std::ostream& theBinFile,
+                                             Message_ProgressScope& thePSentry)
+{
+  // collect unique primitives and their faces
+  std::vector<GltfFacePiece> aPieces;
+  std::vector<std::pair<RWGltf_GltfFace*, RWGltf_GltfFace*>> aSharedPrims;
+  std::vector<size_t> aPrimFirstPiece;
+  std::vector<RWGltf_GltfFace*> aPrims;
+  {
+    NCollection_Map<Handle(RWGltf_GltfFaceList)> aWrittenFaces;
+    NCollection_DataMap<TopoDS_Shape, Handle(RWGltf_GltfFace), TopTools_ShapeMapHasher> aWrittenPrimData;
+    for (ShapeToGltfFaceMap::Iterator aBinDataIter (myBinDataMap); aBinDataIter.More(); aBinDataIter.Next())
+    {
+      const Handle(RWGltf_GltfFaceList)& aGltfFaceList = aBinDataIter.Value();
+      if (!aWrittenFaces.Add (aGltfFaceList)) // skip repeating faces
+      {
+        continue;
+      }
+
+      for (RWGltf_GltfFaceList::Iterator aGltfFaceIter (*aGltfFaceList); aGltfFaceIter.More(); aGltfFaceIter.Next())
+      {
+        const Handle(RWGltf_GltfFace)& aGltfFace = aGltfFaceIter.Value();
+        Handle(RWGltf_GltfFace) anOldGltfFace;
+        if (aWrittenPrimData.Find (aGltfFace->Shape, anOldGltfFace))
+        {
+          aSharedPrims.push_back (std::make_pair (aGltfFace.get(), anOldGltfFace.get()));
+          continue;
+        }
+        aWrittenPrimData.Bind (aGltfFace->Shape, aGltfFace);
+
+        aGltfFace->NbIndexedNodes = 0;
+        aPrims.push_back (aGltfFace.get());
+        aPrimFirstPiece.push_back (aPieces.size());
+        for (RWMesh_FaceIterator aFaceIter (aGltfFace->Shape, aGltfFace->Style); aFaceIter.More(); aFaceIter.Next())
+        {
+          GltfFacePiece aPiece;
+          aPiece.Face         = aFaceIter.Face();
+          aPiece.GltfFace     = aGltfFace.get();
+          aPiece.NbNodes      = aFaceIter.NbNodes();
+          aPiece.NbTriangles  = aFaceIter.NbTriangles();
+          aPiece.NodeFirst    = -aFaceIter.ElemLower();
+          aPiece.HasNormals   = aFaceIter.HasNormals();
+          aPiece.HasTexCoords = toWriteTexCoords (aFaceIter, myIsForcedUVExport);
+          aPieces.push_back (aPiece);
+        }
+      }
+    }
+    aPrimFirstPiece.push_back (aPieces.size());
+  }
+
+  // define accessors and buffer views in the same way as sequential writer does
+  Standard_Integer aNbAccessors = 0;
+  int64_t aPos = (int64_t )theBinFile.tellp();
+  RWGltf_GltfBufferView* aBuffViews[4] = { &myBuffViewPos, &myBuffViewNorm, &myBuffViewTextCoord, &myBuffViewInd };
+  for (Standard_Integer aTypeIter = 0; aTypeIter < 4; ++aTypeIter)
+  {
+    aBuffViews[aTypeIter]->ByteOffset = aPos;
+    for (size_t aPrimIter = 0; aPrimIter < aPrims.size(); ++aPrimIter)
+    {
+      RWGltf_GltfFace& aGltfFace = *aPrims[aPrimIter];
+      for (size_t aPieceIter = aPrimFirstPiece[aPrimIter]; aPieceIter < aPrimFirstPiece[aPrimIter + 1]; ++aPieceIter)
+      {
+        GltfFacePiece& aPiece = aPieces[aPieceIter];
+        switch (aTypeIter)
+        {
+          case 0:
+          {
+            if (aGltfFace.NodePos.Id == RWGltf_GltfAccessor::INVALID_ID)
+            {
+              aGltfFace.NodePos.Id            = aNbAccessors++;
+              aGltfFace.NodePos.ByteOffset    = aPos - myBuffViewPos.ByteOffset;
+              aGltfFace.NodePos.Type          = RWGltf_GltfAccessorLayout_Vec3;
+              aGltfFace.NodePos.ComponentType = RWGltf_GltfAccessorCompType_Float32;
+            }
+            aGltfFace.NodePos.Count += aPiece.NbNodes;
+            aPiece.Offsets[0] = aPos;
+            aPos += int64_t(aPiece.NbNodes) * sizeof(Graphic3d_Vec3);
+            break;
+          }
+          case 1:
+          {
+            if (!aPiece.HasNormals)
+            {
+              break;
+            }
+            if (aGltfFace.NodeNorm.Id == RWGltf_GltfAccessor::INVALID_ID)
+            {
+              aGltfFace.NodeNorm.Id            = aNbAccessors++;
+              aGltfFace.NodeNorm.ByteOffset    = aPos - myBuffViewNorm.ByteOffset;
+              aGltfFace.NodeNorm.Type          = RWGltf_GltfAccessorLayout_Vec3;
+              aGltfFace.NodeNorm.ComponentType = RWGltf_GltfAccessorCompType_Float32;
+            }
+            aGltfFace.NodeNorm.Count += aPiece.NbNodes;
+            aPiece.Offsets[1] = aPos;
+            aPos += int64_t(aPiece.NbNodes) * sizeof(Graphic3d_Vec3);
+            break;
+          }
+          case 2:
+          {
+            if (!aPiece.HasTexCoords)
+            {
+              break;
+            }
+            if (aGltfFace.NodeUV.Id == RWGltf_GltfAccessor::INVALID_ID)
+            {
+              aGltfFace.NodeUV.Id            = aNbAccessors++;
+              aGltfFace.NodeUV.ByteOffset    = aPos - myBuffViewTextCoord.ByteOffset;
+              aGltfFace.NodeUV.Type          = RWGltf_GltfAccessorLayout_Vec2;
+              aGltfFace.NodeUV.ComponentType = RWGltf_GltfAccessorCompType_Float32;
+            }
+            aGltfFace.NodeUV.Count += aPiece.NbNodes;
+            aPiece.Offsets[2] = aPos;
+            aPos += int64_t(aPiece.NbNodes) * sizeof(Graphic3d_Vec2);
+            break;
+          }
+          case 3:
+          {
+            if (aGltfFace.Indices.Id == RWGltf_GltfAccessor::INVALID_ID)
+            {
+              aGltfFace.Indices.Id            = aNbAccessors++;
+              aGltfFace.Indices.ByteOffset    = aPos - myBuffViewInd.ByteOffset;
+              aGltfFace.Indices.Type          = RWGltf_GltfAccessorLayout_Scalar;
+              aGltfFace.Indices.ComponentType = aGltfFace.NodePos.Count > std::numeric_limits<uint16_t>::max()
+                                              ? RWGltf_GltfAccessorCompType_UInt32
+                                              : RWGltf_GltfAccessorCompType_UInt16;
+            }
+            aPiece.NodeFirst += aGltfFace.NbIndexedNodes;
+            aGltfFace.NbIndexedNodes += aPiece.NbNodes;
+            aGltfFace.Indices.Count += aPiece.NbTriangles * 3;
+            aPiece.Offsets[3] = aPos;
+            aPos += int64_t(aPiece.NbTriangles) * 3
+                  * (aGltfFace.Indices.ComponentType == RWGltf_GltfAccessorCompType_UInt32 ? sizeof(uint32_t) : sizeof(uint16_t));
+            break;
+          }
+        }
+      }
+
+      // add alignment by 4 bytes (might happen on RWGltf_GltfAccessorCompType_UInt16 indices)
+      aPos = (aPos + 3) / 4 * 4;
+    }
+    aBuffViews[aTypeIter]->ByteLength = aPos - aBuffViews[aTypeIter]->ByteOffset;
+  }
+
+  // convert faces into chunks of limited size and write them in order
+  std::vector<size_t> aPieceIds;
+  std::vector<char> aChunk;
+  for (Standard_Integer aTypeIter = 0; aTypeIter < 4; ++aTypeIter)
+  {
+    aPieceIds.clear();
+    for (size_t aPieceIter = 0; aPieceIter < aPieces.size(); ++aPieceIter)
+    {
+      if (aPieces[aPieceIter].Offsets[aTypeIter] >= 0)
+      {
+        aPieceIds.push_back (aPieceIter);
+      }
+    }
+
+    const int64_t aViewEnd = aBuffViews[aTypeIter]->ByteOffset + aBuffViews[aTypeIter]->ByteLength;
+    int64_t aChunkOffset = aBuffViews[aTypeIter]->ByteOffset;
+    for (size_t aFirstId = 0; aFirstId < aPieceIds.size(); )
+    {
+      if (!thePSentry.More())
+      {
+        return false;
+      }
+
+      size_t aLastId = aFirstId + 1;
+      for (; aLastId < aPieceIds.size()
+          && aPieces[aPieceIds[aLastId]].Offsets[aTypeIter] - aChunkOffset < THE_PARALLEL_CHUNK_SIZE; ++aLastId) {}
+      const int64_t aChunkEnd = aLastId < aPieceIds.size() ? aPieces[aPieceIds[aLastId]].Offsets[aTypeIter] : aViewEnd;
+
+      aChunk.assign (size_t(aChunkEnd - aChunkOffset), ' ');
+      GltfFacePieceFunctor aFunctor (aPieces, aPieceIds, aTypeIter, myCSTrsf, aChunk.data(), aChunkOffset);
+      OSD_Parallel::For (int(aFirstId), int(aLastId), aFunctor, aLastId - aFirstId < 2);
+
+      theBinFile.write (aChunk.data(), std::streamsize(aChunk.size()));
+      if (!theBinFile.good())
+      {
+        Message::SendFail (TCollection_AsciiString ("File '") + myBinFileNameFull + "' cannot be written");
+        return false;
+      }
+      aChunkOffset = aChunkEnd;
+      aFirstId = aLastId;
+    }
+
+    if (aTypeIter == 0)
+    {
+      for (size_t aPieceIter = 0; aPieceIter < aPieces.size(); ++aPieceIter)
+      {
+        aPieces[aPieceIter].GltfFace->NodePos.BndBox.Combine (aPieces[aPieceIter].BndBox);
+      }
+    }
+    thePSentry.Next();
+  }
+
+  // primitives sharing the same shape refer to the same accessors
+  for (size_t aPrimIter = 0; aPrimIter < aSharedPrims.size(); ++aPrimIter)
+  {
+    RWGltf_GltfFace&       aGltfFace    = *aSharedPrims[aPrimIter].first;
+    const RWGltf_GltfFace& anOldGltfFace = *aSharedPrims[aPrimIter].second;
+    aGltfFace.NodePos  = anOldGltfFace.NodePos;
+    aGltfFace.NodeNorm = anOldGltfFace.NodeNorm;
+    aGltfFace.NodeUV   = anOldGltfFace.NodeUV;
+    aGltfFace.Indices  = anOldGltfFace.Indices;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : shareIdenticalFaces
+// purpose  :
+// =======================================================================
+void RWGltf_CafWriter::shareIdenticalFaces()
+{
+  // collect faces with distinct shapes in the order of writing
+  std::vector<RWGltf_GltfFace*> aFaces;
+  {
+    NCollection_Map<Handle(RWGltf_GltfFaceList)> aWrittenFaces;
+    NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aWrittenShapes;
+    for (ShapeToGltfFaceMap::Iterator aBinDataIter (myBinDataMap); aBinDataIter.More(); aBinDataIter.Next())
+    {
+      const Handle(RWGltf_GltfFaceList)& aGltfFaceList = aBinDataIter.Value();
+      if (!aWrittenFaces.Add (aGltfFaceList))
+      {
+        continue;
+      }
+
+      for (RWGltf_GltfFaceList::Iterator aGltfFaceIter (*aGltfFaceList); aGltfFaceIter.More(); aGltfFaceIter.Next())
+      {
+        if (aWrittenShapes.Add (aGltfFaceIter.Value()->Shape))
+        {
+          aFaces.push_back (aGltfFaceIter.Value().get());
+        }
+      }
+    }
+  }
+
+  std::vector<size_t> aHashes (aFaces.size(), 0);
+  GltfFaceHashFunctor aFunctor (aFaces, aHashes, myCSTrsf, myIsForcedUVExport);
+  OSD_Parallel::For (0, int(aFaces.size()), aFunctor, !myToParallel);
+
+  // compare data of faces with the same hash
+  NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher> aSharedShapes;
+  NCollection_DataMap<size_t, NCollection_List<RWGltf_GltfFace*>> aHashedFaces;
+  std::vector<char> aData, aRefData;
+  for (size_t aFaceIter = 0; aFaceIter < aFaces.size(); ++aFaceIter)
+  {
+    RWGltf_GltfFace* aGltfFace = aFaces[aFaceIter];
+    NCollection_List<RWGltf_GltfFace*>* aSameHashFaces = aHashedFaces.ChangeSeek (aHashes[aFaceIter]);
+    if (aSameHashFaces == NULL)
+    {
+      aSameHashFaces = aHashedFaces.Bound (aHashes[aFaceIter], NCollection_List<RWGltf_GltfFace*>());
+    }
+    else
+    {
+      bool isShared = false;
+      fillGltfFaceData (aData, *aGltfFace, myCSTrsf, myIsForcedUVExport);
+      for (NCollection_List<RWGltf_GltfFace*>::Iterator aRefIter (*aSameHashFaces); aRefIter.More(); aRefIter.Next())
+      {
+        fillGltfFaceData (aRefData, *aRefIter.Value(), myCSTrsf, myIsForcedUVExport);
+        if (aData == aRefData)
+        {
+          aSharedShapes.Bind (aGltfFace->Shape, aRefIter.Value()->Shape);
+          isShared = true;
+          break;
+        }
+      }
+      if (isShared)
+      {
+        continue;
+      }
+    }
+    aSameHashFaces->Append (aGltfFace);
+  }
+  if (aSharedShapes.IsEmpty())
+  {
+    return;
+  }
+
+  // faces are written for the first occurrence of the shape, so that all faces should refer to the same shape
+  for (ShapeToGltfFaceMap::Iterator aBinDataIter (myBinDataMap); aBinDataIter.More(); aBinDataIter.Next())
+  {
+    for (RWGltf_GltfFaceList::Iterator aGltfFaceIter (*aBinDataIter.Value()); aGltfFaceIter.More(); aGltfFaceIter.Next())
+    {
+      const TopoDS_Shape* aSharedShape = aSharedShapes.Seek (aGltfFaceIter.Value()->Shape);
+      if (aSharedShape != NULL)
+      {
+        aGltfFaceIter.Value()->Shape = *aSharedShape;
+      }
+    }
+  }
+}
+
+// =======================================================================
+// function : writeInstancesData
+// purpose  :
+// =======================================================================
+bool RWGltf_CafWriter::writeInstancesData (const Handle(TDocStd_Document)& theDocument,
+                                           const TDF_LabelSequence& theRootLabels,
+                                           const TColStd_MapOfAsciiString* theLabelFilter,
+                                           std::ostream& theBinFile)
+{
+  // accessors to transformations follow accessors to mesh data
+  Standard_Integer aNbAccessors = 0;
+  for (ShapeToGltfFaceMap::Iterator aBinDataIter (myBinDataMap); aBinDataIter.More(); aBinDataIter.Next())
+  {
+    for (RWGltf_GltfFaceList::Iterator aGltfFaceIter (*aBinDataIter.Value()); aGltfFaceIter.More(); aGltfFaceIter.Next())
+    {
+      const RWGltf_GltfFace& aGltfFace = *aGltfFaceIter.Value();
+      aNbAccessors = Max (aNbAccessors, Max (Max (aGltfFace.NodePos.Id, aGltfFace.NodeNorm.Id),
+                                             Max (aGltfFace.NodeUV.Id,  aGltfFace.Indices.Id)) + 1);
+    }
+  }
+
+  // group leaf nodes of the same parent by primitives and materials of their meshes
+  NCollection_IndexedMap<XCAFPrs_Style> aStyles;
+  NCollection_IndexedDataMap<TCollection_AsciiString, NCollection_Sequence<XCAFPrs_DocumentNode>> aGroups;
+  NCollection_Map<Handle(RWGltf_GltfFaceList)> aNodeFaces;
+  for (XCAFPrs_DocumentExplorer aDocExplorer (theDocument, theRootLabels, XCAFPrs_DocumentExplorerFlags_None);
+       aDocExplorer.More(); aDocExplorer.Next())
+  {
+    const XCAFPrs_DocumentNode& aDocNode = aDocExplorer.Current();
+    if (aDocNode.IsAssembly
+     || (theLabelFilter != NULL
+     && !theLabelFilter->Contains (aDocNode.Id)))
+    {
+      continue;
+    }
+
+    // the list of primitives is defined in the same way as in writeMeshes()
+    NCollection_Sequence<Handle(RWGltf_GltfFace)> aNodePrims;
+    aNodeFaces.Clear (false);
+    if (myToMergeFaces)
+    {
+      TopoDS_Shape aShape;
+      if (!XCAFDoc_ShapeTool::GetShape (aDocNode.RefLabel, aShape)
+      ||  aShape.IsNull())
+      {
+        continue;
+      }
+
+      aShape.Location (TopLoc_Location());
+      const Handle(RWGltf_GltfFaceList)* aGltfFaceList = myBinDataMap.Seek (RWGltf_StyledShape (aShape, aDocNode.Style));
+      if (aGltfFaceList != NULL)
+      {
+        for (RWGltf_GltfFaceList::Iterator aGltfFaceIter (**aGltfFaceList); aGltfFaceIter.More(); aGltfFaceIter.Next())
+        {
+          aNodePrims.Append (aGltfFaceIter.Value());
+        }
+      }
+    }
+    else
+    {
+      for (RWMesh_FaceIterator aFaceIter (aDocNode.RefLabel, TopLoc_Location(), true, aDocNode.Style); aFaceIter.More(); aFaceIter.Next())
+      {
+        if (toSkipFaceMesh (aFaceIter))
+        {
+          continue;
+        }
+
+        const Handle(RWGltf_GltfFaceList)* aGltfFaceList = myBinDataMap.Seek (RWGltf_StyledShape (aFaceIter.Face(), aFaceIter.FaceStyle()));
+        if (aGltfFaceList != NULL
+         && aNodeFaces.Add (*aGltfFaceList))
+        {
+          aNodePrims.Append ((*aGltfFaceList)->First());
+        }
+      }
+    }
+    if (aNodePrims.IsEmpty())
+    {
+      continue;
+    }
+
+    const Standard_Integer aDepth = aDocExplorer.CurrentDepth();
+    TCollection_AsciiString aGroupKey = aDepth > 0 ? aDocExplorer.Current (aDepth - 1).Id : TCollection_AsciiString();
+    for (NCollection_Sequence<Handle(RWGltf_GltfFace)>::Iterator aPrimIter (aNodePrims); aPrimIter.More(); aPrimIter.Next())
+    {
+      const RWGltf_GltfFace& aGltfFace = *aPrimIter.Value();
+      aGroupKey = aGroupKey + "|" + aGltfFace.NodePos.Id + " " + aGltfFace.NodeNorm.Id + " " + aGltfFace.NodeUV.Id
+                + " " + aGltfFace.Indices.Id + " " + aStyles.Add (aGltfFace.Style);
+    }
+
+    NCollection_Sequence<XCAFPrs_DocumentNode>* aGroup = aGroups.ChangeSeek (aGroupKey);
+    if (aGroup == NULL)
+    {
+      aGroup = &aGroups.ChangeFromIndex (aGroups.Add (aGroupKey, NCollection_Sequence<XCAFPrs_DocumentNode>()));
+    }
+    aGroup->Append (aDocNode);
+  }
+
+  // write transformations of instances
+  myBuffViewInstances.ByteOffset = (int64_t )theBinFile.tellp();
+  for (Standard_Integer aGroupIter = 1; aGroupIter <= aGroups.Extent(); ++aGroupIter)
+  {
+    const NCollection_Sequence<XCAFPrs_DocumentNode>& aGroup = aGroups.FindFromIndex (aGroupIter);
+    if (aGroup.Length() < myMeshInstancingThreshold)
+    {
+      continue;
+    }
+
+    std::vector<Graphic3d_Vec3> aTranslations (aGroup.Length());
+    std::vector<Graphic3d_Vec4> aRotations    (aGroup.Length());
+    std::vector<Graphic3d_Vec3> aScales       (aGroup.Length());
+    bool hasRotation = false, hasScale = false;
+    for (Standard_Integer aNodeIter = 1; aNodeIter <= aGroup.Length(); ++aNodeIter)
+    {
+      gp_Trsf aTrsf = aGroup.Value (aNodeIter).LocalTrsf.Transformation();
+      myCSTrsf.TransformTransformation (aTrsf);
+      const gp_Quaternion aQuaternion = aTrsf.GetRotation();
+      const Standard_Real aScaleFactor = aTrsf.ScaleFactor();
+      const gp_XYZ& aTranslPart = aTrsf.TranslationPart();
+      hasRotation = hasRotation
+                 || Abs (aQuaternion.X())       > gp::Resolution()
+                 || Abs (aQuaternion.Y())       > gp::Resolution()
+                 || Abs (aQuaternion.Z())       > gp::Resolution()
+                 || Abs (aQuaternion.W() - 1.0) > gp::Resolution();
+      hasScale = hasScale
+              || Abs (aScaleFactor - 1.0) > Precision::Confusion();
+      aTranslations[aNodeIter - 1] = Graphic3d_Vec3 (float(aTranslPart.X()), float(aTranslPart.Y()), float(aTranslPart.Z()));
+      aRotations   [aNodeIter - 1] = Graphic3d_Vec4 (float(aQuaternion.X()), float(aQuaternion.Y()), float(aQuaternion.Z()), float(aQuaternion.W()));
+      aScales      [aNodeIter - 1] = Graphic3d_Vec3 (float(aScaleFactor));
+    }
+
+    RWGltf_MeshInstances anInstances;
+    for (Standard_Integer anAttribIter = 0; anAttribIter < 3; ++anAttribIter)
+    {
+      RWGltf_GltfAccessor& anAccessor = anAttribIter == 0 ? anInstances.Translation
+                                      : (anAttribIter == 1 ? anInstances.Rotation : anInstances.Scale);
+      if ((anAttribIter == 1 && !hasRotation)
+       || (anAttribIter == 2 && !hasScale))
+      {
+        continue;
+      }
+
+      anAccessor.Id            = aNbAccessors++;
+      anAccessor.ByteOffset    = (int64_t )theBinFile.tellp() - myBuffViewInstances.ByteOffset;
+      anAccessor.Count         = aGroup.Length();
+      anAccessor.Type          = anAttribIter == 1 ? RWGltf_GltfAccessorLayout_Vec4 : RWGltf_GltfAccessorLayout_Vec3;
+      anAccessor.ComponentType = RWGltf_GltfAccessorCompType_Float32;
+      if (anAttribIter == 1)
+      {
+        theBinFile.write ((const char* )aRotations.data(), std::streamsize(aRotations.size() * sizeof(Graphic3d_Vec4)));
+      }
+      else
+      {
+        const std::vector<Graphic3d_Vec3>& aValues = anAttribIter == 0 ? aTranslations : aScales;
+        theBinFile.write ((const char* )aValues.data(), std::streamsize(aValues.size() * sizeof(Graphic3d_Vec3)));
+      }
+    }
+
+    myInstancedNodes.Add (aGroup.First().Id, anInstances);
+    for (Standard_Integer aNodeIter = 2; aNodeIter <= aGroup.Length(); ++aNodeIter)
+    {
+      myMergedInstances.Add (aGroup.Value (aNodeIter).Id);
+    }
+  }
+  myBuffViewInstances.ByteLength = (int64_t )theBinFile.tellp() - myBuffViewInstances.ByteOffset;
+
+  if (!theBinFile.good())
+  {
+    Message::SendFail (TCollection_AsciiString ("File '") + myBinFileNameFull + "' cannot be written");
+    return false;
+  }
+  return true;
+}
+
 //================================================================
 // Function : writeJson
 // Purpose  :
@@ -1023,8 +1780,9 @@ bool RWGltf_CafWriter::writeJson (const Handle(TDocStd_Document)&  theDocument,
        aDocExplorer.More(); aDocExplorer.Next())
   {
     const XCAFPrs_DocumentNode& aDocNode = aDocExplorer.Current();
-    if (theLabelFilter != NULL
-    && !theLabelFilter->Contains (aDocNode.Id))
+    if ((theLabelFilter != NULL
+     && !theLabelFilter->Contains (aDocNode.Id))
+     || myMergedInstances.Contains (aDocNode.Id))
     {
       continue;
     }
@@ -1289,10 +2047,55 @@ void RWGltf_CafWriter::writeAccessors (const RWGltf_GltfSceneNodeMap& )
     }
   }
 
+  for (NodeToMeshInstancesMap::Iterator anInstancesIter (myInstancedNodes); anInstancesIter.More(); anInstancesIter.Next())
+  {
+    const RWGltf_MeshInstances& anInstances = anInstancesIter.Value();
+    const RWGltf_GltfAccessor* anAccessors[3] = { &anInstances.Translation, &anInstances.Rotation, &anInstances.Scale };
+    for (Standard_Integer anAttribIter = 0; anAttribIter < 3; ++anAttribIter)
+    {
+      if (anAccessors[anAttribIter]->Id == RWGltf_GltfAccessor::INVALID_ID)
+      {
+        continue;
+      }
+      if (anAccessors[anAttribIter]->Id != aNbAccessors)
+      {
+        throw Standard_ProgramError ("Internal error: RWGltf_CafWriter::writeAccessors()");
+      }
+      ++aNbAccessors;
+      writeInstancesAccessor (*anAccessors[anAttribIter]);
+    }
+  }
+
   myWriter->EndArray();
 #endif
 }
 
+// =======================================================================
+// function : writeInstancesAccessor
+// purpose  :
+// =======================================================================
+void RWGltf_CafWriter::writeInstancesAccessor (const RWGltf_GltfAccessor& theAccessor)
+{
+#ifdef HAVE_RAPIDJSON
+  Standard_ProgramError_Raise_if (myWriter.get() == NULL, "Internal error: RWGltf_CafWriter::writeInstancesAccessor()");
+
+  myWriter->StartObject();
+  myWriter->Key    ("bufferView");
+  myWriter->Int    (myBuffViewInstances.Id);
+  myWriter->Key    ("byteOffset");
+  myWriter->Int64  (theAccessor.ByteOffset);
+  myWriter->Key    ("componentType");
+  myWriter->Int    (theAccessor.ComponentType);
+  myWriter->Key    ("count");
+  myWriter->Int64  (theAccessor.Count);
+  myWriter->Key    ("type");
+  myWriter->String (theAccessor.Type == RWGltf_GltfAccessorLayout_Vec4 ? "VEC4" : "VEC3");
+  myWriter->EndObject();
+#else
+  (void )theAccessor;
+#endif
+}
+
 // =======================================================================
 // function : writePositions
 // purpose  :
@@ -1626,6 +2429,18 @@ void RWGltf_CafWriter::writeBufferViews (const Standard_Integer theBinDataBuffer
       }
     }
   }
+  if (myBuffViewInstances.Id != RWGltf_GltfAccessor::INVALID_ID)
+  {
+    aBuffViewId++;
+    myWriter->StartObject();
+    myWriter->Key    ("buffer");
+    myWriter->Int    (theBinDataBufferId);
+    myWriter->Key    ("byteLength");
+    myWriter->Int64  (myBuffViewInstances.ByteLength);
+    myWriter->Key    ("byteOffset");
+    myWriter->Int64  (myBuffViewInstances.ByteOffset);
+    myWriter->EndObject();
+  }
 
   myMaterialMap->FlushGlbBufferViews (myWriter.get(), theBinDataBufferId, aBuffViewId);
 
@@ -1672,21 +2487,28 @@ void RWGltf_CafWriter::writeExtensions()
 #ifdef HAVE_RAPIDJSON
   Standard_ProgramError_Raise_if (myWriter.get() == NULL, "Internal error: RWGltf_CafWriter::writeExtensions()");
 
-  if (myDracoParameters.DracoCompression)
+  if (!myDracoParameters.DracoCompression
+   && myInstancedNodes.IsEmpty())
   {
-    myWriter->Key(RWGltf_GltfRootElementName(RWGltf_GltfRootElement_ExtensionsUsed));
-
-    myWriter->StartArray();
-    {
-      myWriter->Key("KHR_draco_mesh_compression");
-    }
-    myWriter->EndArray();
+    return;
+  }
 
-    myWriter->Key(RWGltf_GltfRootElementName(RWGltf_GltfRootElement_ExtensionsRequired));
+  // both extensions are required, as data cannot be displayed correctly without them
+  const RWGltf_GltfRootElement aRootElems[2] = { RWGltf_GltfRootElement_ExtensionsUsed, RWGltf_GltfRootElement_ExtensionsRequired };
+  for (Standard_Integer anElemIter = 0; anElemIter < 2; ++anElemIter)
+  {
+    myWriter->Key(RWGltf_GltfRootElementName(aRootElems[anElemIter]));
 
     myWriter->StartArray();
     {
-      myWriter->Key("KHR_draco_mesh_compression");
+      if (myDracoParameters.DracoCompression)
+      {
+        myWriter->String("KHR_draco_mesh_compression");
+      }
+      if (!myInstancedNodes.IsEmpty())
+      {
+        myWriter->String("EXT_mesh_gpu_instancing");
+      }
     }
     myWriter->EndArray();
   }
@@ -1998,6 +2820,12 @@ void RWGltf_CafWriter::writeNodes (const Handle(TDocStd_Document)&  theDocument,
     //RWMesh_FaceIterator aFaceIter (aDocNode.RefLabel, TopLoc_Location(), false);
     //if (!aFaceIter.More()) { continue; }
 
+    // skip instances written within EXT_mesh_gpu_instancing extension of another node
+    if (myMergedInstances.Contains (aDocNode.Id))
+    {
+      continue;
+    }
+
     Standard_Integer aNodeIndex = aSceneNodeMapWithChildren.Add (aDocNode);
     if (aDocExplorer.CurrentDepth() == 0)
     {
@@ -2013,6 +2841,7 @@ void RWGltf_CafWriter::writeNodes (const Handle(TDocStd_Document)&  theDocument,
   for (RWGltf_GltfSceneNodeMap::Iterator aSceneNodeIter (aSceneNodeMapWithChildren); aSceneNodeIter.More(); aSceneNodeIter.Next())
   {
     const XCAFPrs_DocumentNode& aDocNode = aSceneNodeIter.Value();
+    const RWGltf_MeshInstances* anInstances = myInstancedNodes.Seek (aDocNode.Id);
 
     myWriter->StartObject();
     {
@@ -2040,7 +2869,8 @@ void RWGltf_CafWriter::writeNodes (const Handle(TDocStd_Document)&  theDocument,
         myWriter->EndArray();
       }
     }
-    if (!aDocNode.LocalTrsf.IsIdentity())
+    if (!aDocNode.LocalTrsf.IsIdentity()
+     && anInstances == NULL) // transformation is defined per instance
     {
       gp_Trsf aTrsf = aDocNode.LocalTrsf.Transformation();
       if (aTrsf.Form() != gp_Identity)
@@ -2126,6 +2956,34 @@ void RWGltf_CafWriter::writeNodes (const Handle(TDocStd_Document)&  theDocument,
         myWriter->Int (aMeshIdx - 1);
       }
     }
+    if (anInstances != NULL)
+    {
+      myWriter->Key ("extensions");
+      myWriter->StartObject();
+      {
+        myWriter->Key ("EXT_mesh_gpu_instancing");
+        myWriter->StartObject();
+        {
+          myWriter->Key ("attributes");
+          myWriter->StartObject();
+          if (anInstances->Rotation.Id != RWGltf_GltfAccessor::INVALID_ID)
+          {
+            myWriter->Key ("ROTATION");
+            myWriter->Int (anInstances->Rotation.Id);
+          }
+          if (anInstances->Scale.Id != RWGltf_GltfAccessor::INVALID_ID)
+          {
+            myWriter->Key ("SCALE");
+            myWriter->Int (anInstances->Scale.Id);
+          }
+          myWriter->Key ("TRANSLATION");
+          myWriter->Int (anInstances->Translation.Id);
+          myWriter->EndObject();
+        }
+        myWriter->EndObject();
+      }
+      myWriter->EndObject();
+    }
     {
       const TCollection_AsciiString aNodeName = formatName (myNodeNameFormat, aDocNode.Label, aDocNode.RefLabel);
       if (!aNodeName.IsEmpty())
@@ -30,6 +30,7 @@
 #include <memory>
 
 class Message_ProgressRange;
+class Message_ProgressScope;
 class RWMesh_FaceIterator;
 class RWGltf_GltfOStreamWriter;
 class RWGltf_GltfMaterialMap;
@@ -126,7 +127,37 @@ public:
   //! May reduce binary data size thanks to smaller triangle indexes.
   void SetSplitIndices16 (bool theToSplit) { myToSplitIndices16 = theToSplit; }
 
+  //! Return TRUE to write identical triangulation data only once; FALSE by default.
+  bool ToDeduplicateMeshes() const { return myToDeduplicateMeshes; }
+
+  //! Set flag to write identical triangulation data only once.
+  //! Faces (or merged faces) are compared by the content of their triangulations
+  //! as written into binary buffer, so that geometrically identical parts defined by distinct shapes
+  //! (e.g. after STEP import) share the same accessors.
+  //! May reduce binary data size at the cost of comparing the meshes.
+  void SetDeduplicateMeshes (bool theToDeduplicate) { myToDeduplicateMeshes = theToDeduplicate; }
+
+  //! Return TRUE to write repeated instances of the same mesh using EXT_mesh_gpu_instancing extension; FALSE by default.
+  bool ToUseMeshInstancing() const { return myToUseMeshInstancing; }
+
+  //! Set flag to write repeated instances of the same mesh using EXT_mesh_gpu_instancing extension.
+  //! Leaf nodes of the same parent referring to the same primitives and materials
+  //! are written as a single node with per-instance transformations,
+  //! when their number is not less than MeshInstancingThreshold().
+  //! Names and attributes are written only for the first instance of each group.
+  //! The extension is marked as required, so that the file might be unreadable by some applications.
+  void SetMeshInstancing (bool theToUse) { myToUseMeshInstancing = theToUse; }
+
+  //! Return minimal number of instances of the same mesh to be written using EXT_mesh_gpu_instancing extension; 2 by default.
+  Standard_Integer MeshInstancingThreshold() const { return myMeshInstancingThreshold; }
+
+  //! Set minimal number of instances of the same mesh to be written using EXT_mesh_gpu_instancing extension.
+  void SetMeshInstancingThreshold (Standard_Integer theNbInstances) { myMeshInstancingThreshold = Max (theNbInstances, 2); }
+
   //! Return TRUE if multithreaded optimizations are allowed; FALSE by default.
+  //! Without Draco compression, the layout of binary buffer is computed first
+  //! and then faces are converted into the output chunks concurrently,
+  //! so that virtual methods saveNodes(), saveNormals(), saveTextCoords() and saveIndices() are not called.
   bool ToParallel() const { return myToParallel; }
 
   //! Setup multithreaded execution.
@@ -179,6 +210,31 @@ protected:
                                              const TColStd_MapOfAsciiString* theLabelFilter,
                                              const Message_ProgressRange& theProgress);
 
+  //! Write binary data of faces collected within writeBinData() using multiple threads.
+  //! Accessors and buffer views are defined first, then faces are converted concurrently
+  //! into output chunks of limited size, written in the same order as in sequential mode.
+  //! @param[in] theBinFile  output stream
+  //! @param[in] thePSentry  progress scope with 4 steps (one per buffer view)
+  //! @return FALSE on file writing failure or user break
+  Standard_EXPORT bool writeBinDataParallel (std::ostream& theBinFile,
+                                             Message_ProgressScope& thePSentry);
+
+  //! Replace shapes of glTF faces having the same triangulation data as previously collected faces
+  //! (see SetDeduplicateMeshes()), so that their binary data is written only once.
+  Standard_EXPORT void shareIdenticalFaces();
+
+  //! Group instances of the same meshes (see SetMeshInstancing())
+  //! and write their transformations into binary file.
+  //! @param[in] theDocument     input document
+  //! @param[in] theRootLabels   list of root shapes to export
+  //! @param[in] theLabelFilter  optional filter with document nodes to export
+  //! @param[in] theBinFile      output stream
+  //! @return FALSE on file writing failure
+  Standard_EXPORT bool writeInstancesData (const Handle(TDocStd_Document)& theDocument,
+                                           const TDF_LabelSequence& theRootLabels,
+                                           const TColStd_MapOfAsciiString* theLabelFilter,
+                                           std::ostream& theBinFile);
+
   //! Write JSON file with glTF structure (should be called after writeBinData()).
   //! @param[in] theDocument     input document
   //! @param[in] theRootLabels   list of root shapes to export
@@ -277,6 +333,10 @@ protected:
   //! @param[in] theSceneNodeMap  ordered map of scene nodes
   Standard_EXPORT virtual void writeAccessors (const RWGltf_GltfSceneNodeMap& theSceneNodeMap);
 
+  //! Write accessor to instances transformation within RWGltf_GltfRootElement_Accessors section.
+  //! @param[in] theAccessor  accessor definition to write
+  Standard_EXPORT void writeInstancesAccessor (const RWGltf_GltfAccessor& theAccessor);
+
   //! Write RWGltf_GltfRootElement_Animations section (reserved).
   Standard_EXPORT virtual void writeAnimations();
 
@@ -392,6 +452,16 @@ protected:
 
   typedef NCollection_IndexedDataMap<RWGltf_StyledShape, Handle(RWGltf_GltfFaceList), Hasher> ShapeToGltfFaceMap;
 
+  //! Accessors to per-instance transformations of the node written with EXT_mesh_gpu_instancing extension.
+  struct RWGltf_MeshInstances
+  {
+    RWGltf_GltfAccessor Translation; //!< accessor to translations
+    RWGltf_GltfAccessor Rotation;    //!< accessor to rotations (quaternions), or invalid accessor if instances are not rotated
+    RWGltf_GltfAccessor Scale;       //!< accessor to scale factors, or invalid accessor if instances are not scaled
+  };
+
+  typedef NCollection_IndexedDataMap<TCollection_AsciiString, RWGltf_MeshInstances> NodeToMeshInstancesMap;
+
 protected:
 
   TCollection_AsciiString                       myFile;              //!< output glTF file
@@ -418,7 +488,14 @@ protected:
   ShapeToGltfFaceMap                            myBinDataMap;        //!< map for TopoDS_Face to glTF face (merging duplicates)
   int64_t                                       myBinDataLen64;      //!< length of binary file
 
+  RWGltf_GltfBufferView                         myBuffViewInstances; //!< current buffer view with instances transformations
+  NodeToMeshInstancesMap                        myInstancedNodes;    //!< map of nodes (first instances) written with EXT_mesh_gpu_instancing extension
+  TColStd_MapOfAsciiString                      myMergedInstances;   //!< ids of nodes written as instances of another node
+
   std::vector<RWGltf_GltfBufferView>            myBuffViewsDraco;    //!< vector of buffers view with compression data
+  Standard_Boolean                              myToDeduplicateMeshes; //!< flag to write identical triangulation data only once
+  Standard_Boolean                              myToUseMeshInstancing; //!< flag to write repeated meshes using EXT_mesh_gpu_instancing
+  Standard_Integer                              myMeshInstancingThreshold; //!< minimal number of instances for EXT_mesh_gpu_instancing
   Standard_Boolean                              myToParallel;        //!< flag to use multithreading; FALSE by default
 // clang-format on
   RWGltf_DracoParameters                        myDracoParameters;   //!< Draco parameters
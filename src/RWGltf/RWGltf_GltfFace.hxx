@@ -29,7 +29,7 @@ public:
   RWGltf_GltfAccessor NodeNorm; //!< accessor for nodal normals
   RWGltf_GltfAccessor NodeUV;   //!< accessor for nodal UV texture coordinates
   RWGltf_GltfAccessor Indices;  //!< accessor for indexes
-  TopoDS_Shape        Shape;    //!< original Face or face list
+  TopoDS_Shape        Shape;    //!< original Face or face list (or another shape with identical triangulation data)
   XCAFPrs_Style       Style;    //!< face style
 // clang-format off
   Standard_Integer    NbIndexedNodes; //!< transient variable for merging several faces into one while writing Indices
@@ -31,6 +31,7 @@
 #include <TopoDS_Iterator.hxx>
 
 #include <fstream>
+#include <vector>
 
 #ifdef HAVE_RAPIDJSON
 namespace
@@ -318,6 +319,227 @@ namespace
     }
     return myResult;
   }
+
+  //! SAX handler forwarding events to JSON document and skipping elements not used by RWGltf_GltfJsonParser.
+  //! Skipped values are parsed (validated) by the reader, but no DOM values are allocated for them.
+  class RWGltf_GltfSaxFilter
+  {
+  public:
+
+    //! Main constructor.
+    //! @param[in] theDoc document to fill in
+    //! @param[in] theToKeepExtras      keep "extras" of nodes and meshes
+    //! @param[in] theToKeepAssetExtras keep "extras" of asset
+    RWGltf_GltfSaxFilter (rapidjson::Document& theDoc,
+                          bool theToKeepExtras,
+                          bool theToKeepAssetExtras)
+    : myDoc (theDoc),
+      mySkipDepth (0),
+      myExtrasDepth (0),
+      myToSkipNext (false),
+      myToKeepExtras (theToKeepExtras),
+      myToKeepAssetExtras (theToKeepAssetExtras),
+      myIsAssetRoot (false) {}
+
+    bool Null()                { return !toForwardValue() || myDoc.Null(); }
+    bool Bool   (bool theVal)  { return !toForwardValue() || myDoc.Bool   (theVal); }
+    bool Int    (int  theVal)  { return !toForwardValue() || myDoc.Int    (theVal); }
+    bool Uint   (unsigned theVal) { return !toForwardValue() || myDoc.Uint (theVal); }
+    bool Int64  (int64_t  theVal) { return !toForwardValue() || myDoc.Int64  (theVal); }
+    bool Uint64 (uint64_t theVal) { return !toForwardValue() || myDoc.Uint64 (theVal); }
+    bool Double (double   theVal) { return !toForwardValue() || myDoc.Double (theVal); }
+
+    bool RawNumber (const char* theStr, rapidjson::SizeType theLen, bool theToCopy)
+    {
+      return !toForwardValue() || myDoc.RawNumber (theStr, theLen, theToCopy);
+    }
+
+    bool String (const char* theStr, rapidjson::SizeType theLen, bool theToCopy)
+    {
+      return !toForwardValue() || myDoc.String (theStr, theLen, theToCopy);
+    }
+
+    bool StartObject()
+    {
+      if (!toForwardValue())
+      {
+        ++mySkipDepth;
+        return true;
+      }
+      myLevels.push_back (0);
+      return myDoc.StartObject();
+    }
+
+    bool Key (const char* theStr, rapidjson::SizeType theLen, bool theToCopy)
+    {
+      if (mySkipDepth != 0)
+      {
+        return true;
+      }
+      if (toSkipMember (theStr))
+      {
+        myToSkipNext = true;
+        return true;
+      }
+      return myDoc.Key (theStr, theLen, theToCopy);
+    }
+
+    bool EndObject (rapidjson::SizeType )
+    {
+      if (mySkipDepth != 0)
+      {
+        --mySkipDepth;
+        return true;
+      }
+      const rapidjson::SizeType aNbMembers = myLevels.back();
+      myLevels.pop_back();
+      if (myLevels.size() <= myExtrasDepth)
+      {
+        myExtrasDepth = 0;
+      }
+      return myDoc.EndObject (aNbMembers);
+    }
+
+    bool StartArray()
+    {
+      if (!toForwardValue())
+      {
+        ++mySkipDepth;
+        return true;
+      }
+      myLevels.push_back (0);
+      return myDoc.StartArray();
+    }
+
+    bool EndArray (rapidjson::SizeType )
+    {
+      if (mySkipDepth != 0)
+      {
+        --mySkipDepth;
+        return true;
+      }
+      const rapidjson::SizeType aNbElements = myLevels.back();
+      myLevels.pop_back();
+      if (myLevels.size() <= myExtrasDepth)
+      {
+        myExtrasDepth = 0;
+      }
+      return myDoc.EndArray (aNbElements);
+    }
+
+  private:
+
+    //! Return TRUE if the next value should be forwarded to the document; counts the forwarded value.
+    bool toForwardValue()
+    {
+      if (mySkipDepth != 0)
+      {
+        return false;
+      }
+      if (myToSkipNext)
+      {
+        myToSkipNext = false;
+        return false;
+      }
+      if (!myLevels.empty())
+      {
+        ++myLevels.back();
+      }
+      return true;
+    }
+
+    //! Return TRUE if the member of the current object should be skipped.
+    bool toSkipMember (const char* theName)
+    {
+      const size_t aDepth = myLevels.size();
+      if (myExtrasDepth != 0)
+      {
+        if (aDepth > myExtrasDepth)
+        {
+          return false; // content of "extras" is kept as is
+        }
+        myExtrasDepth = 0;
+      }
+
+      if (aDepth == 1)
+      {
+        // root elements
+        static const char* THE_USED_ROOTS[] =
+        {
+          "asset", "scenes", "scene", "nodes", "meshes", "accessors", "bufferViews", "buffers",
+          "materials", "samplers", "textures", "images", "extensionsUsed", "extensionsRequired"
+        };
+        myRootName = theName;
+        myIsAssetRoot = ::strcmp (theName, "asset") == 0;
+        for (size_t aNameIter = 0; aNameIter < sizeof(THE_USED_ROOTS) / sizeof(THE_USED_ROOTS[0]); ++aNameIter)
+        {
+          if (::strcmp (theName, THE_USED_ROOTS[aNameIter]) == 0)
+          {
+            return false;
+          }
+        }
+        return true;
+      }
+      else if (::strcmp (theName, "extras") == 0)
+      {
+        const bool toKeep = aDepth == 2
+                          ? myIsAssetRoot && myToKeepAssetExtras
+                          : aDepth == 3 && myToKeepExtras && (myRootName == "nodes" || myRootName == "meshes");
+        if (toKeep)
+        {
+          myExtrasDepth = aDepth;
+        }
+        return !toKeep;
+      }
+      else if (aDepth == 3 && myRootName == "nodes")
+      {
+        return ::strcmp (theName, "skin")    == 0
+            || ::strcmp (theName, "camera")  == 0
+            || ::strcmp (theName, "weights") == 0;
+      }
+      else if (aDepth == 3 && myRootName == "meshes")
+      {
+        return ::strcmp (theName, "weights") == 0;
+      }
+      else if (aDepth == 5 && myRootName == "meshes")
+      {
+        return ::strcmp (theName, "targets") == 0;
+      }
+      return false;
+    }
+
+  private:
+
+    rapidjson::Document& myDoc;
+    std::vector<rapidjson::SizeType> myLevels; //!< numbers of forwarded values within opened objects and arrays
+    TCollection_AsciiString myRootName;        //!< name of the current root element
+    int  mySkipDepth;                          //!< depth within skipped value
+    size_t myExtrasDepth;                      //!< depth of the object owning kept "extras", or 0
+    bool myToSkipNext;                         //!< flag to skip the value of the current member
+    bool myToKeepExtras;
+    bool myToKeepAssetExtras;
+    bool myIsAssetRoot;
+  };
+
+  //! Generator filling in JSON document from the stream via RWGltf_GltfSaxFilter.
+  struct RWGltf_GltfSaxGenerator
+  {
+    rapidjson::IStreamWrapper* Stream;
+    rapidjson::ParseResult     Result;
+    bool ToStopWhenDone;
+    bool ToKeepExtras;
+    bool ToKeepAssetExtras;
+
+    bool operator() (rapidjson::Document& theDoc)
+    {
+      RWGltf_GltfSaxFilter aFilter (theDoc, ToKeepExtras, ToKeepAssetExtras);
+      rapidjson::Reader aReader;
+      Result = ToStopWhenDone
+             ? aReader.Parse<rapidjson::kParseStopWhenDoneFlag> (*Stream, aFilter)
+             : aReader.Parse<rapidjson::kParseDefaultFlags>     (*Stream, aFilter);
+      return !Result.IsError();
+    }
+  };
 }
 
 //! Find member of the object in a safe way.
@@ -381,6 +603,22 @@ const char* RWGltf_GltfJsonParser::FormatParseError (rapidjson::ParseErrorCode t
   return "UNKOWN syntax error";
 }
 
+// =======================================================================
+// function : ParseStreamCompact
+// purpose  :
+// =======================================================================
+rapidjson::ParseResult RWGltf_GltfJsonParser::ParseStreamCompact (rapidjson::IStreamWrapper& theStream,
+                                                                  bool theToStopWhenDone)
+{
+  RWGltf_GltfSaxGenerator aGenerator;
+  aGenerator.Stream            = &theStream;
+  aGenerator.ToStopWhenDone    = theToStopWhenDone;
+  aGenerator.ToKeepExtras      = myAttribMap != NULL;
+  aGenerator.ToKeepAssetExtras = myToReadAssetExtras && myMetadata != NULL;
+  Populate (aGenerator);
+  return aGenerator.Result;
+}
+
 // =======================================================================
 // function : GltfElementMap::Init
 // purpose  :
@@ -117,6 +117,18 @@ public:
   //! Set flag to use Mesh name in case if Node name is empty, TRUE by default.
   void SetMeshNameAsFallback (bool theToFallback) { myUseMeshNameAsFallback = theToFallback; }
 
+#ifdef HAVE_RAPIDJSON
+  //! Fill in JSON document from the stream by SAX events, skipping the elements which are not used by the parser
+  //! (animations, skins, cameras, morph targets, glTF 1.0 techniques, and "extras" not translated into attributes),
+  //! so that DOM values are created only for the tables actually needed.
+  //! Should be called after setting up attribute map and metadata.
+  //! @param[in] theStream stream to read
+  //! @param[in] theToStopWhenDone stop parsing after the root object (JSON chunk of binary file)
+  //! @return parsing result
+  Standard_EXPORT rapidjson::ParseResult ParseStreamCompact (rapidjson::IStreamWrapper& theStream,
+                                                            bool theToStopWhenDone);
+#endif
+
   //! Parse glTF document.
   Standard_EXPORT bool Parse (const Message_ProgressRange& theProgress);
 
@@ -32,6 +32,12 @@ public:
   //! Setup single/double precision flag for reading vertex data (coordinates).
   void SetSinglePrecision (Standard_Boolean theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
 
+  //! Return TRUE if multithreaded optimizations are allowed; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded execution.
+  void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
+
 protected:
 
   //! Read the mesh from specified file.
@@ -60,6 +66,7 @@ protected:
   NCollection_DataMap<TCollection_AsciiString, Handle(XCAFDoc_VisMaterial)> myObjMaterialMap;
 // clang-format off
   Standard_Boolean myIsSinglePrecision; //!< flag for reading vertex data with single or double floating point precision
+  bool             myToParallel;        //!< flag to use multithreading; FALSE by default
 // clang-format on
 };
 
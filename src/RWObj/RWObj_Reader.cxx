@@ -24,6 +24,7 @@
 #include <Message_ProgressScope.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
 #include <OSD_Timer.hxx>
 #include <Standard_CLocaleSentry.hxx>
@@ -47,6 +48,24 @@ namespace
   // The length of buffer to read (in bytes)
   static const size_t THE_BUFFER_SIZE = 4 * 1024;
 
+  // The length of the batch of lines read at once in parallel mode (in bytes)
+  static const size_t THE_PARALLEL_BATCH_SIZE = 16 * 1024 * 1024;
+
+  // The number of lines within the block parsed by single thread in parallel mode
+  static const size_t THE_PARALLEL_BLOCK_NB_LINES = 16 * 1024;
+
+  //! Return TRUE if the line defines "v" record.
+  static bool isVertexLine (const char* theLine) { return theLine[0] == 'v' && RWObj_Tools::isSpaceChar (theLine[1]); }
+
+  //! Return TRUE if the line defines "vn" record.
+  static bool isNormalLine (const char* theLine) { return theLine[0] == 'v' && theLine[1] == 'n' && RWObj_Tools::isSpaceChar (theLine[2]); }
+
+  //! Return TRUE if the line defines "vt" record.
+  static bool isTexelLine (const char* theLine) { return theLine[0] == 'v' && theLine[1] == 't' && RWObj_Tools::isSpaceChar (theLine[2]); }
+
+  //! Return TRUE if the line defines "f" record.
+  static bool isElementLine (const char* theLine) { return theLine[0] == 'f' && RWObj_Tools::isSpaceChar (theLine[1]); }
+
 
   //! Return TRUE if given polygon has clockwise node order.
   static bool isClockwisePolygon (const Handle(BRepMesh_DataStructureOfDelaun)& theMesh,
@@ -66,6 +85,82 @@ namespace
   }
 }
 
+//! Records of the block of lines parsed in advance in parallel mode.
+struct RWObj_Reader::ParsedRecords
+{
+  size_t FirstLine; //!< first line of the block within the batch
+  size_t LastLine;  //!< last line of the block within the batch (exclusive)
+  std::vector<gp_XYZ>          Verts;   //!< positions of "v" records
+  std::vector<Graphic3d_Vec3>  Norms;   //!< normals of "vn" records
+  std::vector<Graphic3d_Vec2>  Texels;  //!< UV of "vt" records
+  std::vector<Graphic3d_Vec3i> Indices; //!< node indices of "f" records
+  std::vector<Standard_Integer> NbElemNodes; //!< number of nodes of "f" records
+  size_t VertIter, NormIter, TexelIter, IndexIter, ElemIter; //!< positions of the records to be handled next
+
+  ParsedRecords() : FirstLine (0), LastLine (0), VertIter (0), NormIter (0), TexelIter (0), IndexIter (0), ElemIter (0) {}
+
+  //! Reset the block.
+  void Reset (size_t theFirstLine, size_t theLastLine)
+  {
+    FirstLine = theFirstLine;
+    LastLine  = theLastLine;
+    Verts.clear();
+    Norms.clear();
+    Texels.clear();
+    Indices.clear();
+    NbElemNodes.clear();
+    VertIter = NormIter = TexelIter = IndexIter = ElemIter = 0;
+  }
+};
+
+//! Functor parsing the blocks of lines of the batch.
+class RWObj_Reader::ParseFunctor
+{
+public:
+  ParseFunctor (const RWObj_Reader& theReader,
+                const std::vector<char>& theText,
+                const std::vector<size_t>& theLines,
+                std::vector<ParsedRecords>& theBlocks)
+  : myReader (theReader), myText (theText), myLines (theLines), myBlocks (theBlocks) {}
+
+  void operator() (const Standard_Integer theBlockIndex) const
+  {
+    ParsedRecords& aBlock = myBlocks[theBlockIndex];
+    for (size_t aLineIter = aBlock.FirstLine; aLineIter < aBlock.LastLine; ++aLineIter)
+    {
+      const char* aLine = &myText.front() + myLines[aLineIter];
+      if (isVertexLine (aLine))
+      {
+        aBlock.Verts.push_back (gp_XYZ());
+        myReader.parseVertex (aLine + 2, aBlock.Verts.back());
+      }
+      else if (isNormalLine (aLine))
+      {
+        aBlock.Norms.push_back (Graphic3d_Vec3());
+        myReader.parseNormal (aLine + 3, aBlock.Norms.back());
+      }
+      else if (isTexelLine (aLine))
+      {
+        aBlock.Texels.push_back (Graphic3d_Vec2());
+        RWObj_Reader::parseTexel (aLine + 3, aBlock.Texels.back());
+      }
+      else if (isElementLine (aLine))
+      {
+        aBlock.NbElemNodes.push_back (RWObj_Reader::parseIndices (aLine + 2, aBlock.Indices));
+      }
+    }
+  }
+
+private:
+  ParseFunctor& operator= (const ParseFunctor&);
+
+private:
+  const RWObj_Reader&         myReader;
+  const std::vector<char>&    myText;
+  const std::vector<size_t>&  myLines;
+  std::vector<ParsedRecords>& myBlocks;
+};
+
 // ================================================================
 // Function : Read
 // Purpose  :
@@ -77,7 +172,8 @@ RWObj_Reader::RWObj_Reader()
   myNbProbeNodes (0),
   myNbProbeElems (0),
   myNbElemsBig (0),
-  myToAbort (false)
+  myToAbort (false),
+  myToParallel (false)
 {
   //
 }
@@ -128,176 +224,319 @@ Standard_Boolean RWObj_Reader::read (std::istream& theStream,
     return Standard_False;
   }
 
+  const Standard_Integer aNbMiBTotal = Standard_Integer(aFileLen / (1024 * 1024));
+  Message_ProgressScope aPS (theProgress, "Reading text OBJ file", aNbMiBTotal);
+  if (myToParallel
+  && !theToProbe)
+  {
+    if (!readParallel (theStream, aPS))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    Standard_ReadLineBuffer aBuffer (THE_BUFFER_SIZE);
+    aBuffer.SetMultilineMode (true);
+
+    Standard_Integer aNbMiBPassed = 0;
+    OSD_Timer aTimer;
+    aTimer.Start();
+    bool isStart = true;
+    int64_t aPosition = 0;
+    size_t aLineLen = 0;
+    int64_t aReadBytes = 0;
+    const char* aLine = NULL;
+    for (;;)
+    {
+      aLine = aBuffer.ReadLine (theStream, aLineLen, aReadBytes);
+      if (aLine == NULL)
+      {
+        break;
+      }
+      ++myNbLines;
+      aPosition += aReadBytes;
+      if (aTimer.ElapsedTime() > 1.0)
+      {
+        if (!aPS.More())
+        {
+          return false;
+        }
+
+        const Standard_Integer aNbMiBRead = Standard_Integer(aPosition / (1024 * 1024));
+        aPS.Next (aNbMiBRead - aNbMiBPassed);
+        aNbMiBPassed = aNbMiBRead;
+        aTimer.Reset();
+        aTimer.Start();
+      }
+
+      if (!pushLine (aLine, isStart, theToProbe, NULL))
+      {
+        return false;
+      }
+    }
+  }
+
+  // collect external references
+  for (NCollection_DataMap<TCollection_AsciiString, RWObj_Material>::Iterator aMatIter (myMaterials); aMatIter.More(); aMatIter.Next())
+  {
+    const RWObj_Material& aMat = aMatIter.Value();
+    if (!aMat.DiffuseTexture.IsEmpty())
+    {
+      myExternalFiles.Add (aMat.DiffuseTexture);
+    }
+    if (!aMat.SpecularTexture.IsEmpty())
+    {
+      myExternalFiles.Add (aMat.SpecularTexture);
+    }
+    if (!aMat.BumpTexture.IsEmpty())
+    {
+      myExternalFiles.Add (aMat.BumpTexture);
+    }
+  }
+
+  // flush the last group
+  if (!theToProbe)
+  {
+    addMesh (myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+  }
+  if (myNbElemsBig != 0)
+  {
+    Message::SendWarning (TCollection_AsciiString("Warning: OBJ reader, ") + myNbElemsBig + " polygon(s) have been split into triangles");
+  }
+
+  return true;
+}
+
+// =======================================================================
+// function : readParallel
+// purpose  :
+// =======================================================================
+Standard_Boolean RWObj_Reader::readParallel (std::istream& theStream,
+                                             Message_ProgressScope& thePS)
+{
   Standard_ReadLineBuffer aBuffer (THE_BUFFER_SIZE);
   aBuffer.SetMultilineMode (true);
 
-  const Standard_Integer aNbMiBTotal = Standard_Integer(aFileLen / (1024 * 1024));
-  Standard_Integer       aNbMiBPassed = 0;
-  Message_ProgressScope aPS (theProgress, "Reading text OBJ file", aNbMiBTotal);
-  OSD_Timer aTimer;
-  aTimer.Start();
+  std::vector<char> aText;
+  std::vector<size_t> aLines;
+  std::vector<ParsedRecords> aBlocks;
+  aText.reserve (THE_PARALLEL_BATCH_SIZE + THE_BUFFER_SIZE);
+
+  Standard_Integer aNbMiBPassed = 0;
   bool isStart = true;
   int64_t aPosition = 0;
   size_t aLineLen = 0;
   int64_t aReadBytes = 0;
-  const char* aLine = NULL;
-  for (;;)
+  for (bool isEof = false; !isEof; )
   {
-    aLine = aBuffer.ReadLine (theStream, aLineLen, aReadBytes);
-    if (aLine == NULL)
-    {
-      break;
-    }
-    ++myNbLines;
-    aPosition += aReadBytes;
-    if (aTimer.ElapsedTime() > 1.0)
+    // read the batch of lines (this also resolves multi-line records)
+    aText.clear();
+    aLines.clear();
+    while (aText.size() < THE_PARALLEL_BATCH_SIZE)
     {
-      if (!aPS.More())
+      const char* aLine = aBuffer.ReadLine (theStream, aLineLen, aReadBytes);
+      if (aLine == NULL)
       {
-        return false;
+        isEof = true;
+        break;
       }
+      aPosition += aReadBytes;
+      aLines.push_back (aText.size());
+      aText.insert (aText.end(), aLine, aLine + aLineLen + 1);
+    }
+    if (aLines.empty())
+    {
+      break;
+    }
 
-      const Standard_Integer aNbMiBRead = Standard_Integer(aPosition / (1024 * 1024));
-      aPS.Next (aNbMiBRead - aNbMiBPassed);
-      aNbMiBPassed = aNbMiBRead;
-      aTimer.Reset();
-      aTimer.Start();
+    // parse vertex and element records concurrently
+    const size_t aNbBlocks = (aLines.size() + THE_PARALLEL_BLOCK_NB_LINES - 1) / THE_PARALLEL_BLOCK_NB_LINES;
+    if (aBlocks.size() < aNbBlocks)
+    {
+      aBlocks.resize (aNbBlocks);
+    }
+    for (size_t aBlockIter = 0; aBlockIter < aNbBlocks; ++aBlockIter)
+    {
+      aBlocks[aBlockIter].Reset (aBlockIter * THE_PARALLEL_BLOCK_NB_LINES,
+                                 std::min (aLines.size(), (aBlockIter + 1) * THE_PARALLEL_BLOCK_NB_LINES));
     }
+    ParseFunctor aFunctor (*this, aText, aLines, aBlocks);
+    OSD_Parallel::For (0, Standard_Integer(aNbBlocks), aFunctor, aNbBlocks < 2);
 
-    if (*aLine == '#')
+    // pass parsed records in the order of the file
+    for (size_t aBlockIter = 0; aBlockIter < aNbBlocks; ++aBlockIter)
     {
-      if (isStart)
+      ParsedRecords& aBlock = aBlocks[aBlockIter];
+      for (size_t aLineIter = aBlock.FirstLine; aLineIter < aBlock.LastLine; ++aLineIter)
       {
-        TCollection_AsciiString aComment (aLine + 1);
-        aComment.LeftAdjust();
-        aComment.RightAdjust();
-        if (!aComment.IsEmpty())
+        ++myNbLines;
+        if (!pushLine (&aText.front() + aLines[aLineIter], isStart, Standard_False, &aBlock))
         {
-          if (!myFileComments.IsEmpty())
-          {
-            myFileComments += "\n";
-          }
-          myFileComments += aComment;
+          return false;
         }
       }
-      continue;
     }
-    else if (*aLine == '\n'
-          || *aLine == '\0')
-    {
 
-      continue;
+    if (!thePS.More())
+    {
+      return false;
     }
-    isStart = false;
+    const Standard_Integer aNbMiBRead = Standard_Integer(aPosition / (1024 * 1024));
+    thePS.Next (aNbMiBRead - aNbMiBPassed);
+    aNbMiBPassed = aNbMiBRead;
+  }
+  return true;
+}
 
-    if (theToProbe)
+// =======================================================================
+// function : pushLine
+// purpose  :
+// =======================================================================
+bool RWObj_Reader::pushLine (const char* theLine,
+                             bool& theIsStart,
+                             const Standard_Boolean theToProbe,
+                             ParsedRecords* theParsed)
+{
+  if (*theLine == '#')
+  {
+    if (theIsStart)
     {
-      if (::strncmp (aLine, "mtllib", 6) == 0)
-      {
-        readMaterialLib (IsSpace (aLine[6]) ? aLine + 7 : "");
-      }
-      else if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar (aLine[1]))
-      {
-        ++myNbProbeNodes;
-      }
-      else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar (aLine[1]))
+      TCollection_AsciiString aComment (theLine + 1);
+      aComment.LeftAdjust();
+      aComment.RightAdjust();
+      if (!aComment.IsEmpty())
       {
-        ++myNbProbeElems;
+        if (!myFileComments.IsEmpty())
+        {
+          myFileComments += "\n";
+        }
+        myFileComments += aComment;
       }
-      continue;
     }
+    return true;
+  }
+  else if (*theLine == '\n'
+        || *theLine == '\0')
+  {
 
-    if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar (aLine[1]))
-    {
-      ++myNbProbeNodes;
-      pushVertex (aLine + 2);
-    }
-    else if (aLine[0] == 'v'
-          && aLine[1] == 'n'
-          && RWObj_Tools::isSpaceChar (aLine[2]))
+    return true;
+  }
+  theIsStart = false;
+
+  if (theToProbe)
+  {
+    if (::strncmp (theLine, "mtllib", 6) == 0)
     {
-      pushNormal (aLine + 3);
+      readMaterialLib (IsSpace (theLine[6]) ? theLine + 7 : "");
     }
-    else if (aLine[0] == 'v'
-          && aLine[1] == 't'
-          && RWObj_Tools::isSpaceChar (aLine[2]))
+    else if (isVertexLine (theLine))
     {
-      pushTexel (aLine + 3);
+      ++myNbProbeNodes;
     }
-    else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar (aLine[1]))
+    else if (isElementLine (theLine))
     {
       ++myNbProbeElems;
-      pushIndices (aLine + 2);
     }
-    else if (aLine[0] == 'g' && IsSpace (aLine[1]))
+    return true;
+  }
+
+  if (isVertexLine (theLine))
+  {
+    ++myNbProbeNodes;
+    if (theParsed != NULL)
     {
-      pushGroup (aLine + 2);
+      pushVertex (theParsed->Verts[theParsed->VertIter++]);
     }
-    else if (aLine[0] == 's' && IsSpace (aLine[1]))
+    else
     {
-      pushSmoothGroup (aLine + 2);
+      gp_XYZ anXYZ;
+      parseVertex (theLine + 2, anXYZ);
+      pushVertex (anXYZ);
     }
-    else if (aLine[0] == 'o' && IsSpace (aLine[1]))
+  }
+  else if (isNormalLine (theLine))
+  {
+    if (theParsed != NULL)
     {
-      pushObject (aLine + 2);
+      pushNormal (theParsed->Norms[theParsed->NormIter++]);
     }
-    else if (::strncmp (aLine, "mtllib", 6) == 0)
+    else
     {
-      readMaterialLib (IsSpace (aLine[6]) ? aLine + 7 : "");
+      Graphic3d_Vec3 aNorm;
+      parseNormal (theLine + 3, aNorm);
+      pushNormal (aNorm);
     }
-    else if (::strncmp (aLine, "usemtl", 6) == 0)
+  }
+  else if (isTexelLine (theLine))
+  {
+    if (theParsed != NULL)
     {
-      pushMaterial (IsSpace (aLine[6]) ? aLine + 7 : "");
+      pushTexel (theParsed->Texels[theParsed->TexelIter++]);
     }
-
-    if (!checkMemory())
+    else
     {
-      addMesh (myActiveSubMesh, RWObj_SubMeshReason_NewObject);
-      return false;
+      Graphic3d_Vec2 anUV;
+      parseTexel (theLine + 3, anUV);
+      pushTexel (anUV);
     }
   }
-
-  // collect external references
-  for (NCollection_DataMap<TCollection_AsciiString, RWObj_Material>::Iterator aMatIter (myMaterials); aMatIter.More(); aMatIter.Next())
+  else if (isElementLine (theLine))
   {
-    const RWObj_Material& aMat = aMatIter.Value();
-    if (!aMat.DiffuseTexture.IsEmpty())
-    {
-      myExternalFiles.Add (aMat.DiffuseTexture);
-    }
-    if (!aMat.SpecularTexture.IsEmpty())
+    ++myNbProbeElems;
+    if (theParsed != NULL)
     {
-      myExternalFiles.Add (aMat.SpecularTexture);
+      const Standard_Integer aNbNodes = theParsed->NbElemNodes[theParsed->ElemIter++];
+      pushIndices (aNbNodes > 0 ? &theParsed->Indices[theParsed->IndexIter] : NULL, aNbNodes);
+      theParsed->IndexIter += aNbNodes;
     }
-    if (!aMat.BumpTexture.IsEmpty())
+    else
     {
-      myExternalFiles.Add (aMat.BumpTexture);
+      myCurrIndices.clear();
+      const Standard_Integer aNbNodes = parseIndices (theLine + 2, myCurrIndices);
+      pushIndices (aNbNodes > 0 ? &myCurrIndices.front() : NULL, aNbNodes);
     }
   }
-
-  // flush the last group
-  if (!theToProbe)
+  else if (theLine[0] == 'g' && IsSpace (theLine[1]))
   {
-    addMesh (myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+    pushGroup (theLine + 2);
   }
-  if (myNbElemsBig != 0)
+  else if (theLine[0] == 's' && IsSpace (theLine[1]))
   {
-    Message::SendWarning (TCollection_AsciiString("Warning: OBJ reader, ") + myNbElemsBig + " polygon(s) have been split into triangles");
+    pushSmoothGroup (theLine + 2);
+  }
+  else if (theLine[0] == 'o' && IsSpace (theLine[1]))
+  {
+    pushObject (theLine + 2);
+  }
+  else if (::strncmp (theLine, "mtllib", 6) == 0)
+  {
+    readMaterialLib (IsSpace (theLine[6]) ? theLine + 7 : "");
+  }
+  else if (::strncmp (theLine, "usemtl", 6) == 0)
+  {
+    pushMaterial (IsSpace (theLine[6]) ? theLine + 7 : "");
   }
 
+  if (!checkMemory())
+  {
+    addMesh (myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+    return false;
+  }
   return true;
 }
 
 // =======================================================================
-// function : pushIndices
+// function : parseIndices
 // purpose  :
 // =======================================================================
-void RWObj_Reader::pushIndices (const char* thePos)
+Standard_Integer RWObj_Reader::parseIndices (const char* thePos,
+                                             std::vector<Graphic3d_Vec3i>& theIndices)
 {
   char* aNext = NULL;
 
   Standard_Integer aNbElemNodes = 0;
-  for (Standard_Integer aNode = 0;; ++aNode)
+  for (;;)
   {
     Graphic3d_Vec3i a3Indices (-1, -1, -1);
     a3Indices[0] = int(strtol (thePos, &aNext, 10) - 1);
@@ -323,6 +562,35 @@ void RWObj_Reader::pushIndices (const char* thePos)
       }
     }
 
+    theIndices.push_back (a3Indices);
+    ++aNbElemNodes;
+
+    if (*thePos == '\n'
+     || *thePos == '\0')
+    {
+      break;
+    }
+
+    if (*thePos != ' ')
+    {
+      ++thePos;
+    }
+  }
+  return aNbElemNodes;
+}
+
+// =======================================================================
+// function : pushIndices
+// purpose  :
+// =======================================================================
+void RWObj_Reader::pushIndices (const Graphic3d_Vec3i* theIndices,
+                                const Standard_Integer theNbNodes)
+{
+  Standard_Integer aNbElemNodes = 0;
+  for (Standard_Integer aNode = 0; aNode < theNbNodes; ++aNode)
+  {
+    Graphic3d_Vec3i a3Indices = theIndices[aNode];
+
     // handle negative indices
     if (a3Indices[0] < -1)
     {
@@ -400,23 +668,12 @@ void RWObj_Reader::pushIndices (const char* thePos)
       }
     }
 
-    if (myCurrElem.size() < size_t(aNode))
+    if (myCurrElem.size() <= size_t(aNode))
     {
       myCurrElem.resize (aNode * 2, -1);
     }
     myCurrElem[aNode] = anIndex;
     aNbElemNodes = aNode + 1;
-
-    if (*thePos == '\n'
-     || *thePos == '\0')
-    {
-      break;
-    }
-
-    if (*thePos != ' ')
-    {
-      ++thePos;
-    }
   }
 
   if (myCurrElem[0] < 0
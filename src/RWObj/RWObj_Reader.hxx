@@ -18,6 +18,7 @@
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressRange.hxx>
+#include <Message_ProgressScope.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IndexedMap.hxx>
@@ -40,6 +41,11 @@
 //! To use it, create descendant class and implement interface methods.
 //!
 //! Call method Read() to read the file.
+//!
+//! In parallel mode (see SetParallel()) the file is read by batches of lines;
+//! vertex, normal, UV and element records of each batch are parsed concurrently,
+//! while the parsed data is passed to interface methods sequentially in the order of the file,
+//! so that the result is the same as in sequential mode.
 class RWObj_Reader : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(RWObj_Reader, Standard_Transient)
@@ -128,6 +134,12 @@ public:
   //! Setup single/double precision flag for reading vertex data (coordinates).
   void SetSinglePrecision (Standard_Boolean theIsSinglePrecision) { myObjVerts.SetSinglePrecision (theIsSinglePrecision); }
 
+  //! Return TRUE if records should be parsed in parallel threads; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded parsing of records.
+  void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
+
 protected:
 
   //! Reads data from OBJ file.
@@ -184,45 +196,83 @@ protected:
 //! @name implementation details
 private:
 
-  //! Handle "v X Y Z".
-  void pushVertex (const char* theXYZ)
+  struct ParsedRecords;
+  class ParseFunctor;
+
+  //! Read the file in parallel mode.
+  //! @return FALSE on error or user break
+  Standard_Boolean readParallel (std::istream& theStream,
+                                 Message_ProgressScope& thePS);
+
+  //! Handle the line of OBJ file.
+  //! @param theLine    null-terminated line
+  //! @param theIsStart flag indicating that only comments have been met so far
+  //! @param theToProbe flag to probe the file content
+  //! @param theParsed  records parsed in advance (parallel mode) or NULL
+  //! @return FALSE if reading should be aborted due to memory limit
+  bool pushLine (const char* theLine,
+                 bool& theIsStart,
+                 const Standard_Boolean theToProbe,
+                 ParsedRecords* theParsed);
+
+  //! Parse "X Y Z" position of "v" record.
+  void parseVertex (const char* theXYZ, gp_XYZ& theXYZOut) const
   {
     char* aNext = NULL;
-    gp_Pnt anXYZ;
-    RWObj_Tools::ReadVec3 (theXYZ, aNext, anXYZ.ChangeCoord());
-    myCSTrsf.TransformPosition (anXYZ.ChangeCoord());
+    RWObj_Tools::ReadVec3 (theXYZ, aNext, theXYZOut);
+    myCSTrsf.TransformPosition (theXYZOut);
+  }
 
-    myMemEstim += myObjVerts.IsSinglePrecision() ? sizeof(Graphic3d_Vec3) : sizeof(gp_Pnt);
-    myObjVerts.Append (anXYZ);
+  //! Parse "NX NY NZ" normal of "vn" record.
+  void parseNormal (const char* theXYZ, Graphic3d_Vec3& theNorm) const
+  {
+    char* aNext = NULL;
+    RWObj_Tools::ReadVec3 (theXYZ, aNext, theNorm);
+    myCSTrsf.TransformNormal (theNorm);
   }
 
-  //! Handle "vn NX NY NZ".
-  void pushNormal (const char* theXYZ)
+  //! Parse "U V" of "vt" record.
+  static void parseTexel (const char* theUV, Graphic3d_Vec2& theUVOut)
   {
     char* aNext = NULL;
-    Graphic3d_Vec3 aNorm;
-    RWObj_Tools::ReadVec3 (theXYZ, aNext, aNorm);
-    myCSTrsf.TransformNormal (aNorm);
+    theUVOut.x() = (float )Strtod (theUV, &aNext);
+    theUV = aNext;
+    theUVOut.y() = (float )Strtod (theUV, &aNext);
+  }
 
+  //! Parse indices of "f" record.
+  //! @param thePos     indices
+  //! @param theIndices vector to append (0-based) position, UV and normal indices of element nodes
+  //! @return number of element nodes
+  static Standard_Integer parseIndices (const char* thePos,
+                                        std::vector<Graphic3d_Vec3i>& theIndices);
+
+  //! Handle "v X Y Z".
+  void pushVertex (const gp_XYZ& theXYZ)
+  {
+    myMemEstim += myObjVerts.IsSinglePrecision() ? sizeof(Graphic3d_Vec3) : sizeof(gp_Pnt);
+    myObjVerts.Append (theXYZ);
+  }
+
+  //! Handle "vn NX NY NZ".
+  void pushNormal (const Graphic3d_Vec3& theNorm)
+  {
     myMemEstim += sizeof(Graphic3d_Vec3);
-    myObjNorms.Append (aNorm);
+    myObjNorms.Append (theNorm);
   }
 
   //! Handle "vt U V".
-  void pushTexel (const char* theUV)
+  void pushTexel (const Graphic3d_Vec2& theUV)
   {
-    char* aNext = NULL;
-    Graphic3d_Vec2 anUV;
-    anUV.x() = (float )Strtod (theUV, &aNext);
-    theUV = aNext;
-    anUV.y() = (float )Strtod (theUV, &aNext);
-
     myMemEstim += sizeof(Graphic3d_Vec2);
-    myObjVertsUV.Append (anUV);
+    myObjVertsUV.Append (theUV);
   }
 
   //! Handle "f indices".
-  void pushIndices (const char* thePos);
+  //! @param theIndices   position, UV and normal indices of element nodes
+  //! @param theNbNodes   number of element nodes
+  void pushIndices (const Graphic3d_Vec3i* theIndices,
+                    const Standard_Integer theNbNodes);
 
   //! Compute the center of planar polygon.
   //! @param theIndices polygon indices
@@ -367,6 +417,7 @@ protected:
   Standard_Integer                   myNbProbeElems;  //!< number of probed elements
   Standard_Integer                   myNbElemsBig;    //!< number of big elements (polygons with 5+ nodes)
   Standard_Boolean                   myToAbort;       //!< flag indicating abort state (e.g. syntax error)
+  bool                               myToParallel;    //!< flag to parse records in parallel threads
 // clang-format on
 
   // Each node in the Element specifies independent indices of Vertex position, Texture coordinates and Normal.
@@ -384,6 +435,7 @@ protected:
 
   RWObj_SubMesh                      myActiveSubMesh; //!< active sub-mesh definition
   std::vector<Standard_Integer>      myCurrElem;      //!< indices for the current element
+  std::vector<Graphic3d_Vec3i>       myCurrIndices;   //!< parsed indices of the current element
 };
 
 #endif // _RWObj_Reader_HeaderFile
@@ -0,0 +1,107 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_CafReader.hxx>
+
+#include <BRep_Builder.hxx>
+#include <Message.hxx>
+#include <RWPly_PlyReaderContext.hxx>
+#include <TopoDS_Face.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(RWPly_CafReader, RWMesh_CafReader)
+
+//================================================================
+// Function : Constructor
+// Purpose  :
+//================================================================
+RWPly_CafReader::RWPly_CafReader()
+: myIsSinglePrecision (Standard_False),
+  myToParallel (false)
+{
+  // PLY format does not define coordinate system and length units
+}
+
+//================================================================
+// Function : fillNodeAttributes
+// Purpose  :
+//================================================================
+void RWPly_CafReader::fillNodeAttributes (const RWPly_PlyReaderContext& theCtx,
+                                          RWMesh_NodeAttributes& theAttribs)
+{
+  const NCollection_Array1<Graphic3d_Vec4ub>& aColors = theCtx.VertexColors();
+  if (aColors.IsEmpty())
+  {
+    return;
+  }
+
+  const Graphic3d_Vec4ub& aFirstColor = aColors.First();
+  for (NCollection_Array1<Graphic3d_Vec4ub>::Iterator aColorIter (aColors); aColorIter.More(); aColorIter.Next())
+  {
+    if (aColorIter.Value() != aFirstColor)
+    {
+      return;
+    }
+  }
+
+  // colors are written as linear RGB values by RWPly_CafWriter
+  const Graphic3d_Vec4 aColor = Graphic3d_Vec4 (aFirstColor) / 255.0f;
+  theAttribs.Style.SetColorSurf (Quantity_ColorRGBA (aColor));
+}
+
+//================================================================
+// Function : performMesh
+// Purpose  :
+//================================================================
+Standard_Boolean RWPly_CafReader::performMesh (std::istream& theStream,
+                                               const TCollection_AsciiString& theFile,
+                                               const Message_ProgressRange& theProgress,
+                                               const Standard_Boolean theToProbe)
+{
+  RWPly_PlyReaderContext aCtx;
+  aCtx.SetDoublePrecision (!myIsSinglePrecision);
+  aCtx.SetParallel (myToParallel);
+  aCtx.SetCoordinateSystemConverter (myCoordSysConverter);
+  if (!aCtx.ReadHeader (theStream))
+  {
+    Message::SendFail (TCollection_AsciiString ("Error: file '") + theFile + "' has invalid PLY header");
+    return Standard_False;
+  }
+  if (!aCtx.Comments().IsEmpty())
+  {
+    myMetadata.Add ("Comments", aCtx.Comments());
+  }
+  if (theToProbe)
+  {
+    return Standard_True;
+  }
+
+  if (!aCtx.ReadData (theStream, theProgress))
+  {
+    Message::SendFail (TCollection_AsciiString ("Error: file '") + theFile + "' reading failed");
+    return Standard_False;
+  }
+  if (aCtx.Triangulation()->NbNodes() < 1)
+  {
+    return Standard_True;
+  }
+
+  TopoDS_Face aFace;
+  BRep_Builder aBuilder;
+  aBuilder.MakeFace (aFace, aCtx.Triangulation());
+
+  RWMesh_NodeAttributes aShapeAttribs;
+  fillNodeAttributes (aCtx, aShapeAttribs);
+  myAttribMap.Bind (aFace, aShapeAttribs);
+  myRootShapes.Append (aFace);
+  return Standard_True;
+}
@@ -0,0 +1,65 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWPly_CafReader_HeaderFile
+#define _RWPly_CafReader_HeaderFile
+
+#include <RWMesh_CafReader.hxx>
+
+class RWPly_PlyReaderContext;
+
+//! The PLY mesh reader into XDE document.
+//!
+//! The vertices and faces of the file are put into a single face with triangulation.
+//! Per-vertex colors are put into the document as a surface color only when all vertices
+//! share the same color; use RWPly_PlyReaderContext to access arbitrary per-vertex colors.
+class RWPly_CafReader : public RWMesh_CafReader
+{
+  DEFINE_STANDARD_RTTIEXT(RWPly_CafReader, RWMesh_CafReader)
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT RWPly_CafReader();
+
+  //! Return single precision flag for reading vertex data (coordinates); FALSE by default.
+  Standard_Boolean IsSinglePrecision() const { return myIsSinglePrecision; }
+
+  //! Setup single/double precision flag for reading vertex data (coordinates).
+  void SetSinglePrecision (Standard_Boolean theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
+
+  //! Return TRUE if multithreaded optimizations are allowed; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded execution.
+  void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
+
+protected:
+
+  //! Read the mesh from specified file.
+  Standard_EXPORT virtual Standard_Boolean performMesh (std::istream& theStream,
+                                                        const TCollection_AsciiString& theFile,
+                                                        const Message_ProgressRange& theProgress,
+                                                        const Standard_Boolean theToProbe) Standard_OVERRIDE;
+
+  //! Fill the shape attributes from the decoded per-vertex colors.
+  Standard_EXPORT virtual void fillNodeAttributes (const RWPly_PlyReaderContext& theCtx,
+                                                   RWMesh_NodeAttributes& theAttribs);
+
+protected:
+
+  Standard_Boolean myIsSinglePrecision; //!< flag for reading vertex data with single or double floating point precision
+  bool             myToParallel;        //!< flag to use multithreading; FALSE by default
+
+};
+
+#endif // _RWPly_CafReader_HeaderFile
@@ -0,0 +1,1025 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_PlyReaderContext.hxx>
+
+#include <Message.hxx>
+#include <Message_ProgressScope.hxx>
+#include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <cstring>
+#include <string>
+
+namespace
+{
+  //! Size of the chunk of file body read at once.
+  static const Standard_Size THE_CHUNK_SIZE = 16 * 1024 * 1024;
+
+  //! Vertex properties recognized by the reader.
+  enum VertexSlot
+  {
+    VertexSlot_X, VertexSlot_Y, VertexSlot_Z,
+    VertexSlot_NX, VertexSlot_NY, VertexSlot_NZ,
+    VertexSlot_U, VertexSlot_V,
+    VertexSlot_Red, VertexSlot_Green, VertexSlot_Blue, VertexSlot_Alpha,
+    VertexSlot_NB
+  };
+
+  //! Return vertex slot for the property name, or -1.
+  static Standard_Integer vertexSlot (const TCollection_AsciiString& theName)
+  {
+    if (theName == "x") { return VertexSlot_X; }
+    if (theName == "y") { return VertexSlot_Y; }
+    if (theName == "z") { return VertexSlot_Z; }
+    if (theName == "nx") { return VertexSlot_NX; }
+    if (theName == "ny") { return VertexSlot_NY; }
+    if (theName == "nz") { return VertexSlot_NZ; }
+    if (theName == "u" || theName == "s" || theName == "texture_u" || theName == "texture_s") { return VertexSlot_U; }
+    if (theName == "v" || theName == "t" || theName == "texture_v" || theName == "texture_t") { return VertexSlot_V; }
+    if (theName == "red"   || theName == "diffuse_red")   { return VertexSlot_Red; }
+    if (theName == "green" || theName == "diffuse_green") { return VertexSlot_Green; }
+    if (theName == "blue"  || theName == "diffuse_blue")  { return VertexSlot_Blue; }
+    if (theName == "alpha") { return VertexSlot_Alpha; }
+    return -1;
+  }
+
+  //! Parse property type.
+  static RWPly_PlyReaderContext::PropertyType parseType (const TCollection_AsciiString& theType)
+  {
+    if (theType == "char"   || theType == "int8")    { return RWPly_PlyReaderContext::PropertyType_Int8; }
+    if (theType == "uchar"  || theType == "uint8")   { return RWPly_PlyReaderContext::PropertyType_UInt8; }
+    if (theType == "short"  || theType == "int16")   { return RWPly_PlyReaderContext::PropertyType_Int16; }
+    if (theType == "ushort" || theType == "uint16")  { return RWPly_PlyReaderContext::PropertyType_UInt16; }
+    if (theType == "int"    || theType == "int32")   { return RWPly_PlyReaderContext::PropertyType_Int32; }
+    if (theType == "uint"   || theType == "uint32")  { return RWPly_PlyReaderContext::PropertyType_UInt32; }
+    if (theType == "float"  || theType == "float32") { return RWPly_PlyReaderContext::PropertyType_Float32; }
+    if (theType == "double" || theType == "float64") { return RWPly_PlyReaderContext::PropertyType_Float64; }
+    return RWPly_PlyReaderContext::PropertyType_Undefined;
+  }
+
+  //! Return size of the binary value.
+  static Standard_Size typeSize (RWPly_PlyReaderContext::PropertyType theType)
+  {
+    switch (theType)
+    {
+      case RWPly_PlyReaderContext::PropertyType_Int8:
+      case RWPly_PlyReaderContext::PropertyType_UInt8:   return 1;
+      case RWPly_PlyReaderContext::PropertyType_Int16:
+      case RWPly_PlyReaderContext::PropertyType_UInt16:  return 2;
+      case RWPly_PlyReaderContext::PropertyType_Int32:
+      case RWPly_PlyReaderContext::PropertyType_UInt32:
+      case RWPly_PlyReaderContext::PropertyType_Float32: return 4;
+      case RWPly_PlyReaderContext::PropertyType_Float64: return 8;
+      case RWPly_PlyReaderContext::PropertyType_Undefined: break;
+    }
+    return 0;
+  }
+
+  //! Return TRUE if the list length read from the file is valid.
+  //! The data of a single list is limited by the chunk size
+  //! to reject corrupted lengths instead of growing the chunk up to the end of file.
+  static bool isValidListLength (double theNbItems,
+                                 RWPly_PlyReaderContext::PropertyType theType)
+  {
+    return theNbItems >= 0.0
+        && theNbItems * (double )typeSize (theType) <= (double )THE_CHUNK_SIZE;
+  }
+
+  //! Return TRUE for floating point type.
+  static bool isFloatType (RWPly_PlyReaderContext::PropertyType theType)
+  {
+    return theType == RWPly_PlyReaderContext::PropertyType_Float32
+        || theType == RWPly_PlyReaderContext::PropertyType_Float64;
+  }
+
+  //! Determine Big-Endian at runtime.
+  static bool isBigEndianHost()
+  {
+    union { int myInt; char myChar[sizeof(int)]; } aUnion;
+    aUnion.myInt = 1;
+    return !aUnion.myChar[0];
+  }
+
+  //! Read binary value of specified type with optional swapping of bytes.
+  template<typename Type_t>
+  static Type_t readBinary (const char* thePtr, bool theToSwap)
+  {
+    char aBytes[sizeof(Type_t)];
+    if (theToSwap)
+    {
+      for (size_t aByteIter = 0; aByteIter < sizeof(Type_t); ++aByteIter)
+      {
+        aBytes[aByteIter] = thePtr[sizeof(Type_t) - 1 - aByteIter];
+      }
+    }
+    else
+    {
+      memcpy (aBytes, thePtr, sizeof(Type_t));
+    }
+    Type_t aValue;
+    memcpy (&aValue, aBytes, sizeof(Type_t));
+    return aValue;
+  }
+
+  //! Read binary value and convert it to double.
+  static double readBinaryValue (const char* thePtr,
+                                 RWPly_PlyReaderContext::PropertyType theType,
+                                 bool theToSwap)
+  {
+    switch (theType)
+    {
+      case RWPly_PlyReaderContext::PropertyType_Int8:    return (double )readBinary<int8_t>   (thePtr, false);
+      case RWPly_PlyReaderContext::PropertyType_UInt8:   return (double )readBinary<uint8_t>  (thePtr, false);
+      case RWPly_PlyReaderContext::PropertyType_Int16:   return (double )readBinary<int16_t>  (thePtr, theToSwap);
+      case RWPly_PlyReaderContext::PropertyType_UInt16:  return (double )readBinary<uint16_t> (thePtr, theToSwap);
+      case RWPly_PlyReaderContext::PropertyType_Int32:   return (double )readBinary<int32_t>  (thePtr, theToSwap);
+      case RWPly_PlyReaderContext::PropertyType_UInt32:  return (double )readBinary<uint32_t> (thePtr, theToSwap);
+      case RWPly_PlyReaderContext::PropertyType_Float32: return (double )readBinary<float>    (thePtr, theToSwap);
+      case RWPly_PlyReaderContext::PropertyType_Float64: return readBinary<double> (thePtr, theToSwap);
+      case RWPly_PlyReaderContext::PropertyType_Undefined: break;
+    }
+    return 0.0;
+  }
+
+  //! Read next number from the line of ASCII file.
+  //! @return FALSE if the line has no more numbers
+  static bool readAsciiValue (const char*& thePos, double& theValue)
+  {
+    while (*thePos == ' ' || *thePos == '\t' || *thePos == '\r')
+    {
+      ++thePos;
+    }
+    if (*thePos == '\n' || *thePos == '\0')
+    {
+      return false;
+    }
+
+    char* aNext = NULL;
+    theValue = Strtod (thePos, &aNext);
+    if (aNext == thePos)
+    {
+      return false;
+    }
+    thePos = aNext;
+    return true;
+  }
+
+  //! Convert color component into [0, 255] range.
+  static unsigned char toColorComponent (double theValue, bool theIsFloat)
+  {
+    const double aValue = theIsFloat ? theValue * 255.0 : theValue;
+    return (unsigned char )(aValue <= 0.0 ? 0 : (aValue >= 255.0 ? 255 : int(aValue + 0.5)));
+  }
+}
+
+//! Functor decoding the located records of vertex or face element.
+class RWPly_PlyReaderContext::DecodeFunctor
+{
+public:
+
+  DecodeFunctor (RWPly_PlyReaderContext& theCtx,
+                 const Element& theElem,
+                 const bool theIsVertex,
+                 const std::vector<Standard_Size>& theRecords,
+                 const std::vector<Standard_Integer>& theTriOffsets,
+                 const Standard_Integer theFirstItem)
+  : myCtx (theCtx),
+    myElem (theElem),
+    myIsVertex (theIsVertex),
+    myRecords (theRecords),
+    myTriOffsets (theTriOffsets),
+    myFirstItem (theFirstItem),
+    myIsAscii (theCtx.myFormat == FileFormat_Ascii),
+    myToSwap ((theCtx.myFormat == FileFormat_BinaryBE) != isBigEndianHost()),
+    myPosData (NULL), myNormData (NULL), myColData (NULL),
+    myPosStride (0), myNormStride (0), myColStride (0)
+  {
+    for (Standard_Integer aSlotIter = 0; aSlotIter < VertexSlot_NB; ++aSlotIter)
+    {
+      mySlotIsFloat[aSlotIter] = false;
+    }
+    mySlots.resize (theElem.Properties.Length(), -1);
+    if (theIsVertex)
+    {
+      for (Standard_Integer aSlotIter = 0; aSlotIter < VertexSlot_NB; ++aSlotIter)
+      {
+        const Standard_Integer aPropIndex = theCtx.myVertexProps[aSlotIter];
+        if (aPropIndex >= 0)
+        {
+          mySlots[aPropIndex] = aSlotIter;
+          mySlotIsFloat[aSlotIter] = isFloatType (theElem.Properties.Value (aPropIndex).Type);
+        }
+      }
+    }
+
+    if (!theCtx.myPointCloud.IsNull())
+    {
+      // write into vertex buffer directly, as setters of Graphic3d_ArrayOfPoints modify the number of elements
+      const Handle(Graphic3d_Buffer)& anAttribs = theCtx.myPointCloud->Attributes();
+      Standard_Integer anAttribIndex = 0;
+      myPosData  = anAttribs->ChangeAttributeData (Graphic3d_TOA_POS,   anAttribIndex, myPosStride);
+      myNormData = anAttribs->ChangeAttributeData (Graphic3d_TOA_NORM,  anAttribIndex, myNormStride);
+      myColData  = anAttribs->ChangeAttributeData (Graphic3d_TOA_COLOR, anAttribIndex, myColStride);
+    }
+  }
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    const char* aData = &myCtx.myChunk.front() + myRecords[theIndex];
+    if (myIsVertex)
+    {
+      decodeVertex (aData, myFirstItem + theIndex);
+    }
+    else
+    {
+      decodeFace (aData, myTriOffsets[theIndex]);
+    }
+  }
+
+private:
+
+  //! Read scalar value.
+  bool readScalar (const char*& thePos, PropertyType theType, double& theValue) const
+  {
+    if (myIsAscii)
+    {
+      return readAsciiValue (thePos, theValue);
+    }
+    theValue = readBinaryValue (thePos, theType, myToSwap);
+    thePos += typeSize (theType);
+    return true;
+  }
+
+  //! Skip list items.
+  void skipList (const char*& thePos, PropertyType theType, Standard_Integer theNbItems) const
+  {
+    if (!myIsAscii)
+    {
+      thePos += typeSize (theType) * (Standard_Size )theNbItems;
+      return;
+    }
+    double aDummy = 0.0;
+    for (Standard_Integer anItemIter = 0; anItemIter < theNbItems && readAsciiValue (thePos, aDummy); ++anItemIter) {}
+  }
+
+  //! Decode vertex record.
+  void decodeVertex (const char* thePos, const Standard_Integer theVertex) const
+  {
+    double aValues[VertexSlot_NB] = {};
+    aValues[VertexSlot_Alpha] = mySlotIsFloat[VertexSlot_Alpha] ? 1.0 : 255.0;
+    for (Standard_Integer aPropIter = 0; aPropIter < myElem.Properties.Length(); ++aPropIter)
+    {
+      const Property& aProp = myElem.Properties.Value (aPropIter);
+      double aValue = 0.0;
+      if (aProp.IsList())
+      {
+        if (!readScalar (thePos, aProp.CountType, aValue))
+        {
+          break;
+        }
+        skipList (thePos, aProp.Type, int(aValue)); // validated by findRecord()
+        continue;
+      }
+      if (!readScalar (thePos, aProp.Type, aValue))
+      {
+        break;
+      }
+      if (mySlots[aPropIter] >= 0)
+      {
+        aValues[mySlots[aPropIter]] = aValue;
+      }
+    }
+
+    gp_XYZ aPos (aValues[VertexSlot_X], aValues[VertexSlot_Y], aValues[VertexSlot_Z]);
+    myCtx.myCSTrsf.TransformPosition (aPos);
+    Graphic3d_Vec3 aNorm ((float )aValues[VertexSlot_NX], (float )aValues[VertexSlot_NY], (float )aValues[VertexSlot_NZ]);
+    if (myCtx.myHasNormals)
+    {
+      myCtx.myCSTrsf.TransformNormal (aNorm);
+    }
+    Graphic3d_Vec4ub aColor;
+    if (myCtx.myHasColors)
+    {
+      aColor.SetValues (toColorComponent (aValues[VertexSlot_Red],   mySlotIsFloat[VertexSlot_Red]),
+                        toColorComponent (aValues[VertexSlot_Green], mySlotIsFloat[VertexSlot_Green]),
+                        toColorComponent (aValues[VertexSlot_Blue],  mySlotIsFloat[VertexSlot_Blue]),
+                        toColorComponent (aValues[VertexSlot_Alpha], mySlotIsFloat[VertexSlot_Alpha]));
+    }
+
+    if (myPosData != NULL)
+    {
+      *reinterpret_cast<Graphic3d_Vec3*> (myPosData + myPosStride * theVertex) = Graphic3d_Vec3 ((float )aPos.X(), (float )aPos.Y(), (float )aPos.Z());
+      if (myNormData != NULL)
+      {
+        *reinterpret_cast<Graphic3d_Vec3*> (myNormData + myNormStride * theVertex) = aNorm;
+      }
+      if (myColData != NULL)
+      {
+        *reinterpret_cast<Graphic3d_Vec4ub*> (myColData + myColStride * theVertex) = aColor;
+      }
+      return;
+    }
+
+    const Handle(Poly_Triangulation)& aTris = myCtx.myTriangulation;
+    aTris->SetNode (theVertex + 1, aPos);
+    if (myCtx.myHasNormals)
+    {
+      aTris->SetNormal (theVertex + 1, aNorm);
+    }
+    if (myCtx.myHasTexCoords)
+    {
+      aTris->SetUVNode (theVertex + 1, gp_Pnt2d (aValues[VertexSlot_U], aValues[VertexSlot_V]));
+    }
+    if (myCtx.myHasColors)
+    {
+      myCtx.myColors.ChangeValue (theVertex + 1) = aColor;
+    }
+  }
+
+  //! Decode face record into the fan of triangles starting at theTriOffset.
+  void decodeFace (const char* thePos, const Standard_Integer theTriOffset) const
+  {
+    const Handle(Poly_Triangulation)& aTris = myCtx.myTriangulation;
+    const Standard_Integer aNbNodes = aTris->NbNodes();
+    for (Standard_Integer aPropIter = 0; aPropIter < myElem.Properties.Length(); ++aPropIter)
+    {
+      const Property& aProp = myElem.Properties.Value (aPropIter);
+      double aValue = 0.0;
+      if (!aProp.IsList())
+      {
+        if (!readScalar (thePos, aProp.Type, aValue))
+        {
+          return;
+        }
+        continue;
+      }
+
+      if (!readScalar (thePos, aProp.CountType, aValue))
+      {
+        return;
+      }
+      const Standard_Integer aNbItems = int(aValue); // validated by findRecord()
+      if (aPropIter != myCtx.myFaceIndicesProp)
+      {
+        skipList (thePos, aProp.Type, aNbItems);
+        continue;
+      }
+
+      // the number of triangles has been counted by findRecord(), so that all of them are written
+      Standard_Integer aFirst = 0, aPrev = 0;
+      for (Standard_Integer anItemIter = 0; anItemIter < aNbItems; ++anItemIter)
+      {
+        double anIndex = -1.0;
+        if (!readScalar (thePos, aProp.Type, anIndex))
+        {
+          anIndex = -1.0;
+        }
+        const Standard_Integer aNode = (anIndex >= 0.0 && anIndex < double(aNbNodes)) ? int(anIndex) + 1 : 0;
+        if (anItemIter == 0)
+        {
+          aFirst = aNode;
+        }
+        else if (anItemIter >= 2)
+        {
+          // triangles with invalid nodes are marked by zero indices and removed at the end
+          const Standard_Integer aTriIndex = theTriOffset + anItemIter - 2;
+          if (aFirst != 0 && aPrev != 0 && aNode != 0)
+          {
+            aTris->SetTriangle (aTriIndex, Poly_Triangle (aFirst, aPrev, aNode));
+          }
+          else
+          {
+            aTris->SetTriangle (aTriIndex, Poly_Triangle (0, 0, 0));
+          }
+        }
+        aPrev = aNode;
+      }
+      return;
+    }
+  }
+
+private:
+  DecodeFunctor& operator= (const DecodeFunctor&);
+
+private:
+  RWPly_PlyReaderContext& myCtx;
+  const Element& myElem;
+  const bool myIsVertex;
+  const std::vector<Standard_Size>& myRecords;
+  const std::vector<Standard_Integer>& myTriOffsets;
+  const Standard_Integer myFirstItem;
+  const bool myIsAscii;
+  const bool myToSwap;
+  std::vector<Standard_Integer> mySlots;   //!< vertex slot of each property, or -1
+  bool mySlotIsFloat[VertexSlot_NB];       //!< floating point type of the vertex slot
+  Standard_Byte* myPosData;
+  Standard_Byte* myNormData;
+  Standard_Byte* myColData;
+  Standard_Size myPosStride;
+  Standard_Size myNormStride;
+  Standard_Size myColStride;
+};
+
+// =======================================================================
+// function : RWPly_PlyReaderContext
+// purpose  :
+// =======================================================================
+RWPly_PlyReaderContext::RWPly_PlyReaderContext()
+: myFormat (FileFormat_Undefined),
+  myVertexElem (-1),
+  myFaceElem (-1),
+  myFaceIndicesProp (-1),
+  myIsDoublePrec (true),
+  myToParallel (false),
+  myIsPointCloud (false),
+  myHasNormals (false),
+  myHasTexCoords (false),
+  myHasColors (false),
+  myChunkStart (0),
+  myChunkEnd (0),
+  myIsEof (false),
+  myNbTris (0),
+  myNbSkippedTris (0)
+{
+  for (Standard_Integer aSlotIter = 0; aSlotIter < VertexSlot_NB; ++aSlotIter)
+  {
+    myVertexProps[aSlotIter] = -1;
+  }
+}
+
+// =======================================================================
+// function : Read
+// purpose  :
+// =======================================================================
+bool RWPly_PlyReaderContext::Read (const TCollection_AsciiString& theFile,
+                                   const Message_ProgressRange& theProgress)
+{
+  const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aStream = aFileSystem->OpenIStream (theFile, std::ios::in | std::ios::binary);
+  if (aStream.get() == nullptr)
+  {
+    Message::SendFail() << "Error: file '" << theFile << "' cannot be opened";
+    return false;
+  }
+  if (!ReadHeader (*aStream))
+  {
+    Message::SendFail() << "Error: file '" << theFile << "' has invalid PLY header";
+    return false;
+  }
+  return ReadData (*aStream, theProgress);
+}
+
+// =======================================================================
+// function : ReadHeader
+// purpose  :
+// =======================================================================
+bool RWPly_PlyReaderContext::ReadHeader (std::istream& theStream)
+{
+  myElements.Clear();
+  myComments.Clear();
+  myFormat = FileFormat_Undefined;
+  myVertexElem = myFaceElem = myFaceIndicesProp = -1;
+  myHasNormals = myHasTexCoords = myHasColors = false;
+  for (Standard_Integer aSlotIter = 0; aSlotIter < VertexSlot_NB; ++aSlotIter)
+  {
+    myVertexProps[aSlotIter] = -1;
+  }
+
+  std::string aLine;
+  bool isFirstLine = true, isEndHeader = false;
+  while (std::getline (theStream, aLine))
+  {
+    if (!aLine.empty() && aLine[aLine.size() - 1] == '\r')
+    {
+      aLine.erase (aLine.size() - 1);
+    }
+    const TCollection_AsciiString aLineStr (aLine.c_str());
+    if (isFirstLine)
+    {
+      if (aLineStr != "ply")
+      {
+        return false;
+      }
+      isFirstLine = false;
+      continue;
+    }
+
+    const TCollection_AsciiString aKey = aLineStr.Token (" \t", 1);
+    if (aKey.IsEmpty())
+    {
+      continue;
+    }
+    else if (aKey == "comment"
+          || aKey == "obj_info")
+    {
+      TCollection_AsciiString aComment = aLine.size() > (size_t )aKey.Length() ? aLineStr.SubString (aKey.Length() + 1, aLineStr.Length()) : "";
+      aComment.LeftAdjust();
+      if (!myComments.IsEmpty())
+      {
+        myComments += "\n";
+      }
+      myComments += aComment;
+    }
+    else if (aKey == "format")
+    {
+      const TCollection_AsciiString aFormat = aLineStr.Token (" \t", 2);
+      if (aFormat == "ascii")
+      {
+        myFormat = FileFormat_Ascii;
+      }
+      else if (aFormat == "binary_little_endian")
+      {
+        myFormat = FileFormat_BinaryLE;
+      }
+      else if (aFormat == "binary_big_endian")
+      {
+        myFormat = FileFormat_BinaryBE;
+      }
+      else
+      {
+        Message::SendFail() << "Error: unsupported PLY format '" << aFormat << "'";
+        return false;
+      }
+    }
+    else if (aKey == "element")
+    {
+      Element anElem;
+      anElem.Name = aLineStr.Token (" \t", 2);
+      const TCollection_AsciiString aCount = aLineStr.Token (" \t", 3);
+      if (anElem.Name.IsEmpty() || !aCount.IsIntegerValue() || aCount.IntegerValue() < 0)
+      {
+        Message::SendFail() << "Error: invalid PLY element definition '" << aLineStr << "'";
+        return false;
+      }
+      anElem.NbItems = aCount.IntegerValue();
+      myElements.Append (anElem);
+    }
+    else if (aKey == "property")
+    {
+      if (myElements.IsEmpty())
+      {
+        Message::SendFail() << "Error: PLY property '" << aLineStr << "' is defined outside of element";
+        return false;
+      }
+      Property aProp;
+      if (aLineStr.Token (" \t", 2) == "list")
+      {
+        aProp.CountType = parseType (aLineStr.Token (" \t", 3));
+        aProp.Type      = parseType (aLineStr.Token (" \t", 4));
+        aProp.Name      = aLineStr.Token (" \t", 5);
+        if (aProp.CountType == PropertyType_Undefined)
+        {
+          aProp.Type = PropertyType_Undefined;
+        }
+      }
+      else
+      {
+        aProp.Type = parseType (aLineStr.Token (" \t", 2));
+        aProp.Name = aLineStr.Token (" \t", 3);
+      }
+      if (aProp.Type == PropertyType_Undefined
+       || aProp.Name.IsEmpty())
+      {
+        Message::SendFail() << "Error: invalid PLY property definition '" << aLineStr << "'";
+        return false;
+      }
+      myElements.ChangeLast().Properties.Append (aProp);
+    }
+    else if (aKey == "end_header")
+    {
+      isEndHeader = true;
+      break;
+    }
+    else
+    {
+      Message::SendWarning() << "Warning: unknown PLY header line '" << aLineStr << "' is skipped";
+    }
+  }
+  if (!isEndHeader
+    || myFormat == FileFormat_Undefined)
+  {
+    return false;
+  }
+
+  for (Standard_Integer anElemIter = 0; anElemIter < myElements.Length(); ++anElemIter)
+  {
+    Element& anElem = myElements.ChangeValue (anElemIter);
+    anElem.Stride = 0;
+    bool hasList = false;
+    for (NCollection_Vector<Property>::Iterator aPropIter (anElem.Properties); aPropIter.More(); aPropIter.Next())
+    {
+      hasList = hasList || aPropIter.Value().IsList();
+      anElem.Stride += typeSize (aPropIter.Value().Type);
+    }
+    if (hasList)
+    {
+      anElem.Stride = 0;
+    }
+
+    if (anElem.Name == "vertex" && myVertexElem < 0)
+    {
+      myVertexElem = anElemIter;
+      for (Standard_Integer aPropIter = 0; aPropIter < anElem.Properties.Length(); ++aPropIter)
+      {
+        const Property& aProp = anElem.Properties.Value (aPropIter);
+        const Standard_Integer aSlot = !aProp.IsList() ? vertexSlot (aProp.Name) : -1;
+        if (aSlot >= 0 && myVertexProps[aSlot] < 0)
+        {
+          myVertexProps[aSlot] = aPropIter;
+        }
+      }
+    }
+    else if (anElem.Name == "face" && myFaceElem < 0)
+    {
+      myFaceElem = anElemIter;
+      for (Standard_Integer aPropIter = 0; aPropIter < anElem.Properties.Length(); ++aPropIter)
+      {
+        const Property& aProp = anElem.Properties.Value (aPropIter);
+        if (aProp.IsList()
+         && (myFaceIndicesProp < 0
+          || aProp.Name == "vertex_indices"
+          || aProp.Name == "vertex_index"))
+        {
+          myFaceIndicesProp = aPropIter;
+        }
+      }
+    }
+  }
+
+  if (myVertexElem >= 0
+   && (myVertexProps[VertexSlot_X] < 0
+    || myVertexProps[VertexSlot_Y] < 0
+    || myVertexProps[VertexSlot_Z] < 0))
+  {
+    Message::SendFail() << "Error: PLY vertex element does not define coordinates";
+    return false;
+  }
+  if (myFaceElem >= 0
+   && myFaceIndicesProp < 0)
+  {
+    Message::SendFail() << "Error: PLY face element does not define vertex indices";
+    return false;
+  }
+
+  myHasNormals   = myVertexProps[VertexSlot_NX] >= 0 && myVertexProps[VertexSlot_NY] >= 0 && myVertexProps[VertexSlot_NZ] >= 0;
+  myHasTexCoords = myVertexProps[VertexSlot_U] >= 0 && myVertexProps[VertexSlot_V] >= 0;
+  myHasColors    = myVertexProps[VertexSlot_Red] >= 0 && myVertexProps[VertexSlot_Green] >= 0 && myVertexProps[VertexSlot_Blue] >= 0;
+  return true;
+}
+
+// =======================================================================
+// function : ReadData
+// purpose  :
+// =======================================================================
+bool RWPly_PlyReaderContext::ReadData (std::istream& theStream,
+                                       const Message_ProgressRange& theProgress)
+{
+  myTriangulation.Nullify();
+  myPointCloud.Nullify();
+  myColors = NCollection_Array1<Graphic3d_Vec4ub>();
+  myNbTris = 0;
+  myNbSkippedTris = 0;
+  if (myFormat == FileFormat_Undefined)
+  {
+    return false;
+  }
+
+  const Standard_Integer aNbNodes = NbVertices();
+  if (myIsPointCloud)
+  {
+    if (aNbNodes > 0)
+    {
+      myPointCloud = new Graphic3d_ArrayOfPoints (aNbNodes, myHasColors, myHasNormals);
+      myPointCloud->Attributes()->NbElements = aNbNodes;
+    }
+  }
+  else
+  {
+    myTriangulation = new Poly_Triangulation();
+    myTriangulation->SetDoublePrecision (myIsDoublePrec);
+    myTriangulation->ResizeNodes (aNbNodes, false);
+    myTriangulation->ResizeTriangles (NbFaces(), false);
+    if (myHasTexCoords)
+    {
+      myTriangulation->AddUVNodes();
+    }
+    if (myHasNormals)
+    {
+      myTriangulation->AddNormals();
+    }
+    if (myHasColors && aNbNodes > 0)
+    {
+      myColors = NCollection_Array1<Graphic3d_Vec4ub> (1, aNbNodes);
+    }
+  }
+
+  myChunkStart = myChunkEnd = 0;
+  myIsEof = false;
+  Message_ProgressScope aPS (theProgress, "Reading PLY data", myElements.Length());
+  for (Standard_Integer anElemIter = 0; anElemIter < myElements.Length(); ++anElemIter)
+  {
+    if (!readElement (theStream, anElemIter, aPS.Next()))
+    {
+      myChunk.clear();
+      return false;
+    }
+  }
+  std::vector<char>().swap (myChunk);
+
+  finalizeTriangles();
+  return true;
+}
+
+// =======================================================================
+// function : fetchChunk
+// purpose  :
+// =======================================================================
+bool RWPly_PlyReaderContext::fetchChunk (std::istream& theStream)
+{
+  const Standard_Size aNbLeft = myChunkEnd - myChunkStart;
+  if (aNbLeft > 0 && myChunkStart > 0)
+  {
+    memmove (&myChunk.front(), &myChunk.front() + myChunkStart, aNbLeft);
+  }
+  myChunkStart = 0;
+  myChunkEnd   = aNbLeft;
+  if (myChunk.size() < aNbLeft + THE_CHUNK_SIZE + 1)
+  {
+    myChunk.resize (aNbLeft + THE_CHUNK_SIZE + 1);
+  }
+
+  theStream.read (&myChunk.front() + myChunkEnd, (std::streamsize )THE_CHUNK_SIZE);
+  const std::streamsize aNbRead = theStream.gcount();
+  if (theStream.bad())
+  {
+    Message::SendFail ("Error: PLY file reading failed");
+    return false;
+  }
+  myChunkEnd += (Standard_Size )aNbRead;
+  myChunk[myChunkEnd] = '\0'; // terminate the last line of ASCII file
+  myIsEof = aNbRead < (std::streamsize )THE_CHUNK_SIZE;
+  return true;
+}
+
+// =======================================================================
+// function : findRecord
+// purpose  :
+// =======================================================================
+RWPly_PlyReaderContext::RecordStatus RWPly_PlyReaderContext::findRecord (const Element& theElem,
+                                                                         const bool theIsFace,
+                                                                         Standard_Size& theStart,
+                                                                         Standard_Size& theEnd,
+                                                                         Standard_Integer& theNbTris) const
+{
+  theNbTris = 0;
+  if (theStart >= myChunkEnd)
+  {
+    return RecordStatus_Incomplete;
+  }
+
+  const char* aData = &myChunk.front();
+  if (myFormat == FileFormat_Ascii)
+  {
+    for (;;)
+    {
+      if (theStart >= myChunkEnd)
+      {
+        return RecordStatus_Incomplete;
+      }
+      const char* aLine = aData + theStart;
+      const char* aLineEnd = (const char* )memchr (aLine, '\n', myChunkEnd - theStart);
+      if (aLineEnd == NULL && !myIsEof)
+      {
+        return RecordStatus_Incomplete;
+      }
+      theEnd = aLineEnd != NULL ? Standard_Size(aLineEnd - aData) + 1 : myChunkEnd;
+
+      const char* aPos = aLine;
+      while (*aPos == ' ' || *aPos == '\t' || *aPos == '\r')
+      {
+        ++aPos;
+      }
+      if (*aPos == '\n' || *aPos == '\0')
+      {
+        // skip blank line
+        theStart = theEnd;
+        continue;
+      }
+      break;
+    }
+    if (!theIsFace
+      && theElem.Stride != 0)
+    {
+      return RecordStatus_Complete;
+    }
+
+    const char* aPos = aData + theStart;
+    double aValue = 0.0;
+    for (Standard_Integer aPropIter = 0; aPropIter < theElem.Properties.Length(); ++aPropIter)
+    {
+      const Property& aProp = theElem.Properties.Value (aPropIter);
+      if (!readAsciiValue (aPos, aValue))
+      {
+        return RecordStatus_Complete;
+      }
+      if (!aProp.IsList())
+      {
+        continue;
+      }
+      if (!isValidListLength (aValue, aProp.Type))
+      {
+        return RecordStatus_Invalid;
+      }
+      const Standard_Integer aNbItems = int(aValue);
+      if (theIsFace && aPropIter == myFaceIndicesProp)
+      {
+        theNbTris = aNbItems >= 3 ? aNbItems - 2 : 0;
+        return RecordStatus_Complete;
+      }
+      for (Standard_Integer anItemIter = 0; anItemIter < aNbItems && readAsciiValue (aPos, aValue); ++anItemIter) {}
+    }
+    return RecordStatus_Complete;
+  }
+
+  if (theElem.Stride != 0)
+  {
+    if (theStart + theElem.Stride > myChunkEnd)
+    {
+      return RecordStatus_Incomplete;
+    }
+    theEnd = theStart + theElem.Stride;
+    return RecordStatus_Complete;
+  }
+
+  const bool toSwap = (myFormat == FileFormat_BinaryBE) != isBigEndianHost();
+  Standard_Size aPos = theStart;
+  for (Standard_Integer aPropIter = 0; aPropIter < theElem.Properties.Length(); ++aPropIter)
+  {
+    const Property& aProp = theElem.Properties.Value (aPropIter);
+    if (!aProp.IsList())
+    {
+      aPos += typeSize (aProp.Type);
+      if (aPos > myChunkEnd)
+      {
+        return RecordStatus_Incomplete;
+      }
+      continue;
+    }
+
+    const Standard_Size aCountSize = typeSize (aProp.CountType);
+    if (aPos + aCountSize > myChunkEnd)
+    {
+      return RecordStatus_Incomplete;
+    }
+    const double aCount = readBinaryValue (aData + aPos, aProp.CountType, toSwap);
+    if (!isValidListLength (aCount, aProp.Type))
+    {
+      return RecordStatus_Invalid;
+    }
+    const Standard_Integer aNbItems = int(aCount);
+    aPos += aCountSize + typeSize (aProp.Type) * (Standard_Size )aNbItems;
+    if (aPos > myChunkEnd)
+    {
+      return RecordStatus_Incomplete;
+    }
+    if (theIsFace && aPropIter == myFaceIndicesProp)
+    {
+      theNbTris = aNbItems >= 3 ? aNbItems - 2 : 0;
+    }
+  }
+  theEnd = aPos;
+  return RecordStatus_Complete;
+}
+
+// =======================================================================
+// function : readElement
+// purpose  :
+// =======================================================================
+bool RWPly_PlyReaderContext::readElement (std::istream& theStream,
+                                          const Standard_Integer theElemIndex,
+                                          const Message_ProgressRange& theProgress)
+{
+  const Element& anElem = myElements.Value (theElemIndex);
+  const bool isVertex = theElemIndex == myVertexElem;
+  const bool isFace   = theElemIndex == myFaceElem && !myTriangulation.IsNull();
+  Message_ProgressScope aPS (theProgress, "Reading PLY element", Max (1, anElem.NbItems));
+
+  std::vector<Standard_Size> aRecords;
+  std::vector<Standard_Integer> aTriOffsets;
+  Standard_Integer aNbDone = 0;
+  while (aNbDone < anElem.NbItems)
+  {
+    // locate complete records within the chunk
+    aRecords.clear();
+    aTriOffsets.clear();
+    Standard_Integer aNbTris = 0;
+    Standard_Size aPos = myChunkStart;
+    while (aNbDone + (Standard_Integer )aRecords.size() < anElem.NbItems)
+    {
+      Standard_Size anEnd = 0;
+      Standard_Integer aNbRecTris = 0;
+      const RecordStatus aStatus = findRecord (anElem, isFace, aPos, anEnd, aNbRecTris);
+      if (aStatus == RecordStatus_Invalid)
+      {
+        Message::SendFail() << "Error: invalid list length in PLY element '" << anElem.Name
+                            << "' at record " << (aNbDone + (Standard_Integer )aRecords.size());
+        return false;
+      }
+      else if (aStatus == RecordStatus_Incomplete)
+      {
+        break;
+      }
+      aRecords.push_back (aPos);
+      if (isFace)
+      {
+        aTriOffsets.push_back (myNbTris + aNbTris + 1);
+        aNbTris += aNbRecTris;
+      }
+      aPos = anEnd;
+    }
+
+    if (aRecords.empty())
+    {
+      if (myIsEof)
+      {
+        Message::SendFail() << "Error: unexpected end of PLY file while reading element '" << anElem.Name << "'";
+        return false;
+      }
+      if (!fetchChunk (theStream))
+      {
+        return false;
+      }
+      continue;
+    }
+
+    if (isFace
+     && myNbTris + aNbTris > myTriangulation->NbTriangles())
+    {
+      // polygons are split into several triangles - extend the array
+      const Standard_Integer aNbTrisAlloc = myTriangulation->NbTriangles();
+      myTriangulation->ResizeTriangles (Max (myNbTris + aNbTris, aNbTrisAlloc + aNbTrisAlloc / 2), true);
+    }
+
+    if (isVertex || isFace)
+    {
+      DecodeFunctor aFunctor (*this, anElem, isVertex, aRecords, aTriOffsets, aNbDone);
+      OSD_Parallel::For (0, (Standard_Integer )aRecords.size(), aFunctor, !myToParallel);
+    }
+
+    aNbDone += (Standard_Integer )aRecords.size();
+    myNbTris += aNbTris;
+    myChunkStart = aPos;
+    aPS.Next ((Standard_Real )aRecords.size());
+    if (!aPS.More())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : finalizeTriangles
+// purpose  :
+// =======================================================================
+void RWPly_PlyReaderContext::finalizeTriangles()
+{
+  if (myTriangulation.IsNull())
+  {
+    return;
+  }
+
+  Standard_Integer aNbValid = 0;
+  for (Standard_Integer aTriIter = 1; aTriIter <= myNbTris; ++aTriIter)
+  {
+    const Poly_Triangle aTri = myTriangulation->Triangle (aTriIter);
+    if (aTri.Value (1) == 0)
+    {
+      ++myNbSkippedTris;
+      continue;
+    }
+    if (++aNbValid != aTriIter)
+    {
+      myTriangulation->SetTriangle (aNbValid, aTri);
+    }
+  }
+  if (myNbSkippedTris > 0)
+  {
+    Message::SendWarning() << "Warning: " << myNbSkippedTris << " triangles with invalid vertex indices are skipped";
+  }
+  if (aNbValid != myTriangulation->NbTriangles())
+  {
+    myTriangulation->ResizeTriangles (aNbValid, true);
+  }
+}
@@ -0,0 +1,244 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWPly_PlyReaderContext_HeaderFile
+#define _RWPly_PlyReaderContext_HeaderFile
+
+#include <Graphic3d_ArrayOfPoints.hxx>
+#include <Graphic3d_Vec.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <Poly_Triangulation.hxx>
+#include <RWMesh_CoordinateSystemConverter.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <vector>
+
+//! Auxiliary low-level tool reading PLY file.
+//!
+//! ASCII, binary little-endian and binary big-endian files are supported.
+//! The vertices (position, normal, UV and color properties) and the polygonal faces
+//! (split into triangles as fans) are decoded directly into Poly_Triangulation,
+//! or into Graphic3d_ArrayOfPoints in point cloud mode (see SetPointCloudMode()).
+//! Other elements and properties are skipped.
+//!
+//! The body of the file is read from the stream by chunks of limited size;
+//! the records of each chunk are located sequentially and decoded concurrently
+//! when parallel mode is enabled (see SetParallel()).
+class RWPly_PlyReaderContext
+{
+public:
+
+  //! Format of the file body.
+  enum FileFormat
+  {
+    FileFormat_Undefined,      //!< format is not yet read
+    FileFormat_Ascii,          //!< "ascii"
+    FileFormat_BinaryLE,       //!< "binary_little_endian"
+    FileFormat_BinaryBE        //!< "binary_big_endian"
+  };
+
+  //! Type of the property value.
+  enum PropertyType
+  {
+    PropertyType_Undefined,
+    PropertyType_Int8,
+    PropertyType_UInt8,
+    PropertyType_Int16,
+    PropertyType_UInt16,
+    PropertyType_Int32,
+    PropertyType_UInt32,
+    PropertyType_Float32,
+    PropertyType_Float64
+  };
+
+  //! Property of the element.
+  struct Property
+  {
+    TCollection_AsciiString Name;      //!< property name
+    PropertyType            Type;      //!< value type (type of list items for list property)
+    PropertyType            CountType; //!< type of list length, or PropertyType_Undefined for scalar property
+
+    Property() : Type (PropertyType_Undefined), CountType (PropertyType_Undefined) {}
+
+    //! Return TRUE for list property.
+    bool IsList() const { return CountType != PropertyType_Undefined; }
+  };
+
+  //! Element declared in the header.
+  struct Element
+  {
+    TCollection_AsciiString      Name;       //!< element name
+    Standard_Integer             NbItems;    //!< number of records
+    NCollection_Vector<Property> Properties; //!< properties in the order of the file
+    Standard_Size                Stride;     //!< size of binary record, or 0 if element has list properties
+
+    Element() : NbItems (0), Stride (0) {}
+  };
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT RWPly_PlyReaderContext();
+
+public: //! @name reading parameters
+
+  //! Return TRUE if vertex positions are stored in Poly_Triangulation with double precision; TRUE by default.
+  bool IsDoublePrecision() const { return myIsDoublePrec; }
+
+  //! Set if vertex positions should be stored with double floating point precision.
+  void SetDoublePrecision (bool theDoublePrec) { myIsDoublePrec = theDoublePrec; }
+
+  //! Return TRUE if the records are decoded in parallel threads; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Set flag to decode the records in parallel threads.
+  void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
+
+  //! Return TRUE if vertices should be decoded into Graphic3d_ArrayOfPoints
+  //! instead of Poly_Triangulation, faces being skipped; FALSE by default.
+  bool IsPointCloudMode() const { return myIsPointCloud; }
+
+  //! Set point cloud mode.
+  void SetPointCloudMode (bool theIsPointCloud) { myIsPointCloud = theIsPointCloud; }
+
+  //! Return coordinate system converter applied to positions and normals.
+  const RWMesh_CoordinateSystemConverter& CoordinateSystemConverter() const { return myCSTrsf; }
+
+  //! Set coordinate system converter.
+  void SetCoordinateSystemConverter (const RWMesh_CoordinateSystemConverter& theConverter) { myCSTrsf = theConverter; }
+
+public: //! @name reading the file
+
+  //! Read the file.
+  Standard_EXPORT bool Read (const TCollection_AsciiString& theFile,
+                             const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Read the header from the stream.
+  //! The stream is left at the beginning of the body.
+  Standard_EXPORT bool ReadHeader (std::istream& theStream);
+
+  //! Read the body from the stream following the header.
+  Standard_EXPORT bool ReadData (std::istream& theStream,
+                                 const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+public: //! @name header information
+
+  //! Return format of the file body.
+  FileFormat Format() const { return myFormat; }
+
+  //! Return elements declared in the header.
+  const NCollection_Vector<Element>& Elements() const { return myElements; }
+
+  //! Return comments of the header joined by new line.
+  const TCollection_AsciiString& Comments() const { return myComments; }
+
+  //! Return number of vertices declared in the header.
+  Standard_Integer NbVertices() const { return myVertexElem >= 0 ? myElements.Value (myVertexElem).NbItems : 0; }
+
+  //! Return number of faces declared in the header.
+  Standard_Integer NbFaces() const { return myFaceElem >= 0 ? myElements.Value (myFaceElem).NbItems : 0; }
+
+  //! Return TRUE if vertices define normals.
+  bool HasNormals() const { return myHasNormals; }
+
+  //! Return TRUE if vertices define UV coordinates.
+  bool HasTexCoords() const { return myHasTexCoords; }
+
+  //! Return TRUE if vertices define colors.
+  bool HasColors() const { return myHasColors; }
+
+public: //! @name decoded data
+
+  //! Return triangulation (NULL in point cloud mode).
+  //! The triangulation has no triangles if the file defines no faces.
+  const Handle(Poly_Triangulation)& Triangulation() const { return myTriangulation; }
+
+  //! Return point cloud (NULL if point cloud mode is not set).
+  const Handle(Graphic3d_ArrayOfPoints)& PointCloud() const { return myPointCloud; }
+
+  //! Return per-vertex colors of triangulation (empty if vertices have no colors or in point cloud mode).
+  const NCollection_Array1<Graphic3d_Vec4ub>& VertexColors() const { return myColors; }
+
+  //! Return number of skipped triangles referring to invalid vertex indices.
+  Standard_Integer NbSkippedTriangles() const { return myNbSkippedTris; }
+
+private:
+
+  class DecodeFunctor;
+
+  //! Result of locating the record within the chunk.
+  enum RecordStatus
+  {
+    RecordStatus_Complete,   //!< the record is entirely within the chunk
+    RecordStatus_Incomplete, //!< the record continues beyond the chunk
+    RecordStatus_Invalid     //!< the record defines invalid list length
+  };
+
+  //! Locate records of the element within the current chunk, decode them and fetch next chunks.
+  bool readElement (std::istream& theStream,
+                    const Standard_Integer theElemIndex,
+                    const Message_ProgressRange& theProgress);
+
+  //! Find the record starting at theStart within the chunk.
+  //! The length of list properties is validated, so that the decoder may rely on it.
+  //! @param[in] theElem       element of the record
+  //! @param[in] theIsFace     flag to count triangles of the face record
+  //! @param[in][out] theStart position of the record (blank lines of ASCII file are skipped)
+  //! @param[out] theEnd       position after the record
+  //! @param[out] theNbTris    number of triangles defined by the face record
+  //! @return status of the record
+  RecordStatus findRecord (const Element& theElem,
+                           const bool theIsFace,
+                           Standard_Size& theStart,
+                           Standard_Size& theEnd,
+                           Standard_Integer& theNbTris) const;
+
+  //! Read next chunk of the body from the stream, keeping not decoded data.
+  bool fetchChunk (std::istream& theStream);
+
+  //! Remove triangles with invalid indices and fit triangulation size.
+  void finalizeTriangles();
+
+private:
+
+  RWMesh_CoordinateSystemConverter myCSTrsf;
+  NCollection_Vector<Element> myElements;
+  TCollection_AsciiString myComments;
+  FileFormat myFormat;
+  Standard_Integer myVertexElem;             //!< index of vertex element, or -1
+  Standard_Integer myFaceElem;               //!< index of face element, or -1
+  Standard_Integer myFaceIndicesProp;        //!< index of vertex indices list property of face element
+  Standard_Integer myVertexProps[12];        //!< indices of x, y, z, nx, ny, nz, u, v, red, green, blue, alpha properties
+  bool myIsDoublePrec;
+  bool myToParallel;
+  bool myIsPointCloud;
+  bool myHasNormals;
+  bool myHasTexCoords;
+  bool myHasColors;
+
+  std::vector<char> myChunk;                 //!< current chunk of the body
+  Standard_Size myChunkStart;                //!< position of the first not decoded byte in the chunk
+  Standard_Size myChunkEnd;                  //!< end of the data in the chunk
+  bool myIsEof;                              //!< end of stream has been reached
+
+  Handle(Poly_Triangulation) myTriangulation;
+  Handle(Graphic3d_ArrayOfPoints) myPointCloud;
+  NCollection_Array1<Graphic3d_Vec4ub> myColors;
+  Standard_Integer myNbTris;                 //!< number of decoded triangles
+  Standard_Integer myNbSkippedTris;
+
+};
+
+#endif // _RWPly_PlyReaderContext_HeaderFile
@@ -20,8 +20,12 @@
 #include <OSD_File.hxx>
 #include <OSD_FileSystem.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <RWStl_Reader.hxx>
 
+#include <string>
+#include <vector>
+
 namespace
 {
 
@@ -31,6 +35,9 @@ namespace
 // clang-format on
   static const size_t THE_BUFFER_SIZE = 1024; // The length of buffer to read (in bytes)
 
+  static const Standard_Integer THE_PARALLEL_BATCH_NBFACETS = 256 * 1024; // number of facets prepared at once in parallel mode
+  static const Standard_Integer THE_PARALLEL_BLOCK_NBFACETS = 1024;       // number of facets prepared by one parallel task
+
   //! Writing a Little Endian 32 bits integer
   inline static void convertInteger (const Standard_Integer theValue,
                                      Standard_Character* theResult)
@@ -65,6 +72,135 @@ namespace
     theResult[3] = anUnion.c[3];
   }
 
+  //! Return nodes and normal of the facet.
+  inline static void facetNodes (const Handle(Poly_Triangulation)& theMesh,
+                                 const Standard_Integer theTriIndex,
+                                 gp_Pnt theNodes[3],
+                                 gp_Vec& theNorm)
+  {
+    Standard_Integer anElem[3] = {0, 0, 0};
+    theMesh->Triangle (theTriIndex).Get (anElem[0], anElem[1], anElem[2]);
+    theNodes[0] = theMesh->Node (anElem[0]);
+    theNodes[1] = theMesh->Node (anElem[1]);
+    theNodes[2] = theMesh->Node (anElem[2]);
+
+    const gp_Vec aVec1 (theNodes[0], theNodes[1]);
+    const gp_Vec aVec2 (theNodes[0], theNodes[2]);
+    theNorm = aVec1.Crossed (aVec2);
+    if (theNorm.SquareMagnitude() > gp::Resolution())
+    {
+      theNorm.Normalize();
+    }
+    else
+    {
+      theNorm.SetCoord (0.0, 0.0, 0.0);
+    }
+  }
+
+  //! Format the facet in Ascii format.
+  //! @return number of written characters
+  inline static int formatAsciiFacet (const Handle(Poly_Triangulation)& theMesh,
+                                      const Standard_Integer theTriIndex,
+                                      char* theBuffer)
+  {
+    gp_Pnt aNodes[3];
+    gp_Vec aVNorm;
+    facetNodes (theMesh, theTriIndex, aNodes, aVNorm);
+    return Sprintf (theBuffer,
+          " facet normal % 12e % 12e % 12e\n"
+          "   outer loop\n"
+          "     vertex % 12e % 12e % 12e\n"
+          "     vertex % 12e % 12e % 12e\n"
+          "     vertex % 12e % 12e % 12e\n"
+          "   endloop\n"
+          " endfacet\n",
+          aVNorm.X(), aVNorm.Y(), aVNorm.Z(),
+          aNodes[0].X(), aNodes[0].Y(), aNodes[0].Z(),
+          aNodes[1].X(), aNodes[1].Y(), aNodes[1].Z(),
+          aNodes[2].X(), aNodes[2].Y(), aNodes[2].Z());
+  }
+
+  //! Fill the data of the facet in binary format (THE_STL_SIZEOF_FACET bytes).
+  inline static void fillBinaryFacet (const Handle(Poly_Triangulation)& theMesh,
+                                      const Standard_Integer theTriIndex,
+                                      Standard_Character* theData)
+  {
+    gp_Pnt aNodes[3];
+    gp_Vec aVNorm;
+    facetNodes (theMesh, theTriIndex, aNodes, aVNorm);
+
+    convertDouble (aVNorm.X(), theData);
+    convertDouble (aVNorm.Y(), theData + 4);
+    convertDouble (aVNorm.Z(), theData + 8);
+    for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      Standard_Character* aNodeData = theData + 12 * (aNodeIter + 1);
+      convertDouble (aNodes[aNodeIter].X(), aNodeData);
+      convertDouble (aNodes[aNodeIter].Y(), aNodeData + 4);
+      convertDouble (aNodes[aNodeIter].Z(), aNodeData + 8);
+    }
+
+    // attribute byte count
+    theData[48] = 0;
+    theData[49] = 0;
+  }
+
+  //! Functor preparing blocks of facets in parallel mode.
+  class FacetsFunctor
+  {
+  public:
+
+    //! Main constructor.
+    //! @param[in] theMesh     triangulation to write
+    //! @param[in] theFirstTri index of the first triangle of the batch
+    //! @param[in] theNbTris   number of triangles in the batch
+    //! @param[out] theBinary  binary data of the batch, or NULL in Ascii mode
+    //! @param[out] theAscii   formatted blocks of the batch, or NULL in binary mode
+    FacetsFunctor (const Handle(Poly_Triangulation)& theMesh,
+                   const Standard_Integer theFirstTri,
+                   const Standard_Integer theNbTris,
+                   Standard_Character* theBinary,
+                   std::vector<std::string>* theAscii)
+    : myMesh (theMesh),
+      myFirstTri (theFirstTri),
+      myNbTris (theNbTris),
+      myBinary (theBinary),
+      myAscii (theAscii) {}
+
+    //! Prepare facets of the block.
+    void operator() (const Standard_Integer theBlockIndex) const
+    {
+      const Standard_Integer aFirst = theBlockIndex * THE_PARALLEL_BLOCK_NBFACETS;
+      const Standard_Integer aLast  = Min (aFirst + THE_PARALLEL_BLOCK_NBFACETS, myNbTris);
+      if (myBinary != NULL)
+      {
+        for (Standard_Integer aTriIter = aFirst; aTriIter < aLast; ++aTriIter)
+        {
+          fillBinaryFacet (myMesh, myFirstTri + aTriIter, myBinary + size_t(aTriIter) * THE_STL_SIZEOF_FACET);
+        }
+        return;
+      }
+
+      char aBuffer[512];
+      std::string& aBlock = (*myAscii)[theBlockIndex];
+      aBlock.clear();
+      for (Standard_Integer aTriIter = aFirst; aTriIter < aLast; ++aTriIter)
+      {
+        const int aLen = formatAsciiFacet (myMesh, myFirstTri + aTriIter, aBuffer);
+        aBlock.append (aBuffer, aLen);
+      }
+    }
+
+  private:
+    FacetsFunctor& operator= (const FacetsFunctor& );
+  private:
+    const Handle(Poly_Triangulation)& myMesh;
+    Standard_Integer myFirstTri;
+    Standard_Integer myNbTris;
+    Standard_Character* myBinary;
+    std::vector<std::string>* myAscii;
+  };
+
   class Reader : public RWStl_Reader
   {
   public:
@@ -146,9 +282,22 @@ namespace
 Handle(Poly_Triangulation) RWStl::ReadFile (const Standard_CString theFile,
                                             const Standard_Real theMergeAngle,
                                             const Message_ProgressRange& theProgress)
+{
+  return ReadFile (theFile, theMergeAngle, Standard_False, theProgress);
+}
+
+//=============================================================================
+//function : ReadFile
+//purpose  :
+//=============================================================================
+Handle(Poly_Triangulation) RWStl::ReadFile (const Standard_CString theFile,
+                                            const Standard_Real theMergeAngle,
+                                            const Standard_Boolean theToParallel,
+                                            const Message_ProgressRange& theProgress)
 {
   Reader aReader;
   aReader.SetMergeAngle (theMergeAngle);
+  aReader.SetParallel (theToParallel);
   aReader.Read (theFile, theProgress);
   // note that returned bool value is ignored intentionally -- even if something went wrong,
   // but some data have been read, we at least will return these data
@@ -163,9 +312,23 @@ void RWStl::ReadFile(const Standard_CString theFile,
                      const Standard_Real theMergeAngle,
                      NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
                      const Message_ProgressRange& theProgress)
+{
+  ReadFile (theFile, theMergeAngle, Standard_False, theTriangList, theProgress);
+}
+
+//=============================================================================
+//function : ReadFile
+//purpose  :
+//=============================================================================
+void RWStl::ReadFile(const Standard_CString theFile,
+                     const Standard_Real theMergeAngle,
+                     const Standard_Boolean theToParallel,
+                     NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
+                     const Message_ProgressRange& theProgress)
 {
   MultiDomainReader aReader;
   aReader.SetMergeAngle (theMergeAngle);
+  aReader.SetParallel (theToParallel);
   aReader.Read (theFile, theProgress);
   theTriangList.Clear();
   theTriangList.Append (aReader.ChangeTriangulationList());
@@ -254,6 +417,18 @@ Handle(Poly_Triangulation) RWStl::ReadAscii (const OSD_Path& theFile,
 Standard_Boolean RWStl::WriteBinary (const Handle(Poly_Triangulation)& theMesh,
                                      const OSD_Path& thePath,
                                      const Message_ProgressRange& theProgress)
+{
+  return WriteBinary (theMesh, thePath, Standard_False, theProgress);
+}
+
+//=============================================================================
+//function : Write
+//purpose  :
+//=============================================================================
+Standard_Boolean RWStl::WriteBinary (const Handle(Poly_Triangulation)& theMesh,
+                                     const OSD_Path& thePath,
+                                     const Standard_Boolean theToParallel,
+                                     const Message_ProgressRange& theProgress)
 {
   if (theMesh.IsNull() || theMesh->NbTriangles() <= 0)
   {
@@ -269,7 +444,7 @@ Standard_Boolean RWStl::WriteBinary (const Handle(Poly_Triangulation)& theMesh,
     return Standard_False;
   }
 
-  Standard_Boolean isOK = writeBinary (theMesh, aFile, theProgress);
+  Standard_Boolean isOK = writeBinary (theMesh, aFile, theToParallel, theProgress);
 
   fclose (aFile);
   return isOK;
@@ -282,6 +457,18 @@ Standard_Boolean RWStl::WriteBinary (const Handle(Poly_Triangulation)& theMesh,
 Standard_Boolean RWStl::WriteAscii (const Handle(Poly_Triangulation)& theMesh,
                                     const OSD_Path& thePath,
                                     const Message_ProgressRange& theProgress)
+{
+  return WriteAscii (theMesh, thePath, Standard_False, theProgress);
+}
+
+//=============================================================================
+//function : Write
+//purpose  :
+//=============================================================================
+Standard_Boolean RWStl::WriteAscii (const Handle(Poly_Triangulation)& theMesh,
+                                    const OSD_Path& thePath,
+                                    const Standard_Boolean theToParallel,
+                                    const Message_ProgressRange& theProgress)
 {
   if (theMesh.IsNull() || theMesh->NbTriangles() <= 0)
   {
@@ -297,7 +484,7 @@ Standard_Boolean RWStl::WriteAscii (const Handle(Poly_Triangulation)& theMesh,
     return Standard_False;
   }
 
-  Standard_Boolean isOK = writeASCII (theMesh, aFile, theProgress);
+  Standard_Boolean isOK = writeASCII (theMesh, aFile, theToParallel, theProgress);
   fclose (aFile);
   return isOK;
 }
@@ -308,6 +495,7 @@ Standard_Boolean RWStl::WriteAscii (const Handle(Poly_Triangulation)& theMesh,
 //=============================================================================
 Standard_Boolean RWStl::writeASCII (const Handle(Poly_Triangulation)& theMesh,
                                     FILE* theFile,
+                                    const Standard_Boolean theToParallel,
                                     const Message_ProgressRange& theProgress)
 {
   // note that space after 'solid' is necessary for many systems
@@ -316,58 +504,52 @@ Standard_Boolean RWStl::writeASCII (const Handle(Poly_Triangulation)& theMesh,
     return Standard_False;
   }
 
-  char aBuffer[512];
-  memset (aBuffer, 0, sizeof(aBuffer));
-
   const Standard_Integer NBTriangles = theMesh->NbTriangles();
   Message_ProgressScope aPS (theProgress, "Triangles", NBTriangles);
-
-  Standard_Integer anElem[3] = {0, 0, 0};
-  for (Standard_Integer aTriIter = 1; aTriIter <= NBTriangles; ++aTriIter)
+  if (theToParallel)
   {
-    const Poly_Triangle aTriangle = theMesh->Triangle (aTriIter);
-    aTriangle.Get (anElem[0], anElem[1], anElem[2]);
-
-    const gp_Pnt aP1 = theMesh->Node (anElem[0]);
-    const gp_Pnt aP2 = theMesh->Node (anElem[1]);
-    const gp_Pnt aP3 = theMesh->Node (anElem[2]);
-
-    const gp_Vec aVec1 (aP1, aP2);
-    const gp_Vec aVec2 (aP1, aP3);
-    gp_Vec aVNorm = aVec1.Crossed (aVec2);
-    if (aVNorm.SquareMagnitude() > gp::Resolution())
+    // format batches of facets by blocks in parallel and write blocks in the order of triangles
+    std::vector<std::string> aBlocks (THE_PARALLEL_BATCH_NBFACETS / THE_PARALLEL_BLOCK_NBFACETS);
+    for (Standard_Integer aFirstTri = 1; aFirstTri <= NBTriangles; aFirstTri += THE_PARALLEL_BATCH_NBFACETS)
     {
-      aVNorm.Normalize();
-    }
-    else
-    {
-      aVNorm.SetCoord (0.0, 0.0, 0.0);
-    }
-
-    Sprintf (aBuffer,
-          " facet normal % 12e % 12e % 12e\n"
-          "   outer loop\n"
-          "     vertex % 12e % 12e % 12e\n"
-          "     vertex % 12e % 12e % 12e\n"
-          "     vertex % 12e % 12e % 12e\n"
-          "   endloop\n"
-          " endfacet\n",
-          aVNorm.X(), aVNorm.Y(), aVNorm.Z(),
-          aP1.X(), aP1.Y(), aP1.Z(),
-          aP2.X(), aP2.Y(), aP2.Z(),
-          aP3.X(), aP3.Y(), aP3.Z());
+      if (!aPS.More())
+      {
+        return Standard_False;
+      }
 
-    if (fprintf (theFile, "%s", aBuffer) < 0)
-    {
-      return Standard_False;
+      const Standard_Integer aNbTris    = Min (THE_PARALLEL_BATCH_NBFACETS, NBTriangles - aFirstTri + 1);
+      const Standard_Integer aNbBlocks  = (aNbTris + THE_PARALLEL_BLOCK_NBFACETS - 1) / THE_PARALLEL_BLOCK_NBFACETS;
+      OSD_Parallel::For (0, aNbBlocks, FacetsFunctor (theMesh, aFirstTri, aNbTris, NULL, &aBlocks), aNbBlocks < 2);
+      for (Standard_Integer aBlockIter = 0; aBlockIter < aNbBlocks; ++aBlockIter)
+      {
+        const std::string& aBlock = aBlocks[aBlockIter];
+        if (fwrite (aBlock.c_str(), 1, aBlock.size(), theFile) != aBlock.size())
+        {
+          return Standard_False;
+        }
+      }
+      aPS.Next (aNbTris);
     }
-
-    // update progress only per 1k triangles
-    if ((aTriIter % IND_THRESHOLD) == 0)
+  }
+  else
+  {
+    char aBuffer[512];
+    memset (aBuffer, 0, sizeof(aBuffer));
+    for (Standard_Integer aTriIter = 1; aTriIter <= NBTriangles; ++aTriIter)
     {
-      if (!aPS.More())
+      formatAsciiFacet (theMesh, aTriIter, aBuffer);
+      if (fprintf (theFile, "%s", aBuffer) < 0)
+      {
         return Standard_False;
-      aPS.Next(IND_THRESHOLD);
+      }
+
+      // update progress only per 1k triangles
+      if ((aTriIter % IND_THRESHOLD) == 0)
+      {
+        if (!aPS.More())
+          return Standard_False;
+        aPS.Next(IND_THRESHOLD);
+      }
     }
   }
 
@@ -385,6 +567,7 @@ Standard_Boolean RWStl::writeASCII (const Handle(Poly_Triangulation)& theMesh,
 //=============================================================================
 Standard_Boolean RWStl::writeBinary (const Handle(Poly_Triangulation)& theMesh,
                                      FILE* theFile,
+                                     const Standard_Boolean theToParallel,
                                      const Message_ProgressRange& theProgress)
 {
   char aHeader[80] = "STL Exported by Open CASCADE Technology [dev.opencascade.org]";
@@ -396,7 +579,7 @@ Standard_Boolean RWStl::writeBinary (const Handle(Poly_Triangulation)& theMesh,
   const Standard_Integer aNBTriangles = theMesh->NbTriangles();
   Message_ProgressScope aPS (theProgress, "Triangles", aNBTriangles);
 
-  const Standard_Size aNbChunkTriangles = 4096;
+  const Standard_Size aNbChunkTriangles = theToParallel ? THE_PARALLEL_BATCH_NBFACETS : 4096;
   const Standard_Size aChunkSize = aNbChunkTriangles * THE_STL_SIZEOF_FACET;
   NCollection_Array1<Standard_Character> aData (1, aChunkSize);
   Standard_Character* aDataChunk = &aData.ChangeFirst();
@@ -408,47 +591,34 @@ Standard_Boolean RWStl::writeBinary (const Handle(Poly_Triangulation)& theMesh,
     return Standard_False;
   }
 
-  Standard_Size aByteCount = 0;
-  for (Standard_Integer aTriIter = 1; aTriIter <= aNBTriangles; ++aTriIter)
+  if (theToParallel)
   {
-    Standard_Integer id[3];
-    const Poly_Triangle aTriangle = theMesh->Triangle (aTriIter);
-    aTriangle.Get (id[0], id[1], id[2]);
-
-    const gp_Pnt aP1 = theMesh->Node (id[0]);
-    const gp_Pnt aP2 = theMesh->Node (id[1]);
-    const gp_Pnt aP3 = theMesh->Node (id[2]);
-
-    gp_Vec aVec1 (aP1, aP2);
-    gp_Vec aVec2 (aP1, aP3);
-    gp_Vec aVNorm = aVec1.Crossed(aVec2);
-    if (aVNorm.SquareMagnitude() > gp::Resolution())
+    // fill batches of facets by blocks in parallel
+    for (Standard_Integer aFirstTri = 1; aFirstTri <= aNBTriangles; aFirstTri += THE_PARALLEL_BATCH_NBFACETS)
     {
-      aVNorm.Normalize();
-    }
-    else
-    {
-      aVNorm.SetCoord (0.0, 0.0, 0.0);
-    }
-
-    convertDouble (aVNorm.X(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aVNorm.Y(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aVNorm.Z(), &aDataChunk[aByteCount]); aByteCount += 4;
-
-    convertDouble (aP1.X(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP1.Y(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP1.Z(), &aDataChunk[aByteCount]); aByteCount += 4;
-
-    convertDouble (aP2.X(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP2.Y(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP2.Z(), &aDataChunk[aByteCount]); aByteCount += 4;
+      if (!aPS.More())
+      {
+        return Standard_False;
+      }
 
-    convertDouble (aP3.X(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP3.Y(), &aDataChunk[aByteCount]); aByteCount += 4;
-    convertDouble (aP3.Z(), &aDataChunk[aByteCount]); aByteCount += 4;
+      const Standard_Integer aNbTris   = Min (THE_PARALLEL_BATCH_NBFACETS, aNBTriangles - aFirstTri + 1);
+      const Standard_Integer aNbBlocks = (aNbTris + THE_PARALLEL_BLOCK_NBFACETS - 1) / THE_PARALLEL_BLOCK_NBFACETS;
+      OSD_Parallel::For (0, aNbBlocks, FacetsFunctor (theMesh, aFirstTri, aNbTris, aDataChunk, NULL), aNbBlocks < 2);
+      const Standard_Size aByteCount = Standard_Size(aNbTris) * THE_STL_SIZEOF_FACET;
+      if (fwrite (aDataChunk, 1, aByteCount, theFile) != aByteCount)
+      {
+        return Standard_False;
+      }
+      aPS.Next (aNbTris);
+    }
+    return Standard_True;
+  }
 
-    aDataChunk[aByteCount] = 0; aByteCount += 1;
-    aDataChunk[aByteCount] = 0; aByteCount += 1;
+  Standard_Size aByteCount = 0;
+  for (Standard_Integer aTriIter = 1; aTriIter <= aNBTriangles; ++aTriIter)
+  {
+    fillBinaryFacet (theMesh, aTriIter, &aDataChunk[aByteCount]);
+    aByteCount += THE_STL_SIZEOF_FACET;
 
     // Chunk is filled. Dump it to the file.
     if (aByteCount == aChunkSize)
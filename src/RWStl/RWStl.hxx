@@ -33,6 +33,18 @@ public:
   Standard_EXPORT static Standard_Boolean WriteBinary (const Handle(Poly_Triangulation)& theMesh,
                                                        const OSD_Path& thePath,
                                                        const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Write triangulation to binary STL file.
+  //! @param[in] theMesh       triangulation to write
+  //! @param[in] thePath       file path to write
+  //! @param[in] theToParallel flag to fill the facets data in parallel threads
+  //! @param[in] theProgress   progress indicator
+  //! @return FALSE if the file cannot be opened or written
+  Standard_EXPORT static Standard_Boolean WriteBinary (const Handle(Poly_Triangulation)& theMesh,
+                                                       const OSD_Path& thePath,
+                                                       const Standard_Boolean theToParallel,
+                                                       const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   
   //! write the meshing in a file following the
   //! Ascii  format of an STL file.
@@ -40,6 +52,18 @@ public:
   Standard_EXPORT static Standard_Boolean WriteAscii (const Handle(Poly_Triangulation)& theMesh,
                                                       const OSD_Path& thePath,
                                                       const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Write triangulation to Ascii STL file.
+  //! @param[in] theMesh       triangulation to write
+  //! @param[in] thePath       file path to write
+  //! @param[in] theToParallel flag to format the facets in parallel threads
+  //! @param[in] theProgress   progress indicator
+  //! @return FALSE if the file cannot be opened or written
+  Standard_EXPORT static Standard_Boolean WriteAscii (const Handle(Poly_Triangulation)& theMesh,
+                                                      const OSD_Path& thePath,
+                                                      const Standard_Boolean theToParallel,
+                                                      const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   
   //! Read specified STL file and returns its content as triangulation.
   //! In case of error, returns Null handle.
@@ -62,6 +86,18 @@ public:
   Standard_EXPORT static Handle(Poly_Triangulation) ReadFile (const Standard_CString theFile,
                                                               const Standard_Real theMergeAngle,
                                                               const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Read specified STL file and returns its content as triangulation.
+  //! @param[in] theFile file path to read
+  //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes; M_PI/2 means ignore angle
+  //! @param[in] theToParallel flag to decode binary file and merge nodes in parallel threads (see RWStl_Reader::SetParallel())
+  //! @param[in] theProgress progress indicator
+  //! @return result triangulation or NULL in case of error
+  Standard_EXPORT static Handle(Poly_Triangulation) ReadFile (const Standard_CString theFile,
+                                                              const Standard_Real theMergeAngle,
+                                                              const Standard_Boolean theToParallel,
+                                                              const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   
   //! Read specified STL file and fills triangulation list for multi-domain case.
   //! @param[in] theFile file path to read
@@ -72,6 +108,19 @@ public:
                                        const Standard_Real theMergeAngle,
                                        NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
                                        const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Read specified STL file and fills triangulation list for multi-domain case.
+  //! @param[in] theFile file path to read
+  //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes; M_PI/2 means ignore angle
+  //! @param[in] theToParallel flag to decode binary file and merge nodes in parallel threads (see RWStl_Reader::SetParallel())
+  //! @param[out] theTriangList triangulation list for multi-domain case
+  //! @param[in] theProgress progress indicator
+  Standard_EXPORT static void ReadFile(const Standard_CString theFile,
+                                       const Standard_Real theMergeAngle,
+                                       const Standard_Boolean theToParallel,
+                                       NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
+                                       const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   
   //! Read triangulation from a binary STL file
   //! In case of error, returns Null handle.
@@ -88,11 +137,13 @@ private:
   //! Write ASCII version.
   static Standard_Boolean writeASCII (const Handle(Poly_Triangulation)& theMesh,
                                       FILE *theFile,
+                                      const Standard_Boolean theToParallel,
                                       const Message_ProgressRange& theProgress);
 
   //! Write binary version.
   static Standard_Boolean writeBinary (const Handle(Poly_Triangulation)& theMesh,
                                        FILE *theFile,
+                                       const Standard_Boolean theToParallel,
                                        const Message_ProgressRange& theProgress);
 };
 
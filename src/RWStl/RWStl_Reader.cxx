@@ -22,12 +22,14 @@
 #include <NCollection_IncAllocator.hxx>
 #include <FSD_BinaryFile.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Timer.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Standard_CLocaleSentry.hxx>
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 IMPLEMENT_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
 
@@ -41,6 +43,15 @@ namespace
   // The length of buffer to read (in bytes)
   static const size_t THE_BUFFER_SIZE = 1024;
 
+  // The number of facets of binary file read at once in parallel mode (~25 MiB)
+  static const Standard_Integer THE_PARALLEL_BATCH_NBFACETS = 512 * 1024;
+
+  // The number of facets decoded by one parallel task
+  static const Standard_Integer THE_PARALLEL_BLOCK_NBFACETS = 4096;
+
+  // The number of partitions of nodes merged in parallel mode
+  static const Standard_Integer THE_PARALLEL_NB_PARTITIONS = 64;
+
   //! Auxiliary tool for merging nodes during STL reading.
   class MergeNodeTool : public Poly_MergeNodesTool
   {
@@ -117,6 +128,147 @@ namespace
                    readStlFloat (theData + sizeof(float) * 2));
   }
 
+  //! Hasher of node positions for merging exactly coincident nodes,
+  //! consistent with Poly_MergeNodesTool without merge tolerance.
+  struct Vec3fHasher
+  {
+    size_t operator() (const NCollection_Vec3<float>& theVec) const
+    {
+      return opencascade::hashBytes (&theVec[0], 3 * sizeof(float));
+    }
+
+    bool operator() (const NCollection_Vec3<float>& theVec1,
+                     const NCollection_Vec3<float>& theVec2) const
+    {
+      return theVec1.IsEqual (theVec2);
+    }
+  };
+
+  //! Node bound to the map of merged nodes.
+  struct MergedNode
+  {
+    Standard_Integer Id;         //!< node index returned by RWStl_Reader::AddNode()
+    Standard_Integer BatchIndex; //!< index of the first occurrence within current batch, or -1 if node has been already added
+
+    MergedNode (Standard_Integer theId, Standard_Integer theBatchIndex) : Id (theId), BatchIndex (theBatchIndex) {}
+  };
+
+  typedef NCollection_DataMap<NCollection_Vec3<float>, MergedNode, Vec3fHasher> MergedNodeMap;
+
+  //! Batch of binary facets decoded in parallel mode.
+  struct BinaryBatch
+  {
+    const char*                          Data;       //!< facets read from the file
+    Standard_Integer                     NbFacets;   //!< number of facets within the batch
+    std::vector<NCollection_Vec3<float>> Nodes;      //!< decoded nodes, 3 per facet
+    std::vector<Standard_Integer>        Partitions; //!< partition of each node
+    std::vector<Standard_Integer>        Order;      //!< node indices sorted by partitions
+    std::vector<Standard_Integer>        PartStarts; //!< ranges of partitions within Order
+    std::vector<Standard_Integer>        Refs;       //!< index of the first occurrence of the node within the batch, or -1 if merged with node added before
+    std::vector<Standard_Integer>        NodeIds;    //!< node indices returned by RWStl_Reader::AddNode()
+    std::vector<MergedNode*>             Slots;      //!< map items of the nodes first occurred within the batch
+
+    BinaryBatch() : Data (NULL), NbFacets (0) {}
+  };
+
+  //! Functor decoding the blocks of binary facets.
+  class BinaryDecodeFunctor
+  {
+  public:
+
+    //! Main constructor.
+    BinaryDecodeFunctor (BinaryBatch& theBatch,
+                         const bool theToPartition)
+    : myBatch (theBatch),
+      myToPartition (theToPartition) {}
+
+    //! Decode facets of the block.
+    void operator() (const Standard_Integer theBlockIndex) const
+    {
+      const Standard_Integer aFirst = theBlockIndex * THE_PARALLEL_BLOCK_NBFACETS;
+      const Standard_Integer aLast  = Min (aFirst + THE_PARALLEL_BLOCK_NBFACETS, myBatch.NbFacets);
+      const Vec3fHasher aHasher;
+      for (Standard_Integer aFacetIter = aFirst; aFacetIter < aLast; ++aFacetIter)
+      {
+        // skip normal
+        const char* aFacet = myBatch.Data + THE_STL_SIZEOF_FACET * aFacetIter + sizeof(float) * 3;
+        NCollection_Vec3<float>* aNodes = &myBatch.Nodes[aFacetIter * 3];
+      #if OCCT_BINARY_FILE_DO_INVERSE
+        for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+        {
+          const char* aNodeData = aFacet + sizeof(float) * 3 * aNodeIter;
+          aNodes[aNodeIter].SetValues (readStlFloat (aNodeData),
+                                       readStlFloat (aNodeData + sizeof(float)),
+                                       readStlFloat (aNodeData + sizeof(float) * 2));
+        }
+      #else
+        // on little-endian platform, copy 3 float triplets at once
+        memcpy (aNodes, aFacet, sizeof(float) * 9);
+      #endif
+        if (myToPartition)
+        {
+          for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+          {
+            myBatch.Partitions[aFacetIter * 3 + aNodeIter] = Standard_Integer(aHasher (aNodes[aNodeIter]) % THE_PARALLEL_NB_PARTITIONS);
+          }
+        }
+      }
+    }
+
+  private:
+    BinaryDecodeFunctor& operator= (const BinaryDecodeFunctor& );
+  private:
+    BinaryBatch& myBatch;
+    bool myToPartition;
+  };
+
+  //! Functor merging the nodes of the batch within one partition.
+  class BinaryMergeFunctor
+  {
+  public:
+
+    //! Main constructor.
+    BinaryMergeFunctor (BinaryBatch& theBatch,
+                        std::vector<MergedNodeMap>& theMaps)
+    : myBatch (theBatch),
+      myMaps (theMaps) {}
+
+    //! Merge nodes of the partition in the order of the file.
+    void operator() (const Standard_Integer thePartition) const
+    {
+      MergedNodeMap& aMap = myMaps[thePartition];
+      for (Standard_Integer anOrderIter = myBatch.PartStarts[thePartition];
+           anOrderIter < myBatch.PartStarts[thePartition + 1]; ++anOrderIter)
+      {
+        const Standard_Integer aNodeIndex = myBatch.Order[anOrderIter];
+        const NCollection_Vec3<float>& aNode = myBatch.Nodes[aNodeIndex];
+        if (MergedNode* aMerged = aMap.ChangeSeek (aNode))
+        {
+          if (aMerged->BatchIndex >= 0)
+          {
+            myBatch.Refs[aNodeIndex] = aMerged->BatchIndex;
+          }
+          else
+          {
+            myBatch.Refs[aNodeIndex] = -1;
+            myBatch.NodeIds[aNodeIndex] = aMerged->Id;
+          }
+        }
+        else
+        {
+          myBatch.Slots[aNodeIndex] = aMap.Bound (aNode, MergedNode (-1, aNodeIndex));
+          myBatch.Refs[aNodeIndex] = aNodeIndex;
+        }
+      }
+    }
+
+  private:
+    BinaryMergeFunctor& operator= (const BinaryMergeFunctor& );
+  private:
+    BinaryBatch& myBatch;
+    std::vector<MergedNodeMap>& myMaps;
+  };
+
 }
 
 //==============================================================================
@@ -125,7 +277,8 @@ namespace
 //==============================================================================
 RWStl_Reader::RWStl_Reader()
 : myMergeAngle (M_PI/2.0),
-  myMergeTolearance (0.0)
+  myMergeTolearance (0.0),
+  myToParallel (false)
 {
   //
 }
@@ -429,6 +582,10 @@ Standard_Boolean RWStl_Reader::ReadBinary (Standard_IStream& theStream,
 
   // number of facets is stored as 32-bit integer at position 80
   const Standard_Integer aNbFacets = *(int32_t*)(aHeader + 80);
+  if (myToParallel)
+  {
+    return readBinaryParallel (theStream, aNbFacets, theProgress);
+  }
 
   MergeNodeTool aMergeTool (this, aNbFacets);
   aMergeTool.SetMergeAngle (myMergeAngle);
@@ -477,3 +634,136 @@ Standard_Boolean RWStl_Reader::ReadBinary (Standard_IStream& theStream,
 
   return aPS.More();
 }
+
+//==============================================================================
+//function : readBinaryParallel
+//purpose  :
+//==============================================================================
+Standard_Boolean RWStl_Reader::readBinaryParallel (Standard_IStream& theStream,
+                                                   const Standard_Integer theNbFacets,
+                                                   const Message_ProgressRange& theProgress)
+{
+  // exactly coincident nodes are merged in parallel within partitions defined by hash of coordinates;
+  // merging with tolerance or angle depends on the order of triangles and is done by sequential tool
+  const bool isNoMerge    = (float )myMergeAngle <= 0.0f
+                         && (float )myMergeTolearance <= 0.0f;
+  const bool isExactMerge = !isNoMerge
+                         && (float )myMergeTolearance <= 0.0f
+                         && (float )Cos (myMergeAngle) <= 0.01f;
+  Handle(MergeNodeTool) aMergeTool;
+  if (!isNoMerge && !isExactMerge)
+  {
+    aMergeTool = new MergeNodeTool (this, theNbFacets);
+    aMergeTool->SetMergeAngle (myMergeAngle);
+    aMergeTool->SetMergeTolerance (myMergeTolearance);
+  }
+
+  Message_ProgressScope aPS (theProgress, "Reading binary STL file", theNbFacets);
+  const Standard_Integer aBatchNbFacets = Max (0, Min (theNbFacets, THE_PARALLEL_BATCH_NBFACETS));
+  std::vector<char> aBuffer (size_t(aBatchNbFacets) * THE_STL_SIZEOF_FACET);
+  BinaryBatch aBatch;
+  aBatch.Data = aBuffer.data();
+  aBatch.Nodes  .resize (size_t(aBatchNbFacets) * 3);
+  aBatch.NodeIds.resize (size_t(aBatchNbFacets) * 3);
+  std::vector<MergedNodeMap> aMaps;
+  if (isExactMerge)
+  {
+    aBatch.Partitions.resize (size_t(aBatchNbFacets) * 3);
+    aBatch.Order     .resize (size_t(aBatchNbFacets) * 3);
+    aBatch.Refs      .resize (size_t(aBatchNbFacets) * 3);
+    aBatch.Slots     .resize (size_t(aBatchNbFacets) * 3);
+    aBatch.PartStarts.resize (THE_PARALLEL_NB_PARTITIONS + 1);
+    aMaps.resize (THE_PARALLEL_NB_PARTITIONS);
+    for (Standard_Integer aPartIter = 0; aPartIter < THE_PARALLEL_NB_PARTITIONS; ++aPartIter)
+    {
+      // consider ratio 1:2 (NbTriangles:MergedNodes) as expected
+      aMaps[aPartIter].ReSize (theNbFacets / THE_PARALLEL_NB_PARTITIONS / 2 + 1);
+    }
+  }
+
+  for (Standard_Integer aNbFacetRead = 0; aNbFacetRead < theNbFacets && aPS.More(); )
+  {
+    const Standard_Integer aNbToRead   = Min (aBatchNbFacets, theNbFacets - aNbFacetRead);
+    const std::streamsize  aDataToRead = std::streamsize(aNbToRead) * THE_STL_SIZEOF_FACET;
+    const std::streamsize  aDataRead   = theStream.read (aBuffer.data(), aDataToRead).gcount();
+    aBatch.NbFacets = Standard_Integer(aDataRead / std::streamsize(THE_STL_SIZEOF_FACET));
+
+    const Standard_Integer aNbBlocks = (aBatch.NbFacets + THE_PARALLEL_BLOCK_NBFACETS - 1) / THE_PARALLEL_BLOCK_NBFACETS;
+    OSD_Parallel::For (0, aNbBlocks, BinaryDecodeFunctor (aBatch, isExactMerge), aNbBlocks < 2);
+    const Standard_Integer aNbNodes = aBatch.NbFacets * 3;
+    if (isExactMerge)
+    {
+      // sort nodes by partitions keeping the order of the file within each partition
+      std::fill (aBatch.PartStarts.begin(), aBatch.PartStarts.end(), 0);
+      for (Standard_Integer aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+      {
+        ++aBatch.PartStarts[aBatch.Partitions[aNodeIter] + 1];
+      }
+      for (Standard_Integer aPartIter = 0; aPartIter < THE_PARALLEL_NB_PARTITIONS; ++aPartIter)
+      {
+        aBatch.PartStarts[aPartIter + 1] += aBatch.PartStarts[aPartIter];
+      }
+      std::vector<Standard_Integer> aPartCursors (aBatch.PartStarts.begin(), aBatch.PartStarts.end() - 1);
+      for (Standard_Integer aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+      {
+        aBatch.Order[aPartCursors[aBatch.Partitions[aNodeIter]]++] = aNodeIter;
+      }
+      OSD_Parallel::For (0, THE_PARALLEL_NB_PARTITIONS, BinaryMergeFunctor (aBatch, aMaps), aNbBlocks < 2);
+    }
+
+    // pass nodes and triangles to the reader in the order of the file
+    for (Standard_Integer aFacetIter = 0; aFacetIter < aBatch.NbFacets; ++aFacetIter)
+    {
+      const NCollection_Vec3<float>* aNodes = &aBatch.Nodes[aFacetIter * 3];
+      if (!aMergeTool.IsNull())
+      {
+        const gp_XYZ aTriNodes[3] =
+        {
+          gp_XYZ (aNodes[0].x(), aNodes[0].y(), aNodes[0].z()),
+          gp_XYZ (aNodes[1].x(), aNodes[1].y(), aNodes[1].z()),
+          gp_XYZ (aNodes[2].x(), aNodes[2].y(), aNodes[2].z())
+        };
+        aMergeTool->AddTriangle (aTriNodes);
+        continue;
+      }
+
+      Standard_Integer* aNodeIds = &aBatch.NodeIds[aFacetIter * 3];
+      for (Standard_Integer aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+      {
+        const Standard_Integer aNodeIndex = aFacetIter * 3 + aNodeIter;
+        const Standard_Integer aRef = isExactMerge ? aBatch.Refs[aNodeIndex] : aNodeIndex;
+        if (aRef == aNodeIndex)
+        {
+          const NCollection_Vec3<float>& aNode = aNodes[aNodeIter];
+          aNodeIds[aNodeIter] = AddNode (gp_XYZ (aNode.x(), aNode.y(), aNode.z()));
+          if (isExactMerge)
+          {
+            MergedNode* aMerged = aBatch.Slots[aNodeIndex];
+            aMerged->Id = aNodeIds[aNodeIter];
+            aMerged->BatchIndex = -1;
+          }
+        }
+        else if (aRef >= 0)
+        {
+          aNodeIds[aNodeIter] = aBatch.NodeIds[aRef];
+        }
+      }
+      if (aNodeIds[0] != aNodeIds[1]
+       && aNodeIds[1] != aNodeIds[2]
+       && aNodeIds[2] != aNodeIds[0])
+      {
+        AddTriangle (aNodeIds[0], aNodeIds[1], aNodeIds[2]);
+      }
+    }
+
+    aNbFacetRead += aNbToRead;
+    aPS.Next (aNbToRead);
+    if (aDataRead != aDataToRead)
+    {
+      Message::SendFail ("Error: binary STL read failed");
+      return false;
+    }
+  }
+
+  return aPS.More();
+}
@@ -30,6 +30,11 @@ class Message_ProgressRange;
 //! Call method Read() to read the file. In the process of reading, the tool will call methods addNode() and addTriangle() to fill the mesh data structure.
 //!
 //! The nodes with equal coordinates are merged automatically  on the fly.
+//!
+//! In parallel mode (see SetParallel()), the facets of binary file are read by large batches and decoded concurrently.
+//! Exactly coincident nodes are then merged concurrently within partitions of the nodes defined by hash of coordinates,
+//! while the callbacks are still called from the calling thread in the order of the file.
+//! The result is the same as in sequential mode for well-formed files.
 class RWStl_Reader : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
@@ -103,10 +108,26 @@ public:
   //! Set linear merge tolerance.
   void SetMergeTolerance (double theTolerance) { myMergeTolearance = theTolerance; }
 
+  //! Return TRUE if binary data should be decoded in parallel threads; FALSE by default.
+  //! Nodes are merged in parallel threads only with zero merge tolerance and merge angle M_PI/2 (or zero),
+  //! as merging with tolerance or angle depends on the order of triangles.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Set flag to decode binary data and merge nodes in parallel threads.
+  void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
+
+private:
+
+  //! Read facets of binary file by batches decoded in parallel threads.
+  Standard_Boolean readBinaryParallel (Standard_IStream& theStream,
+                                       const Standard_Integer theNbFacets,
+                                       const Message_ProgressRange& theProgress);
+
 protected:
 
   Standard_Real myMergeAngle;
   Standard_Real myMergeTolearance;
+  bool          myToParallel;
 
 };
 
@@ -20,11 +20,15 @@
 #include <Geom_CartesianPoint.hxx>
 #include <Geom_Plane.hxx>
 #include <Interface_EntityIterator.hxx>
+#include <Interface_HGraph.hxx>
 #include <StepData_StepModel.hxx>
 #include <HeaderSection_FileSchema.hxx>
 #include <Interface_Static.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_DataMap.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
 #include <OSD_Path.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <StepBasic_ConversionBasedUnitAndLengthUnit.hxx>
@@ -184,11 +188,14 @@
 #include <TDF_Label.hxx>
 #include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
+#include <TNaming_Builder.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
+#include <TopTools_DataMapOfShapeShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
 #include <Transfer_Binder.hxx>
 #include <Transfer_TransientProcess.hxx>
@@ -295,7 +302,8 @@ STEPCAFControl_Reader::STEPCAFControl_Reader()
   mySHUOMode(Standard_False),
   myGDTMode(Standard_True),
   myMatMode(Standard_True),
-  myViewMode(Standard_True)
+  myViewMode(Standard_True),
+  myDeferredShapeMode(Standard_False)
 {
   STEPCAFControl_Controller::Init();
   if (!myReader.WS().IsNull())
@@ -320,7 +328,8 @@ STEPCAFControl_Reader::STEPCAFControl_Reader(const Handle(XSControl_WorkSession)
   mySHUOMode(Standard_False),
   myGDTMode(Standard_True),
   myMatMode(Standard_True),
-  myViewMode(Standard_True)
+  myViewMode(Standard_True),
+  myDeferredShapeMode(Standard_False)
 {
   STEPCAFControl_Controller::Init();
   Init(WS, scratch);
@@ -347,6 +356,7 @@ void STEPCAFControl_Reader::Init(const Handle(XSControl_WorkSession)& WS,
   myReader.SetWS(WS, scratch);
   myFiles.Clear();
   myMap.Clear();
+  myDeferredItems.Clear();
 }
 
 //=======================================================================
@@ -427,6 +437,237 @@ Standard_Boolean STEPCAFControl_Reader::Transfer (const Handle(TDocStd_Document)
   return Transfer (myReader, 0, doc, Lseq, Standard_False, theProgress);
 }
 
+namespace
+{
+  //! Collects placeholders of deferred items within the shape.
+  static void collectDeferredShapes (const TopoDS_Shape& theShape,
+                                     const STEPControl_ActorRead::IndexedDataMapOfDeferredItem& theItems,
+                                     TopTools_IndexedMapOfShape& thePlaceholders)
+  {
+    if (theShape.IsNull()
+     || theShape.ShapeType() != TopAbs_COMPOUND)
+    {
+      return;
+    }
+
+    const TopoDS_Shape aShape = theShape.Located (TopLoc_Location());
+    if (theItems.Contains (aShape))
+    {
+      thePlaceholders.Add (aShape);
+      return;
+    }
+    for (TopoDS_Iterator anIter (theShape, Standard_False, Standard_False); anIter.More(); anIter.Next())
+    {
+      collectDeferredShapes (anIter.Value(), theItems, thePlaceholders);
+    }
+  }
+
+  //! Returns a copy of the shape with placeholders replaced by translated geometry.
+  static TopoDS_Shape substituteDeferredShapes (const TopoDS_Shape& theShape,
+                                                const TopTools_DataMapOfShapeShape& theResults)
+  {
+    if (theShape.IsNull()
+     || theShape.ShapeType() != TopAbs_COMPOUND)
+    {
+      return theShape;
+    }
+
+    if (const TopoDS_Shape* aResult = theResults.Seek (theShape.Located (TopLoc_Location())))
+    {
+      TopoDS_Shape aShape = aResult->Moved (theShape.Location());
+      aShape.Compose (theShape.Orientation());
+      return aShape;
+    }
+
+    BRep_Builder aBuilder;
+    TopoDS_Compound aComp;
+    aBuilder.MakeCompound (aComp);
+    Standard_Boolean isModified = Standard_False;
+    for (TopoDS_Iterator anIter (theShape, Standard_False, Standard_False); anIter.More(); anIter.Next())
+    {
+      const TopoDS_Shape aSubShape = substituteDeferredShapes (anIter.Value(), theResults);
+      isModified = isModified || !aSubShape.IsEqual (anIter.Value());
+      aBuilder.Add (aComp, aSubShape);
+    }
+    if (!isModified)
+    {
+      return theShape;
+    }
+    aComp.Location (theShape.Location());
+    aComp.Orientation (theShape.Orientation());
+    return aComp;
+  }
+
+  //! Functor translating deferred items in parallel threads.
+  class DeferredItemFunctor
+  {
+  public:
+
+    //! Main constructor.
+    DeferredItemFunctor (const NCollection_Array1<STEPControl_ActorRead::DeferredItem>& theItems,
+                         const NCollection_Array1<Message_ProgressRange>& theRanges,
+                         const Handle(StepData_StepModel)& theModel,
+                         const Handle(Interface_HGraph)& theGraph,
+                         NCollection_Array1<TopoDS_Shape>& theResults)
+    : myItems (theItems),
+      myRanges (theRanges),
+      myModel (theModel),
+      myGraph (theGraph),
+      myResults (theResults) {}
+
+    //! Translates the item with the given index using its own actor and transient process.
+    void operator() (const Standard_Integer theIndex) const
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        Handle(Transfer_TransientProcess) aTP = new Transfer_TransientProcess (100);
+        aTP->SetModel (myModel);
+        aTP->SetGraph (myGraph);
+        aTP->SetTraceLevel (0);
+        Handle(STEPControl_ActorRead) anActor = new STEPControl_ActorRead (myModel);
+        aTP->SetActor (anActor);
+        myResults.ChangeValue (theIndex) = anActor->TransferDeferredItem (myItems.Value (theIndex), aTP, myRanges.Value (theIndex));
+      }
+      catch (Standard_Failure const&)
+      {
+        myResults.ChangeValue (theIndex).Nullify();
+      }
+    }
+
+  private:
+    DeferredItemFunctor& operator= (const DeferredItemFunctor&);
+
+  private:
+    const NCollection_Array1<STEPControl_ActorRead::DeferredItem>& myItems;
+    const NCollection_Array1<Message_ProgressRange>& myRanges;
+    Handle(StepData_StepModel)       myModel;
+    Handle(Interface_HGraph)         myGraph;
+    NCollection_Array1<TopoDS_Shape>& myResults;
+  };
+}
+
+//=======================================================================
+//function : TransferDeferredShapes
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean STEPCAFControl_Reader::TransferDeferredShapes (const Handle(TDocStd_Document)& theDoc,
+                                                                const TDF_LabelSequence& theLabels,
+                                                                const Message_ProgressRange& theProgress)
+{
+  if (theDoc.IsNull())
+  {
+    return Standard_False;
+  }
+
+  TopTools_IndexedMapOfShape aPlaceholders;
+  if (theLabels.IsEmpty())
+  {
+    for (Standard_Integer anIndex = 1; anIndex <= myDeferredItems.Extent(); ++anIndex)
+    {
+      aPlaceholders.Add (myDeferredItems.FindKey (anIndex));
+    }
+  }
+  else
+  {
+    for (TDF_LabelSequence::Iterator aLabIter (theLabels); aLabIter.More(); aLabIter.Next())
+    {
+      collectDeferredShapes (XCAFDoc_ShapeTool::GetShape (aLabIter.Value()), myDeferredItems, aPlaceholders);
+    }
+  }
+  if (aPlaceholders.IsEmpty())
+  {
+    return Standard_True;
+  }
+
+  Handle(StepData_StepModel) aModel = Handle(StepData_StepModel)::DownCast (myReader.Model());
+  const Handle(Transfer_TransientProcess)& aMainTP = myReader.WS()->TransferReader()->TransientProcess();
+  if (aModel.IsNull())
+  {
+    return Standard_False;
+  }
+
+  Message_ProgressScope aPSRoot (theProgress, "Transferring deferred shapes", 2);
+  const Standard_Integer aNbItems = aPlaceholders.Extent();
+  NCollection_Array1<STEPControl_ActorRead::DeferredItem> anItems (1, aNbItems);
+  NCollection_Array1<Message_ProgressRange> aRanges (1, aNbItems);
+  NCollection_Array1<TopoDS_Shape> aResults (1, aNbItems);
+  {
+    Message_ProgressScope aPS (aPSRoot.Next(), NULL, aNbItems);
+    for (Standard_Integer anIndex = 1; anIndex <= aNbItems; ++anIndex)
+    {
+      anItems.ChangeValue (anIndex) = myDeferredItems.FindFromKey (aPlaceholders.FindKey (anIndex));
+      aRanges.ChangeValue (anIndex) = aPS.Next();
+    }
+    // the graph of the model is shared between threads for read-only access
+    Handle(Interface_HGraph) aGraph = !aMainTP.IsNull() && aMainTP->HasGraph()
+                                    ? aMainTP->HGraph()
+                                    : new Interface_HGraph (aModel);
+    DeferredItemFunctor aFunctor (anItems, aRanges, aModel, aGraph, aResults);
+    OSD_Parallel::For (1, aNbItems + 1, aFunctor, aNbItems == 1);
+  }
+  if (aPSRoot.UserBreak())
+  {
+    return Standard_False;
+  }
+
+  Standard_Boolean isDone = Standard_True;
+  TopTools_DataMapOfShapeShape aShapeMap;
+  for (Standard_Integer anIndex = 1; anIndex <= aNbItems; ++anIndex)
+  {
+    if (aResults.Value (anIndex).IsNull())
+    {
+      // keep placeholder
+      isDone = Standard_False;
+      continue;
+    }
+    aShapeMap.Bind (aPlaceholders.FindKey (anIndex), aResults.Value (anIndex));
+    myDeferredItems.RemoveKey (aPlaceholders.FindKey (anIndex));
+  }
+  if (aShapeMap.IsEmpty())
+  {
+    return isDone;
+  }
+
+  // replace placeholders within parts and their sub-shapes
+  Handle(XCAFDoc_ShapeTool) aSTool = XCAFDoc_DocumentTool::ShapeTool (theDoc->Main());
+  TDF_LabelSequence aShapeLabels;
+  aSTool->GetShapes (aShapeLabels);
+  Message_ProgressScope aPS (aPSRoot.Next(), NULL, aShapeLabels.Length());
+  for (TDF_LabelSequence::Iterator aLabIter (aShapeLabels); aLabIter.More() && aPS.More(); aLabIter.Next(), aPS.Next())
+  {
+    const TDF_Label& aLabel = aLabIter.Value();
+    if (XCAFDoc_ShapeTool::IsAssembly (aLabel))
+    {
+      continue;
+    }
+
+    const TopoDS_Shape aShape = XCAFDoc_ShapeTool::GetShape (aLabel);
+    const TopoDS_Shape aNewShape = substituteDeferredShapes (aShape, aShapeMap);
+    if (aNewShape.IsEqual (aShape))
+    {
+      continue;
+    }
+    aSTool->SetShape (aLabel, aNewShape);
+
+    TDF_LabelSequence aSubLabels;
+    XCAFDoc_ShapeTool::GetSubShapes (aLabel, aSubLabels);
+    for (TDF_LabelSequence::Iterator aSubIter (aSubLabels); aSubIter.More(); aSubIter.Next())
+    {
+      const TopoDS_Shape aSubShape = XCAFDoc_ShapeTool::GetShape (aSubIter.Value());
+      const TopoDS_Shape aNewSubShape = substituteDeferredShapes (aSubShape, aShapeMap);
+      if (!aNewSubShape.IsEqual (aSubShape))
+      {
+        TNaming_Builder aBuilder (aSubIter.Value());
+        aBuilder.Generated (aNewSubShape);
+      }
+    }
+  }
+  aSTool->UpdateAssemblies();
+  return isDone;
+}
+
 
 //=======================================================================
 //function : Perform
@@ -601,6 +842,15 @@ Standard_Boolean STEPCAFControl_Reader::Transfer (STEPControl_Reader &reader,
 
   Message_ProgressScope aPSRoot (theProgress, NULL, 2);
 
+  // in deferred shape mode the actor binds placeholders to geometric items
+  Handle(STEPControl_ActorRead) anActor =
+    Handle(STEPControl_ActorRead)::DownCast(reader.WS()->TransferReader()->Actor());
+  if (!anActor.IsNull())
+  {
+    anActor->ClearDeferredItems();
+    anActor->SetDeferGeometry(myDeferredShapeMode);
+  }
+
   if (nroot) {
     if (nroot > num) return Standard_False;
     reader.TransferOneRoot (nroot, aPSRoot.Next());
@@ -610,6 +860,14 @@ Standard_Boolean STEPCAFControl_Reader::Transfer (STEPControl_Reader &reader,
     for (i = 1; i <= num && aPS.More(); i++)
       reader.TransferOneRoot (i, aPS.Next());
   }
+  if (!anActor.IsNull())
+  {
+    const STEPControl_ActorRead::IndexedDataMapOfDeferredItem& aDeferredItems = anActor->DeferredItems();
+    for (i = 1; i <= aDeferredItems.Extent(); i++)
+      myDeferredItems.Add(aDeferredItems.FindKey(i), aDeferredItems.FindFromIndex(i));
+    anActor->ClearDeferredItems();
+    anActor->SetDeferGeometry(Standard_False);
+  }
   if (aPSRoot.UserBreak())
     return Standard_False;
 
@@ -5368,6 +5626,26 @@ Standard_Boolean STEPCAFControl_Reader::GetViewMode() const
   return myViewMode;
 }
 
+//=======================================================================
+//function : SetDeferredShapeMode
+//purpose  : 
+//=======================================================================
+
+void STEPCAFControl_Reader::SetDeferredShapeMode(const Standard_Boolean theToDefer)
+{
+  myDeferredShapeMode = theToDefer;
+}
+
+//=======================================================================
+//function : GetDeferredShapeMode
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean STEPCAFControl_Reader::GetDeferredShapeMode() const
+{
+  return myDeferredShapeMode;
+}
+
 //=======================================================================
 //function : ReadMetadata
 //purpose  : 
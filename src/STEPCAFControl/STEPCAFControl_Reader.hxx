@@ -16,6 +16,7 @@
 #ifndef _STEPCAFControl_Reader_HeaderFile
 #define _STEPCAFControl_Reader_HeaderFile
 
+#include <STEPControl_ActorRead.hxx>
 #include <STEPControl_Reader.hxx>
 #include <StepData_Factors.hxx>
 #include <IFSelect_ReturnStatus.hxx>
@@ -116,6 +117,21 @@ public:
   //! Provided for use like single-file reader
   Standard_EXPORT Standard_Boolean Transfer (const Handle(TDocStd_Document)& doc,
                                              const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Translates geometry of parts which transfer has been deferred (see SetDeferredShapeMode())
+  //! and replaces their placeholders in the document; the geometry is translated in parallel threads.
+  //! Should be called before the next file is loaded into the reader.
+  //! @param[in] theDoc      document filled by Transfer() of this reader
+  //! @param[in] theLabels   labels of parts and assemblies which geometry should be translated;
+  //!                        geometry of all deferred parts is translated if the sequence is empty
+  //! @param[in] theProgress progress indicator
+  //! @return FALSE if geometry of some parts cannot be translated
+  Standard_EXPORT Standard_Boolean TransferDeferredShapes (const Handle(TDocStd_Document)& theDoc,
+                                                           const TDF_LabelSequence& theLabels = TDF_LabelSequence(),
+                                                           const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Returns number of geometric items which transfer is still deferred.
+  Standard_Integer NbDeferredShapes() const { return myDeferredItems.Extent(); }
   
   Standard_EXPORT Standard_Boolean Perform (const TCollection_AsciiString& filename,
                                             const Handle(TDocStd_Document)& doc,
@@ -207,6 +223,16 @@ public:
   //! Get View mode
   Standard_EXPORT Standard_Boolean GetViewMode() const;
 
+  //! Set deferred shape mode: if TRUE, Transfer() builds assembly structure, placements, names
+  //! and other attributes, while solid, shell and face based models of parts are represented by
+  //! empty compounds until TransferDeferredShapes() is called.
+  //! Colors and layers assigned to sub-shapes of such models are not read in this mode.
+  //! FALSE by default.
+  Standard_EXPORT void SetDeferredShapeMode (const Standard_Boolean theToDefer);
+
+  //! Get deferred shape mode
+  Standard_EXPORT Standard_Boolean GetDeferredShapeMode() const;
+
   const XCAFDoc_DataMapOfShapeLabel& GetShapeLabelMap() const { return myMap; }
 
 protected:
@@ -374,7 +400,9 @@ private:
   Standard_Boolean myGDTMode;
   Standard_Boolean myMatMode;
   Standard_Boolean myViewMode;
+  Standard_Boolean myDeferredShapeMode;
   NCollection_DataMap<Handle(Standard_Transient), TDF_Label> myGDTMap;
+  STEPControl_ActorRead::IndexedDataMapOfDeferredItem myDeferredItems;
 
 };
 
@@ -215,7 +215,8 @@ namespace {
 STEPControl_ActorRead::STEPControl_ActorRead(const Handle(Interface_InterfaceModel)& theModel)
 : myPrecision(0.0),
   myMaxTol(0.0),
-  myModel(theModel)
+  myModel(theModel),
+  myToDeferGeometry(Standard_False)
 {
 }
 
@@ -909,7 +910,23 @@ Handle(TransferBRep_ShapeBinder) STEPControl_ActorRead::TransferEntity(
       }
     }
     Handle(Transfer_Binder) binder;
-    if (!TP->IsBound(anitem)) {
+    if (!TP->IsBound(anitem)
+      && myToDeferGeometry && isManifold
+      && (anitem->IsKind(STANDARD_TYPE(StepShape_ManifoldSolidBrep))
+       || anitem->IsKind(STANDARD_TYPE(StepShape_ShellBasedSurfaceModel))
+       || anitem->IsKind(STANDARD_TYPE(StepShape_FaceBasedSurfaceModel))))
+    {
+      // bind empty compound to be replaced by the geometry transferred on demand
+      TopoDS_Compound aPlaceholder;
+      B.MakeCompound(aPlaceholder);
+      DeferredItem aDeferredItem;
+      aDeferredItem.Item = anitem;
+      aDeferredItem.Representation = sr;
+      myDeferredItems.Add(aPlaceholder, aDeferredItem);
+      binder = new TransferBRep_ShapeBinder(aPlaceholder);
+      TP->Bind(anitem, binder);
+    }
+    else if (!TP->IsBound(anitem)) {
       binder = TransferShape(anitem, TP, aLocalFactors, isManifold, Standard_False, aRange);
     }
     else {
@@ -1845,6 +1862,31 @@ Handle(Transfer_Binder) STEPControl_ActorRead::TransferShape(
   
   return shbinder;
 }
+
+//=======================================================================
+//function : TransferDeferredItem
+//purpose  : 
+//=======================================================================
+
+TopoDS_Shape STEPControl_ActorRead::TransferDeferredItem (const DeferredItem& theItem,
+                                                          const Handle(Transfer_TransientProcess)& theTP,
+                                                          const Message_ProgressRange& theProgress)
+{
+  Handle(StepData_StepModel) aStepModel = Handle(StepData_StepModel)::DownCast(theTP->Model());
+  if (theItem.Item.IsNull() || aStepModel.IsNull())
+  {
+    return TopoDS_Shape();
+  }
+
+  StepData_Factors aLocalFactors;
+  aLocalFactors.SetCascadeUnit(aStepModel->LocalLengthUnit());
+  PrepareUnits(theItem.Representation, theTP, aLocalFactors);
+  Handle(Transfer_Binder) aBinder = TransferShape(theItem.Item, theTP, aLocalFactors,
+                                                  Standard_True, Standard_False, theProgress);
+  PrepareUnits(Handle(StepRepr_Representation)(), theTP, aLocalFactors);
+  return TransferBRep::ShapeResult(aBinder);
+}
+
 // ============================================================================
 // Method  : STEPControl_ActorRead::PrepareUnits
 // Purpose : Set the unit conversion factors
@@ -28,8 +28,11 @@
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <Message_ProgressRange.hxx>
 #include <Interface_InterfaceModel.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <StepRepr_Representation.hxx>
+#include <StepRepr_RepresentationItem.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
 
-class StepRepr_Representation;
 class Standard_Transient;
 class Transfer_Binder;
 class Transfer_TransientProcess;
@@ -63,6 +66,18 @@ DEFINE_STANDARD_HANDLE(STEPControl_ActorRead, Transfer_ActorOfTransientProcess)
 class STEPControl_ActorRead : public Transfer_ActorOfTransientProcess
 {
 
+public:
+
+  //! Geometric representation item which transfer has been deferred.
+  struct DeferredItem
+  {
+    Handle(StepRepr_RepresentationItem) Item;           //!< geometric representation item
+    Handle(StepRepr_Representation)     Representation; //!< representation defining units of the item
+  };
+
+  //! Map of placeholder shapes to the deferred items.
+  typedef NCollection_IndexedDataMap<TopoDS_Shape, DeferredItem, TopTools_ShapeMapHasher> IndexedDataMapOfDeferredItem;
+
 public:
 
   Standard_EXPORT STEPControl_ActorRead(const Handle(Interface_InterfaceModel)& theModel);
@@ -96,6 +111,31 @@ public:
   //! Set model
   Standard_EXPORT void SetModel(const Handle(Interface_InterfaceModel)& theModel);
 
+  //! Returns TRUE if transfer of geometry of shape representations is deferred; FALSE by default.
+  Standard_Boolean ToDeferGeometry() const { return myToDeferGeometry; }
+
+  //! Sets flag to defer transfer of solid, shell and face based models of manifold shape representations.
+  //! Each such item is bound to an empty compound (placeholder) registered in DeferredItems(),
+  //! while product structure and placements are transferred as usual;
+  //! the geometry can be transferred later with TransferDeferredItem().
+  void SetDeferGeometry (const Standard_Boolean theToDefer) { myToDeferGeometry = theToDefer; }
+
+  //! Returns the map of placeholders to the items which transfer has been deferred.
+  const IndexedDataMapOfDeferredItem& DeferredItems() const { return myDeferredItems; }
+
+  //! Clears the map of deferred items.
+  void ClearDeferredItems() { myDeferredItems.Clear(); }
+
+  //! Transfers the geometric item which transfer has been deferred,
+  //! taking units and tolerances from its representation.
+  //! @param[in] theItem     deferred item
+  //! @param[in] theTP       transient process of the model
+  //! @param[in] theProgress progress indicator
+  //! @return resulting shape or null shape on failure
+  Standard_EXPORT TopoDS_Shape TransferDeferredItem (const DeferredItem& theItem,
+                                                     const Handle(Transfer_TransientProcess)& theTP,
+                                                     const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   //! Computes transformation defined by two axis placements (in MAPPED_ITEM
   //! or ITEM_DEFINED_TRANSFORMATION) taking into account their
   //! representation contexts (i.e. units, which may be different)
@@ -226,6 +266,8 @@ private:
   Standard_Real myMaxTol;
   Handle(StepRepr_Representation) mySRContext;
   Handle(Interface_InterfaceModel) myModel;
+  IndexedDataMapOfDeferredItem myDeferredItems;
+  Standard_Boolean myToDeferGeometry;
 
 };
 
@@ -26,12 +26,17 @@
 #include <Geom_Plane.hxx>
 #include <Geom_Surface.hxx>
 #include <GeomToStep_MakeAxis2Placement3d.hxx>
+#include <Interface_Check.hxx>
 #include <Interface_Macros.hxx>
 #include <Interface_MSG.hxx>
 #include <Interface_Static.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_ShapeTolerance.hxx>
 #include <ShapeProcess_ShapeContext.hxx>
+#include <Standard_ErrorHandler.hxx>
 #include <Standard_Type.hxx>
 #include <StepBasic_ApplicationProtocolDefinition.hxx>
 #include <StepBasic_HArray1OfProduct.hxx>
@@ -66,6 +71,7 @@
 #include <StepVisual_TessellatedSolid.hxx>
 #include <TCollection_HAsciiString.hxx>
 #include <TColStd_HSequenceOfTransient.hxx>
+#include <TColStd_PackedMapOfInteger.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -82,6 +88,7 @@
 #include <TopoDSToStep_MakeShellBasedSurfaceModel.hxx>
 #include <TopoDSToStep_MakeStepVertex.hxx>
 #include <TopoDSToStep_Tool.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
 #include <TopTools_HSequenceOfShape.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
@@ -519,6 +526,24 @@ Standard_Boolean  STEPControl_ActorWrite::Recognize (const Handle(Transfer_Finde
 
 //  ########    MAKE PRODUCT DATA + CONTEXT    ########
 
+//=======================================================================
+//function : initLocalFactors
+//purpose  : initializes conversion factors from units of the model
+//=======================================================================
+static void initLocalFactors (const Handle(StepData_StepModel)& theModel,
+                              StepData_Factors& theLocalFactors)
+{
+  if (!theModel->IsInitializedUnit())
+  {
+    XSAlgo::AlgoContainer()->PrepareForTransfer(); // update unit info
+    theModel->SetLocalLengthUnit(UnitsMethods::GetCasCadeLengthUnit());
+  }
+  Standard_Real aLFactor = theModel->WriteLengthUnit();
+  aLFactor /= theModel->LocalLengthUnit();
+  const Standard_Integer anglemode = theModel->InternalParameters.AngleUnit;
+  theLocalFactors.InitializeFactors(aLFactor, (anglemode <= 1 ? 1. : M_PI / 180.), 1.);
+}
+
 //=======================================================================
 //function : Transfer
 //purpose  : 
@@ -538,16 +563,8 @@ Handle(Transfer_Binder) STEPControl_ActorWrite::Transfer (const Handle(Transfer_
   if ( ! model.IsNull() ) myContext.SetModel ( model ); //: abv 04.11.00: take APD from model
   myContext.AddAPD ( Standard_False ); // update APD
   myContext.SetLevel ( 1 ); // set assembly level to 1 (to ensure)
-  if (!model->IsInitializedUnit())
-  {
-    XSAlgo::AlgoContainer()->PrepareForTransfer(); // update unit info
-    model->SetLocalLengthUnit(UnitsMethods::GetCasCadeLengthUnit());
-  }
-  Standard_Real aLFactor = model->WriteLengthUnit();
-  aLFactor /= model->LocalLengthUnit();
-  const Standard_Integer anglemode = model->InternalParameters.AngleUnit;
   StepData_Factors aLocalFactors;
-  aLocalFactors.InitializeFactors(aLFactor, (anglemode <= 1 ? 1. : M_PI / 180.), 1.);
+  initLocalFactors (model, aLocalFactors);
   // create SDR
   STEPConstruct_Part SDRTool;
   SDRTool.MakeSDR ( 0, myContext.GetProductName(), myContext.GetAPD()->Application(), model);
@@ -690,6 +707,288 @@ static Standard_Boolean transferVertex (const Handle(Transfer_FinderProcess)& FP
   return IsDone;
 }
 
+//=======================================================================
+//function : transferManifoldSolid
+//purpose  : converts solid into manifold solid brep or brep with voids
+//=======================================================================
+static void transferManifoldSolid (const TopoDS_Solid& theSolid,
+                                   const Handle(Transfer_FinderProcess)& theFP,
+                                   const StepData_Factors& theLocalFactors,
+                                   const Standard_Real theTol,
+                                   Handle(StepGeom_GeometricRepresentationItem)& theItem,
+                                   Handle(StepGeom_GeometricRepresentationItem)& theItemTess,
+                                   const Message_ProgressRange& theProgress)
+{
+  Message_ProgressScope aPS (theProgress, NULL, 1);
+
+  //:d6 abv 13 Mar 98: if solid has more than 1 shell, 
+  // try to treat it as solid with voids
+  Standard_Integer nbShells = 0;
+  for ( TopoDS_Iterator It ( theSolid ); It.More(); It.Next() ) 
+    if (It.Value().ShapeType() == TopAbs_SHELL) nbShells++;
+  if ( nbShells >1 ) {
+    TopoDSToStep_MakeBrepWithVoids MkBRepWithVoids(theSolid, theFP, theLocalFactors, aPS.Next());
+    MkBRepWithVoids.Tolerance() = theTol;
+    if (MkBRepWithVoids.IsDone()) 
+    {
+      theItem = MkBRepWithVoids.Value();
+      theItemTess = MkBRepWithVoids.TessellatedValue();
+    }
+    else nbShells = 1; //smth went wrong; let it will be just Manifold
+  }
+  if ( nbShells ==1 ) {
+    TopoDSToStep_MakeManifoldSolidBrep MkManifoldSolidBrep(theSolid, theFP, theLocalFactors, aPS.Next());
+    MkManifoldSolidBrep.Tolerance() = theTol;
+    if (MkManifoldSolidBrep.IsDone()) 
+    {
+      theItem = MkManifoldSolidBrep.Value();
+      theItemTess = MkManifoldSolidBrep.TessellatedValue();
+    }
+  }
+}
+
+//=======================================================================
+//class    : PrepareItemFunctor
+//purpose  : converts solids into STEP entities in parallel threads
+//=======================================================================
+class STEPControl_ActorWrite::PrepareItemFunctor
+{
+public:
+
+  //! Main constructor.
+  PrepareItemFunctor (NCollection_DataMap<TopoDS_Shape, PreparedItem>& theItems,
+                      const NCollection_Array1<TopoDS_Shape>& theSolids,
+                      const NCollection_Array1<Message_ProgressRange>& theRanges,
+                      const Handle(StepData_StepModel)& theModel,
+                      const StepData_Factors& theLocalFactors)
+  : myItems (theItems),
+    mySolids (theSolids),
+    myRanges (theRanges),
+    myModel (theModel),
+    myLocalFactors (theLocalFactors) {}
+
+  //! Converts the solid with the specified index.
+  void operator() (const Standard_Integer theIndex) const
+  {
+    const TopoDS_Shape& aSolid = mySolids.Value (theIndex);
+    PreparedItem& anItem = myItems.ChangeFind (aSolid);
+    try
+    {
+      OCC_CATCH_SIGNALS
+      Message_ProgressScope aPS (myRanges.Value (theIndex), NULL, 2);
+      anItem.FP = new Transfer_FinderProcess();
+      anItem.FP->SetModel (myModel);
+      anItem.FP->SetTraceLevel (0);
+      anItem.Shape = aSolid;
+      if (hasGeometry (aSolid))
+      {
+        const Standard_Real aMaxTol = myModel->InternalParameters.ReadMaxPrecisionVal;
+        anItem.Shape = XSAlgo::AlgoContainer()->ProcessShape (aSolid, anItem.Tolerance, aMaxTol,
+                                                              "write.step.resource.name",
+                                                              "write.step.sequence", anItem.Info,
+                                                              aPS.Next());
+      }
+      if (anItem.Shape.ShapeType() != TopAbs_SOLID)
+      {
+        return;
+      }
+      transferManifoldSolid (TopoDS::Solid (anItem.Shape), anItem.FP, myLocalFactors, anItem.Tolerance,
+                             anItem.Item, anItem.ItemTess, aPS.Next());
+      anItem.IsDone = !anItem.Item.IsNull() || !anItem.ItemTess.IsNull();
+    }
+    catch (Standard_Failure const&)
+    {
+      // the solid will be converted by sequential Transfer()
+      anItem.IsDone = Standard_False;
+    }
+  }
+
+private:
+  PrepareItemFunctor operator= (const PrepareItemFunctor&);
+
+private:
+  NCollection_DataMap<TopoDS_Shape, PreparedItem>& myItems;
+  const NCollection_Array1<TopoDS_Shape>&          mySolids;
+  const NCollection_Array1<Message_ProgressRange>& myRanges;
+  Handle(StepData_StepModel)                       myModel;
+  const StepData_Factors&                          myLocalFactors;
+};
+
+//=======================================================================
+//function : PrepareTransfer
+//purpose  : 
+//=======================================================================
+void STEPControl_ActorWrite::PrepareTransfer (const TopoDS_Shape& theShape,
+                                              const Handle(StepData_StepModel)& theModel,
+                                              const Message_ProgressRange& theProgress)
+{
+  myPreparedItems.Clear();
+  const STEPControl_StepModelType aMode = Mode();
+  if (theShape.IsNull()
+   || theModel.IsNull()
+   || theModel->InternalParameters.WriteNonmanifold != 0
+   || (aMode != STEPControl_AsIs && aMode != STEPControl_ManifoldSolidBrep))
+  {
+    return;
+  }
+
+  NCollection_Map<TopoDS_Shape> aParts;
+  collectPreparedItems (theModel, theShape, aParts);
+  if (myPreparedItems.IsEmpty())
+  {
+    return;
+  }
+
+  // solids sharing sub-shapes are left to sequential conversion,
+  // as shape processing might modify shared sub-shapes;
+  // the same for solids met within parts of different tolerances
+  NCollection_Array1<TopoDS_Shape> aSolids (1, myPreparedItems.Extent());
+  Standard_Integer aNbSolids = 0;
+  {
+    TopTools_DataMapOfShapeInteger aVertexOwners;
+    TColStd_PackedMapOfInteger aShared;
+    for (NCollection_DataMap<TopoDS_Shape, PreparedItem>::Iterator anIter (myPreparedItems); anIter.More(); anIter.Next())
+    {
+      aSolids.SetValue (++aNbSolids, anIter.Key());
+      if (anIter.Value().Tolerance < 0.0)
+      {
+        aShared.Add (aNbSolids);
+      }
+      for (TopExp_Explorer anExp (anIter.Key(), TopAbs_VERTEX); anExp.More(); anExp.Next())
+      {
+        const TopoDS_Shape aVertex = anExp.Current().Located (TopLoc_Location());
+        if (const Standard_Integer* anOwner = aVertexOwners.Seek (aVertex))
+        {
+          if (*anOwner != aNbSolids)
+          {
+            aShared.Add (*anOwner);
+            aShared.Add (aNbSolids);
+          }
+        }
+        else
+        {
+          aVertexOwners.Bind (aVertex, aNbSolids);
+        }
+      }
+    }
+    aNbSolids = 0;
+    for (Standard_Integer aSolidIter = aSolids.Lower(); aSolidIter <= aSolids.Upper(); ++aSolidIter)
+    {
+      if (aShared.Contains (aSolidIter))
+      {
+        myPreparedItems.UnBind (aSolids.Value (aSolidIter));
+      }
+      else
+      {
+        aSolids.SetValue (++aNbSolids, aSolids.Value (aSolidIter));
+      }
+    }
+  }
+  if (aNbSolids < 2)
+  {
+    myPreparedItems.Clear();
+    return;
+  }
+
+  StepData_Factors aLocalFactors;
+  initLocalFactors (theModel, aLocalFactors);
+
+  // progress ranges are prepared sequentially
+  Message_ProgressScope aPS (theProgress, NULL, aNbSolids);
+  NCollection_Array1<Message_ProgressRange> aRanges (1, aNbSolids);
+  for (Standard_Integer aSolidIter = 1; aSolidIter <= aNbSolids; ++aSolidIter)
+  {
+    aRanges.SetValue (aSolidIter, aPS.Next());
+  }
+
+  const PrepareItemFunctor aFunctor (myPreparedItems, aSolids, aRanges, theModel, aLocalFactors);
+  OSD_Parallel::For (1, aNbSolids + 1, aFunctor);
+}
+
+//=======================================================================
+//function : ClearPreparedTransfer
+//purpose  : 
+//=======================================================================
+void STEPControl_ActorWrite::ClearPreparedTransfer()
+{
+  myPreparedItems.Clear();
+}
+
+//=======================================================================
+//function : collectPreparedItems
+//purpose  : 
+//=======================================================================
+void STEPControl_ActorWrite::collectPreparedItems (const Handle(StepData_StepModel)& theModel,
+                                                   const TopoDS_Shape& theShape,
+                                                   NCollection_Map<TopoDS_Shape>& theParts)
+{
+  TopoDS_Shape aShape = theShape;
+  if (IsAssembly (theModel, aShape))
+  {
+    // sub-shapes are transferred as parts at the origin (see TransferSubShape())
+    for (TopoDS_Iterator anIter (aShape); anIter.More(); anIter.Next())
+    {
+      TopoDS_Shape aSubShape = anIter.Value();
+      aSubShape.Location (TopLoc_Location());
+      collectPreparedItems (theModel, aSubShape, theParts);
+    }
+    return;
+  }
+  if (!theParts.Add (aShape))
+  {
+    return;
+  }
+
+  Handle(StepData_StepModel) aModel = theModel;
+  const Standard_Real aTol = UsedTolerance (aModel, mytoler, aShape);
+  for (TopExp_Explorer anExp (aShape, TopAbs_SOLID); anExp.More(); anExp.Next())
+  {
+    if (PreparedItem* anItem = myPreparedItems.ChangeSeek (anExp.Current()))
+    {
+      if (anItem->Tolerance != aTol)
+      {
+        anItem->Tolerance = -1.0;
+      }
+      continue;
+    }
+    PreparedItem anItem;
+    anItem.Tolerance = aTol;
+    myPreparedItems.Bind (anExp.Current(), anItem);
+  }
+}
+
+//=======================================================================
+//function : mergePreparedItem
+//purpose  : 
+//=======================================================================
+void STEPControl_ActorWrite::mergePreparedItem (const PreparedItem& theItem,
+                                                const Handle(Transfer_FinderProcess)& theFP) const
+{
+  for (Standard_Integer aMapIter = 1; aMapIter <= theItem.FP->NbMapped(); ++aMapIter)
+  {
+    const Handle(Transfer_Binder) aBinder = theItem.FP->MapItem (aMapIter);
+    if (aBinder.IsNull())
+    {
+      continue;
+    }
+    const Handle(Transfer_Finder)& aFinder = theItem.FP->Mapped (aMapIter);
+    Handle(Transfer_Binder) aMainBinder = theFP->Find (aFinder);
+    if (aMainBinder.IsNull())
+    {
+      theFP->Bind (aFinder, aBinder);
+      continue;
+    }
+    if (aBinder->HasResult())
+    {
+      aMainBinder->AddResult (aBinder);
+    }
+    else
+    {
+      aMainBinder->CCheck()->GetMessages (aBinder->Check());
+    }
+  }
+}
+
      
 Handle(Transfer_Binder) STEPControl_ActorWrite::TransferShape
                    (const Handle(Transfer_Finder)& start,
@@ -999,8 +1298,26 @@ Handle(Transfer_Binder) STEPControl_ActorWrite::TransferShape
 
     TopoDS_Shape aShape = xShape;
     Handle(Standard_Transient) info;
+    Handle(StepGeom_GeometricRepresentationItem) item, itemTess;
 
-    if (hasGeometry(aShape)) 
+    // take the solid converted in parallel by PrepareTransfer(), if any
+    const PreparedItem* aPrepared = myPreparedItems.Seek (xShape);
+    const Standard_Boolean isPrepared = aPrepared != NULL
+                                     && aPrepared->IsDone
+                                     && isManifold
+                                     && trmode == STEPControl_ManifoldSolidBrep
+                                     && aPrepared->Tolerance == Tol;
+    if (isPrepared)
+    {
+      mergePreparedItem (*aPrepared, FP);
+      aShape   = aPrepared->Shape;
+      info     = aPrepared->Info;
+      item     = aPrepared->Item;
+      itemTess = aPrepared->ItemTess;
+      // the same solid met once more is converted anew as in sequential mode
+      myPreparedItems.UnBind (xShape);
+    }
+    else if (hasGeometry(aShape)) 
     {
       Standard_Real maxTol = aStepModel->InternalParameters.ReadMaxPrecisionVal;
 
@@ -1018,38 +1335,14 @@ Handle(Transfer_Binder) STEPControl_ActorWrite::TransferShape
     }
 
     // create a STEP entity corresponding to shape
-    Handle(StepGeom_GeometricRepresentationItem) item, itemTess;
+    if (!isPrepared)
     switch (trmode)
       {
       case STEPControl_ManifoldSolidBrep:
 	{
 	  if (aShape.ShapeType() == TopAbs_SOLID) {
-	    TopoDS_Solid aSolid = TopoDS::Solid(aShape);
-
-	    //:d6 abv 13 Mar 98: if solid has more than 1 shell, 
-	    // try to treat it as solid with voids
-	    Standard_Integer nbShells = 0;
-	    for ( TopoDS_Iterator It ( aSolid ); It.More(); It.Next() ) 
-              if (It.Value().ShapeType() == TopAbs_SHELL) nbShells++;
-	    if ( nbShells >1 ) {
-	      TopoDSToStep_MakeBrepWithVoids MkBRepWithVoids(aSolid, FP, theLocalFactors, aPS1.Next());
-	      MkBRepWithVoids.Tolerance() = Tol;
-	      if (MkBRepWithVoids.IsDone()) 
-              {
-		item = MkBRepWithVoids.Value();
-                itemTess = MkBRepWithVoids.TessellatedValue();
-              }
-              else nbShells = 1; //smth went wrong; let it will be just Manifold
-	    }
-	    if ( nbShells ==1 ) {
-              TopoDSToStep_MakeManifoldSolidBrep MkManifoldSolidBrep(aSolid, FP, theLocalFactors, aPS1.Next());
-	      MkManifoldSolidBrep.Tolerance() = Tol;
-	      if (MkManifoldSolidBrep.IsDone()) 
-              {
-		item = MkManifoldSolidBrep.Value();
-                itemTess = MkManifoldSolidBrep.TessellatedValue();
-              }
-            }
+	    transferManifoldSolid (TopoDS::Solid(aShape), FP, theLocalFactors, Tol,
+	                           item, itemTess, aPS1.Next());
 	  }
 	  else if (aShape.ShapeType() == TopAbs_SHELL) {
 	    TopoDS_Shell aShell = TopoDS::Shell(aShape);
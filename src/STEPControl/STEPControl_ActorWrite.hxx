@@ -21,13 +21,17 @@
 #include <Standard_Type.hxx>
 
 #include <Standard_Integer.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Map.hxx>
 #include <STEPConstruct_ContextTool.hxx>
+#include <StepGeom_GeometricRepresentationItem.hxx>
 #include <Transfer_ActorOfFinderProcess.hxx>
+#include <Transfer_FinderProcess.hxx>
+#include <TopoDS_Shape.hxx>
 #include <TopTools_HSequenceOfShape.hxx>
 #include <STEPControl_StepModelType.hxx>
 class Transfer_Finder;
 class Transfer_Binder;
-class Transfer_FinderProcess;
 class StepShape_ShapeDefinitionRepresentation;
 class StepGeom_Axis2Placement3d;
 class TopoDS_Shape;
@@ -98,6 +102,23 @@ public:
   Standard_EXPORT virtual Standard_Boolean IsAssembly (const Handle(StepData_StepModel)& theModel,
                                                        TopoDS_Shape& S) const;
 
+  //! Converts the distinct solids of the parts of the shape into STEP entities in parallel threads,
+  //! so that the following Transfer() of the same shape takes the prepared entities
+  //! instead of converting the solids one after another.
+  //! Shape processing and conversion of each solid are performed within a private finder process;
+  //! its results are merged into the finder process of Transfer() in the sequential order,
+  //! so that the resulting model and numbering of its entities are the same as in sequential mode.
+  //! Does nothing in non-manifold mode and in modes other than AsIs and ManifoldSolidBrep.
+  //! @param[in] theShape    shape to be transferred
+  //! @param[in] theModel    STEP model defining the transfer parameters
+  //! @param[in] theProgress progress indicator
+  Standard_EXPORT void PrepareTransfer (const TopoDS_Shape& theShape,
+                                        const Handle(StepData_StepModel)& theModel,
+                                        const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Releases the results of PrepareTransfer() not consumed by Transfer().
+  Standard_EXPORT void ClearPreparedTransfer();
+
 
 
 
@@ -110,7 +131,31 @@ protected:
 
 private:
 
-  
+  //! Solid converted by PrepareTransfer().
+  struct PreparedItem
+  {
+    TopoDS_Shape                                 Shape;     //!< shape after shape processing
+    Handle(Standard_Transient)                   Info;      //!< shape processing information
+    Handle(StepGeom_GeometricRepresentationItem) Item;      //!< converted item
+    Handle(StepGeom_GeometricRepresentationItem) ItemTess;  //!< converted tessellated item
+    Handle(Transfer_FinderProcess)               FP;        //!< private finder process with results for sub-shapes
+    Standard_Real                                Tolerance; //!< tolerance used for shape processing
+    Standard_Boolean                             IsDone;    //!< conversion has been done
+
+    PreparedItem() : Tolerance (0.0), IsDone (Standard_False) {}
+  };
+
+  class PrepareItemFunctor;
+
+  //! Collects the solids of parts of the shape to be converted by PrepareTransfer().
+  void collectPreparedItems (const Handle(StepData_StepModel)& theModel,
+                             const TopoDS_Shape& theShape,
+                             NCollection_Map<TopoDS_Shape>& theParts);
+
+  //! Merges prepared item into the finder process.
+  void mergePreparedItem (const PreparedItem& theItem,
+                          const Handle(Transfer_FinderProcess)& theFP) const;
+
   //! Non-manifold shapes are stored in NMSSR group
   //! (NON_MANIFOLD_SURFACE_SHAPE_REPRESENTATION).
   //! Use this method to get the corresponding NMSSR (or
@@ -133,6 +178,7 @@ private:
   Standard_Integer mygroup;
   Standard_Real mytoler;
   STEPConstruct_ContextTool myContext;
+  NCollection_DataMap<TopoDS_Shape, PreparedItem> myPreparedItems; //!< solids converted by PrepareTransfer()
 
 
 };
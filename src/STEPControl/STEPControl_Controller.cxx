@@ -185,6 +185,13 @@ STEPControl_Controller::STEPControl_Controller ()
     Interface_Static::Init ("step","write.step.vertex.mode",'&',"eval Single Vertex");
     Interface_Static::SetIVal("write.step.vertex.mode",0);
 
+    // Parallel conversion of distinct part shapes: OFF by default
+    Interface_Static::Init ("step","write.step.parallel",'e',"");
+    Interface_Static::Init ("step","write.step.parallel",'&',"enum 0");
+    Interface_Static::Init ("step","write.step.parallel",'&',"eval Off");
+    Interface_Static::Init ("step","write.step.parallel",'&',"eval On");
+    Interface_Static::SetIVal("write.step.parallel",0);
+
     // abv 15.11.00: ShapeProcessing
     Interface_Static::Init ("XSTEP", "write.step.resource.name",                      't', "STEP");
     Interface_Static::Init ("XSTEP", "read.step.resource.name",                       't', "STEP");
@@ -15,6 +15,7 @@
 
 #include <Interface_InterfaceModel.hxx>
 #include <Interface_Macros.hxx>
+#include <Message_ProgressScope.hxx>
 #include <STEPControl_ActorWrite.hxx>
 #include <STEPControl_Controller.hxx>
 #include <DESTEP_Parameters.hxx>
@@ -167,6 +168,16 @@ IFSelect_ReturnStatus STEPControl_Writer::Transfer
   Handle(STEPControl_ActorWrite) ActWrite =
     Handle(STEPControl_ActorWrite)::DownCast(WS()->NormAdaptor()->ActorWrite());
   ActWrite->SetGroupMode(Handle(StepData_StepModel)::DownCast(thesession->Model())->InternalParameters.WriteAssembly);
+  if (theParams.WriteParallel)
+  {
+    // convert solids of distinct parts in parallel threads before the sequential transfer
+    Message_ProgressScope aPS(theProgress, NULL, 2);
+    ActWrite->SetMode(mode);
+    ActWrite->PrepareTransfer(sh, Handle(StepData_StepModel)::DownCast(thesession->Model()), aPS.Next());
+    const IFSelect_ReturnStatus aStatus = thesession->TransferWriteShape(sh, compgraph, aPS.Next());
+    ActWrite->ClearPreparedTransfer();
+    return aStatus;
+  }
   return thesession->TransferWriteShape(sh, compgraph, theProgress);
 }
 
@@ -28,7 +28,8 @@
 //purpose  :
 //=============================================================================
 StlAPI_Writer::StlAPI_Writer()
-: myASCIIMode (Standard_True)
+: myASCIIMode (Standard_True),
+  myIsParallel (Standard_False)
 {
   //
 }
@@ -120,8 +121,8 @@ Standard_Boolean StlAPI_Writer::Write (const TopoDS_Shape&    theShape,
 
   OSD_Path aPath (theFileName);
   Standard_Boolean isDone = (myASCIIMode
-    ? RWStl::WriteAscii(aMesh, aPath, theProgress)
-    : RWStl::WriteBinary(aMesh, aPath, theProgress));
+    ? RWStl::WriteAscii(aMesh, aPath, myIsParallel, theProgress)
+    : RWStl::WriteBinary(aMesh, aPath, myIsParallel, theProgress));
 
   if (isDone && (aNbFacesNoTri > 0))
   {
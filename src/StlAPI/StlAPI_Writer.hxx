@@ -38,6 +38,10 @@ public:
   //! If the mode returns False, the generated file is a binary file.
   Standard_Boolean& ASCIIMode() { return myASCIIMode; }
 
+  //! Returns the address to the flag defining if the facets are prepared in parallel threads.
+  //! This address may be used to either read or change the flag; False by default.
+  Standard_Boolean& ParallelMode() { return myIsParallel; }
+
   //! Converts a given shape to STL format and writes it to file with a given filename.
   //! \return the error state.
   Standard_EXPORT Standard_Boolean Write (const TopoDS_Shape& theShape,
@@ -46,6 +50,7 @@ public:
 
 private:
   Standard_Boolean myASCIIMode;
+  Standard_Boolean myIsParallel;
 };
 
 #endif // _StlAPI_Writer_HeaderFile
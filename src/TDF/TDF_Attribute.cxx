@@ -257,7 +257,15 @@ void TDF_Attribute::Backup()
       aMess += "\" is changed outside transaction";
       throw Standard_ImmutableObject(aMess.ToCString());
     }
+    if ( aData->IsReadOnly() ) {
+      TCollection_AsciiString aMess;
+      aMess = "Attribute \"";
+      aMess += DynamicType()->Name();
+      aMess += "\" is changed in read-only data framework";
+      throw Standard_ImmutableObject(aMess.ToCString());
+    }
 
+    aData->RegisterModification();
     const Standard_Integer currentTransaction =
       aData->Transaction();
     if (myTransaction < currentTransaction) {//"!=" is less secure.
@@ -376,6 +384,17 @@ Handle(TDF_DeltaOnRemoval) TDF_Attribute::DeltaOnRemoval() const
 { return new TDF_DefaultDeltaOnRemoval(this); } // myBackup
 
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_Attribute::MemorySize() const
+{
+  return sizeof(TDF_Attribute);
+}
+
+
 //=======================================================================
 //function : Dump
 //purpose  : This method is equivalent to operator <<
@@ -309,6 +309,13 @@ public:
   //! Makes a DeltaOnRemoval on <me> because <me> has
   //! disappeared from the DS.
   Standard_EXPORT virtual Handle(TDF_DeltaOnRemoval) DeltaOnRemoval() const;
+
+  //! Returns the approximate size in bytes of memory occupied by the attribute
+  //! including its data allocated on the heap. It is used to estimate the memory
+  //! kept by the undo history (see TDF_Delta::MemorySize()).
+  //! The default implementation returns the size of the base class only,
+  //! attributes holding large data should redefine it.
+  Standard_EXPORT virtual Standard_Size MemorySize() const;
   
   //! Returns an new empty attribute from the good end
   //! type. It is used by the copy algorithm.
@@ -68,6 +68,15 @@ Standard_GUID TDF_AttributeDelta::ID() const
 { return myAttribute->ID(); }
 
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_AttributeDelta::MemorySize() const
+{ return sizeof(TDF_AttributeDelta); }
+
+
 //=======================================================================
 //function : Dump
 //purpose  : 
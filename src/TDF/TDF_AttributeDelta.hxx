@@ -57,6 +57,11 @@ public:
   
   //! Returns the ID of the attribute concerned by <me>.
   Standard_EXPORT Standard_GUID ID() const;
+
+  //! Returns the approximate size in bytes of memory kept by <me>.
+  //! The default implementation returns the size of the base class only,
+  //! as the attribute referred by the delta is present in the data framework.
+  Standard_EXPORT virtual Standard_Size MemorySize() const;
   
   //! Dumps the contents.
   Standard_EXPORT virtual Standard_OStream& Dump (Standard_OStream& OS) const;
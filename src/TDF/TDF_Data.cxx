@@ -88,7 +88,10 @@ myTransaction           (0),
 myNbTouchedAtt          (0),
 myNotUndoMode           (Standard_True),
 myTime                  (0),
+myNbUntrackedModifs     (0),
 myAllowModification     (Standard_True),
+myCompactDeltas         (Standard_False),
+myIsReadOnly            (Standard_False),
 myAccessByEntries       (Standard_False)
 {
   const Handle(NCollection_IncAllocator) anIncAllocator=
@@ -508,4 +511,5 @@ void TDF_Data::DumpJson (Standard_OStream& theOStream, Standard_Integer /*theDep
     OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, aTime)
   }
   OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myAllowModification)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL (theOStream, myIsReadOnly)
 }
@@ -27,6 +27,8 @@
 #include <TDF_Label.hxx>
 #include <Standard_OStream.hxx>
 #include <NCollection_DataMap.hxx>
+
+#include <atomic>
 class TDF_Delta;
 class TDF_Label;
 
@@ -93,6 +95,36 @@ Standard_OStream& operator<< (Standard_OStream& anOS) const
   
   //! returns modification mode.
     Standard_Boolean IsModificationAllowed() const;
+
+  //! Returns the number of additions, modifications and removals of attributes
+  //! made while no transaction is open. Such modifications are not recorded in deltas.
+    Standard_Integer NbUntrackedModifications() const;
+
+  //! Counts the modification of an attribute if no transaction is open.
+  //! Called by the attributes and the labels on each modification.
+    void RegisterModification();
+
+  //! Sets the mode keeping in the deltas of modification only the modified
+  //! part of the old attribute values instead of their complete backup copies,
+  //! if it is supported by the attribute (for example, only the modified items
+  //! of TDataStd arrays). Reduces the memory kept by the undo history.
+  //! The mode is off by default.
+  void SetCompactDeltas (const Standard_Boolean theToCompact) { myCompactDeltas = theToCompact; }
+
+  //! Returns true if the deltas of modification keep only the modified part
+  //! of the old attribute values.
+  Standard_Boolean ToCompactDeltas() const { return myCompactDeltas; }
+
+  //! Sets the read-only mode allowing concurrent reading of the data framework
+  //! from several threads. In this mode finding of labels and attributes and
+  //! iteration on them do not modify any state shared between the threads
+  //! (e.g. the cache of the last found child label is not updated), while adding
+  //! of labels and modification of attributes raise Standard_ImmutableObject.
+  //! The mode should be changed when no other thread accesses the data framework.
+  void SetReadOnly (const Standard_Boolean theIsReadOnly) { myIsReadOnly = theIsReadOnly; }
+
+  //! Returns true if the data framework is in read-only mode.
+  Standard_Boolean IsReadOnly() const { return myIsReadOnly; }
   
   //! Initializes a mechanism for fast access to the labels by their entries.
   //! The fast access is useful for large documents and often access to the labels 
@@ -210,9 +242,12 @@ private:
   Standard_Integer myNbTouchedAtt;
   Standard_Boolean myNotUndoMode;
   Standard_Integer myTime;
+  std::atomic<Standard_Integer> myNbUntrackedModifs; // attributes may be pasted in parallel threads
   TColStd_ListOfInteger myTimes;
   TDF_HAllocator myLabelNodeAllocator;
   Standard_Boolean myAllowModification;
+  Standard_Boolean myCompactDeltas;
+  Standard_Boolean myIsReadOnly;
   Standard_Boolean myAccessByEntries;
   NCollection_DataMap<TCollection_AsciiString, TDF_Label> myAccessByEntriesTable;
 };
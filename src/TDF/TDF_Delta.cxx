@@ -42,7 +42,8 @@ IMPLEMENT_STANDARD_RTTIEXT(TDF_Delta,Standard_Transient)
 
 TDF_Delta::TDF_Delta() 
 : myBeginTime(0),
-  myEndTime(0)
+  myEndTime(0),
+  myMemorySize(0)
 {}
 
 
@@ -67,7 +68,32 @@ void TDF_Delta::Validity
 
 void TDF_Delta::AddAttributeDelta
 (const Handle(TDF_AttributeDelta)& anAttributeDelta)
-{ if (!anAttributeDelta.IsNull()) myAttDeltaList.Append(anAttributeDelta); }
+{
+  if (!anAttributeDelta.IsNull())
+  {
+    myAttDeltaList.Append(anAttributeDelta);
+    myMemorySize = 0;
+  }
+}
+
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_Delta::MemorySize() const
+{
+  if (myMemorySize == 0)
+  {
+    myMemorySize = sizeof(TDF_Delta);
+    for (TDF_ListIteratorOfAttributeDeltaList anIt (myAttDeltaList); anIt.More(); anIt.Next())
+    {
+      myMemorySize += anIt.Value()->MemorySize();
+    }
+  }
+  return myMemorySize;
+}
 
 
 //=======================================================================
@@ -71,6 +71,10 @@ public:
   //! Associates a name <theName> with this delta
     void SetName (const TCollection_ExtendedString& theName);
 
+  //! Returns the approximate size in bytes of memory kept by the attribute deltas
+  //! (see TDF_AttributeDelta::MemorySize()). The value is computed on the first call.
+  Standard_EXPORT Standard_Size MemorySize() const;
+
   Standard_EXPORT void Dump (Standard_OStream& OS) const;
 
   //! Dumps the content of me into the stream
@@ -107,6 +111,7 @@ private:
   Standard_Integer myEndTime;
   TDF_AttributeDeltaList myAttDeltaList;
   TCollection_ExtendedString myName;
+  mutable Standard_Size myMemorySize;
 
 
 };
@@ -20,6 +20,8 @@
 
 #include <TDF_DeltaOnModification.hxx>
 
+#include <TDF_Attribute.hxx>
+
 IMPLEMENT_STANDARD_RTTIEXT(TDF_DeltaOnModification,TDF_AttributeDelta)
 
 //=======================================================================
@@ -39,3 +41,12 @@ TDF_DeltaOnModification::TDF_DeltaOnModification
 
 void TDF_DeltaOnModification::Apply() 
 { Attribute()->DeltaOnModification(this); }
+
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_DeltaOnModification::MemorySize() const
+{ return TDF_AttributeDelta::MemorySize() + Attribute()->MemorySize(); }
@@ -39,6 +39,10 @@ public:
   //! Applies the delta to the attribute.
   Standard_EXPORT virtual void Apply() Standard_OVERRIDE;
 
+  //! Returns the size of memory kept by the delta including
+  //! the backup copy of the attribute.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
+
 
 
 
@@ -20,6 +20,8 @@
 
 #include <TDF_DeltaOnRemoval.hxx>
 
+#include <TDF_Attribute.hxx>
+
 IMPLEMENT_STANDARD_RTTIEXT(TDF_DeltaOnRemoval,TDF_AttributeDelta)
 
 //=======================================================================
@@ -29,3 +31,12 @@ IMPLEMENT_STANDARD_RTTIEXT(TDF_DeltaOnRemoval,TDF_AttributeDelta)
 TDF_DeltaOnRemoval::TDF_DeltaOnRemoval(const Handle(TDF_Attribute)& anAtt)
 : TDF_AttributeDelta(anAtt)
 {}
+
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDF_DeltaOnRemoval::MemorySize() const
+{ return TDF_AttributeDelta::MemorySize() + Attribute()->MemorySize(); }
@@ -35,8 +35,9 @@ class TDF_DeltaOnRemoval : public TDF_AttributeDelta
 
 public:
 
-
-
+  //! Returns the size of memory kept by the delta including
+  //! the removed attribute.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
 
 
   DEFINE_STANDARD_RTTIEXT(TDF_DeltaOnRemoval,TDF_AttributeDelta)
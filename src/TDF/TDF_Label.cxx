@@ -26,6 +26,20 @@
 #include <TDF_LabelNodePtr.hxx>
 #include <TDF_Tool.hxx>
 
+#include <algorithm>
+
+namespace
+{
+  //! Number of children passed by linear search creating the index of children.
+  static const Standard_Integer THE_CHILD_INDEX_THRESHOLD = 128;
+
+  //! Compares tag of the label node with the tag.
+  static bool isLessTag (const TDF_LabelNode* theNode, const Standard_Integer theTag)
+  {
+    return theNode->Tag() < theTag;
+  }
+}
+
 // Attribute methods ++++++++++++++++++++++++++++++++++++++++++++++++++++
 //=======================================================================
 //function : Imported
@@ -320,9 +334,26 @@ TDF_LabelNode* TDF_Label::FindOrAddChild
   //jfa 10.01.2003 end
 
   // To facilitate many tools, label brethren are stored in increasing order.
-  while ((currentLnp != NULL) && (currentLnp->Tag() < aTag) ) {
-    lastLnp    = currentLnp;
-    currentLnp = currentLnp->Brother();
+  std::vector<TDF_LabelNode*>* anIndex = myLabelNode->myChildIndex;
+  std::vector<TDF_LabelNode*>::iterator anIndexIter;
+  Standard_Integer aNbPassed = 0;
+  if (anIndex != NULL && currentLnp != NULL && currentLnp->Tag() < aTag) {
+    // binary search in the index of children
+    anIndexIter = std::lower_bound (anIndex->begin(), anIndex->end(), aTag, isLessTag);
+    currentLnp = anIndexIter != anIndex->end()   ? *anIndexIter       : NULL;
+    lastLnp    = anIndexIter != anIndex->begin() ? *(anIndexIter - 1) : NULL;
+  }
+  else {
+    while ((currentLnp != NULL) && (currentLnp->Tag() < aTag) ) {
+      lastLnp    = currentLnp;
+      currentLnp = currentLnp->Brother();
+      ++aNbPassed;
+    }
+    if (anIndex != NULL) {
+      anIndexIter = lastLnp == NULL
+                  ? anIndex->begin()
+                  : std::lower_bound (anIndex->begin(), anIndex->end(), aTag, isLessTag);
+    }
   }
 
   if ( (currentLnp != NULL) && (currentLnp->Tag() == aTag) ) {
@@ -330,6 +361,9 @@ TDF_LabelNode* TDF_Label::FindOrAddChild
     childLabelNode = currentLnp;
   }
   else if (create) {
+    if (myLabelNode->Data()->IsReadOnly())
+      throw Standard_ImmutableObject("Label is added to read-only data framework");
+
     // Creates the label to be inserted always before currentLnp.
     const TDF_HAllocator& anAllocator = myLabelNode->Data()->LabelNodeAllocator();
     childLabelNode =  new (anAllocator) TDF_LabelNode (aTag, myLabelNode);
@@ -340,12 +374,21 @@ TDF_LabelNode* TDF_Label::FindOrAddChild
       myLabelNode->myFirstChild = childLabelNode;
     else                 // ... somewhere.
       lastLnp->myBrother = childLabelNode;
+    // Update index of children.
+    if (anIndex != NULL)
+      anIndex->insert (anIndexIter, childLabelNode);
     // Update table for fast access to the labels.
     if (myLabelNode->Data()->IsAccessByEntries())
       myLabelNode->Data()->RegisterLabel (childLabelNode);
   }
 
-  if (lastLnp)                               //agv 14.07.2010
+  // The index is created on long search, not shared between threads in read-only mode.
+  if (anIndex == NULL && aNbPassed > THE_CHILD_INDEX_THRESHOLD
+   && !myLabelNode->Data()->IsReadOnly())
+    myLabelNode->CreateChildIndex();
+
+  // the cache is shared between the threads reading the data framework in read-only mode
+  if (lastLnp && !myLabelNode->Data()->IsReadOnly()) //agv 14.07.2010
     myLabelNode->myLastFoundChild = lastLnp; //jfa 10.01.2003
 
   return childLabelNode;
@@ -542,6 +585,13 @@ void TDF_Label::AddToNode (const TDF_LabelNodePtr& toNode,
     aMess += "\" is added to label outside transaction";
     throw Standard_ImmutableObject(aMess.ToCString());
   }
+  if ( toNode->Data()->IsReadOnly() ) {
+    TCollection_AsciiString aMess;
+    aMess = "Attribute \"";
+    aMess += anAttribute->DynamicType()->Name();
+    aMess += "\" is added to label in read-only data framework";
+    throw Standard_ImmutableObject(aMess.ToCString());
+  }
     
   if (!anAttribute->Label().IsNull())
     throw Standard_DomainError("Attribute to add is already attached to a label.");
@@ -562,6 +612,7 @@ void TDF_Label::AddToNode (const TDF_LabelNodePtr& toNode,
 
   toNode->AddAttribute(dummyAtt,anAttribute);
   toNode->AttributesModified(anAttribute->myTransaction != 0);
+  toNode->Data()->RegisterModification();
   //if (myData->NotUndoMode()) anAttribute->AfterAddition();  
   if (toNode->Data()->NotUndoMode()) anAttribute->AfterAddition();
 }
@@ -583,12 +634,20 @@ void TDF_Label::ForgetFromNode (const TDF_LabelNodePtr& fromNode,
     aMess += "\" is removed from label outside transaction";
     throw Standard_ImmutableObject(aMess.ToCString());
   }
+  if ( fromNode->Data()->IsReadOnly() ) {
+    TCollection_AsciiString aMess;
+    aMess = "Attribute \"";
+    aMess += anAttribute->DynamicType()->Name();
+    aMess += "\" is removed from label in read-only data framework";
+    throw Standard_ImmutableObject(aMess.ToCString());
+  }
     
   if (fromNode != anAttribute->Label().myLabelNode)
     throw Standard_DomainError("Attribute to forget not attached to my label.");
 
   Standard_Integer curTrans = fromNode->Data()->Transaction();
   if (!anAttribute->IsForgotten()) {
+    fromNode->Data()->RegisterModification();
     if ( (curTrans == 0) ||
         ( (anAttribute->myTransaction == curTrans) &&
          anAttribute->myBackup.IsNull())) {
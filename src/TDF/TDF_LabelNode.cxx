@@ -33,6 +33,7 @@ TDF_LabelNode::TDF_LabelNode
 #endif
   myFirstChild      (NULL),
   myLastFoundChild  (NULL), //jfa 10.01.2003
+  myChildIndex      (NULL),
   myTag             (0), // Always 0 for root.
   myFlags           (0),
 #ifdef KEEP_LOCAL_ROOT
@@ -56,6 +57,7 @@ TDF_LabelNode::TDF_LabelNode
   myBrother         (NULL),
   myFirstChild      (NULL),
   myLastFoundChild  (NULL), //jfa 10.01.2003
+  myChildIndex      (NULL),
   myTag             (aTag),
   myFlags           (0),
 #ifdef KEEP_LOCAL_ROOT
@@ -89,6 +91,8 @@ void TDF_LabelNode::Destroy (const TDF_HAllocator& theAllocator)
     myFirstChild->Destroy (theAllocator);
     myFirstChild = aSecondChild;
   }
+  delete myChildIndex;
+  myChildIndex = NULL;
   this->~TDF_LabelNode();
   myFather = myBrother = myFirstChild = myLastFoundChild = NULL;
   myTag = myFlags = 0;
@@ -141,6 +145,23 @@ void TDF_LabelNode::RemoveAttribute
 }
 
 
+//=======================================================================
+//function : CreateChildIndex
+//purpose  : Creates the index of children sorted by tag.
+//=======================================================================
+
+void TDF_LabelNode::CreateChildIndex()
+{
+  if (myChildIndex == NULL) {
+    myChildIndex = new std::vector<TDF_LabelNode*>();
+  }
+  myChildIndex->clear();
+  for (TDF_LabelNode* aChild = myFirstChild; aChild != NULL; aChild = aChild->myBrother) {
+    myChildIndex->push_back (aChild);
+  }
+}
+
+
 //=======================================================================
 //function : RootNode
 //purpose  : used for non const object.
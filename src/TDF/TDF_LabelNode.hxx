@@ -26,6 +26,8 @@
   #include <atomic>
 #endif
 
+#include <vector>
+
 class TDF_Attribute;
 class TDF_Data;
 
@@ -63,6 +65,10 @@ class TDF_LabelNode {
   inline TDF_LabelNode* FirstChild() const
     { return myFirstChild; }
 
+  // Index of children sorted by tag, NULL if not created
+  inline const std::vector<TDF_LabelNode*>* ChildIndex() const
+    { return myChildIndex; }
+
     // Attribute access
   inline const Handle(TDF_Attribute)& FirstAttribute() const
     { return myFirstAttribute; }
@@ -139,6 +145,9 @@ class TDF_LabelNode {
 
   const TDF_LabelNode* RootNode () const;
 
+  // Creates the index of children sorted by tag
+  void CreateChildIndex();
+
   Standard_EXPORT void AllMayBeModified();
 
   // Tag modification
@@ -165,6 +174,7 @@ class TDF_LabelNode {
   TDF_LabelNodePtr      myBrother; 
   TDF_LabelNodePtr      myFirstChild;
   Standard_ATOMIC(TDF_LabelNodePtr) myLastFoundChild; //jfa 10.01.2003
+  std::vector<TDF_LabelNode*>* myChildIndex; // created for many children
   Standard_Integer      myTag;
   Standard_Integer      myFlags; // Flags & Depth
   Handle(TDF_Attribute) myFirstAttribute;
@@ -322,6 +322,15 @@ Standard_OStream& TDataStd_BooleanArray::Dump (Standard_OStream& anOS) const
   return anOS;
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+Standard_Size TDataStd_BooleanArray::MemorySize() const
+{
+  return sizeof(TDataStd_BooleanArray) + (myValues.IsNull() ? 0 : myValues->Length() * sizeof(Standard_Byte));
+}
+
 //=======================================================================
 //function : DumpJson
 //purpose  : 
@@ -95,6 +95,9 @@ public:
   
   Standard_EXPORT virtual Standard_OStream& Dump (Standard_OStream& OS) const Standard_OVERRIDE;
 
+  //! Returns the approximate size of memory occupied by the attribute.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
+
   //! Dumps the content of me into the stream
   Standard_EXPORT virtual void DumpJson (Standard_OStream& theOStream, Standard_Integer theDepth = -1) const Standard_OVERRIDE;
 
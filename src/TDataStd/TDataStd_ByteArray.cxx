@@ -20,6 +20,7 @@
 #include <Standard_Type.hxx>
 #include <TDataStd_DeltaOnModificationOfByteArray.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_DefaultDeltaOnModification.hxx>
 #include <TDF_DeltaOnModification.hxx>
 #include <TDF_Label.hxx>
@@ -305,9 +306,26 @@ Standard_OStream& TDataStd_ByteArray::Dump (Standard_OStream& anOS) const
 Handle(TDF_DeltaOnModification) TDataStd_ByteArray::DeltaOnModification
 (const Handle(TDF_Attribute)& OldAttribute) const
 {
-  if(myIsDelta)
-    return new TDataStd_DeltaOnModificationOfByteArray(Handle(TDataStd_ByteArray)::DownCast (OldAttribute));
-  else return new TDF_DefaultDeltaOnModification(OldAttribute);
+  Handle(TDataStd_ByteArray) anOldArray = Handle(TDataStd_ByteArray)::DownCast (OldAttribute);
+  if (myIsDelta)
+    return new TDataStd_DeltaOnModificationOfByteArray(anOldArray);
+
+  // the compact delta keeps the modified items of arrays having the same lower bound
+  if (Label().Data()->ToCompactDeltas()
+   && !anOldArray.IsNull() && !anOldArray->myValue.IsNull() && !myValue.IsNull()
+   && anOldArray->myValue->Lower() == myValue->Lower())
+    return new TDataStd_DeltaOnModificationOfByteArray(anOldArray);
+  return new TDF_DefaultDeltaOnModification(OldAttribute);
+}
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_ByteArray::MemorySize() const
+{
+  return sizeof(TDataStd_ByteArray) + (myValue.IsNull() ? 0 : myValue->Length() * sizeof(Standard_Byte));
 }
 
 //=======================================================================
@@ -176,4 +176,17 @@ void TDataStd_DeltaOnModificationOfByteArray::Apply()
 #endif
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
 
+Standard_Size TDataStd_DeltaOnModificationOfByteArray::MemorySize() const
+{
+  Standard_Size aSize = TDF_DeltaOnModification::MemorySize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += myIndxes->Length() * sizeof(Standard_Integer) + myValues->Length() * sizeof(Standard_Byte);
+  }
+  return aSize;
+}
@@ -179,4 +179,21 @@ void TDataStd_DeltaOnModificationOfExtStringArray::Apply()
 #endif
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
 
+Standard_Size TDataStd_DeltaOnModificationOfExtStringArray::MemorySize() const
+{
+  Standard_Size aSize = TDF_DeltaOnModification::MemorySize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += myIndxes->Length() * sizeof(Standard_Integer);
+    for (Standard_Integer anIndex = myValues->Lower(); anIndex <= myValues->Upper(); ++anIndex)
+    {
+      aSize += sizeof(TCollection_ExtendedString) + myValues->Value (anIndex).Length() * sizeof(Standard_ExtCharacter);
+    }
+  }
+  return aSize;
+}
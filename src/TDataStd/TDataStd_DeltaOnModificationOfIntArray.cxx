@@ -174,4 +174,17 @@ void TDataStd_DeltaOnModificationOfIntArray::Apply()
 #endif
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
 
+Standard_Size TDataStd_DeltaOnModificationOfIntArray::MemorySize() const
+{
+  Standard_Size aSize = TDF_DeltaOnModification::MemorySize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += myIndxes->Length() * sizeof(Standard_Integer) + myValues->Length() * sizeof(Standard_Integer);
+  }
+  return aSize;
+}
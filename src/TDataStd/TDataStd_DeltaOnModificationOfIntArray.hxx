@@ -41,6 +41,9 @@ public:
   //! Applies the delta to the attribute.
   Standard_EXPORT virtual void Apply() Standard_OVERRIDE;
 
+  //! Returns the memory size of the modified items kept by the delta.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
+
 
 
 
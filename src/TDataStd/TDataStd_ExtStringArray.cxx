@@ -21,6 +21,7 @@
 #include <TCollection_ExtendedString.hxx>
 #include <TDataStd_DeltaOnModificationOfExtStringArray.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_DefaultDeltaOnModification.hxx>
 #include <TDF_DeltaOnModification.hxx>
 #include <TDF_Label.hxx>
@@ -331,9 +332,34 @@ Standard_OStream& TDataStd_ExtStringArray::Dump (Standard_OStream& anOS) const
 Handle(TDF_DeltaOnModification) TDataStd_ExtStringArray::DeltaOnModification
 (const Handle(TDF_Attribute)& OldAttribute) const
 {
-  if(myIsDelta)
-    return new TDataStd_DeltaOnModificationOfExtStringArray(Handle(TDataStd_ExtStringArray)::DownCast (OldAttribute));
-  else return new TDF_DefaultDeltaOnModification(OldAttribute);
+  Handle(TDataStd_ExtStringArray) anOldArray = Handle(TDataStd_ExtStringArray)::DownCast (OldAttribute);
+  if (myIsDelta)
+    return new TDataStd_DeltaOnModificationOfExtStringArray(anOldArray);
+
+  // the compact delta keeps the modified items of arrays having the same lower bound
+  if (Label().Data()->ToCompactDeltas()
+   && !anOldArray.IsNull() && !anOldArray->myValue.IsNull() && !myValue.IsNull()
+   && anOldArray->myValue->Lower() == myValue->Lower())
+    return new TDataStd_DeltaOnModificationOfExtStringArray(anOldArray);
+  return new TDF_DefaultDeltaOnModification(OldAttribute);
+}
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_ExtStringArray::MemorySize() const
+{
+  Standard_Size aSize = sizeof(TDataStd_ExtStringArray);
+  if (!myValue.IsNull())
+  {
+    for (Standard_Integer anIndex = myValue->Lower(); anIndex <= myValue->Upper(); ++anIndex)
+    {
+      aSize += sizeof(TCollection_ExtendedString) + myValue->Value (anIndex).Length() * sizeof(Standard_ExtCharacter);
+    }
+  }
+  return aSize;
 }
 
 //=======================================================================
@@ -235,6 +235,16 @@ Handle(TDF_DeltaOnModification) TDataStd_IntPackedMap::DeltaOnModification
   else return new TDF_DefaultDeltaOnModification(OldAttribute);
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_IntPackedMap::MemorySize() const
+{
+  return sizeof(TDataStd_IntPackedMap) + (myMap.IsNull() ? 0 : myMap->Map().Extent() * sizeof(Standard_Integer));
+}
+
 //=======================================================================
 //function : DumpJson
 //purpose  : 
@@ -21,6 +21,7 @@
 #include <Standard_Type.hxx>
 #include <TDataStd_DeltaOnModificationOfIntArray.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_DefaultDeltaOnModification.hxx>
 #include <TDF_DeltaOnModification.hxx>
 #include <TDF_Label.hxx>
@@ -333,9 +334,26 @@ Standard_OStream& TDataStd_IntegerArray::Dump (Standard_OStream& anOS) const
 Handle(TDF_DeltaOnModification) TDataStd_IntegerArray::DeltaOnModification
 (const Handle(TDF_Attribute)& OldAttribute) const
 {
-  if(myIsDelta)
-    return new TDataStd_DeltaOnModificationOfIntArray(Handle(TDataStd_IntegerArray)::DownCast (OldAttribute));
-  else return new TDF_DefaultDeltaOnModification(OldAttribute);
+  Handle(TDataStd_IntegerArray) anOldArray = Handle(TDataStd_IntegerArray)::DownCast (OldAttribute);
+  if (myIsDelta)
+    return new TDataStd_DeltaOnModificationOfIntArray(anOldArray);
+
+  // the compact delta keeps the modified items of arrays having the same lower bound
+  if (Label().Data()->ToCompactDeltas()
+   && !anOldArray.IsNull() && !anOldArray->myValue.IsNull() && !myValue.IsNull()
+   && anOldArray->myValue->Lower() == myValue->Lower())
+    return new TDataStd_DeltaOnModificationOfIntArray(anOldArray);
+  return new TDF_DefaultDeltaOnModification(OldAttribute);
+}
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_IntegerArray::MemorySize() const
+{
+  return sizeof(TDataStd_IntegerArray) + (myValue.IsNull() ? 0 : myValue->Length() * sizeof(Standard_Integer));
 }
 
 //=======================================================================
@@ -49,6 +49,8 @@ public:
   //! with the specified <lower> and <upper> boundaries.
   //! If <isDelta> == False, DefaultDeltaOnModification is used.
   //! If <isDelta> == True, DeltaOnModification of the current attribute is used.
+  //! The latter is also used if the data framework keeps compact deltas
+  //! (see TDF_Data::SetCompactDeltas()).
   //! If attribute is already set, all input parameters are refused and the found
   //! attribute is returned.
   Standard_EXPORT static Handle(TDataStd_IntegerArray) Set (const TDF_Label& label, const Standard_Integer lower, 
@@ -124,6 +126,9 @@ public:
   //! Makes a DeltaOnModification between <me> and
   //! <anOldAttribute>.
   Standard_EXPORT virtual Handle(TDF_DeltaOnModification) DeltaOnModification (const Handle(TDF_Attribute)& anOldAttribute) const Standard_OVERRIDE;
+
+  //! Returns the approximate size of memory occupied by the attribute.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
   
   //! Dumps the content of me into the stream
   Standard_EXPORT virtual void DumpJson (Standard_OStream& theOStream, Standard_Integer theDepth = -1) const Standard_OVERRIDE;
@@ -21,6 +21,7 @@
 #include <Standard_Type.hxx>
 #include <TDataStd_DeltaOnModificationOfRealArray.hxx>
 #include <TDF_Attribute.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_DefaultDeltaOnModification.hxx>
 #include <TDF_DeltaOnModification.hxx>
 #include <TDF_Label.hxx>
@@ -329,9 +330,26 @@ Standard_OStream& TDataStd_RealArray::Dump (Standard_OStream& anOS) const
 Handle(TDF_DeltaOnModification) TDataStd_RealArray::DeltaOnModification
 (const Handle(TDF_Attribute)& OldAtt) const
 {
-  if(myIsDelta)
-    return new TDataStd_DeltaOnModificationOfRealArray(Handle(TDataStd_RealArray)::DownCast (OldAtt));
-  else return new TDF_DefaultDeltaOnModification(OldAtt);
+  Handle(TDataStd_RealArray) anOldArray = Handle(TDataStd_RealArray)::DownCast (OldAtt);
+  if (myIsDelta)
+    return new TDataStd_DeltaOnModificationOfRealArray(anOldArray);
+
+  // the compact delta keeps the modified items of arrays having the same lower bound
+  if (Label().Data()->ToCompactDeltas()
+   && !anOldArray.IsNull() && !anOldArray->myValue.IsNull() && !myValue.IsNull()
+   && anOldArray->myValue->Lower() == myValue->Lower())
+    return new TDataStd_DeltaOnModificationOfRealArray(anOldArray);
+  return new TDF_DefaultDeltaOnModification(OldAtt);
+}
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDataStd_RealArray::MemorySize() const
+{
+  return sizeof(TDataStd_RealArray) + (myValue.IsNull() ? 0 : myValue->Length() * sizeof(Standard_Real));
 }
 
 //=======================================================================
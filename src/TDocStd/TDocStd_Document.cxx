@@ -77,8 +77,10 @@ TDocStd_Document::TDocStd_Document(const TCollection_ExtendedString& aStorageFor
 myStorageFormat(aStorageFormat),
 myData (new TDF_Data()),
 myUndoLimit(0),
+myUndoMemoryLimit(0),
 myUndoTransaction ("UNDO"),
 mySaveTime(0),
+mySaveNbUntrackedModifs(0),
 myIsNestedTransactionMode(0),
 mySaveEmptyLabels(Standard_False),
 myStorageFormatVersion(TDocStd_FormatVersion_CURRENT)
@@ -133,6 +135,7 @@ TCollection_ExtendedString TDocStd_Document::GetPath () const
 void TDocStd_Document::SetData (const Handle(TDF_Data)& D)
 {
   myData = D;
+  myData->SetCompactDeltas (myUndoMemoryLimit > 0);
   myUndoTransaction.Initialize (myData);
 }
 
@@ -330,6 +333,7 @@ Standard_Boolean TDocStd_Document::CommitTransaction()
       if(!D->IsEmpty()) {
         myUndos.Append(D);
         myRedos.Clear(); // if we push an Undo we clear the redos
+        applyUndoMemoryLimit();
         isDone = Standard_True;
       }
     }
@@ -369,6 +373,7 @@ Standard_Boolean TDocStd_Document::CommitTransaction()
           }
 #endif
         }
+        applyUndoMemoryLimit();
       }
 
     }
@@ -495,6 +500,73 @@ void TDocStd_Document::SetUndoLimit(const Standard_Integer L)
   //OpenTransaction(); dp 15/10/99
 }
 
+//=======================================================================
+//function : SetUndoMemoryLimit
+//purpose  : 
+//=======================================================================
+
+void TDocStd_Document::SetUndoMemoryLimit (const Standard_Size theLimit)
+{
+  myUndoMemoryLimit = theLimit;
+  myData->SetCompactDeltas (myUndoMemoryLimit > 0);
+  applyUndoMemoryLimit();
+}
+
+//=======================================================================
+//function : UndoMemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TDocStd_Document::UndoMemorySize() const
+{
+  Standard_Size aSize = 0;
+  for (TDF_ListIteratorOfDeltaList anIter (myUndos); anIter.More(); anIter.Next())
+  {
+    aSize += anIter.Value()->MemorySize();
+  }
+  for (TDF_ListIteratorOfDeltaList anIter (myRedos); anIter.More(); anIter.Next())
+  {
+    aSize += anIter.Value()->MemorySize();
+  }
+  return aSize;
+}
+
+//=======================================================================
+//function : applyUndoMemoryLimit
+//purpose  : Removes the oldest undos exceeding the limit of memory
+//=======================================================================
+
+void TDocStd_Document::applyUndoMemoryLimit()
+{
+  if (myUndoMemoryLimit == 0)
+  {
+    return;
+  }
+
+  Standard_Size aSize = UndoMemorySize();
+  while (aSize > myUndoMemoryLimit && myUndos.Extent() > 1)
+  {
+    const Handle(TDF_Delta) aDelta = myUndos.First();
+    aSize -= aDelta->MemorySize();
+    myUndos.RemoveFirst();
+#ifdef SRN_DELTA_COMPACT
+    if (myFromUndo == aDelta)
+    {
+      // the oldest undo delta coincides with `from` delta
+      if (myUndos.Extent() == 1)
+      {
+        myFromUndo.Nullify();
+        myFromRedo.Nullify();
+      }
+      else
+      {
+        myFromUndo = myUndos.First();
+      }
+    }
+#endif
+  }
+}
+
 //=======================================================================
 //function : GetUndoLimit
 //purpose  : 
@@ -72,6 +72,10 @@ public:
   
   //! This method have to be called to show document that it has been saved
     void SetSaved();
+
+  //! Returns true if attributes have been added, modified or removed outside of commands
+  //! since the last call of SetSaved(). Such modifications are not recorded by undo deltas.
+    Standard_Boolean HasUntrackedModifications() const;
   
   //! Say to document what it is not saved.
   //! Use value, returned earlier by GetSavedTime().
@@ -157,6 +161,20 @@ public:
   //! document. If this figure is greater than 0, the method Undo
   //! can be used.
   Standard_EXPORT Standard_Integer GetAvailableUndos() const;
+
+  //! Returns the limit of memory in bytes kept by the undos, 0 means no limit.
+  Standard_Size GetUndoMemoryLimit() const { return myUndoMemoryLimit; }
+
+  //! Sets the limit of memory in bytes kept by the undos, 0 disables the limit (default).
+  //! When the estimated memory of the stored undos (see UndoMemorySize()) exceeds
+  //! the limit after the commit, the oldest undos are removed keeping at least the last one.
+  //! While the limit is set, the modifications of attributes supporting it
+  //! (e.g. TDataStd arrays) are kept in the undos as the modified items only
+  //! (see TDF_Data::SetCompactDeltas()).
+  Standard_EXPORT void SetUndoMemoryLimit (const Standard_Size theLimit);
+
+  //! Returns the approximate size in bytes of memory kept by the stored undos and redos.
+  Standard_EXPORT Standard_Size UndoMemorySize() const;
   
   //! Will UNDO  one step, returns  False if no undo was
   //! done (Undos == 0).
@@ -284,12 +302,17 @@ private:
   //! ===============
   Standard_EXPORT static void AppendDeltaToTheFirst (const Handle(TDocStd_CompoundDelta)& theDelta1, const Handle(TDF_Delta)& theDelta2);
 
+  //! Removes the oldest undos exceeding the limit of memory.
+  Standard_EXPORT void applyUndoMemoryLimit();
+
   Handle(TDF_Data) myData;
   Standard_Integer myUndoLimit;
+  Standard_Size myUndoMemoryLimit;
   TDF_Transaction myUndoTransaction;
   Handle(TDF_Delta) myFromUndo;
   Handle(TDF_Delta) myFromRedo;
   Standard_Integer mySaveTime;
+  Standard_Integer mySaveNbUntrackedModifs;
   Standard_Boolean myIsNestedTransactionMode;
   TDF_DeltaList myUndoFILO;
   Standard_Boolean myOnlyTransactionModification;
@@ -151,4 +151,21 @@ void TNaming_DeltaOnModification::Apply()
   }
 }
 
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
 
+Standard_Size TNaming_DeltaOnModification::MemorySize() const
+{
+  Standard_Size aSize = TDF_DeltaOnModification::MemorySize();
+  if (!myOld.IsNull())
+  {
+    aSize += myOld->Length() * sizeof(TopoDS_Shape);
+  }
+  if (!myNew.IsNull())
+  {
+    aSize += myNew->Length() * sizeof(TopoDS_Shape);
+  }
+  return aSize;
+}
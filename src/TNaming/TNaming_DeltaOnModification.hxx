@@ -45,6 +45,10 @@ public:
   //! Applies the delta to the attribute.
   Standard_EXPORT virtual void Apply() Standard_OVERRIDE;
 
+  //! Returns the memory size of the delta.
+  //! Shapes are shared with the data framework and only their references are counted.
+  Standard_EXPORT virtual Standard_Size MemorySize() const Standard_OVERRIDE;
+
 
 
 
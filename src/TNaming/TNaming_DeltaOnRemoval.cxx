@@ -42,3 +42,13 @@ void TNaming_DeltaOnRemoval::Apply()
 {
   myDelta->Apply();
 }
+
+//=======================================================================
+//function : MemorySize
+//purpose  : 
+//=======================================================================
+
+Standard_Size TNaming_DeltaOnRemoval::MemorySize() const
+{
+  return TDF_DeltaOnRemoval::MemorySize() + (myDelta.IsNull() ? 0 : myDelta->MemorySize());
+}
@@ -521,6 +521,41 @@ void XCAFDoc_DocumentTool::SetLengthUnit(const Handle(TDocStd_Document)& theDoc,
   XCAFDoc_LengthUnit::Set(theDoc->Main().Root(), aUnitName, theUnitValue);
 }
 
+//=======================================================================
+//function : SetReadOnly
+//purpose  :
+//=======================================================================
+void XCAFDoc_DocumentTool::SetReadOnly (const Handle(TDocStd_Document)& theDoc,
+                                        const Standard_Boolean theIsReadOnly)
+{
+  const TDF_Label aMain = theDoc->Main();
+  if (theIsReadOnly && IsXCAFDocument (theDoc))
+  {
+    // shape tool is referred by other tools lazily on first access
+    if (CheckColorTool (aMain))
+    {
+      ColorTool (aMain)->ShapeTool();
+    }
+    if (CheckLayerTool (aMain))
+    {
+      LayerTool (aMain)->ShapeTool();
+    }
+    if (CheckDimTolTool (aMain))
+    {
+      DimTolTool (aMain)->ShapeTool();
+    }
+    if (CheckMaterialTool (aMain))
+    {
+      MaterialTool (aMain)->ShapeTool();
+    }
+    if (CheckVisMaterialTool (aMain))
+    {
+      VisMaterialTool (aMain)->ShapeTool();
+    }
+  }
+  theDoc->GetData()->SetReadOnly (theIsReadOnly);
+}
+
 //=======================================================================
 //function : ID
 //purpose  : 
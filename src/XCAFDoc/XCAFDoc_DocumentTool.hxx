@@ -176,6 +176,14 @@ public:
                                             const Standard_Real theUnitValue,
                                             const UnitsMethods_LengthUnit theBaseUnit);
 
+  //! Switches the data framework of the document to read-only mode (see TDF_Data::SetReadOnly())
+  //! allowing concurrent reading of the document from several threads, or back to normal mode.
+  //! Before switching to read-only mode initializes the references of the existing tools
+  //! which are otherwise initialized on first access. Tools missing in the document are not created.
+  //! Should be called when no other thread accesses the document.
+  Standard_EXPORT static void SetReadOnly (const Handle(TDocStd_Document)& theDoc,
+                                           const Standard_Boolean theIsReadOnly);
+
 public:
 
   Standard_EXPORT XCAFDoc_DocumentTool();
@@ -80,7 +80,11 @@ Handle(XCAFDoc_ShapeTool) XCAFDoc_ShapeTool::Set(const TDF_Label& L)
     A = new XCAFDoc_ShapeTool ();
     L.AddAttribute(A);
   }
-  A->Init();
+  // avoid writing into the attribute shared between the threads reading the document
+  if (A->hasSimpleShapes)
+  {
+    A->Init();
+  }
   return A;
 }
 
@@ -144,7 +144,6 @@ void XCAFPrs::CollectStyleSettings (const TDF_Label& theLabel,
 
   // collect settings on subshapes
   Handle(XCAFDoc_ColorTool) aColorTool = XCAFDoc_DocumentTool::ColorTool(theLabel);
-  Handle(XCAFDoc_VisMaterialTool) aMatTool = XCAFDoc_DocumentTool::VisMaterialTool (theLabel);
 
   TDF_LabelSequence aLabSeq;
   XCAFDoc_ShapeTool::GetSubShapes (theLabel, aLabSeq);
@@ -155,7 +154,7 @@ void XCAFPrs::CollectStyleSettings (const TDF_Label& theLabel,
     const TDF_Label& aLabel = aLabIter.Value();
     XCAFPrs_Style aStyle;
     aStyle.SetVisibility (aColorTool->IsVisible (aLabel));
-    aStyle.SetMaterial (aMatTool->GetShapeMaterial (aLabel));
+    aStyle.SetMaterial (XCAFDoc_VisMaterialTool::GetShapeMaterial (aLabel));
 
     Handle(TColStd_HSequenceOfExtendedString) aLayerNames;
     Handle(XCAFDoc_LayerTool) aLayerTool = XCAFDoc_DocumentTool::LayerTool (aLabel);
@@ -227,7 +226,7 @@ void XCAFPrs::CollectStyleSettings (const TDF_Label& theLabel,
         }
 
         XCAFPrs_Style aShuoStyle;
-        aShuoStyle.SetMaterial  (aMatTool->GetShapeMaterial (aShuolab));
+        aShuoStyle.SetMaterial  (XCAFDoc_VisMaterialTool::GetShapeMaterial (aShuolab));
         aShuoStyle.SetVisibility(aColorTool->IsVisible (aShuolab));
         fillStyleColors (aShuoStyle, aColorTool, aShuolab);
         if (aShuoStyle.IsEmpty())
@@ -26,7 +26,6 @@ namespace
 {
   //! Return merged style for the child node.
   static XCAFPrs_Style mergedStyle (const Handle(XCAFDoc_ColorTool)& theColorTool,
-                                    const Handle(XCAFDoc_VisMaterialTool)& theVisMatTool,
                                     const XCAFPrs_Style& theParenStyle,
                                     const TDF_Label& theLabel,
                                     const TDF_Label& theRefLabel)
@@ -37,7 +36,7 @@ namespace
     }
 
     XCAFPrs_Style aStyle = theParenStyle;
-    if (Handle(XCAFDoc_VisMaterial) aVisMat = theVisMatTool->GetShapeMaterial (theRefLabel))
+    if (Handle(XCAFDoc_VisMaterial) aVisMat = XCAFDoc_VisMaterialTool::GetShapeMaterial (theRefLabel))
     {
       aStyle.SetMaterial (aVisMat);
     }
@@ -59,7 +58,7 @@ namespace
     if (theLabel != theRefLabel)
     {
       // override Reference style with Instance style when defined (bad model?)
-      if (Handle(XCAFDoc_VisMaterial) aVisMat = theVisMatTool->GetShapeMaterial (theLabel))
+      if (Handle(XCAFDoc_VisMaterial) aVisMat = XCAFDoc_VisMaterialTool::GetShapeMaterial (theLabel))
       {
         aStyle.SetMaterial (aVisMat);
       }
@@ -234,7 +233,13 @@ void XCAFPrs_DocumentExplorer::Init (const Handle(TDocStd_Document)& theDocument
   if ((theFlags & XCAFPrs_DocumentExplorerFlags_NoStyle) == 0)
   {
     myColorTool = XCAFDoc_DocumentTool::ColorTool (theDocument->Main());
-    myVisMatTool = XCAFDoc_DocumentTool::VisMaterialTool (theDocument->Main());
+    myVisMatTool.Nullify();
+    // missing tool cannot be created in read-only document
+    if (!theDocument->GetData()->IsReadOnly()
+      || XCAFDoc_DocumentTool::CheckVisMaterialTool (theDocument->Main()))
+    {
+      myVisMatTool = XCAFDoc_DocumentTool::VisMaterialTool (theDocument->Main());
+    }
   }
   else
   {
@@ -321,7 +326,7 @@ void XCAFPrs_DocumentExplorer::initCurrent (Standard_Boolean theIsAssembly)
     XCAFDoc_ShapeTool::GetReferredShape (myCurrent.Label, myCurrent.RefLabel);
     myCurrent.LocalTrsf= XCAFDoc_ShapeTool::GetLocation (myCurrent.Label);
     myCurrent.Location = myCurrent.LocalTrsf;
-    myCurrent.Style    = mergedStyle (myColorTool, myVisMatTool, myDefStyle, myCurrent.Label, myCurrent.RefLabel);
+    myCurrent.Style    = mergedStyle (myColorTool, myDefStyle, myCurrent.Label, myCurrent.RefLabel);
     myCurrent.Id       = DefineChildId (myCurrent.Label, TCollection_AsciiString());
   }
   else
@@ -332,7 +337,7 @@ void XCAFPrs_DocumentExplorer::initCurrent (Standard_Boolean theIsAssembly)
     XCAFDoc_ShapeTool::GetReferredShape (myCurrent.Label, myCurrent.RefLabel);
     myCurrent.LocalTrsf= XCAFDoc_ShapeTool::GetLocation (myCurrent.Label);
     myCurrent.Location = aTopNodeInStack.Location * myCurrent.LocalTrsf;
-    myCurrent.Style    = mergedStyle (myColorTool, myVisMatTool, aTopNodeInStack.Style, myCurrent.Label, myCurrent.RefLabel);
+    myCurrent.Style    = mergedStyle (myColorTool, aTopNodeInStack.Style, myCurrent.Label, myCurrent.RefLabel);
     myCurrent.Id       = DefineChildId (myCurrent.Label, aTopNodeInStack.Id);
   }
 }
@@ -371,7 +376,7 @@ void XCAFPrs_DocumentExplorer::Next()
     aNodeInStack.ChildIter  = TDF_ChildIterator (aNodeInStack.RefLabel);
     aNodeInStack.LocalTrsf  = XCAFDoc_ShapeTool::GetLocation (aNodeInStack.Label);
     aNodeInStack.Location   = aNodeInStack.LocalTrsf;
-    aNodeInStack.Style      = mergedStyle (myColorTool, myVisMatTool, myDefStyle, aNodeInStack.Label, aNodeInStack.RefLabel);
+    aNodeInStack.Style      = mergedStyle (myColorTool, myDefStyle, aNodeInStack.Label, aNodeInStack.RefLabel);
     aNodeInStack.Id         = DefineChildId (aNodeInStack.Label, TCollection_AsciiString());
     myNodeStack.SetValue (0, aNodeInStack);
     if ((myFlags & XCAFPrs_DocumentExplorerFlags_OnlyLeafNodes) == 0)
@@ -420,7 +425,7 @@ void XCAFPrs_DocumentExplorer::Next()
         aNodeInStack.RefLabel   = aRefLabel;
         aNodeInStack.LocalTrsf  = XCAFDoc_ShapeTool::GetLocation (aNodeInStack.Label);
         aNodeInStack.Location   = aParent.Location * aNodeInStack.LocalTrsf;
-        aNodeInStack.Style      = mergedStyle (myColorTool, myVisMatTool, aParent.Style, aNodeInStack.Label, aNodeInStack.RefLabel);
+        aNodeInStack.Style      = mergedStyle (myColorTool, aParent.Style, aNodeInStack.Label, aNodeInStack.RefLabel);
         aNodeInStack.Id         = DefineChildId (aNodeInStack.Label, aParent.Id);
         aNodeInStack.ChildIter  = TDF_ChildIterator (aNodeInStack.RefLabel);
         myNodeStack.SetValue (myTop, aNodeInStack);
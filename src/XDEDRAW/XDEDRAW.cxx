@@ -31,10 +31,13 @@
 #include <Draw_PluginMacro.hxx>
 #include <Draw_ProgressIndicator.hxx>
 #include <Geom_Axis2Placement.hxx>
+#include <OSD_Parallel.hxx>
 #include <DEIGES_ConfigurationNode.hxx>
 #include <Prs3d_Drawer.hxx>
 #include <Prs3d_LineAspect.hxx>
 #include <Quantity_Color.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_ImmutableObject.hxx>
 #include <DESTL_ConfigurationNode.hxx>
 #include <DEGLTF_ConfigurationNode.hxx>
 #include <DEOBJ_ConfigurationNode.hxx>
@@ -102,6 +105,7 @@
 #include <XCAFDoc_Volume.hxx>
 #include <XCAFPrs.hxx>
 #include <XCAFPrs_AISObject.hxx>
+#include <XCAFPrs_DocumentExplorer.hxx>
 #include <XCAFPrs_Driver.hxx>
 #include <XDEDRAW.hxx>
 #include <XDEDRAW_Colors.hxx>
@@ -1703,6 +1707,150 @@ static Standard_Integer XRescaleGeometry(Draw_Interpretor& di,
   return 0;
 }
 
+//=======================================================================
+//function : readDocumentSignature
+//purpose  : Reads labels, attributes, shapes and styles of the document
+//           into the string used to compare results of concurrent reading
+//=======================================================================
+
+static TCollection_AsciiString readDocumentSignature (const Handle(TDocStd_Document)& theDoc)
+{
+  TCollection_AsciiString aSignature;
+  for (TDF_ChildIterator aLabIter (theDoc->GetData()->Root(), Standard_True); aLabIter.More(); aLabIter.Next())
+  {
+    TCollection_AsciiString anEntry;
+    TDF_Tool::Entry (aLabIter.Value(), anEntry);
+    aSignature += anEntry + " " + aLabIter.Value().NbAttributes();
+    Handle(TDataStd_Name) aName;
+    if (aLabIter.Value().FindAttribute (TDataStd_Name::GetID(), aName))
+    {
+      aSignature += TCollection_AsciiString (" ") + TCollection_AsciiString (aName->Get());
+    }
+    aSignature += "\n";
+  }
+
+  Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool (theDoc->Main());
+  TDF_LabelSequence aShapeLabels;
+  aShapeTool->GetShapes (aShapeLabels);
+  for (TDF_LabelSequence::Iterator aShapeIter (aShapeLabels); aShapeIter.More(); aShapeIter.Next())
+  {
+    const TDF_Label& aLabel = aShapeIter.Value();
+    const TopoDS_Shape aShape = XCAFDoc_ShapeTool::GetShape (aLabel);
+    TDF_Label aFoundLabel;
+    TCollection_AsciiString aFoundEntry;
+    if (aShapeTool->FindShape (aShape, aFoundLabel))
+    {
+      TDF_Tool::Entry (aFoundLabel, aFoundEntry);
+    }
+    TDF_LabelSequence aComponents;
+    XCAFDoc_ShapeTool::GetComponents (aLabel, aComponents);
+    aSignature += aFoundEntry + " " + (Standard_Integer )aShape.ShapeType()
+                + " " + (XCAFDoc_ShapeTool::IsAssembly (aLabel) ? 1 : 0) + " " + aComponents.Length() + "\n";
+  }
+
+  for (XCAFPrs_DocumentExplorer anExplorer (theDoc, XCAFPrs_DocumentExplorerFlags_None); anExplorer.More(); anExplorer.Next())
+  {
+    const XCAFPrs_DocumentNode& aNode = anExplorer.Current();
+    aSignature += aNode.Id;
+    if (aNode.Style.IsSetColorSurf())
+    {
+      aSignature += TCollection_AsciiString (" ") + Quantity_ColorRGBA::ColorToHex (aNode.Style.GetColorSurfRGBA());
+    }
+    aSignature += "\n";
+  }
+  return aSignature;
+}
+
+//=======================================================================
+//function : XCheckConcurrentRead
+//purpose  : Reads the document concurrently in read-only mode
+//=======================================================================
+
+static Standard_Integer XCheckConcurrentRead (Draw_Interpretor& di,
+                                              Standard_Integer argc,
+                                              const char ** argv)
+{
+  if (argc < 2)
+  {
+    di << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Handle(TDocStd_Document) aDoc;
+  DDocStd::GetDocument (argv[1], aDoc);
+  if (aDoc.IsNull())
+  {
+    di << "Syntax error: " << argv[1] << " is not a document\n";
+    return 1;
+  }
+
+  Standard_Integer aNbReads = 100;
+  for (Standard_Integer anArgIter = 2; anArgIter < argc; ++anArgIter)
+  {
+    TCollection_AsciiString anArg (argv[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-nbreads"
+     && anArgIter + 1 < argc)
+    {
+      aNbReads = Draw::Atoi (argv[++anArgIter]);
+    }
+    else
+    {
+      di << "Syntax error at '" << argv[anArgIter] << "'\n";
+      return 1;
+    }
+  }
+  if (aNbReads < 1)
+  {
+    di << "Syntax error: number of reads should be positive\n";
+    return 1;
+  }
+
+  const Standard_Boolean wasReadOnly = aDoc->GetData()->IsReadOnly();
+  XCAFDoc_DocumentTool::SetReadOnly (aDoc, Standard_True);
+  const TCollection_AsciiString aReference = readDocumentSignature (aDoc);
+
+  // all threads read the same document
+  NCollection_Array1<TCollection_AsciiString> aSignatures (0, aNbReads - 1);
+  OSD_Parallel::For (0, aNbReads, [&](Standard_Integer theIndex)
+  {
+    aSignatures.ChangeValue (theIndex) = readDocumentSignature (aDoc);
+  });
+
+  Standard_Integer aNbMismatches = 0;
+  for (NCollection_Array1<TCollection_AsciiString>::Iterator aSignIter (aSignatures); aSignIter.More(); aSignIter.Next())
+  {
+    if (aSignIter.Value() != aReference)
+    {
+      ++aNbMismatches;
+    }
+  }
+
+  // modification of the read-only document should be rejected
+  Standard_Boolean isModified = Standard_True;
+  try
+  {
+    OCC_CATCH_SIGNALS
+    aDoc->Main().NewChild();
+  }
+  catch (Standard_ImmutableObject const&)
+  {
+    isModified = Standard_False;
+  }
+  XCAFDoc_DocumentTool::SetReadOnly (aDoc, wasReadOnly);
+
+  di << "Concurrent reads: " << aNbReads << ", mismatches: " << aNbMismatches << "\n";
+  if (aNbMismatches != 0)
+  {
+    di << "Error: results of concurrent reading differ\n";
+  }
+  if (isModified)
+  {
+    di << "Error: label is added to read-only document\n";
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : testDoc
 //purpose  : Method to test destruction of document
@@ -1872,6 +2020,10 @@ void XDEDRAW::Init(Draw_Interpretor& di)
   di.Add("XRescaleGeometry",
          "Doc factor [-root label] [-force]: Applies geometrical scale to assembly",
          __FILE__, XRescaleGeometry, g);
+  di.Add("XCheckConcurrentRead",
+         "Doc [-nbReads N=100]: Reads labels, shapes and styles of the document concurrently"
+         "\n\t\t: in read-only mode and compares the results",
+         __FILE__, XCheckConcurrentRead, g);
 
   // Specialized commands
   XDEDRAW_Shapes::InitCommands ( di );
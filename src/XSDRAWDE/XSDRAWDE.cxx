@@ -368,6 +368,77 @@ static Standard_Integer WriteFile(Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : ConvertFiles
+//purpose  :
+//=======================================================================
+static Standard_Integer ConvertFiles(Draw_Interpretor& theDI,
+                                     Standard_Integer theNbArgs,
+                                     const char** theArgVec)
+{
+  TCollection_AsciiString aConfString;
+  Standard_Integer aNbJobs = 0;
+  TColStd_ListOfAsciiString aPaths;
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if ((anArg == "-conf") &&
+        (anArgIter + 1 < theNbArgs))
+    {
+      ++anArgIter;
+      aConfString = theArgVec[anArgIter];
+    }
+    else if ((anArg == "-jobs") &&
+             (anArgIter + 1 < theNbArgs))
+    {
+      ++anArgIter;
+      aNbJobs = Draw::Atoi(theArgVec[anArgIter]);
+    }
+    else
+    {
+      aPaths.Append(theArgVec[anArgIter]);
+    }
+  }
+  if (aPaths.IsEmpty() || aPaths.Size() % 2 != 0)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+  Handle(DE_Wrapper) aConf = DE_Wrapper::GlobalWrapper()->Copy();
+  if (!aConfString.IsEmpty() && !aConf->Load(aConfString))
+  {
+    theDI << "Error: configuration is incorrect\n";
+    return 1;
+  }
+
+  NCollection_Array1<DE_Wrapper::BatchItem> anItems(1, aPaths.Size() / 2);
+  Standard_Integer anIndex = 1;
+  for (TColStd_ListOfAsciiString::Iterator aPathIter(aPaths); aPathIter.More(); aPathIter.Next(), ++anIndex)
+  {
+    anItems.ChangeValue(anIndex).InputPath = aPathIter.Value();
+    aPathIter.Next();
+    anItems.ChangeValue(anIndex).OutputPath = aPathIter.Value();
+  }
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(theDI, 1);
+  const Standard_Boolean isDone = aConf->ConvertBatch(anItems, aNbJobs, aProgress->Start());
+  for (NCollection_Array1<DE_Wrapper::BatchItem>::Iterator anItemIter(anItems); anItemIter.More(); anItemIter.Next())
+  {
+    const DE_Wrapper::BatchItem& anItem = anItemIter.Value();
+    theDI << anItem.InputPath << " -> " << anItem.OutputPath << ": ";
+    if (anItem.IsDone)
+    {
+      theDI << "Done (read " << anItem.ReadTime << " s, write " << anItem.WriteTime << " s)\n";
+    }
+    else
+    {
+      theDI << "Error: " << anItem.Error << "\n";
+    }
+  }
+  return isDone ? 0 : 1;
+}
+
 //=======================================================================
 //function : Factory
 //purpose  :
@@ -418,6 +489,12 @@ void XSDRAWDE::Factory(Draw_Interpretor& theDI)
             "writefile shapeName filePath [-conf <value|path>]\n"
             "\n\t\t: Write CAD file to shape with registered format's providers. Use global configuration by default.",
             __FILE__, WriteFile, aGroup);
+  theDI.Add("ConvertFiles",
+            "ConvertFiles inPath1 outPath1 [inPath2 outPath2 ...] [-jobs N] [-conf <value|path>]\n"
+            "\n\t\t: Convert CAD files with registered format's providers in parallel threads."
+            "\n\t\t: Use global configuration by default."
+            "\n\t\t:   '-jobs' - maximum number of files converted at once. Default is number of threads",
+            __FILE__, ConvertFiles, aGroup);
 
   // Load XSDRAW session for pilot activation
   XSDRAW::LoadDraw(theDI);
@@ -131,6 +131,7 @@ static Standard_Integer ReadGltf(Draw_Interpretor& theDI,
   Standard_Boolean toSkipLateDataLoading = Standard_False;
   Standard_Boolean toKeepLateData = Standard_True;
   Standard_Boolean toPrintDebugInfo = Standard_False;
+  Standard_Boolean toSkipUnusedJson = Standard_False;
   Standard_Boolean toLoadAllScenes = Standard_False;
   Standard_Boolean toPrintAssetInfo = Standard_False;
   Standard_Boolean isNoDoc = (TCollection_AsciiString(theArgVec[0]) == "readgltf");
@@ -176,6 +177,10 @@ static Standard_Integer ReadGltf(Draw_Interpretor& theDI,
     {
       toPrintDebugInfo = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
     }
+    else if (anArgCase == "-skipunusedjson")
+    {
+      toSkipUnusedJson = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
     else if (anArgCase == "-listexternalfiles"
       || anArgCase == "-listexternals"
       || anArgCase == "-listexternal"
@@ -251,6 +256,7 @@ static Standard_Integer ReadGltf(Draw_Interpretor& theDI,
   aReader.SetToSkipLateDataLoading(toSkipLateDataLoading);
   aReader.SetToKeepLateData(toKeepLateData);
   aReader.SetToPrintDebugMessages(toPrintDebugInfo);
+  aReader.SetSkipUnusedJson(toSkipUnusedJson);
   aReader.SetLoadAllScenes(toLoadAllScenes);
   if (aDestName.IsEmpty())
   {
@@ -314,6 +320,8 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
   RWMesh_CoordinateSystem aSystemCoordSys = RWMesh_CoordinateSystem_Zup;
   bool toForceUVExport = false, toEmbedTexturesInGlb = true;
   bool toMergeFaces = false, toSplitIndices16 = false;
+  bool toDeduplicateMeshes = false, toUseMeshInstancing = false;
+  Standard_Integer aMinInstances = 2;
   bool isParallel = false;
   RWMesh_NameFormat aNodeNameFormat = RWMesh_NameFormat_InstanceOrProduct;
   RWMesh_NameFormat aMeshNameFormat = RWMesh_NameFormat_Product;
@@ -364,6 +372,32 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
         ++anArgIter;
       }
     }
+    else if (anArgCase == "-deduplicatemeshes"
+      || anArgCase == "-dedupmeshes")
+    {
+      toDeduplicateMeshes = true;
+      if (anArgIter + 1 < theNbArgs
+        && Draw::ParseOnOff(theArgVec[anArgIter + 1], toDeduplicateMeshes))
+      {
+        ++anArgIter;
+      }
+    }
+    else if (anArgCase == "-meshinstancing"
+      || anArgCase == "-instancing")
+    {
+      toUseMeshInstancing = true;
+      if (anArgIter + 1 < theNbArgs
+        && Draw::ParseOnOff(theArgVec[anArgIter + 1], toUseMeshInstancing))
+      {
+        ++anArgIter;
+      }
+    }
+    else if (anArgCase == "-mininstances"
+      && anArgIter + 1 < theNbArgs
+      && Draw::ParseInteger(theArgVec[anArgIter + 1], aMinInstances))
+    {
+      ++anArgIter;
+    }
     else if (anArgIter + 1 < theNbArgs
       && (anArgCase == "-systemcoordinatesystem"
         || anArgCase == "-systemcoordsystem"
@@ -519,6 +553,9 @@ static Standard_Integer WriteGltf(Draw_Interpretor& theDI,
   aWriter.SetToEmbedTexturesInGlb(toEmbedTexturesInGlb);
   aWriter.SetMergeFaces(toMergeFaces);
   aWriter.SetSplitIndices16(toSplitIndices16);
+  aWriter.SetDeduplicateMeshes(toDeduplicateMeshes);
+  aWriter.SetMeshInstancing(toUseMeshInstancing);
+  aWriter.SetMeshInstancingThreshold(aMinInstances);
   aWriter.SetParallel(isParallel);
   aWriter.SetCompressionParameters(aDracoParameters);
   aWriter.ChangeCoordinateSystemConverter().SetInputLengthUnit(aScaleFactorM);
@@ -554,6 +591,8 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
             "\n\t\t:             about deferred storage to load/unload this data later."
             "\n\t\t:   -allScenes load all scenes defined in the document instead of default one (false by default)"
             "\n\t\t:   -toPrintDebugInfo print additional debug information during data reading"
+            "\n\t\t:   -skipUnusedJson skip JSON elements not used by the reader (animations, skins, cameras, etc.)"
+            "\n\t\t:                   while parsing the file to reduce memory footprint (false by default)"
             "\n\t\t:   -assetInfo print asset information",
             __FILE__, ReadGltf, aGroup);
   theDI.Add("readgltf",
@@ -565,6 +604,7 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
             "\n\t\t:            [-systemCoordSys {Zup|Yup}]=Zup"
             "\n\t\t:            [-comments Text] [-author Name]"
             "\n\t\t:            [-forceUVExport]=0 [-texturesSeparate]=0 [-mergeFaces]=0 [-splitIndices16]=0"
+            "\n\t\t:            [-deduplicateMeshes]=0 [-meshInstancing]=0 [-minInstances Count]=2"
             "\n\t\t:            [-nodeNameFormat {empty|product|instance|instOrProd|prodOrInst|prodAndInst|verbose}]=instOrProd"
             "\n\t\t:            [-meshNameFormat {empty|product|instance|instOrProd|prodOrInst|prodAndInst|verbose}]=product"
             "\n\t\t:            [-draco]=0 [-compressionLevel {0-10}]=7 [-quantizePositionBits Value]=14 [-quantizeNormalBits Value]=10"
@@ -576,6 +616,10 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
             "\n\t\t:   -mergeFaces       merge Faces within the same Mesh"
             "\n\t\t:   -splitIndices16   split Faces to keep 16-bit indices when -mergeFaces is enabled"
             "\n\t\t:   -forceUVExport    always export UV coordinates"
+            "\n\t\t:   -deduplicateMeshes write identical triangulation data of distinct shapes only once"
+            "\n\t\t:   -meshInstancing   write repeated meshes within the same parent node"
+            "\n\t\t:                     using EXT_mesh_gpu_instancing extension"
+            "\n\t\t:   -minInstances     minimal number of instances for -meshInstancing (by default 2)"
             "\n\t\t:   -texturesSeparate write textures to separate files"
             "\n\t\t:   -nodeNameFormat   name format for Nodes"
             "\n\t\t:   -meshNameFormat   name format for Meshes"
@@ -588,7 +632,7 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
             "\n\t\t:   -quantizeGenericBits  quantization bits for skinning attribute (joint indices and joint weights)"
             "\n                        and custom attributes when using Draco compression (by default 12)"
             "\n\t\t:   -unifiedQuantization  quantization is applied on each primitive separately if this option is false"
-            "\n\t\t:   -parallel             use multithreading for Draco compression",
+            "\n\t\t:   -parallel             use multithreading for writing binary data and Draco compression",
             __FILE__, WriteGltf, aGroup);
   theDI.Add("writegltf",
             "writegltf shape file",
@@ -22,7 +22,9 @@
 #include <Draw_Interpretor.hxx>
 #include <Draw_PluginMacro.hxx>
 #include <Draw_ProgressIndicator.hxx>
+#include <Message.hxx>
 #include <RWMesh_FaceIterator.hxx>
+#include <RWPly_CafReader.hxx>
 #include <RWPly_CafWriter.hxx>
 #include <RWPly_PlyWriterContext.hxx>
 #include <TDataStd_Name.hxx>
@@ -36,6 +38,181 @@
 #include <XSControl_WorkSession.hxx>
 #include <XSDRAW.hxx>
 
+//=============================================================================
+//function : parseCoordinateSystem
+//purpose  : Parse RWMesh_CoordinateSystem enumeration
+//=============================================================================
+static bool parseCoordinateSystem(const char* theArg,
+                                  RWMesh_CoordinateSystem& theSystem)
+{
+  TCollection_AsciiString aCSStr(theArg);
+  aCSStr.LowerCase();
+  if (aCSStr == "zup")
+  {
+    theSystem = RWMesh_CoordinateSystem_Zup;
+  }
+  else if (aCSStr == "yup")
+  {
+    theSystem = RWMesh_CoordinateSystem_Yup;
+  }
+  else
+  {
+    return Standard_False;
+  }
+  return Standard_True;
+}
+
+//=============================================================================
+//function : ReadPly
+//purpose  : Reads PLY file
+//=============================================================================
+static Standard_Integer ReadPly (Draw_Interpretor& theDI,
+                                 Standard_Integer theNbArgs,
+                                 const char** theArgVec)
+{
+  TCollection_AsciiString aDestName, aFilePath;
+  Standard_Boolean toUseExistingDoc = Standard_False;
+  Standard_Real aFileUnitFactor = -1.0;
+  RWMesh_CoordinateSystem aResultCoordSys = RWMesh_CoordinateSystem_Undefined, aFileCoordSys = RWMesh_CoordinateSystem_Undefined;
+  Standard_Boolean isSinglePrecision = Standard_False;
+  bool toParallel = false;
+  Standard_Boolean isNoDoc = (TCollection_AsciiString(theArgVec[0]) == "readply");
+  for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgIter + 1 < theNbArgs
+     && (anArgCase == "-unit"
+      || anArgCase == "-units"
+      || anArgCase == "-fileunit"
+      || anArgCase == "-fileunits"))
+    {
+      const TCollection_AsciiString aUnitStr (theArgVec[++anArgIter]);
+      aFileUnitFactor = UnitsAPI::AnyToSI (1.0, aUnitStr.ToCString());
+      if (aFileUnitFactor <= 0.0)
+      {
+        Message::SendFail() << "Syntax error: wrong length unit '" << aUnitStr << "'";
+        return 1;
+      }
+    }
+    else if (anArgIter + 1 < theNbArgs
+          && (anArgCase == "-filecoordinatesystem"
+           || anArgCase == "-filecoordsystem"
+           || anArgCase == "-filecoordsys"))
+    {
+      if (!parseCoordinateSystem (theArgVec[++anArgIter], aFileCoordSys))
+      {
+        Message::SendFail() << "Syntax error: unknown coordinate system '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    else if (anArgIter + 1 < theNbArgs
+          && (anArgCase == "-resultcoordinatesystem"
+           || anArgCase == "-resultcoordsystem"
+           || anArgCase == "-resultcoordsys"
+           || anArgCase == "-rescoordsys"))
+    {
+      if (!parseCoordinateSystem (theArgVec[++anArgIter], aResultCoordSys))
+      {
+        Message::SendFail() << "Syntax error: unknown coordinate system '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    else if (anArgCase == "-singleprecision"
+          || anArgCase == "-singleprec")
+    {
+      isSinglePrecision = Standard_True;
+      if (anArgIter + 1 < theNbArgs
+       && Draw::ParseOnOff (theArgVec[anArgIter + 1], isSinglePrecision))
+      {
+        ++anArgIter;
+      }
+    }
+    else if (anArgCase == "-parallel"
+          || anArgCase == "-noparallel")
+    {
+      toParallel = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (!isNoDoc
+          && (anArgCase == "-nocreate"
+           || anArgCase == "-nocreatedoc"))
+    {
+      toUseExistingDoc = Standard_True;
+      if (anArgIter + 1 < theNbArgs
+       && Draw::ParseOnOff (theArgVec[anArgIter + 1], toUseExistingDoc))
+      {
+        ++anArgIter;
+      }
+    }
+    else if (aDestName.IsEmpty())
+    {
+      aDestName = theArgVec[anArgIter];
+    }
+    else if (aFilePath.IsEmpty())
+    {
+      aFilePath = theArgVec[anArgIter];
+    }
+    else
+    {
+      Message::SendFail() << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aFilePath.IsEmpty())
+  {
+    Message::SendFail() << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator (theDI, 1);
+  Handle(TDocStd_Document) aDoc;
+  if (!isNoDoc)
+  {
+    Handle(TDocStd_Application) anApp = DDocStd::GetApplication();
+    Standard_CString aNameVar = aDestName.ToCString();
+    DDocStd::GetDocument (aNameVar, aDoc, Standard_False);
+    if (aDoc.IsNull())
+    {
+      if (toUseExistingDoc)
+      {
+        Message::SendFail() << "Error: document with name " << aDestName << " does not exist";
+        return 1;
+      }
+      anApp->NewDocument (TCollection_ExtendedString ("BinXCAF"), aDoc);
+    }
+    else if (!toUseExistingDoc)
+    {
+      Message::SendFail() << "Error: document with name " << aDestName << " already exists";
+      return 1;
+    }
+  }
+  const Standard_Real aScaleFactorM = XSDRAW::GetLengthUnit() / 1000;
+
+  RWPly_CafReader aReader;
+  aReader.SetSinglePrecision (isSinglePrecision);
+  aReader.SetParallel (toParallel);
+  aReader.SetSystemLengthUnit (aScaleFactorM);
+  aReader.SetSystemCoordinateSystem (aResultCoordSys);
+  aReader.SetFileLengthUnit (aFileUnitFactor);
+  aReader.SetFileCoordinateSystem (aFileCoordSys);
+  aReader.SetDocument (aDoc);
+  if (!aReader.Perform (aFilePath, aProgress->Start()))
+  {
+    Message::SendFail() << "Error: file '" << aFilePath << "' reading failed";
+  }
+  if (isNoDoc)
+  {
+    DBRep::Set (aDestName.ToCString(), aReader.SingleShape());
+  }
+  else
+  {
+    Handle(DDocStd_DrawDocument) aDrawDoc = new DDocStd_DrawDocument (aDoc);
+    TDataStd_Name::Set (aDoc->GetData()->Root(), aDestName);
+    Draw::Set (aDestName.ToCString(), aDrawDoc);
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : writeply
 //purpose  : write PLY file
@@ -320,6 +497,23 @@ void XSDRAWPLY::Factory(Draw_Interpretor& theDI)
 
   const char* aGroup = "XSTEP-STL/VRML";  // Step transfer file commands
   //XSDRAW::LoadDraw(theCommands);
+  theDI.Add("ReadPly",
+            "ReadPly Doc file [-fileCoordSys {Zup|Yup}] [-fileUnit Unit]"
+            "\n\t\t:                  [-resultCoordSys {Zup|Yup}] [-singlePrecision]"
+            "\n\t\t:                  [-parallel {on|off}]=off [-noCreateDoc]"
+            "\n\t\t: Read PLY file into XDE document."
+            "\n\t\t:   -fileUnit       length unit of PLY file content;"
+            "\n\t\t:   -fileCoordSys   coordinate system defined by PLY file; no conversion when not specified."
+            "\n\t\t:   -resultCoordSys result coordinate system; no conversion when not specified."
+            "\n\t\t:   -singlePrecision truncate vertex data to single precision during read; FALSE by default."
+            "\n\t\t:   -parallel       decode the file body in parallel threads; FALSE by default."
+            "\n\t\t:   -noCreateDoc    read into existing XDE document.",
+            __FILE__, ReadPly, aGroup);
+  theDI.Add("readply",
+            "readply shape file [-fileCoordSys {Zup|Yup}] [-fileUnit Unit]"
+            "\n\t\t:                    [-resultCoordSys {Zup|Yup}] [-singlePrecision] [-parallel {on|off}]=off"
+            "\n\t\t: Same as ReadPly but reads PLY file into a shape instead of a document.",
+            __FILE__, ReadPly, aGroup);
   theDI.Add("WritePly", R"(
 WritePly Doc file [-normals {0|1}]=1 [-colors {0|1}]=1 [-uv {0|1}]=0 [-partId {0|1}]=1 [-faceId {0|1}]=0
                   [-pointCloud {0|1}]=0 [-distance Value]=0.0 [-density Value] [-tolerance Value]
@@ -49,9 +49,18 @@
 #include <XSControl_WorkSession.hxx>
 #include <XSDRAW.hxx>
 
+#include <memory>
+
 namespace
 {
   using ExternalFileMap = NCollection_DataMap<TCollection_AsciiString, Handle(STEPCAFControl_ExternFile)>;
+
+  //! Returns readers with deferred shapes mapped by document name.
+  static NCollection_DataMap<TCollection_AsciiString, std::shared_ptr<STEPCAFControl_Reader>>& deferredReaders()
+  {
+    static NCollection_DataMap<TCollection_AsciiString, std::shared_ptr<STEPCAFControl_Reader>> THE_READERS;
+    return THE_READERS;
+  }
 }
 
 
@@ -651,6 +660,7 @@ static Standard_Integer ReadStep(Draw_Interpretor& theDI,
   Standard_CString aDocumentName = NULL;
   TCollection_AsciiString aFilePath, aModeStr;
   bool toTestStream = false;
+  bool toDeferShapes = false;
 
   for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
   {
@@ -661,6 +671,10 @@ static Standard_Integer ReadStep(Draw_Interpretor& theDI,
     {
       toTestStream = true;
     }
+    else if (anArgCase == "-defershapes")
+    {
+      toDeferShapes = true;
+    }
     else if (aDocumentName == NULL)
     {
       aDocumentName = theArgVec[anArgIter];
@@ -692,7 +706,9 @@ static Standard_Integer ReadStep(Draw_Interpretor& theDI,
     theDI << " Model taken from the session : " << aFileName << "\n";
   }
 
-  STEPCAFControl_Reader aReader(XSDRAW::Session(), isFileMode);
+  std::shared_ptr<STEPCAFControl_Reader> aReaderPtr = std::make_shared<STEPCAFControl_Reader>(XSDRAW::Session(), isFileMode);
+  STEPCAFControl_Reader& aReader = *aReaderPtr;
+  aReader.SetDeferredShapeMode(toDeferShapes);
   if (!aModeStr.IsEmpty())
   {
     Standard_Boolean aMode = Standard_True;
@@ -792,6 +808,12 @@ static Standard_Integer ReadStep(Draw_Interpretor& theDI,
 
   theDI << "Document saved with name " << aDocumentName;
 
+  deferredReaders().UnBind(aDocumentName);
+  if (aReader.NbDeferredShapes() > 0)
+  {
+    deferredReaders().Bind(aDocumentName, aReaderPtr);
+  }
+
   XSDRAW::CollectActiveWorkSessions(aFilePath);
   for (ExternalFileMap::Iterator anIter(aReader.ExternFiles()); anIter.More(); anIter.Next())
   {
@@ -801,6 +823,63 @@ static Standard_Integer ReadStep(Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : ReadStepDeferred
+//purpose  : Transfer geometry deferred by ReadStep -deferShapes
+//=======================================================================
+static Standard_Integer ReadStepDeferred(Draw_Interpretor& theDI,
+                                         Standard_Integer theNbArgs,
+                                         const char** theArgVec)
+{
+  if (theNbArgs < 2)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  Handle(TDocStd_Document) aDocument;
+  DDocStd::GetDocument(theArgVec[1], aDocument);
+  if (aDocument.IsNull())
+  {
+    return 1;
+  }
+
+  const std::shared_ptr<STEPCAFControl_Reader>* aReaderPtr = deferredReaders().Seek(theArgVec[1]);
+  if (aReaderPtr == NULL)
+  {
+    theDI << "Document " << theArgVec[1] << " has no deferred shapes";
+    return 0;
+  }
+
+  TDF_LabelSequence aLabels;
+  for (Standard_Integer anArgIter = 2; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TDF_Label aLabel;
+    DDF::FindLabel(aDocument->GetData(), theArgVec[anArgIter], aLabel);
+    if (aLabel.IsNull())
+    {
+      Message::SendFail() << "Syntax error: label " << theArgVec[anArgIter] << " is not found";
+      return 1;
+    }
+    aLabels.Append(aLabel);
+  }
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(theDI);
+  const Standard_Boolean isDone = (*aReaderPtr)->TransferDeferredShapes(aDocument, aLabels, aProgress->Start());
+  const Standard_Integer aNbDeferred = (*aReaderPtr)->NbDeferredShapes();
+  if (aNbDeferred == 0)
+  {
+    deferredReaders().UnBind(theArgVec[1]);
+  }
+  if (!isDone)
+  {
+    theDI << "Error: geometry of some parts cannot be transferred";
+    return 1;
+  }
+  theDI << "Remaining deferred shapes: " << aNbDeferred;
+  return 0;
+}
+
 //=======================================================================
 //function : WriteStep
 //purpose  : Write DECAF document to STEP
@@ -1047,10 +1126,18 @@ void XSDRAWSTEP::Factory(Draw_Interpretor& theDI)
   theDI.Add("dumpassembly", "TEST", __FILE__, dumpassembly, aGroup);
   theDI.Add("stepfileunits", "stepfileunits name_file", __FILE__, stepfileunits, aGroup);
   theDI.Add("ReadStep",
-            "Doc filename [mode] [-stream]"
+            "Doc filename [mode] [-stream] [-deferShapes]"
             "\n\t\t: Read STEP file to a document."
-            "\n\t\t:  -stream read using istream reading interface (testing)",
+            "\n\t\t:  -stream read using istream reading interface (testing)"
+            "\n\t\t:  -deferShapes read assembly structure and attributes only;"
+            "\n\t\t:   geometry of parts is translated later by ReadStepDeferred",
             __FILE__, ReadStep, aGroup);
+  theDI.Add("ReadStepDeferred",
+            "Doc [label1 ... labelN]"
+            "\n\t\t: Translate geometry of parts deferred by ReadStep -deferShapes"
+            "\n\t\t: (all parts or parts within specified labels) in parallel threads."
+            "\n\t\t: Should be called before the next STEP file is read.",
+            __FILE__, ReadStepDeferred, aGroup);
   theDI.Add("WriteStep",
             "Doc filename [mode=a [multifile_prefix] [label]] [-stream]"
             "\n\t\t: Write DECAF document to STEP file"
@@ -18,6 +18,8 @@
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
 #include <CDM_MetaData.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
 #include <OSD_FileSystem.hxx>
 #include <OSD_Path.hxx>
 #include <PCDM_DOMHeaderParser.hxx>
@@ -25,6 +27,7 @@
 #include <TCollection_AsciiString.hxx>
 #include <TCollection_ExtendedString.hxx>
 #include <TDF_Data.hxx>
+#include <TDF_Label.hxx>
 #include <TDocStd_Document.hxx>
 #include <TDocStd_Owner.hxx>
 #include <UTL.hxx>
@@ -36,6 +39,8 @@
 #include <XmlObjMgt.hxx>
 #include <XmlObjMgt_RRelocationTable.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(XmlLDrivers_DocumentRetrievalDriver,PCDM_RetrievalDriver)
 
 #ifdef _MSC_VER
@@ -51,6 +56,10 @@ IMPLEMENT_STANDARD_RTTIEXT(XmlLDrivers_DocumentRetrievalDriver,PCDM_RetrievalDri
 #define MODIFICATION_COUNTER "MODIFICATION_COUNTER: "
 #define REFERENCE_COUNTER    "REFERENCE_COUNTER: "
 
+IMPLEMENT_DOMSTRING (TagString,    "tag")
+IMPLEMENT_DOMSTRING (LabelString,  "label")
+IMPLEMENT_DOMSTRING (ShapesString, "shapes")
+
 //#define TAKE_TIMES
 static void take_time (const Standard_Integer, const char *,
                        const Handle(Message_Messenger)&)
@@ -145,11 +154,216 @@ static TCollection_AsciiString AbsolutePath(
   return retx;
 }
 
+//=======================================================================
+//function : findShapeSection
+//purpose  : Returns the position of the start tag of the shapes section
+//           searching it backward from the end of the stream, or -1
+//=======================================================================
+static std::streamoff findShapeSection (Standard_IStream&    theIStream,
+                                        const std::streamoff theStart)
+{
+  static const char THE_SHAPES_TAG[] = "<shapes";
+  const std::streamoff aTagLen    = sizeof(THE_SHAPES_TAG) - 1;
+  const std::streamoff aChunkSize = 65536;
+
+  theIStream.clear();
+  if (!theIStream.seekg (0, std::ios_base::end))
+    return -1;
+  const std::streamoff anEnd = theIStream.tellg();
+  NCollection_Array1<char> aBuffer (0, (Standard_Integer )(aChunkSize + aTagLen));
+  for (std::streamoff aPos = anEnd; aPos > theStart; )
+  {
+    // the chunk overlaps the previous one to find the tag crossing their boundary
+    const std::streamoff aBegin = std::max (theStart, aPos - aChunkSize);
+    const std::streamoff aLen   = std::min (aPos + aTagLen + 1, anEnd) - aBegin;
+    theIStream.seekg (aBegin, std::ios_base::beg);
+    theIStream.read (&aBuffer.ChangeFirst(), aLen);
+    if (theIStream.gcount() != aLen)
+      break;
+
+    for (std::streamoff anIndex = aPos - aBegin - 1; anIndex >= 0; --anIndex)
+    {
+      if (anIndex + aTagLen >= aLen
+       || strncmp (&aBuffer.Value ((Standard_Integer )anIndex), THE_SHAPES_TAG, aTagLen) != 0)
+        continue;
+
+      const char aNext = aBuffer.Value ((Standard_Integer )(anIndex + aTagLen));
+      if (aNext == '>' || aNext == '/' || aNext == ' ' || aNext == '\t' || aNext == '\r' || aNext == '\n')
+        return aBegin + anIndex;
+    }
+    aPos = aBegin;
+  }
+  theIStream.clear();
+  return -1;
+}
+
+//=======================================================================
+//class    : DocumentParser
+//purpose  : Parser restoring labels and attributes of the document
+//           element by element while reading the stream
+//=======================================================================
+class XmlLDrivers_DocumentRetrievalDriver::DocumentParser : public LDOMParser
+{
+public:
+
+  //! Constructor.
+  DocumentParser (XmlLDrivers_DocumentRetrievalDriver& theDriver,
+                  const Handle(CDM_Document)&          theNewDocument,
+                  const Handle(CDM_Application)&       theApplication,
+                  const XmlObjMgt_Element&             theShapesElement,
+                  Message_ProgressScope&               theScope)
+  : myDriver         (theDriver),
+    myNewDocument    (theNewDocument),
+    myApplication    (theApplication),
+    myShapesElement  (theShapesElement),
+    myScope          (theScope),
+    myData           (new TDF_Data()),
+    myStatus         (PCDM_RS_OK),
+    myIsHeaderRead   (Standard_False)
+  {
+    setDropping (Standard_True);
+  }
+
+  //! Returns the restored data framework.
+  const Handle(TDF_Data)& Data() const { return myData; }
+
+  //! Returns the status of reading set when the parsing is aborted.
+  PCDM_ReaderStatus Status() const { return myStatus; }
+
+  //! Returns true if the header of the document has been read.
+  Standard_Boolean IsHeaderRead() const { return myIsHeaderRead; }
+
+  //! Returns the driver of shapes returned by ReadShapeSection().
+  const Handle(XmlMDF_ADriver)& NamedShapeDriver() const { return myNSDriver; }
+
+  //! Reads the header of the document preceding its labels.
+  Standard_Boolean ReadHeader()
+  {
+    myIsHeaderRead = Standard_True;
+    const XmlObjMgt_Element aRoot = getDocument().getDocumentElement();
+    if (!myDriver.readHeader (aRoot, myShapesElement.isNull() ? aRoot : myShapesElement,
+                              myNewDocument, myApplication, myNSDriver, myScope.Next()))
+    {
+      myStatus = myDriver.myReaderStatus;
+      return Standard_False;
+    }
+    myDriver.myDrivers->CreateDrvMap (myDriverMap);
+    return Standard_True;
+  }
+
+protected:
+
+  //! Creates the label or defers reading of the attribute until its end tag.
+  virtual Standard_Boolean startElement() Standard_OVERRIDE
+  {
+    Item anItem;
+    anItem.Element = getCurrentElement();
+    anItem.Kind = ItemKind_Other;
+    const XmlObjMgt_DOMString aName = anItem.Element.getTagName();
+    if (myItems.Size() == 1)
+    {
+      // children of the document element
+      if (aName.equals (::LabelString()))
+      {
+        if (!myIsHeaderRead && !ReadHeader())
+          return Standard_True;
+        anItem.Label = myData->Root();
+        anItem.Kind = ItemKind_Label;
+        dropCurrentElement();
+      }
+      else if (aName.equals (::ShapesString()))
+      {
+        // already read before the labels
+        dropCurrentElement();
+      }
+    }
+    else if (!myItems.IsEmpty() && myItems.Last().Kind == ItemKind_Label)
+    {
+      if (aName.equals (::LabelString()))
+      {
+        Standard_Integer aTag = 0;
+        XmlObjMgt_DOMString aTagStr (anItem.Element.getAttribute (::TagString()));
+        if (!aTagStr.GetInteger (aTag))
+        {
+          TCollection_ExtendedString anErrorMessage =
+            TCollection_ExtendedString ("Wrong Tag value for OCAF Label: ") + aTagStr;
+          myApplication->MessageDriver()->Send (anErrorMessage, Message_Fail);
+          myStatus = PCDM_RS_MakeFailure;
+          return Standard_True;
+        }
+        anItem.Label = myItems.Last().Label.FindChild (aTag, Standard_True);
+        anItem.Kind = ItemKind_Label;
+      }
+      else
+      {
+        anItem.Kind = ItemKind_Attribute;
+      }
+      dropCurrentElement();
+    }
+    myItems.Append (anItem);
+    return Standard_False;
+  }
+
+  //! Reads the attribute which element is completely parsed.
+  virtual Standard_Boolean endElement() Standard_OVERRIDE
+  {
+    const Item anItem = myItems.Last();
+    myItems.EraseLast();
+    if (anItem.Kind == ItemKind_Attribute)
+    {
+      if (XmlMDF::ReadAttribute (anItem.Element, myItems.Last().Label,
+                                 myDriver.myRelocTable, myDriverMap) < 0)
+      {
+        myStatus = PCDM_RS_MakeFailure;
+        return Standard_True;
+      }
+    }
+    else if (anItem.Kind == ItemKind_Label && !myScope.More())
+    {
+      myStatus = PCDM_RS_UserBreak;
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+private:
+
+  enum ItemKind
+  {
+    ItemKind_Other,
+    ItemKind_Label,
+    ItemKind_Attribute
+  };
+
+  //! Element of the currently parsed branch.
+  struct Item
+  {
+    XmlObjMgt_Element Element;
+    TDF_Label         Label;
+    ItemKind          Kind;
+  };
+
+private:
+
+  XmlLDrivers_DocumentRetrievalDriver& myDriver;
+  Handle(CDM_Document)                 myNewDocument;
+  Handle(CDM_Application)              myApplication;
+  XmlObjMgt_Element                    myShapesElement;
+  Message_ProgressScope&               myScope;
+  Handle(TDF_Data)                     myData;
+  Handle(XmlMDF_ADriver)               myNSDriver;
+  XmlMDF_MapOfDriver                   myDriverMap;
+  NCollection_Vector<Item>             myItems;
+  PCDM_ReaderStatus                    myStatus;
+  Standard_Boolean                     myIsHeaderRead;
+};
+
 //=======================================================================
 //function : XmlLDrivers_DocumentRetrievalDriver
 //purpose  : Constructor
 //=======================================================================
 XmlLDrivers_DocumentRetrievalDriver::XmlLDrivers_DocumentRetrievalDriver()
+: myIsStreamingMode (Standard_False)
 {
   myReaderStatus = PCDM_RS_OK;
 }
@@ -201,13 +415,19 @@ void XmlLDrivers_DocumentRetrievalDriver::Read (Standard_IStream&              t
   Handle(Message_Messenger) aMessageDriver = theApplication -> MessageDriver();
   ::take_time (~0, " +++++ Start RETRIEVE procedures ++++++", aMessageDriver);
 
-  // 1. Read DOM_Document from file
-  LDOMParser aParser;
-
   // if myFileName is not empty, "document" tag is required to be read 
   // from the received document
   Standard_Boolean aWithoutRoot = myFileName.IsEmpty();
 
+  if (myIsStreamingMode
+   && readStreaming (theIStream, aWithoutRoot, theNewDocument, theApplication, theRange))
+  {
+    return;
+  }
+
+  // 1. Read DOM_Document from file
+  LDOMParser aParser;
+
   if (aParser.parse(theIStream, Standard_False, aWithoutRoot))
   {
     TCollection_AsciiString aData;
@@ -233,6 +453,59 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument
                                  const Handle(CDM_Document)&    theNewDocument,
                                  const Handle(CDM_Application)& theApplication,
                                 const Message_ProgressRange&    theRange)
+{
+  const Handle(Message_Messenger) aMsgDriver =
+    theApplication -> MessageDriver();
+  Message_ProgressScope aPS(theRange, "Reading document", 2);
+  Handle(XmlMDF_ADriver) aNSDriver;
+  if (!readHeader (theElement, theElement, theNewDocument, theApplication, aNSDriver, aPS.Next()))
+    return;
+
+  // 5. Read document contents
+  try
+  {
+    OCC_CATCH_SIGNALS
+#ifdef OCCT_DEBUG
+    TCollection_ExtendedString aMessage ("PasteDocument");
+    aMsgDriver ->Send (aMessage.ToExtString(), Message_Trace);
+#endif
+    if (!MakeDocument(theElement, theNewDocument, aPS.Next()))
+      myReaderStatus = PCDM_RS_MakeFailure;
+    else
+      myReaderStatus = PCDM_RS_OK;
+  }
+  catch (Standard_Failure const& anException)
+  {
+    TCollection_ExtendedString anErrorString (anException.GetMessageString());
+    aMsgDriver ->Send (anErrorString.ToExtString(), Message_Fail);
+  }
+  if (!aPS.More())
+  {
+    myReaderStatus = PCDM_RS_UserBreak;
+    return;
+  }
+
+  //    Wipe off the shapes written to the <shapes> section
+  ShapeSetCleaning(aNSDriver);
+
+  //    Clean the relocation table.
+  //    If the application needs to use myRelocTable to retrieve additional
+  //    data from LDOM, this method should be reimplemented avoiding this step
+  myRelocTable.Clear();
+  ::take_time (0, " +++++ Fin reading data OCAF : ", aMsgDriver);
+}
+
+//=======================================================================
+//function : readHeader
+//purpose  : 
+//=======================================================================
+Standard_Boolean XmlLDrivers_DocumentRetrievalDriver::readHeader
+                                (const XmlObjMgt_Element&       theElement,
+                                 const XmlObjMgt_Element&       theShapesElement,
+                                 const Handle(CDM_Document)&    theNewDocument,
+                                 const Handle(CDM_Application)& theApplication,
+                                 Handle(XmlMDF_ADriver)&        theNSDriver,
+                                 const Message_ProgressRange&   theRange)
 {
   const Handle(Message_Messenger) aMsgDriver =
     theApplication -> MessageDriver();
@@ -274,7 +547,7 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument
       myReaderStatus = PCDM_RS_NoVersion;
       if(!aMsgDriver.IsNull()) 
         aMsgDriver->Send(aMsg.ToExtString(), Message_Fail);
-      return;
+      return Standard_False;
     }
 
     Standard_Boolean isRef = Standard_False;
@@ -426,17 +699,17 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument
       }
     }
   }
-  Message_ProgressScope aPS(theRange, "Reading document", 2);
   // 2. Read Shapes section
   if (myDrivers.IsNull()) myDrivers = AttributeDrivers (aMsgDriver);  
-  const Handle(XmlMDF_ADriver) aNSDriver = ReadShapeSection(theElement, aMsgDriver, aPS.Next());
-  if(!aNSDriver.IsNull())
+  Message_ProgressScope aPS(theRange, "Reading shapes", 1);
+  theNSDriver = ReadShapeSection(theShapesElement, aMsgDriver, aPS.Next());
+  if(!theNSDriver.IsNull())
     ::take_time (0, " +++++ Fin reading Shapes :    ", aMsgDriver);
 
   if (!aPS.More())
   {
     myReaderStatus = PCDM_RS_UserBreak;
-    return;
+    return Standard_False;
   }
 
   // 2.1. Keep document format version in RT
@@ -444,39 +717,94 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument
   aHeaderData->SetStorageVersion(aCurDocVersion);
   myRelocTable.Clear();
   myRelocTable.SetHeaderData(aHeaderData);
+  return Standard_True;
+}
 
-  // 5. Read document contents
+//=======================================================================
+//function : readStreaming
+//purpose  : 
+//=======================================================================
+Standard_Boolean XmlLDrivers_DocumentRetrievalDriver::readStreaming
+                                (Standard_IStream&              theIStream,
+                                 const Standard_Boolean         theWithoutRoot,
+                                 const Handle(CDM_Document)&    theNewDocument,
+                                 const Handle(CDM_Application)& theApplication,
+                                 const Message_ProgressRange&   theRange)
+{
+  const Handle(TDocStd_Document) aDoc = Handle(TDocStd_Document)::DownCast (theNewDocument);
+  const std::streamoff aStartPos = theIStream.tellg();
+  if (aDoc.IsNull() || aStartPos < 0)
+  {
+    return Standard_False;
+  }
+
+  // 1. Read the shapes section written after the labels
+  LDOMParser aShapesParser;
+  XmlObjMgt_Element aShapesElement;
+  const std::streamoff aShapesPos = findShapeSection (theIStream, aStartPos);
+  if (aShapesPos >= 0)
+  {
+    theIStream.seekg (aShapesPos, std::ios_base::beg);
+    if (!aShapesParser.parse (theIStream, Standard_False, Standard_True))
+    {
+      aShapesElement = aShapesParser.getDocument().getDocumentElement();
+    }
+  }
+  theIStream.clear();
+  if (!theIStream.seekg (aStartPos, std::ios_base::beg))
+  {
+    theIStream.clear();
+    return Standard_False;
+  }
+  if (aShapesPos >= 0 && aShapesElement.isNull())
+  {
+    // the shapes section cannot be read separately
+    return Standard_False;
+  }
+
+  // 2. Restore labels while parsing the document
+  const Handle(Message_Messenger) aMsgDriver = theApplication->MessageDriver();
+  Message_ProgressScope aPS (theRange, "Reading document", 2);
+  DocumentParser aParser (*this, theNewDocument, theApplication, aShapesElement, aPS);
+  myReaderStatus = PCDM_RS_DriverFailure;
   try
   {
     OCC_CATCH_SIGNALS
-#ifdef OCCT_DEBUG
-    TCollection_ExtendedString aMessage ("PasteDocument");
-    aMsgDriver ->Send (aMessage.ToExtString(), Message_Trace);
-#endif
-    if (!MakeDocument(theElement, theNewDocument, aPS.Next()))
-      myReaderStatus = PCDM_RS_MakeFailure;
-    else
+    if (aParser.parse (theIStream, Standard_False, theWithoutRoot))
+    {
+      if (aParser.Status() != PCDM_RS_OK)
+      {
+        myReaderStatus = aParser.Status();
+      }
+      else
+      {
+        TCollection_AsciiString aData;
+        std::cout << aParser.GetError(aData) << ": " << aData << std::endl;
+        myReaderStatus = PCDM_RS_FormatFailure;
+      }
+    }
+    else if (aParser.IsHeaderRead() || aParser.ReadHeader())
+    {
+      aDoc->SetData (aParser.Data());
+      TDocStd_Owner::SetDocument (aParser.Data(), aDoc);
       myReaderStatus = PCDM_RS_OK;
+    }
+    else
+    {
+      myReaderStatus = aParser.Status();
+    }
   }
   catch (Standard_Failure const& anException)
   {
     TCollection_ExtendedString anErrorString (anException.GetMessageString());
     aMsgDriver ->Send (anErrorString.ToExtString(), Message_Fail);
   }
-  if (!aPS.More())
-  {
-    myReaderStatus = PCDM_RS_UserBreak;
-    return;
-  }
 
   //    Wipe off the shapes written to the <shapes> section
-  ShapeSetCleaning(aNSDriver);
-
-  //    Clean the relocation table.
-  //    If the application needs to use myRelocTable to retrieve additional
-  //    data from LDOM, this method should be reimplemented avoiding this step
+  ShapeSetCleaning (aParser.NamedShapeDriver());
   myRelocTable.Clear();
   ::take_time (0, " +++++ Fin reading data OCAF : ", aMsgDriver);
+  return Standard_True;
 }
 
 //=======================================================================
@@ -59,6 +59,17 @@ public:
   
   Standard_EXPORT virtual Handle(XmlMDF_ADriverTable) AttributeDrivers (const Handle(Message_Messenger)& theMsgDriver);
 
+  //! Returns true if the labels are read in the streaming mode.
+  Standard_Boolean IsStreamingMode() const { return myIsStreamingMode; }
+
+  //! Sets the streaming mode of reading (off by default). In this mode the labels and attributes
+  //! are restored while parsing the file element by element instead of building the DOM tree
+  //! of the whole document, so that only the currently read branch of labels is kept in memory.
+  //! The shapes section closing the document is located and read beforehand,
+  //! thus the mode requires a seekable stream; otherwise the document is read as usual.
+  //! Note that ReadFromDomDocument() and MakeDocument() are not called in this mode.
+  void SetStreamingMode (const Standard_Boolean theIsStreaming) { myIsStreamingMode = theIsStreaming; }
+
 
 
 
@@ -90,8 +101,28 @@ protected:
 
 private:
 
+  class DocumentParser;
+
+  //! Reads info, comments and shapes section of the document and initializes
+  //! the relocation table. Returns false if the document cannot be read further.
+  Standard_Boolean readHeader (const XmlObjMgt_Element&       theElement,
+                               const XmlObjMgt_Element&       theShapesElement,
+                               const Handle(CDM_Document)&    theNewDocument,
+                               const Handle(CDM_Application)& theApplication,
+                               Handle(XmlMDF_ADriver)&        theNSDriver,
+                               const Message_ProgressRange&   theRange);
+
+  //! Reads the document in the streaming mode.
+  //! Returns false if the stream does not allow it.
+  Standard_Boolean readStreaming (Standard_IStream&              theIStream,
+                                  const Standard_Boolean         theWithoutRoot,
+                                  const Handle(CDM_Document)&    theNewDocument,
+                                  const Handle(CDM_Application)& theApplication,
+                                  const Message_ProgressRange&   theRange);
 
+private:
 
+  Standard_Boolean myIsStreamingMode;
 
 };
 
@@ -231,80 +231,10 @@ Standard_Integer XmlMDF::ReadSubTree (const XmlObjMgt_Element&     theElement,
       else
       {
         // read attribute
-        XmlObjMgt_DOMString aName = anElem.getNodeName();
-
-#ifdef DATATYPE_MIGRATION
-	TCollection_AsciiString  newName;	
-	if(Storage_Schema::CheckTypeMigration(aName, newName)) {
-#ifdef OCCT_DEBUG
-	  std::cout << "CheckTypeMigration:OldType = " <<aName.GetString() << " Len = "<<strlen(aName.GetString())<<std::endl;
-	  std::cout << "CheckTypeMigration:NewType = " <<newName  << " Len = "<< newName.Length()<<std::endl;
-#endif
-	  aName = newName.ToCString();
-	}
-#endif  
-       
-        if (theDriverMap.IsBound (aName))
-        {
-          count++;
-          const Handle(XmlMDF_ADriver)& driver = theDriverMap.Find(aName);
-          XmlObjMgt_Persistent pAtt (anElem);
-          Standard_Integer anID = pAtt.Id ();
-          if (anID <= 0) {      // check for ID validity
-            TCollection_ExtendedString anErrorMessage =
-             TCollection_ExtendedString("Wrong ID of OCAF attribute with type ")
-               + aName;
-            driver -> myMessageDriver->Send (anErrorMessage, Message_Fail);
-            return -1;
-          }
-          Handle(TDF_Attribute) tAtt;
-          Standard_Boolean isBound = theRelocTable.IsBound(anID);
-          if (isBound)
-            tAtt = Handle(TDF_Attribute)::DownCast(theRelocTable.Find(anID));
-          else
-            tAtt = driver -> NewEmpty();
-
-          if (tAtt->Label().IsNull())
-          {
-            try
-            {
-              theLabel.AddAttribute (tAtt);
-            }
-            catch (const Standard_DomainError&)
-            {
-              // For attributes that can have arbitrary GUID (e.g. TDataStd_Integer), exception
-              // will be raised in valid case if attribute of that type with default GUID is already
-              // present  on the same label; the reason is that actual GUID will be read later.
-              // To avoid this, set invalid (null) GUID to the newly added attribute (see #29669)
-              static const Standard_GUID fbidGuid;
-              tAtt->SetID (fbidGuid);
-              theLabel.AddAttribute (tAtt);
-            }
-          }
-	  else
-	    driver->myMessageDriver->Send
-	      (TCollection_ExtendedString("XmlDriver warning: ") +
-	       "attempt to attach attribute " +
-	       aName + " to a second label", Message_Warning);
-
-          if (! driver -> Paste (pAtt, tAtt, theRelocTable))
-          {
-            // error converting persistent to transient
-            driver->myMessageDriver->Send
-              (TCollection_ExtendedString("XmlDriver warning: ") +
-               "failure reading attribute " + aName, Message_Warning);
-          }
-          else if (isBound == Standard_False)
-            theRelocTable.Bind (anID, tAtt);
-        }
-#ifdef OCCT_DEBUG
-        else
-        {
-          const TCollection_AsciiString anAsciiName = aName;
-          std::cerr << "XmlDriver warning: "
-               << "label contains object of unknown type "<< anAsciiName<< std::endl;
-        }
-#endif
+        const Standard_Integer aResult = ReadAttribute (anElem, theLabel, theRelocTable, theDriverMap);
+        if (aResult < 0)
+          return -1;
+        count += aResult;
       }
     }
     //anElem = (const XmlObjMgt_Element &) anElem.getNextSibling();
@@ -323,6 +253,90 @@ Standard_Integer XmlMDF::ReadSubTree (const XmlObjMgt_Element&     theElement,
   return count;
 }
 
+//=======================================================================
+//function : ReadAttribute
+//purpose  : 
+//=======================================================================
+Standard_Integer XmlMDF::ReadAttribute (const XmlObjMgt_Element&    theElement,
+                                        const TDF_Label&            theLabel,
+                                        XmlObjMgt_RRelocationTable& theRelocTable,
+                                        const XmlMDF_MapOfDriver&   theDriverMap)
+{
+  XmlObjMgt_DOMString aName = theElement.getNodeName();
+
+#ifdef DATATYPE_MIGRATION
+  TCollection_AsciiString  newName;
+  if(Storage_Schema::CheckTypeMigration(aName, newName)) {
+#ifdef OCCT_DEBUG
+    std::cout << "CheckTypeMigration:OldType = " <<aName.GetString() << " Len = "<<strlen(aName.GetString())<<std::endl;
+    std::cout << "CheckTypeMigration:NewType = " <<newName  << " Len = "<< newName.Length()<<std::endl;
+#endif
+    aName = newName.ToCString();
+  }
+#endif
+
+  if (!theDriverMap.IsBound (aName))
+  {
+#ifdef OCCT_DEBUG
+    const TCollection_AsciiString anAsciiName = aName;
+    std::cerr << "XmlDriver warning: "
+         << "label contains object of unknown type "<< anAsciiName<< std::endl;
+#endif
+    return 0;
+  }
+
+  const Handle(XmlMDF_ADriver)& driver = theDriverMap.Find(aName);
+  XmlObjMgt_Persistent pAtt (theElement);
+  Standard_Integer anID = pAtt.Id ();
+  if (anID <= 0) {      // check for ID validity
+    TCollection_ExtendedString anErrorMessage =
+     TCollection_ExtendedString("Wrong ID of OCAF attribute with type ")
+       + aName;
+    driver -> myMessageDriver->Send (anErrorMessage, Message_Fail);
+    return -1;
+  }
+  Handle(TDF_Attribute) tAtt;
+  Standard_Boolean isBound = theRelocTable.IsBound(anID);
+  if (isBound)
+    tAtt = Handle(TDF_Attribute)::DownCast(theRelocTable.Find(anID));
+  else
+    tAtt = driver -> NewEmpty();
+
+  if (tAtt->Label().IsNull())
+  {
+    try
+    {
+      theLabel.AddAttribute (tAtt);
+    }
+    catch (const Standard_DomainError&)
+    {
+      // For attributes that can have arbitrary GUID (e.g. TDataStd_Integer), exception
+      // will be raised in valid case if attribute of that type with default GUID is already
+      // present  on the same label; the reason is that actual GUID will be read later.
+      // To avoid this, set invalid (null) GUID to the newly added attribute (see #29669)
+      static const Standard_GUID fbidGuid;
+      tAtt->SetID (fbidGuid);
+      theLabel.AddAttribute (tAtt);
+    }
+  }
+  else
+    driver->myMessageDriver->Send
+      (TCollection_ExtendedString("XmlDriver warning: ") +
+       "attempt to attach attribute " +
+       aName + " to a second label", Message_Warning);
+
+  if (! driver -> Paste (pAtt, tAtt, theRelocTable))
+  {
+    // error converting persistent to transient
+    driver->myMessageDriver->Send
+      (TCollection_ExtendedString("XmlDriver warning: ") +
+       "failure reading attribute " + aName, Message_Warning);
+  }
+  else if (isBound == Standard_False)
+    theRelocTable.Bind (anID, tAtt);
+  return 1;
+}
+
 //=======================================================================
 //function : AddDrivers
 //purpose  : 
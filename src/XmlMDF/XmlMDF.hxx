@@ -71,6 +71,16 @@ public:
                                  const Handle(XmlMDF_ADriverTable)& aDrivers, 
                                  const Message_ProgressRange& theRange = Message_ProgressRange());
   
+  //! Translates a persistent attribute <theElement> into a transient
+  //! attribute attached to <theLabel>.
+  //! Returns 1 if the attribute is read, 0 if its type is unknown
+  //! and -1 on error.
+  Standard_EXPORT static Standard_Integer ReadAttribute
+                                (const XmlObjMgt_Element& theElement,
+                                 const TDF_Label& theLabel,
+                                 XmlObjMgt_RRelocationTable& theReloc,
+                                 const XmlMDF_MapOfDriver& theDrivers);
+
   //! Adds the attribute storage drivers to <aDriverSeq>.
   Standard_EXPORT static void AddDrivers (const Handle(XmlMDF_ADriverTable)& aDriverTable, 
                                           const Handle(Message_Messenger)& theMessageDriver);
@@ -19,10 +19,15 @@
 #include <math_MultipleVarFunctionWithHessian.hxx>
 #include <math_NewtonMinimum.hxx>
 #include <math_Powell.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_Integer.hxx>
 #include <Standard_Real.hxx>
 #include <Precision.hxx>
 
+#include <algorithm>
+#include <memory>
+
 //=======================================================================
 //function : DistanceToBorder
 //purpose  :
@@ -45,6 +50,50 @@ static Standard_Real DistanceToBorder(const math_Vector & theX,
 }
 
 
+namespace
+{
+//=======================================================================
+//class    : SolutionComparator
+//purpose  : Orders solutions by functional values and then by coordinates
+//=======================================================================
+class SolutionComparator
+{
+public:
+  SolutionComparator(const NCollection_Vector<Standard_Real>& thePoints,
+                     const NCollection_Vector<Standard_Real>& theValues,
+                     const Standard_Integer theDim,
+                     const Standard_Real theZ)
+  : myPoints(thePoints),
+    myValues(theValues),
+    myDim(theDim),
+    myZ(theZ)
+  {}
+
+  bool operator()(const Standard_Integer theSol1, const Standard_Integer theSol2) const
+  {
+    // myZ is -1 for the minimum search, so that the best value goes first.
+    const Standard_Real aDelta = (myValues(theSol1) - myValues(theSol2)) * myZ;
+    if (aDelta != 0.0)
+      return aDelta > 0.0;
+
+    for (Standard_Integer j = 0; j < myDim; j++)
+    {
+      const Standard_Real aCoord1 = myPoints(theSol1 * myDim + j);
+      const Standard_Real aCoord2 = myPoints(theSol2 * myDim + j);
+      if (aCoord1 != aCoord2)
+        return aCoord1 < aCoord2;
+    }
+    return false;
+  }
+
+private:
+  const NCollection_Vector<Standard_Real>& myPoints;
+  const NCollection_Vector<Standard_Real>& myValues;
+  Standard_Integer myDim;
+  Standard_Real myZ;
+};
+}
+
 //=======================================================================
 //function : math_GlobOptMin
 //purpose  : Constructor
@@ -65,6 +114,7 @@ math_GlobOptMin::math_GlobOptMin(math_MultipleVarFunction* theFunc,
   myTmp(1, myN),
   myV(1, myN),
   myMaxV(1, myN),
+  myStoreTol(1, myN),
   myCellSize(0, myN - 1),
   myFilter(theFunc->NbVariables()),
   myCont(2),
@@ -101,11 +151,60 @@ math_GlobOptMin::math_GlobOptMin(math_MultipleVarFunction* theFunc,
   Standard_Integer aSolNb = Standard_Integer(Pow(3.0, Standard_Real(myN)));
   myMinCellFilterSol = Max(2 * aSolNb, aMaxSquareSearchSol);
   initCellSize();
+  initStoreTol();
   ComputeInitSol();
 
   myDone = Standard_False;
 }
 
+//=======================================================================
+//function : math_GlobOptMin
+//purpose  : Constructor of the strip algorithm
+//=======================================================================
+math_GlobOptMin::math_GlobOptMin(const math_GlobOptMin& theParent,
+                                 math_MultipleVarFunction* theFunc,
+                                 const math_Vector& theA,
+                                 const math_Vector& theB)
+: myFunc(theFunc),
+  myN(theParent.myN),
+  myA(theA),
+  myB(theB),
+  myGlobA(theParent.myGlobA),
+  myGlobB(theParent.myGlobB),
+  myTol(theParent.myTol),
+  mySameTol(theParent.mySameTol),
+  myC(theParent.myC),
+  myInitC(theParent.myInitC),
+  myIsFindSingleSolution(theParent.myIsFindSingleSolution),
+  myFunctionalMinimalValue(theParent.myFunctionalMinimalValue),
+  myIsConstLocked(Standard_True),
+  myDone(Standard_False),
+  myY(theParent.myY),
+  mySolCount(theParent.mySolCount),
+  myZ(theParent.myZ),
+  myE1(theParent.myE1),
+  myE2(theParent.myE2),
+  myE3(theParent.myE3),
+  myX(1, myN),
+  myTmp(1, myN),
+  myV(1, myN),
+  myMaxV(1, myN),
+  myLastStep(0.0),
+  myStoreTol(theParent.myStoreTol),
+  myCellSize(theParent.myCellSize),
+  myMinCellFilterSol(theParent.myMinCellFilterSol),
+  isFirstCellFilterInvoke(Standard_True),
+  myFilter(myN),
+  myCont(theParent.myCont),
+  myF(theParent.myF)
+{
+  for (Standard_Integer i = 1; i <= myN; i++)
+  {
+    myV(i) = 0.0;
+    myMaxV(i) = (myB(i) - myA(i)) / 3.0;
+  }
+}
+
 //=======================================================================
 //function : SetGlobalParams
 //purpose  : Set parameters without memory allocation.
@@ -143,6 +242,7 @@ void math_GlobOptMin::SetGlobalParams(math_MultipleVarFunction* theFunc,
   mySameTol = theSameTol;
 
   initCellSize();
+  initStoreTol();
   ComputeInitSol();
 
   myDone = Standard_False;
@@ -169,9 +269,29 @@ void math_GlobOptMin::SetLocalParams(const math_Vector& theLocalA,
     myMaxV(i) = (myB(i) - myA(i)) / 3.0;
   }
 
+  initStoreTol();
   myDone = Standard_False;
 }
 
+//=======================================================================
+//function : SetParallelFunctions
+//purpose  :
+//=======================================================================
+void math_GlobOptMin::SetParallelFunctions(const NCollection_Array1<math_MultipleVarFunction*>& theFuncs)
+{
+  if (theFuncs.IsEmpty())
+  {
+    myParallelFuncs = NCollection_Array1<math_MultipleVarFunction*>();
+    return;
+  }
+
+  myParallelFuncs = NCollection_Array1<math_MultipleVarFunction*>(1, theFuncs.Size());
+  for (Standard_Integer i = theFuncs.Lower(); i <= theFuncs.Upper(); i++)
+  {
+    myParallelFuncs(i - theFuncs.Lower() + 1) = theFuncs(i);
+  }
+}
+
 //=======================================================================
 //function : SetTol
 //purpose  : Set algorithm tolerances.
@@ -181,6 +301,7 @@ void math_GlobOptMin::SetTol(const Standard_Real theDiscretizationTol,
 {
   myTol = theDiscretizationTol;
   mySameTol = theSameTol;
+  initStoreTol();
 }
 
 //=======================================================================
@@ -258,11 +379,102 @@ void math_GlobOptMin::Perform(const Standard_Boolean isFindSingleSolution)
 
   myLastStep = 0.0;
   isFirstCellFilterInvoke = Standard_True;
-  computeGlobalExtremum(myN);
+  if (myParallelFuncs.Size() > 1)
+  {
+    computeGlobalExtremumParallel();
+  }
+  else
+  {
+    computeGlobalExtremum(myN);
+  }
 
   myDone = Standard_True;
 }
 
+//=======================================================================
+//class    : StripFunctor
+//purpose  : Explores single strip of the search box
+//=======================================================================
+class math_GlobOptMin::StripFunctor
+{
+public:
+  StripFunctor(NCollection_Array1<std::unique_ptr<math_GlobOptMin> >& theStrips)
+  : myStrips(theStrips)
+  {}
+
+  void operator()(const Standard_Integer theIndex) const
+  {
+    const std::unique_ptr<math_GlobOptMin>& aStrip = myStrips(theIndex);
+    if (!aStrip->CheckFunctionalStopCriteria())
+    {
+      aStrip->computeGlobalExtremum(aStrip->myN);
+    }
+    aStrip->myDone = Standard_True;
+  }
+
+private:
+  StripFunctor& operator=(const StripFunctor&);
+
+private:
+  NCollection_Array1<std::unique_ptr<math_GlobOptMin> >& myStrips;
+};
+
+//=======================================================================
+//function : computeGlobalExtremumParallel
+//purpose  :
+//=======================================================================
+void math_GlobOptMin::computeGlobalExtremumParallel()
+{
+  // Split the last variable into strips; each strip starts from the current solutions,
+  // so that the pruning does not depend on the order of processing of the strips.
+  const Standard_Integer aNbStrips = myParallelFuncs.Size();
+  NCollection_Array1<std::unique_ptr<math_GlobOptMin> > aStrips(1, aNbStrips);
+  math_Vector aStripA(myA), aStripB(myB);
+  const Standard_Real aStep = (myB(myN) - myA(myN)) / aNbStrips;
+  for (Standard_Integer aStripIdx = 1; aStripIdx <= aNbStrips; aStripIdx++)
+  {
+    aStripA(myN) = myA(myN) + aStep * (aStripIdx - 1);
+    aStripB(myN) = (aStripIdx == aNbStrips) ? myB(myN) : myA(myN) + aStep * aStripIdx;
+    aStrips(aStripIdx).reset(new math_GlobOptMin(*this, myParallelFuncs(aStripIdx), aStripA, aStripB));
+  }
+
+  OSD_Parallel::For(1, aNbStrips + 1, StripFunctor(aStrips));
+
+  // Collect the solutions of the strips and evaluate the functional in each of them,
+  // as the best value of the strip is known only approximately for its other points.
+  NCollection_Vector<Standard_Real> aPoints, aValues;
+  math_Vector aPnt(1, myN);
+  for (Standard_Integer aStripIdx = 1; aStripIdx <= aNbStrips; aStripIdx++)
+  {
+    const std::unique_ptr<math_GlobOptMin>& aStrip = aStrips(aStripIdx);
+    for (Standard_Integer aSolIdx = 1; aSolIdx <= aStrip->mySolCount; aSolIdx++)
+    {
+      aStrip->Points(aSolIdx, aPnt);
+      for (Standard_Integer j = 1; j <= myN; j++)
+        aPoints.Append(aPnt(j));
+      Standard_Real aVal = 0.0;
+      myFunc->Value(aPnt, aVal);
+      aValues.Append(aVal);
+    }
+  }
+  if (aValues.IsEmpty())
+    return;
+
+  // Merge the solutions from the best one; points with equal values are ordered
+  // by their coordinates, so that the order does not depend on the splitting.
+  NCollection_Array1<Standard_Integer> anOrder(0, aValues.Length() - 1);
+  for (Standard_Integer aSolIdx = anOrder.Lower(); aSolIdx <= anOrder.Upper(); aSolIdx++)
+    anOrder(aSolIdx) = aSolIdx;
+  std::sort(anOrder.begin(), anOrder.end(), SolutionComparator(aPoints, aValues, myN, myZ));
+  for (Standard_Integer anOrderIdx = anOrder.Lower(); anOrderIdx <= anOrder.Upper(); anOrderIdx++)
+  {
+    const Standard_Integer aSolIdx = anOrder(anOrderIdx);
+    for (Standard_Integer j = 1; j <= myN; j++)
+      aPnt(j) = aPoints(aSolIdx * myN + j - 1);
+    checkAddCandidate(aPnt, aValues(aSolIdx));
+  }
+}
+
 //=======================================================================
 //function : computeLocalExtremum
 //purpose  :
@@ -499,8 +711,6 @@ Standard_Boolean math_GlobOptMin::isStored(const math_Vector& thePnt)
 {
   Standard_Integer i,j;
   Standard_Boolean isSame = Standard_True;
-  math_Vector aTol(1, myN);
-  aTol = (myB -  myA) * mySameTol;
 
   // C1 * n^2 = C2 * 3^dim * n
   if (mySolCount < myMinCellFilterSol)
@@ -510,7 +720,7 @@ Standard_Boolean math_GlobOptMin::isStored(const math_Vector& thePnt)
       isSame = Standard_True;
       for(j = 1; j <= myN; j++)
       {
-        if ((Abs(thePnt(j) - myY(i * myN + j))) > aTol(j))
+        if ((Abs(thePnt(j) - myY(i * myN + j))) > myStoreTol(j))
         {
           isSame = Standard_False;
           break;
@@ -580,6 +790,15 @@ void math_GlobOptMin::initCellSize()
   }
 }
 
+//=======================================================================
+//function : initStoreTol
+//purpose  :
+//=======================================================================
+void math_GlobOptMin::initStoreTol()
+{
+  myStoreTol = (myB - myA) * mySameTol;
+}
+
 //=======================================================================
 //function : CheckFunctionalStopCriteria
 //purpose  :
@@ -19,6 +19,7 @@
 #include <gp_Pnt.hxx>
 #include <NCollection_CellFilter.hxx>
 #include <math_MultipleVarFunction.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_Sequence.hxx>
 
 //! This class represents Evtushenko's algorithm of global optimization based on non-uniform mesh.
@@ -98,6 +99,21 @@ public:
   //! @param isFindSingleSolution - defines whether to find single solution or all solutions.
   Standard_EXPORT void Perform(const Standard_Boolean isFindSingleSolution = Standard_False);
 
+  //! Sets the copies of the objective functional enabling the parallel search.
+  //! When N > 1 functionals are given, Perform() splits the search box along the last
+  //! variable into N equal strips, which are explored concurrently, each one with its own
+  //! functional. The solutions of the strips are merged in order of their functional values
+  //! evaluated anew, so that the merged set does not depend on the order of the strips.
+  //! All strips start from the same best value computed before splitting and use the
+  //! tolerances of the whole box, so that the result does not depend on the number of threads.
+  //! The functionals must be independent copies of the one given to the constructor,
+  //! as the evaluation of the functional usually modifies its state.
+  //! The functionals are not owned by the algorithm. Pass empty array to disable the parallel search.
+  Standard_EXPORT void SetParallelFunctions (const NCollection_Array1<math_MultipleVarFunction*>& theFuncs);
+
+  //! Returns the copies of the objective functional used for the parallel search.
+  const NCollection_Array1<math_MultipleVarFunction*>& ParallelFunctions() const { return myParallelFuncs; }
+
   //! Return solution theIndex, 1 <= theIndex <= NbExtrema.
   Standard_EXPORT void Points(const Standard_Integer theIndex, math_Vector& theSol);
 
@@ -201,9 +217,26 @@ private:
   };
 
 
+  //! Creates the algorithm exploring the strip [theA, theB] of the search box of the parent
+  //! algorithm with the given functional. All parameters, tolerances and the current solutions
+  //! are copied from the parent one.
+  math_GlobOptMin (const math_GlobOptMin& theParent,
+                   math_MultipleVarFunction* theFunc,
+                   const math_Vector& theA,
+                   const math_Vector& theB);
+
+  //! Explores the strips of the search box concurrently and merges their solutions.
+  void computeGlobalExtremumParallel();
+
+  //! Functor exploring single strip of the search box.
+  class StripFunctor;
+
   // Compute cell size.
   void initCellSize();
 
+  // Compute tolerances of coincidence of stored solutions.
+  void initStoreTol();
+
   // Compute initial solution
   void ComputeInitSol();
 
@@ -271,6 +304,8 @@ private:
   math_Vector myMaxV; // Max Steps array.
   Standard_Real myLastStep; // Last step.
 
+  math_Vector myStoreTol; // Tolerances of coincidence of stored solutions,
+                          // the strips of the parallel search inherit them from the parent.
   NCollection_Array1<Standard_Real> myCellSize;
   Standard_Integer myMinCellFilterSol;
   Standard_Boolean isFirstCellFilterInvoke;
@@ -279,6 +314,9 @@ private:
   // Continuity of local borders.
   Standard_Integer myCont;
 
+  // Copies of the functional for the parallel search.
+  NCollection_Array1<math_MultipleVarFunction*> myParallelFuncs;
+
   Standard_Real myF; // Current value of Global optimum.
 };
 